@@ -418,7 +418,7 @@ void PropertyEditorPanel::RenderForStaticMesh(UStaticMeshComponent* StaticMeshCo
             PreviewName = TEXT("None");
         }
 
-        const TMap<FName, FAssetInfo> Assets = UAssetManager::Get().GetAssetRegistry();
+        const TMap<FName, FAssetInfo>& Assets = UAssetManager::Get().GetAssetRegistry();
 
         if (ImGui::BeginCombo("##StaticMesh", GetData(PreviewName), ImGuiComboFlags_None))
         {
@@ -1346,7 +1346,7 @@ void PropertyEditorPanel::RenderForCurve(FString& CurvePath) const
             {
                 if (!bIsExist)
                 {
-                    UAssetManager::Get().LoadObjFiles();
+                    UAssetManager::Get().ScanAssetRegistry();
                 }
                 // Linear
                 // Cubic Hermite?
@@ -1413,7 +1413,7 @@ void PropertyEditorPanel::RenderForCurve(FString& CurvePath) const
     {
         FileName = FString(CurveFilePath.stem());
     }
-    const TMap<FName, FAssetInfo> Assets = UAssetManager::Get().GetAssetRegistry();
+    const TMap<FName, FAssetInfo>& Assets = UAssetManager::Get().GetAssetRegistry();
 
     if (ImGui::BeginCombo("##Curve", GetData(FileName), ImGuiComboFlags_None))
     {
@@ -1535,6 +1535,7 @@ void PropertyEditorPanel::RenderForSkeletalMeshComponent(USkinnedMeshComponent*
         FString FilePath = SkeletalMesh->GetRenderData()->FilePath;
 
         ImGui::Text("Skeletal Mesh: %s", *MeshName);
+        ImGui::Text("Pose Memory: %.2f KB", static_cast<float>(SkeletalMeshComp->GetPoseMemorySize()) / 1024.f);
         ImGui::Separator();
 
         if (ImGui::Button("Open in EngineSIU_Viewer"))
@@ -64,6 +64,7 @@ void SkeletonDataPanel::Render()
     };
 
     Skeleton = SkeletalMesh->Skeleton;
+    SkeletalComponent = SkeletalComp;
 
     if (!Skeleton)
     {
@@ -169,12 +170,13 @@ void SkeletonDataPanel::DrawBoneTransformPanel() const
     UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
     const FBoneNode* SelectedBone = Engine->GetSelectedBone();
 
-    if (SelectedBone)
+    if (SelectedBone && SkeletalComponent)
     {
         int BoneIndex = Skeleton->BoneNameToIndex[SelectedBone->Name];
 
-        FMatrix LocalTransform = Skeleton->CurrentPose.LocalTransforms[BoneIndex];
-        FMatrix GlobalTransform = Skeleton->CurrentPose.GlobalTransforms[BoneIndex];
+        const FAnimationPoseData& Pose = SkeletalComponent->GetPose();
+        FMatrix LocalTransform = Pose.LocalTransforms[BoneIndex];
+        FMatrix GlobalTransform = Pose.GlobalTransforms[BoneIndex];
 
         FVector LocalPos = LocalTransform.GetTranslationVector();
         FRotator LocalRot = LocalTransform.ToQuat().Rotator();
@@ -223,9 +225,8 @@ void SkeletonDataPanel::DrawBoneTransformPanel() const
                         FMatrix::GetRotationMatrix(LocalRot) *
                         FMatrix::GetTranslationMatrix(LocalPos);
 
-                    Mesh->SetBoneLocalMatrix(BoneIndex, NewLocalMatrix);
-                    Mesh->UpdateWorldTransforms();
-                    Mesh->UpdateAndApplySkinning();
+                    Mesh->SetBoneLocalMatrix(SkeletalComp->GetPose(), BoneIndex, NewLocalMatrix);
+                    SkeletalComp->RefreshBoneTransforms();
                 }
 
                 if (bGlobalChanged)
@@ -239,16 +240,15 @@ void SkeletonDataPanel::DrawBoneTransformPanel() const
                     FMatrix ParentGlobalInverse = FMatrix::Identity;
                     int32 ParentIdx = SelectedBone->ParentIndex;
 
-                    if (ParentIdx != INDEX_NONE && Skeleton->CurrentPose.GlobalTransforms.IsValidIndex(ParentIdx))
+                    if (ParentIdx != INDEX_NONE && SkeletalComp->GetPose().GlobalTransforms.IsValidIndex(ParentIdx))
                     {
-                        ParentGlobalInverse = FMatrix::Inverse(Skeleton->CurrentPose.GlobalTransforms[ParentIdx]);
+                        ParentGlobalInverse = FMatrix::Inverse(SkeletalComp->GetPose().GlobalTransforms[ParentIdx]);
                     }
 
                     FMatrix NewLocalMatrix = NewGlobalMatrix * ParentGlobalInverse;
 
-                    Mesh->SetBoneLocalMatrix(BoneIndex, NewLocalMatrix);
-                    Mesh->UpdateWorldTransforms();
-                    Mesh->UpdateAndApplySkinning();
+                    Mesh->SetBoneLocalMatrix(SkeletalComp->GetPose(), BoneIndex, NewLocalMatrix);
+                    SkeletalComp->RefreshBoneTransforms();
                 }
             }
         }
@@ -3,6 +3,7 @@
 #include "UnrealEd/EditorPanel.h"
 
 class USkeleton;
+class USkeletalMeshComponent;
 
 class SkeletonDataPanel : public UEditorPanel
 {
@@ -16,6 +17,7 @@ public:
 private:
     void DrawBoneTransformPanel() const;
     USkeleton* Skeleton = nullptr;
+    USkeletalMeshComponent* SkeletalComponent = nullptr;
 private:
     float Width = 400, Height = 600;
 };
@@ -8,112 +8,105 @@
 #include "UObject/ObjectFactory.h"
 #include "UObject/ObjectGlobals.h"
 
-#include "JSON/json.hpp"
+#include "SceneManagerData.h"
 #include "World/World.h"
 
 using namespace NS_SceneManagerData;
-using json = nlohmann::json;
 
 
-#pragma region nlohmann::json function overload
-[[maybe_unused]]
-static void to_json(json& Json, const FString& S)
-{
-    Json = S.GetContainerPrivate();
-}
-
-[[maybe_unused]]
-static void from_json(const json& Json, FString& S)
+void SceneManager::LoadSceneFromJsonFile(const std::filesystem::path& FilePath, UWorld& OutWorld)
 {
-    if (Json.is_string())
+    FSceneData SceneData;
+    if (!ReadJsonFile(FilePath, SceneData))
     {
-        Json.get_to(S.GetContainerPrivate());
+        return;
     }
-}
-
 
-template <typename ElementType, typename AllocatorType>
-[[maybe_unused]]
-static void to_json(json& Json, const TArray<ElementType, AllocatorType>& Array)
-{
-    Json = Array.GetContainerPrivate();
+    LoadWorldFromData(SceneData, FilePath, &OutWorld);
 }
 
-template <typename ElementType, typename AllocatorType>
-[[maybe_unused]]
-static void from_json(const json& Json, TArray<ElementType, AllocatorType>& Array)
+bool SceneManager::SaveSceneToJsonFile(const std::filesystem::path& FilePath, const UWorld& InWorld)
 {
-    Json.get_to(Array.GetContainerPrivate());
-}
+    FSceneData SceneData = WorldToSceneData(InWorld);
+    
+    std::filesystem::path Dir = std::filesystem::path(FilePath).parent_path();
+    
+    if (!std::filesystem::exists(Dir)) {
+        std::filesystem::create_directories(Dir); // 중간 경로까지 모두 생성
+    }
+    
+    std::ofstream outFile(FilePath);
+    if (!outFile)
+    {
+        MessageBoxA(nullptr, "Failed to open file for writing: ", "Error", MB_OK | MB_ICONERROR);
+        return false;
+    }
 
+    InWorld.GetActiveLevel()->SetLevelPath(FilePath);
+    
+    FString JsonData;
+    SceneDataToJson(SceneData, JsonData);
+    outFile << JsonData.GetContainerPrivate();
+    outFile.close();
 
-template <typename KeyType, typename ValueType, typename Allocator>
-[[maybe_unused]]
-static void to_json(json& Json, const TMap<KeyType, ValueType, Allocator>& Map)
-{
-    Json = Map.GetContainerPrivate();
-}
+    // JSON보다 나중에 쓰므로 다음 LoadScene에서 Binary Level을 읽습니다.
+    SaveCookedScene(GetCookedScenePath(FilePath), SceneData);
 
-template <typename KeyType, typename ValueType, typename Allocator>
-[[maybe_unused]]
-static void from_json(const json& Json, TMap<KeyType, ValueType, Allocator>& Map)
-{
-    Json.get_to(Map.GetContainerPrivate());
+    return true;
 }
-#pragma endregion
 
-namespace NS_SceneManagerData
+void SceneManager::LoadScene(const std::filesystem::path& FilePath, UWorld& OutWorld)
 {
-// 컴포넌트 하나의 저장 정보를 담는 구조체
-struct FComponentSaveData
-{
-    FString ComponentID;    // 컴포넌트의 고유 ID (액터 내에서 유일해야 함, FName) 
-    FString ComponentClass; // 컴포넌트 클래스 이름 (예: "UStaticMeshComponent", "UPointLightComponent")
-
-    TMap<FString, FString> Properties;
+    const std::filesystem::path CookedPath = GetCookedScenePath(FilePath);
 
-    NLOHMANN_DEFINE_TYPE_INTRUSIVE(FComponentSaveData, ComponentID, ComponentClass, Properties)
-};
+    std::error_code ec;
+    const std::filesystem::file_time_type SourceTimestamp = std::filesystem::last_write_time(FilePath, ec);
+    const bool bSourceExists = !ec;
+    const std::filesystem::file_time_type CookedTimestamp = std::filesystem::last_write_time(CookedPath, ec);
+    const bool bCookedUpToDate = !ec && (!bSourceExists || CookedTimestamp >= SourceTimestamp);
 
-// 액터 하나의 저장 정보를 담는 구조체
-struct FActorSaveData
-{
-    FString ActorID;    // 액터의 고유 ID FName
-    FString ActorClass; // 액터의 클래스 이름 (예: "AStaticMeshActor", "APointLight")
-    FString ActorLabel; // 에디터에서 보이는 이름 (선택적)
-    // FTransform ActorTransform; // 액터 자체의 트랜스폼 (보통 루트 컴포넌트가 결정) - 필요 여부 검토
+    FSceneData SceneData;
+    if (bCookedUpToDate && ReadBinaryFile(CookedPath, SceneData))
+    {
+        // Level 경로는 편집용 원본인 JSON으로 유지해서, 저장할 때 JSON에 씁니다.
+        LoadWorldFromData(SceneData, FilePath, &OutWorld);
+        return;
+    }
 
-    FString RootComponentID;               // 이 액터의 루트 컴포넌트 ID (아래 Components 리스트 내 ID 참조)
-    TArray<FComponentSaveData> Components; // 이 액터가 소유한 컴포넌트 목록
+    if (!ReadJsonFile(FilePath, SceneData))
+    {
+        return;
+    }
 
-    TMap<FString, FString> Properties;
-    
-    NLOHMANN_DEFINE_TYPE_INTRUSIVE(FActorSaveData, ActorID, ActorClass, ActorLabel, RootComponentID, Components, Properties)
-};
+    LoadWorldFromData(SceneData, FilePath, &OutWorld);
+    SaveCookedScene(CookedPath, SceneData);
+}
 
-struct FSceneData
+bool SceneManager::CookScene(const std::filesystem::path& FilePath)
 {
-    int32 Version = 0;
-    int32 NextUUID = 0;
-    //TMap<int32, UObject*> Primitives;
-
-    TArray<FActorSaveData> Actors; // 씬에 있는 모든 액터 정보
-
-    NLOHMANN_DEFINE_TYPE_INTRUSIVE(FSceneData, Version, NextUUID, Actors)
-};
-
-//TODO : 레벨 데이타 구현
+    FSceneData SceneData;
+    if (!ReadJsonFile(FilePath, SceneData))
+    {
+        return false;
+    }
+    return SaveCookedScene(GetCookedScenePath(FilePath), SceneData);
 }
 
+std::filesystem::path SceneManager::GetCookedScenePath(const std::filesystem::path& FilePath)
+{
+    std::filesystem::path CookedPath = FilePath;
+    CookedPath += ".bin";
+    return CookedPath;
+}
 
-void SceneManager::LoadSceneFromJsonFile(const std::filesystem::path& FilePath, UWorld& OutWorld)
+bool SceneManager::ReadJsonFile(const std::filesystem::path& FilePath, FSceneData& OutSceneData)
 {
     std::ifstream JsonFile(FilePath);
     if (!JsonFile.is_open())
     {
         //MessageBox(nullptr, (FString(FilePath) + FString("(으)로부터 Scene을 읽어오는데 실패했습니다!")).ToWideString().c_str(), L"Scene Load Error", MB_ICONWARNING | MB_OK);
         //UE_LOG(LogLevel::Error, "Failed to open file for reading: %s", FilePath.c_str());
-        return;
+        return false;
     }
 
     FString JsonString;
@@ -125,44 +118,56 @@ void SceneManager::LoadSceneFromJsonFile(const std::filesystem::path& FilePath,
     JsonFile.read(&JsonString[0], Size);
     JsonFile.close();
 
-    FSceneData SceneData;
-    bool Result = JsonToSceneData(JsonString,SceneData);
-    if (!Result)
+    if (!JsonToSceneData(JsonString, OutSceneData))
     {
         UE_LOG(LogLevel::Error, "Failed to parse scene data from file: %s", FilePath.c_str());
-        return ;
+        return false;
     }
-
-    LoadWorldFromData(SceneData, FilePath, &OutWorld);
+    return true;
 }
 
-bool SceneManager::SaveSceneToJsonFile(const std::filesystem::path& FilePath, const UWorld& InWorld)
+bool SceneManager::ReadBinaryFile(const std::filesystem::path& FilePath, FSceneData& OutSceneData)
 {
-    FSceneData SceneData = WorldToSceneData(InWorld);
-    
-    std::filesystem::path Dir = std::filesystem::path(FilePath).parent_path();
-    
-    if (!std::filesystem::exists(Dir)) {
-        std::filesystem::create_directories(Dir); // 중간 경로까지 모두 생성
-    }
-    
-    std::ofstream outFile(FilePath);
-    if (!outFile)
+    std::ifstream File(FilePath, std::ios::binary | std::ios::ate);
+    if (!File.is_open())
     {
-        MessageBoxA(nullptr, "Failed to open file for writing: ", "Error", MB_OK | MB_ICONERROR);
         return false;
     }
 
-    InWorld.GetActiveLevel()->SetLevelPath(FilePath);
-    
-    FString JsonData;
-    SceneDataToJson(SceneData, JsonData);
-    outFile << JsonData.GetContainerPrivate();
-    outFile.close();
+    // 파일 전체를 한 번에 읽은 뒤 메모리에서 Record 배열을 그대로 복사합니다.
+    const int64 Size = File.tellg();
+    TArray<uint8> Data;
+    Data.SetNum(static_cast<int32>(Size));
+    File.seekg(0, std::ios::beg);
+    File.read(reinterpret_cast<char*>(Data.GetData()), Size);
+    if (!File)
+    {
+        return false;
+    }
 
+    if (!DeserializeFromBinary(Data, OutSceneData))
+    {
+        UE_LOG(LogLevel::Warning, "Cooked scene is outdated or corrupted, falling back to JSON: %s", FilePath.string().c_str());
+        return false;
+    }
     return true;
 }
 
+bool SceneManager::SaveCookedScene(const std::filesystem::path& FilePath, const FSceneData& InSceneData)
+{
+    TArray<uint8> Data;
+    SerializeToBinary(InSceneData, Data);
+
+    std::ofstream File(FilePath, std::ios::binary);
+    if (!File.is_open())
+    {
+        UE_LOG(LogLevel::Error, "Failed to open file for writing: %s", FilePath.string().c_str());
+        return false;
+    }
+    File.write(reinterpret_cast<const char*>(Data.GetData()), Data.Num());
+    return static_cast<bool>(File);
+}
+
 bool SceneManager::JsonToSceneData(const FString& InJsonString, FSceneData& OutSceneData)
 {
     try
@@ -223,6 +228,15 @@ FSceneData SceneManager::WorldToSceneData(const UWorld& InWorld)
             
             //TMap<FString, FString> InProperties;
             Component->GetProperties(componentData.Properties);
+
+            // Binary Level에는 문자열로 바꾸기 전의 값을 저장합니다.
+            if (const USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+            {
+                componentData.bHasTransform = true;
+                componentData.RelativeLocation = SceneComponent->GetRelativeLocation();
+                componentData.RelativeRotation = SceneComponent->GetRelativeRotation();
+                componentData.RelativeScale3D = SceneComponent->GetRelativeScale3D();
+            }
             
             // 컴포넌트의 속성들을 JSON으로 변환하여 저장
             // for (const auto& Property : InProperties)
@@ -252,6 +266,21 @@ bool SceneManager::LoadWorldFromData(const FSceneData& sceneData, const std::fil
     TMap<FString, AActor*> SpawnedActorsMap;
     //TMap<FString, UActorComponent*> SpawnedComponentsMap;
     
+    // --- 0단계: Static Mesh 미리 요청 ---
+    // Component를 만들기 전에 모든 Mesh를 Background Loader에 넣어두면, SetProperties의 CreateStaticMesh가 하나씩 읽는 대신
+    // 여러 Mesh를 동시에 읽은 결과를 기다려서 사용합니다.
+    for (const FActorSaveData& actorData : sceneData.Actors)
+    {
+        for (const FComponentSaveData& componentData : actorData.Components)
+        {
+            const FString* StaticMeshPath = componentData.Properties.Find(TEXT("StaticMeshPath"));
+            if (StaticMeshPath && *StaticMeshPath != TEXT("None"))
+            {
+                FManagerOBJ::RequestStaticMeshAsync(*StaticMeshPath);
+            }
+        }
+    }
+
 
     // --- 1단계: 액터 및 컴포넌트 생성 ---
     UE_LOG(LogLevel::Display, TEXT("Loading Scene Data: Phase 1 - Spawning Actors and Components..."));
@@ -426,6 +455,15 @@ bool SceneManager::LoadWorldFromData(const FSceneData& sceneData, const std::fil
                 }
             }
 
+            // Binary Level에서 읽은 경우 Transform이 이미 값으로 들어있습니다.
+            if (componentData.bHasTransform)
+            {
+                CurrentSceneComp->SetRelativeLocation(componentData.RelativeLocation);
+                CurrentSceneComp->SetRelativeRotation(componentData.RelativeRotation);
+                CurrentSceneComp->SetRelativeScale3D(componentData.RelativeScale3D);
+                continue;
+            }
+
             FVector RelativeLocation = FVector::ZeroVector;
             const FString* LocStr = componentData.Properties.Find(TEXT("RelativeLocation"));
             if (LocStr) RelativeLocation.InitFromString(*LocStr); // 또는 직접 파싱
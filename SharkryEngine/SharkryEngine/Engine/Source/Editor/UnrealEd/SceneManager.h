@@ -2,6 +2,8 @@
 #include <filesystem>
 #include <string>
 
+#include "Container/Array.h"
+
 class FString;
 class UWorld;
 
@@ -30,7 +32,24 @@ public:
      */
     static bool SaveSceneToJsonFile(const std::filesystem::path& FilePath, const UWorld& InWorld);
 
-private:
+    /**
+     * World 파일을 불러옵니다. JSON보다 최신인 Binary Level이 있다면 그것을 읽고,
+     * 없거나 오래되었다면 JSON을 읽은 뒤 다음 로드를 위해 Binary Level을 만듭니다.
+     * @param FilePath Json형식으로 World정보가 저장된 파일의 경로
+     * @param OutWorld 생성된 World
+     */
+    static void LoadScene(const std::filesystem::path& FilePath, UWorld& OutWorld);
+
+    /**
+     * Json형식의 World 파일로 Binary Level을 만듭니다. JSON은 편집용 원본으로 그대로 둡니다.
+     * @param FilePath Json형식으로 World정보가 저장된 파일의 경로
+     * @return 성공적으로 저장되었는지 여부
+     */
+    static bool CookScene(const std::filesystem::path& FilePath);
+
+    /** JSON World 파일에 대응하는 Binary Level 경로, Sponza.scene -> Sponza.scene.bin */
+    static std::filesystem::path GetCookedScenePath(const std::filesystem::path& FilePath);
+
     /**
      * JSON 문자열을 역직렬화하여 FSceneData를 생성합니다.
      *
@@ -42,6 +61,20 @@ private:
 
     static bool SceneDataToJson(const NS_SceneManagerData::FSceneData& InSceneData, FString& OutJsonString);
 
+    /**
+     * FSceneData를 Binary Level 형식으로 직렬화합니다.
+     * 모든 문자열은 한 번씩만 문자열 표에 저장하고, Actor, Component, Property는 고정 크기 Record 배열로 저장합니다.
+     * Component의 상대 Transform은 문자열이 아닌 float로 저장합니다.
+     */
+    static void SerializeToBinary(const NS_SceneManagerData::FSceneData& InSceneData, TArray<uint8>& OutData);
+
+    /**
+     * Binary Level을 FSceneData로 역직렬화합니다.
+     * @return 성공 여부, 버전이 다르거나 Content Hash가 맞지 않는 등 데이터가 손상되었다면 false
+     */
+    static bool DeserializeFromBinary(const TArray<uint8>& InData, NS_SceneManagerData::FSceneData& OutSceneData);
+
+private:
     /**
      * World를 FSceneData로 직렬화합니다.
      *
@@ -54,12 +87,8 @@ private:
     static bool LoadWorldFromData(const NS_SceneManagerData::FSceneData& sceneData, const std::filesystem::path& ScenePath, UWorld* targetWorld);
 
 private:
-    // TODO: IFileManager::Get().CreateFileReader() & Writer() 만들면 여기에 추가
-    // static void DeserializeFromBinary(const void* Data, int64 Size, NS_SceneManagerData::FSceneData& OutSceneData);
-    // or 중간 구조체 사용 안할경우
-    // static UWorld* DeserializeFromBinary(const void* Data, int64 Size);
-
-    // static TArray<uint8> SerializeToBinary(const NS_SceneManagerData::FSceneData& SceneData);
-    // or 중간 구조체 사용 안할경우
-    // static TArray<uint8> SerializeToBinary(UWorld* World);
+    static bool ReadJsonFile(const std::filesystem::path& FilePath, NS_SceneManagerData::FSceneData& OutSceneData);
+    static bool ReadBinaryFile(const std::filesystem::path& FilePath, NS_SceneManagerData::FSceneData& OutSceneData);
+
+    static bool SaveCookedScene(const std::filesystem::path& FilePath, const NS_SceneManagerData::FSceneData& InSceneData);
 };
@@ -0,0 +1,369 @@
+#include "SceneManager.h"
+
+#include <cstddef>
+#include <stdexcept>
+
+#include "SceneManagerData.h"
+#include "Misc/XxHash.h"
+#include "Serialization/MemoryArchive.h"
+#include "UserInterface/Console.h"
+
+using namespace NS_SceneManagerData;
+
+/*
+ * Binary Level 형식
+ *
+ * [FSceneBinaryHeader]
+ * [uint32 StringOffsets[NumStrings + 1]] [char StringBytes[NumStringBytes]] [4 Byte 정렬 Padding]
+ * [FActorRecord     Actors[NumActors]]
+ * [FComponentRecord Components[NumComponents]]
+ * [FPropertyRecord  Properties[NumProperties]]
+ *
+ * 모든 문자열은 문자열 표에 한 번씩만 저장하고 Record는 표의 Index로 참조합니다.
+ * Actor는 자신의 Component와 Property를, Component는 자신의 Property를 배열의 연속 구간으로 가리키므로
+ * 각 배열을 한 번에 읽을 수 있습니다.
+ *
+ * Header의 ContentHash는 Header에서 ContentHash 앞까지와 Header 뒤의 모든 Byte를 덮으므로,
+ * 개수나 범위가 맞더라도 문자열이나 Transform이 손상된 파일은 읽지 않고 JSON에서 다시 만듭니다.
+ */
+namespace
+{
+    /** 'SKLV' */
+    constexpr uint32 SceneBinaryMagic = 0x564C4B53;
+
+    /** 형식이 바뀌면 올립니다. 버전이 다른 Binary Level은 읽지 않고 JSON에서 다시 만듭니다. */
+    constexpr uint32 SceneBinaryVersion = 2;
+
+    struct FSceneBinaryHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        int32 SceneVersion;
+        int32 NextUUID;
+        uint32 NumStrings;
+        uint32 NumStringBytes;
+        uint32 NumActors;
+        uint32 NumComponents;
+        uint32 NumProperties;
+        uint32 Reserved;
+
+        /** 마지막 필드여야 합니다. Reserved까지 채워서 Hash하는 구간에 Padding이 없도록 합니다. */
+        uint64 ContentHash;
+    };
+    static_assert(offsetof(FSceneBinaryHeader, ContentHash) + sizeof(uint64) == sizeof(FSceneBinaryHeader));
+
+    struct FActorRecord
+    {
+        uint32 ActorID;
+        uint32 ActorClass;
+        uint32 ActorLabel;
+        uint32 RootComponentID;
+        uint32 FirstComponent;
+        uint32 NumComponents;
+        uint32 FirstProperty;
+        uint32 NumProperties;
+    };
+
+    struct FComponentRecord
+    {
+        uint32 ComponentID;
+        uint32 ComponentClass;
+        uint32 FirstProperty;
+        uint32 NumProperties;
+
+        /** 0이라면 아래 Transform은 사용하지 않습니다. */
+        uint32 bHasTransform;
+        float RelativeLocation[3];
+        float RelativeRotation[3]; // Pitch, Yaw, Roll
+        float RelativeScale3D[3];
+    };
+
+    struct FPropertyRecord
+    {
+        uint32 Key;
+        uint32 Value;
+    };
+
+    /** Transform은 FComponentRecord에 값으로 저장하므로 Property 문자열로는 저장하지 않습니다. */
+    bool IsTransformProperty(const FString& Key)
+    {
+        return Key == TEXT("RelativeLocation") || Key == TEXT("RelativeRotation") || Key == TEXT("RelativeScale3D");
+    }
+
+    class FStringTableBuilder
+    {
+    public:
+        FStringTableBuilder()
+        {
+            Offsets.Add(0);
+        }
+
+        uint32 Intern(const FString& String)
+        {
+            if (const uint32* Found = Indices.Find(String))
+            {
+                return *Found;
+            }
+
+            const uint32 Index = static_cast<uint32>(Offsets.Num() - 1);
+            const int32 Length = String.Len();
+            const int32 Start = Bytes.Num();
+            Bytes.SetNum(Start + Length);
+            FPlatformMemory::Memcpy(Bytes.GetData() + Start, GetData(String), Length);
+            Offsets.Add(static_cast<uint32>(Bytes.Num()));
+            Indices.Add(String, Index);
+            return Index;
+        }
+
+        TArray<uint32> Offsets;
+        TArray<uint8> Bytes;
+
+    private:
+        TMap<FString, uint32> Indices;
+    };
+
+    template <typename ElementType>
+    void WriteArray(FMemoryWriter& Writer, const TArray<ElementType>& Array)
+    {
+        Writer.Serialize(const_cast<ElementType*>(Array.GetData()), static_cast<int64>(Array.Num()) * sizeof(ElementType));
+    }
+
+    template <typename ElementType>
+    void ReadArray(FMemoryReader& Reader, TArray<ElementType>& OutArray, uint32 Num)
+    {
+        OutArray.SetNum(static_cast<int32>(Num));
+        Reader.Serialize(OutArray.GetData(), static_cast<int64>(Num) * sizeof(ElementType));
+    }
+
+    uint64 ComputeContentHash(const TArray<uint8>& Data)
+    {
+        const uint64 HeaderHash = FXxHash64::HashBuffer(Data.GetData(), offsetof(FSceneBinaryHeader, ContentHash));
+        return FXxHash64::HashBuffer(Data.GetData() + sizeof(FSceneBinaryHeader), Data.Num() - sizeof(FSceneBinaryHeader), HeaderHash);
+    }
+
+    void CheckRange(uint32 First, uint32 Num, uint32 Total)
+    {
+        if (First > Total || Num > Total - First)
+        {
+            throw std::runtime_error("Record range is out of bounds.");
+        }
+    }
+}
+
+void SceneManager::SerializeToBinary(const FSceneData& InSceneData, TArray<uint8>& OutData)
+{
+    FStringTableBuilder StringTable;
+    TArray<FActorRecord> ActorRecords;
+    TArray<FComponentRecord> ComponentRecords;
+    TArray<FPropertyRecord> PropertyRecords;
+    ActorRecords.Reserve(InSceneData.Actors.Num());
+
+    const auto AddProperties = [&StringTable, &PropertyRecords](const TMap<FString, FString>& Properties, bool bSkipTransform, uint32& OutFirst, uint32& OutNum)
+    {
+        OutFirst = static_cast<uint32>(PropertyRecords.Num());
+        for (const auto& [Key, Value] : Properties)
+        {
+            if (bSkipTransform && IsTransformProperty(Key))
+            {
+                continue;
+            }
+            PropertyRecords.Add({ StringTable.Intern(Key), StringTable.Intern(Value) });
+        }
+        OutNum = static_cast<uint32>(PropertyRecords.Num()) - OutFirst;
+    };
+
+    for (const FActorSaveData& ActorData : InSceneData.Actors)
+    {
+        FActorRecord& ActorRecord = ActorRecords[ActorRecords.Add(FActorRecord())];
+        ActorRecord.ActorID = StringTable.Intern(ActorData.ActorID);
+        ActorRecord.ActorClass = StringTable.Intern(ActorData.ActorClass);
+        ActorRecord.ActorLabel = StringTable.Intern(ActorData.ActorLabel);
+        ActorRecord.RootComponentID = StringTable.Intern(ActorData.RootComponentID);
+        AddProperties(ActorData.Properties, false, ActorRecord.FirstProperty, ActorRecord.NumProperties);
+
+        ActorRecord.FirstComponent = static_cast<uint32>(ComponentRecords.Num());
+        ActorRecord.NumComponents = static_cast<uint32>(ActorData.Components.Num());
+        for (const FComponentSaveData& ComponentData : ActorData.Components)
+        {
+            FVector RelativeLocation = ComponentData.RelativeLocation;
+            FRotator RelativeRotation = ComponentData.RelativeRotation;
+            FVector RelativeScale3D = ComponentData.RelativeScale3D;
+            bool bHasTransform = ComponentData.bHasTransform;
+
+            // JSON에서 읽은 경우 Cook할 때 한 번만 파싱해서 로드할 때는 문자열을 거치지 않도록 합니다.
+            if (!bHasTransform)
+            {
+                const FString* LocationString = ComponentData.Properties.Find(TEXT("RelativeLocation"));
+                const FString* RotationString = ComponentData.Properties.Find(TEXT("RelativeRotation"));
+                const FString* ScaleString = ComponentData.Properties.Find(TEXT("RelativeScale3D"));
+                bHasTransform = LocationString || RotationString || ScaleString;
+                if (LocationString) RelativeLocation.InitFromString(*LocationString);
+                if (RotationString) RelativeRotation.InitFromString(*RotationString);
+                if (ScaleString) RelativeScale3D.InitFromString(*ScaleString);
+            }
+
+            FComponentRecord ComponentRecord = {};
+            ComponentRecord.ComponentID = StringTable.Intern(ComponentData.ComponentID);
+            ComponentRecord.ComponentClass = StringTable.Intern(ComponentData.ComponentClass);
+            AddProperties(ComponentData.Properties, bHasTransform, ComponentRecord.FirstProperty, ComponentRecord.NumProperties);
+
+            ComponentRecord.bHasTransform = bHasTransform ? 1 : 0;
+            ComponentRecord.RelativeLocation[0] = RelativeLocation.X;
+            ComponentRecord.RelativeLocation[1] = RelativeLocation.Y;
+            ComponentRecord.RelativeLocation[2] = RelativeLocation.Z;
+            ComponentRecord.RelativeRotation[0] = RelativeRotation.Pitch;
+            ComponentRecord.RelativeRotation[1] = RelativeRotation.Yaw;
+            ComponentRecord.RelativeRotation[2] = RelativeRotation.Roll;
+            ComponentRecord.RelativeScale3D[0] = RelativeScale3D.X;
+            ComponentRecord.RelativeScale3D[1] = RelativeScale3D.Y;
+            ComponentRecord.RelativeScale3D[2] = RelativeScale3D.Z;
+            ComponentRecords.Add(ComponentRecord);
+        }
+    }
+
+    FSceneBinaryHeader Header;
+    Header.Magic = SceneBinaryMagic;
+    Header.Version = SceneBinaryVersion;
+    Header.SceneVersion = InSceneData.Version;
+    Header.NextUUID = InSceneData.NextUUID;
+    Header.NumStrings = static_cast<uint32>(StringTable.Offsets.Num() - 1);
+    Header.NumStringBytes = static_cast<uint32>(StringTable.Bytes.Num());
+    Header.NumActors = static_cast<uint32>(ActorRecords.Num());
+    Header.NumComponents = static_cast<uint32>(ComponentRecords.Num());
+    Header.NumProperties = static_cast<uint32>(PropertyRecords.Num());
+    Header.Reserved = 0;
+    Header.ContentHash = 0;
+
+    // Record 배열이 4 Byte 정렬되도록 문자열 뒤를 채웁니다.
+    while (StringTable.Bytes.Num() % 4 != 0)
+    {
+        StringTable.Bytes.Add(0);
+    }
+
+    OutData.Empty();
+    FMemoryWriter Writer(OutData);
+    Writer.Serialize(Header);
+    WriteArray(Writer, StringTable.Offsets);
+    WriteArray(Writer, StringTable.Bytes);
+    WriteArray(Writer, ActorRecords);
+    WriteArray(Writer, ComponentRecords);
+    WriteArray(Writer, PropertyRecords);
+
+    const uint64 ContentHash = ComputeContentHash(OutData);
+    FPlatformMemory::Memcpy(OutData.GetData() + offsetof(FSceneBinaryHeader, ContentHash), &ContentHash, sizeof(ContentHash));
+}
+
+bool SceneManager::DeserializeFromBinary(const TArray<uint8>& InData, FSceneData& OutSceneData)
+{
+    try
+    {
+        FMemoryReader Reader(InData);
+
+        FSceneBinaryHeader Header;
+        Reader.Serialize(Header);
+        if (Header.Magic != SceneBinaryMagic || Header.Version != SceneBinaryVersion)
+        {
+            return false;
+        }
+
+        // 배열을 할당하기 전에 Header의 개수가 파일 크기와 맞는지 확인합니다.
+        const uint64 ExpectedSize = sizeof(FSceneBinaryHeader)
+            + (static_cast<uint64>(Header.NumStrings) + 1) * sizeof(uint32)
+            + ((static_cast<uint64>(Header.NumStringBytes) + 3) & ~3ull)
+            + static_cast<uint64>(Header.NumActors) * sizeof(FActorRecord)
+            + static_cast<uint64>(Header.NumComponents) * sizeof(FComponentRecord)
+            + static_cast<uint64>(Header.NumProperties) * sizeof(FPropertyRecord);
+        if (ExpectedSize != static_cast<uint64>(InData.Num()))
+        {
+            return false;
+        }
+        if (ComputeContentHash(InData) != Header.ContentHash)
+        {
+            return false;
+        }
+
+        TArray<uint32> StringOffsets;
+        ReadArray(Reader, StringOffsets, Header.NumStrings + 1);
+
+        // 문자열은 버퍼에서 바로 만들고, Padding까지 건너뜁니다.
+        const int64 StringBytesOffset = sizeof(FSceneBinaryHeader) + (static_cast<int64>(Header.NumStrings) + 1) * sizeof(uint32);
+        const int64 PaddedStringBytes = (static_cast<int64>(Header.NumStringBytes) + 3) & ~3ll;
+        Reader.Seek(StringBytesOffset + PaddedStringBytes);
+        const char* StringBytes = reinterpret_cast<const char*>(InData.GetData() + StringBytesOffset);
+
+        TArray<FString> Strings;
+        Strings.Reserve(static_cast<int32>(Header.NumStrings));
+        for (uint32 Index = 0; Index < Header.NumStrings; ++Index)
+        {
+            const uint32 Begin = StringOffsets[Index];
+            const uint32 End = StringOffsets[Index + 1];
+            if (Begin > End || End > Header.NumStringBytes)
+            {
+                return false;
+            }
+            Strings.Emplace(std::string(StringBytes + Begin, End - Begin));
+        }
+
+        TArray<FActorRecord> ActorRecords;
+        TArray<FComponentRecord> ComponentRecords;
+        TArray<FPropertyRecord> PropertyRecords;
+        ReadArray(Reader, ActorRecords, Header.NumActors);
+        ReadArray(Reader, ComponentRecords, Header.NumComponents);
+        ReadArray(Reader, PropertyRecords, Header.NumProperties);
+
+        const auto GetString = [&Strings](uint32 Index) -> const FString&
+        {
+            if (Index >= static_cast<uint32>(Strings.Num()))
+            {
+                throw std::runtime_error("String index is out of bounds.");
+            }
+            return Strings[static_cast<int32>(Index)];
+        };
+
+        const auto ReadProperties = [&](uint32 First, uint32 Num, TMap<FString, FString>& OutProperties)
+        {
+            CheckRange(First, Num, Header.NumProperties);
+            for (uint32 Index = First; Index < First + Num; ++Index)
+            {
+                const FPropertyRecord& Record = PropertyRecords[static_cast<int32>(Index)];
+                OutProperties.Add(GetString(Record.Key), GetString(Record.Value));
+            }
+        };
+
+        OutSceneData.Version = Header.SceneVersion;
+        OutSceneData.NextUUID = Header.NextUUID;
+        OutSceneData.Actors.SetNum(static_cast<int32>(Header.NumActors));
+        for (uint32 ActorIndex = 0; ActorIndex < Header.NumActors; ++ActorIndex)
+        {
+            const FActorRecord& ActorRecord = ActorRecords[static_cast<int32>(ActorIndex)];
+            FActorSaveData& ActorData = OutSceneData.Actors[static_cast<int32>(ActorIndex)];
+            ActorData.ActorID = GetString(ActorRecord.ActorID);
+            ActorData.ActorClass = GetString(ActorRecord.ActorClass);
+            ActorData.ActorLabel = GetString(ActorRecord.ActorLabel);
+            ActorData.RootComponentID = GetString(ActorRecord.RootComponentID);
+            ReadProperties(ActorRecord.FirstProperty, ActorRecord.NumProperties, ActorData.Properties);
+
+            CheckRange(ActorRecord.FirstComponent, ActorRecord.NumComponents, Header.NumComponents);
+            ActorData.Components.SetNum(static_cast<int32>(ActorRecord.NumComponents));
+            for (uint32 Offset = 0; Offset < ActorRecord.NumComponents; ++Offset)
+            {
+                const FComponentRecord& ComponentRecord = ComponentRecords[static_cast<int32>(ActorRecord.FirstComponent + Offset)];
+                FComponentSaveData& ComponentData = ActorData.Components[static_cast<int32>(Offset)];
+                ComponentData.ComponentID = GetString(ComponentRecord.ComponentID);
+                ComponentData.ComponentClass = GetString(ComponentRecord.ComponentClass);
+                ReadProperties(ComponentRecord.FirstProperty, ComponentRecord.NumProperties, ComponentData.Properties);
+
+                ComponentData.bHasTransform = ComponentRecord.bHasTransform != 0;
+                ComponentData.RelativeLocation = FVector(ComponentRecord.RelativeLocation[0], ComponentRecord.RelativeLocation[1], ComponentRecord.RelativeLocation[2]);
+                ComponentData.RelativeRotation = FRotator(ComponentRecord.RelativeRotation[0], ComponentRecord.RelativeRotation[1], ComponentRecord.RelativeRotation[2]);
+                ComponentData.RelativeScale3D = FVector(ComponentRecord.RelativeScale3D[0], ComponentRecord.RelativeScale3D[1], ComponentRecord.RelativeScale3D[2]);
+            }
+        }
+    }
+    catch (const std::exception& e)
+    {
+        UE_LOG(LogLevel::Error, "Error reading cooked scene: %s", e.what());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "Math/Rotator.h"
+#include "Math/Vector.h"
+
+#include "JSON/json.hpp"
+
+using json = nlohmann::json;
+
+
+#pragma region nlohmann::json function overload
+[[maybe_unused]]
+static void to_json(json& Json, const FString& S)
+{
+    Json = S.GetContainerPrivate();
+}
+
+[[maybe_unused]]
+static void from_json(const json& Json, FString& S)
+{
+    if (Json.is_string())
+    {
+        Json.get_to(S.GetContainerPrivate());
+    }
+}
+
+
+template <typename ElementType, typename AllocatorType>
+[[maybe_unused]]
+static void to_json(json& Json, const TArray<ElementType, AllocatorType>& Array)
+{
+    Json = Array.GetContainerPrivate();
+}
+
+template <typename ElementType, typename AllocatorType>
+[[maybe_unused]]
+static void from_json(const json& Json, TArray<ElementType, AllocatorType>& Array)
+{
+    Json.get_to(Array.GetContainerPrivate());
+}
+
+
+template <typename KeyType, typename ValueType, typename Allocator>
+[[maybe_unused]]
+static void to_json(json& Json, const TMap<KeyType, ValueType, Allocator>& Map)
+{
+    // 기존 씬 파일과 같이 Key를 문자열로 하는 Object로 저장
+    Json = json::object();
+    for (const auto& [Key, Value] : Map)
+    {
+        Json[static_cast<std::string>(Key)] = Value;
+    }
+}
+
+template <typename KeyType, typename ValueType, typename Allocator>
+[[maybe_unused]]
+static void from_json(const json& Json, TMap<KeyType, ValueType, Allocator>& Map)
+{
+    Map.Empty();
+    for (const auto& [Key, Value] : Json.items())
+    {
+        Map.Add(KeyType(Key), Value.template get<ValueType>());
+    }
+}
+#pragma endregion
+
+namespace NS_SceneManagerData
+{
+// 컴포넌트 하나의 저장 정보를 담는 구조체
+struct FComponentSaveData
+{
+    FString ComponentID;    // 컴포넌트의 고유 ID (액터 내에서 유일해야 함, FName) 
+    FString ComponentClass; // 컴포넌트 클래스 이름 (예: "UStaticMeshComponent", "UPointLightComponent")
+
+    TMap<FString, FString> Properties;
+
+    /**
+     * USceneComponent의 상대 Transform, bHasTransform이 true인 경우에만 유효합니다.
+     * JSON에는 Properties의 문자열로만 저장되고, Binary Level이나 World에서 만든 경우 문자열을 거치지 않은 값이 들어있습니다.
+     */
+    bool bHasTransform = false;
+    FVector RelativeLocation = FVector::ZeroVector;
+    FRotator RelativeRotation;
+    FVector RelativeScale3D = FVector::OneVector;
+
+    NLOHMANN_DEFINE_TYPE_INTRUSIVE(FComponentSaveData, ComponentID, ComponentClass, Properties)
+};
+
+// 액터 하나의 저장 정보를 담는 구조체
+struct FActorSaveData
+{
+    FString ActorID;    // 액터의 고유 ID FName
+    FString ActorClass; // 액터의 클래스 이름 (예: "AStaticMeshActor", "APointLight")
+    FString ActorLabel; // 에디터에서 보이는 이름 (선택적)
+    // FTransform ActorTransform; // 액터 자체의 트랜스폼 (보통 루트 컴포넌트가 결정) - 필요 여부 검토
+
+    FString RootComponentID;               // 이 액터의 루트 컴포넌트 ID (아래 Components 리스트 내 ID 참조)
+    TArray<FComponentSaveData> Components; // 이 액터가 소유한 컴포넌트 목록
+
+    TMap<FString, FString> Properties;
+    
+    NLOHMANN_DEFINE_TYPE_INTRUSIVE(FActorSaveData, ActorID, ActorClass, ActorLabel, RootComponentID, Components, Properties)
+};
+
+struct FSceneData
+{
+    int32 Version = 0;
+    int32 NextUUID = 0;
+    //TMap<int32, UObject*> Primitives;
+
+    TArray<FActorSaveData> Actors; // 씬에 있는 모든 액터 정보
+
+    NLOHMANN_DEFINE_TYPE_INTRUSIVE(FSceneData, Version, NextUUID, Actors)
+};
+
+//TODO : 레벨 데이타 구현
+}
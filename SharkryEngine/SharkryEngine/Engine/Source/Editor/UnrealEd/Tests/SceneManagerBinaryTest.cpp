@@ -0,0 +1,274 @@
+#include "Misc/AutomationTest.h"
+#include <cstring>
+#include "UnrealEd/SceneManager.h"
+#include "UnrealEd/SceneManagerData.h"
+
+using namespace NS_SceneManagerData;
+
+namespace
+{
+    /** 실행마다 같은 Scene이 나오도록 하는 간단한 난수 */
+    struct FTestRandom
+    {
+        uint32 State = 12345u;
+
+        uint32 Next()
+        {
+            State = State * 1664525u + 1013904223u;
+            return State >> 8;
+        }
+
+        /** 문자열로 저장하면 정밀도를 잃는 값이 나오도록 범위 안의 임의의 float을 만듭니다. */
+        float Range(float Min, float Max)
+        {
+            return Min + (Max - Min) * static_cast<float>(Next() & 0xFFFFFF) / 16777215.f;
+        }
+    };
+
+    /**
+     * 여러 종류의 Component를 가진 Scene을 만듭니다.
+     * 일부 Component는 World에서 만든 것처럼 Transform을 float로, 일부는 JSON에서 읽은 것처럼 Property 문자열로 가집니다.
+     */
+    FSceneData MakeTestScene(int32 NumActors, FTestRandom& Random)
+    {
+        FSceneData SceneData;
+        SceneData.Version = 3;
+        SceneData.NextUUID = 1000 + NumActors;
+
+        for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+        {
+            FActorSaveData& ActorData = SceneData.Actors[SceneData.Actors.Add(FActorSaveData())];
+            ActorData.ActorID = FString::Printf(TEXT("AActor_%d"), ActorIndex);
+            ActorData.ActorClass = ActorIndex % 3 == 0 ? TEXT("AStaticMeshActor") : TEXT("AActor");
+            ActorData.ActorLabel = ActorIndex % 5 == 0 ? FString() : FString::Printf(TEXT("Label %d"), ActorIndex);
+            ActorData.RootComponentID = TEXT("Root");
+            if (ActorIndex % 2 == 0)
+            {
+                ActorData.Properties.Add(TEXT("bHidden"), TEXT("false"));
+            }
+
+            const int32 NumComponents = 1 + ActorIndex % 4;
+            for (int32 ComponentIndex = 0; ComponentIndex < NumComponents; ++ComponentIndex)
+            {
+                FComponentSaveData& ComponentData = ActorData.Components[ActorData.Components.Add(FComponentSaveData())];
+                ComponentData.ComponentID = ComponentIndex == 0 ? FString(TEXT("Root")) : FString::Printf(TEXT("Component_%d"), ComponentIndex);
+                ComponentData.ComponentClass = ComponentIndex % 2 == 0 ? TEXT("UStaticMeshComponent") : TEXT("UPointLightComponent");
+                ComponentData.Properties.Add(TEXT("StaticMeshPath"), TEXT("Contents/Reference/Reference.obj"));
+                ComponentData.Properties.Add(TEXT("Intensity"), FString::Printf(TEXT("%d"), ComponentIndex * 100));
+
+                const FVector Location(Random.Range(-1000.f, 1000.f), Random.Range(-1000.f, 1000.f), Random.Range(-1000.f, 1000.f));
+                const FRotator Rotation(Random.Range(-90.f, 90.f), Random.Range(-180.f, 180.f), Random.Range(-180.f, 180.f));
+                const FVector Scale(Random.Range(0.1f, 4.f), Random.Range(0.1f, 4.f), Random.Range(0.1f, 4.f));
+                switch ((ActorIndex + ComponentIndex) % 3)
+                {
+                case 0:
+                    ComponentData.bHasTransform = true;
+                    ComponentData.RelativeLocation = Location;
+                    ComponentData.RelativeRotation = Rotation;
+                    ComponentData.RelativeScale3D = Scale;
+                    break;
+                case 1:
+                    ComponentData.Properties.Add(TEXT("RelativeLocation"), Location.ToString());
+                    ComponentData.Properties.Add(TEXT("RelativeRotation"), Rotation.ToString());
+                    ComponentData.Properties.Add(TEXT("RelativeScale3D"), Scale.ToString());
+                    break;
+                default:
+                    // Transform이 없는 Component
+                    break;
+                }
+            }
+        }
+        return SceneData;
+    }
+
+    bool IsTransformProperty(const FString& Key)
+    {
+        return Key == TEXT("RelativeLocation") || Key == TEXT("RelativeRotation") || Key == TEXT("RelativeScale3D");
+    }
+
+    /** Transform Property는 Binary Level에서 float로 옮겨지므로 비교하지 않습니다. */
+    bool PropertiesMatch(const TMap<FString, FString>& Expected, const TMap<FString, FString>& Actual)
+    {
+        int32 NumExpected = 0;
+        for (const auto& [Key, Value] : Expected)
+        {
+            if (IsTransformProperty(Key))
+            {
+                continue;
+            }
+            ++NumExpected;
+
+            const FString* Found = Actual.Find(Key);
+            if (!Found || *Found != Value)
+            {
+                return false;
+            }
+        }
+        return NumExpected == Actual.Num();
+    }
+
+    bool BitwiseEqual(const FVector& A, const FVector& B)
+    {
+        return std::memcmp(&A.X, &B.X, sizeof(float)) == 0 && std::memcmp(&A.Y, &B.Y, sizeof(float)) == 0 && std::memcmp(&A.Z, &B.Z, sizeof(float)) == 0;
+    }
+
+    bool BitwiseEqual(const FRotator& A, const FRotator& B)
+    {
+        return BitwiseEqual(FVector(A.Pitch, A.Yaw, A.Roll), FVector(B.Pitch, B.Yaw, B.Roll));
+    }
+
+    /**
+     * Expected를 Binary Level로 저장했다가 읽은 Actual이 같은 Scene인지 확인하고, 다른 곳을 Test에 Error로 남깁니다.
+     * float로 가진 Transform은 Bit 단위로 같아야 하고, 문자열로 가진 Transform은 한 번 파싱한 값과 같아야 합니다.
+     */
+    int32 CountSceneMismatches(FAutomationTestBase& Test, const FSceneData& Expected, const FSceneData& Actual)
+    {
+        if (Expected.Version != Actual.Version || Expected.NextUUID != Actual.NextUUID || Expected.Actors.Num() != Actual.Actors.Num())
+        {
+            Test.AddError(TEXT("Scene header or actor count differs"));
+            return 1;
+        }
+
+        int32 NumMismatches = 0;
+        for (int32 ActorIndex = 0; ActorIndex < Expected.Actors.Num(); ++ActorIndex)
+        {
+            const FActorSaveData& ExpectedActor = Expected.Actors[ActorIndex];
+            const FActorSaveData& ActualActor = Actual.Actors[ActorIndex];
+            if (ExpectedActor.ActorID != ActualActor.ActorID
+                || ExpectedActor.ActorClass != ActualActor.ActorClass
+                || ExpectedActor.ActorLabel != ActualActor.ActorLabel
+                || ExpectedActor.RootComponentID != ActualActor.RootComponentID
+                || !PropertiesMatch(ExpectedActor.Properties, ActualActor.Properties)
+                || ExpectedActor.Components.Num() != ActualActor.Components.Num())
+            {
+                Test.AddError(FString::Printf(TEXT("Actor %s differs"), *ExpectedActor.ActorID));
+                ++NumMismatches;
+                continue;
+            }
+
+            for (int32 ComponentIndex = 0; ComponentIndex < ExpectedActor.Components.Num(); ++ComponentIndex)
+            {
+                const FComponentSaveData& ExpectedComponent = ExpectedActor.Components[ComponentIndex];
+                const FComponentSaveData& ActualComponent = ActualActor.Components[ComponentIndex];
+
+                bool bHasTransform = ExpectedComponent.bHasTransform;
+                FVector Location = ExpectedComponent.RelativeLocation;
+                FRotator Rotation = ExpectedComponent.RelativeRotation;
+                FVector Scale = ExpectedComponent.RelativeScale3D;
+                if (!bHasTransform)
+                {
+                    const FString* LocationString = ExpectedComponent.Properties.Find(TEXT("RelativeLocation"));
+                    const FString* RotationString = ExpectedComponent.Properties.Find(TEXT("RelativeRotation"));
+                    const FString* ScaleString = ExpectedComponent.Properties.Find(TEXT("RelativeScale3D"));
+                    bHasTransform = LocationString || RotationString || ScaleString;
+                    if (LocationString) Location.InitFromString(*LocationString);
+                    if (RotationString) Rotation.InitFromString(*RotationString);
+                    if (ScaleString) Scale.InitFromString(*ScaleString);
+                }
+
+                const bool bTransformMatches = ActualComponent.bHasTransform == bHasTransform
+                    && (!bHasTransform || (BitwiseEqual(ActualComponent.RelativeLocation, Location)
+                        && BitwiseEqual(ActualComponent.RelativeRotation, Rotation)
+                        && BitwiseEqual(ActualComponent.RelativeScale3D, Scale)));
+
+                if (ExpectedComponent.ComponentID != ActualComponent.ComponentID
+                    || ExpectedComponent.ComponentClass != ActualComponent.ComponentClass
+                    || !PropertiesMatch(ExpectedComponent.Properties, ActualComponent.Properties)
+                    || !bTransformMatches)
+                {
+                    Test.AddError(FString::Printf(TEXT("Component %s.%s differs"), *ExpectedActor.ActorID, *ExpectedComponent.ComponentID));
+                    ++NumMismatches;
+                }
+            }
+        }
+        return NumMismatches;
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FSceneManagerBinaryRoundTripTest, "Editor.SceneManager.Binary.RoundTrip", EAutomationTestType::Unit)
+{
+    FTestRandom Random;
+    const FSceneData SceneData = MakeTestScene(200, Random);
+
+    TArray<uint8> Data;
+    SceneManager::SerializeToBinary(SceneData, Data);
+
+    FSceneData Loaded;
+    if (!TestTrue("Cooked scene deserialized", SceneManager::DeserializeFromBinary(Data, Loaded)))
+    {
+        return false;
+    }
+    TestEqual("Mismatches after binary round trip", CountSceneMismatches(*this, SceneData, Loaded), 0);
+
+    // 읽은 Scene을 다시 Cook해도 같아야 합니다. Transform이 이미 float로 옮겨졌으므로 문자열을 다시 파싱하지 않습니다.
+    TArray<uint8> Recooked;
+    FSceneData Reloaded;
+    SceneManager::SerializeToBinary(Loaded, Recooked);
+    TestTrue("Recooked scene deserialized", SceneManager::DeserializeFromBinary(Recooked, Reloaded));
+    TestEqual("Mismatches after recooking", CountSceneMismatches(*this, Loaded, Reloaded), 0);
+
+    // 에디터가 저장하는 경로처럼 JSON을 거친 뒤 Cook해도 같은 Scene이어야 합니다.
+    FString JsonString;
+    FSceneData FromJson;
+    TestTrue("Scene converted to JSON", SceneManager::SceneDataToJson(SceneData, JsonString));
+    TestTrue("Scene parsed from JSON", SceneManager::JsonToSceneData(JsonString, FromJson));
+
+    TArray<uint8> JsonCooked;
+    FSceneData JsonLoaded;
+    SceneManager::SerializeToBinary(FromJson, JsonCooked);
+    TestTrue("Scene cooked from JSON deserialized", SceneManager::DeserializeFromBinary(JsonCooked, JsonLoaded));
+    TestEqual("Mismatches after JSON -> binary", CountSceneMismatches(*this, FromJson, JsonLoaded), 0);
+
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FSceneManagerBinaryCorruptionTest, "Editor.SceneManager.Binary.RejectCorrupted", EAutomationTestType::Unit)
+{
+    FTestRandom Random;
+    const FSceneData SceneData = MakeTestScene(16, Random);
+
+    TArray<uint8> Data;
+    SceneManager::SerializeToBinary(SceneData, Data);
+
+    const auto IsRejected = [](const TArray<uint8>& Corrupted)
+    {
+        FSceneData Loaded;
+        return !SceneManager::DeserializeFromBinary(Corrupted, Loaded);
+    };
+
+    // 어느 Byte 하나만 바뀌어도, 개수나 범위 검사를 통과하는 문자열, Transform 값까지 Content Hash로 걸러야 합니다.
+    int32 NumAcceptedFlips = 0;
+    int32 FirstAcceptedOffset = INDEX_NONE;
+    for (int32 Offset = 0; Offset < Data.Num(); ++Offset)
+    {
+        TArray<uint8> Corrupted = Data;
+        Corrupted[Offset] ^= 0x10;
+        if (!IsRejected(Corrupted))
+        {
+            FirstAcceptedOffset = NumAcceptedFlips == 0 ? Offset : FirstAcceptedOffset;
+            ++NumAcceptedFlips;
+        }
+    }
+    if (!TestEqual("Single byte flips accepted", NumAcceptedFlips, 0))
+    {
+        AddError(FString::Printf(TEXT("First accepted flip at byte %d of %d"), FirstAcceptedOffset, Data.Num()));
+    }
+
+    // Content Hash 자체가 손상된 경우, Hash는 40 Byte 위치에서 시작하는 Header의 마지막 필드입니다.
+    constexpr int32 ContentHashOffset = 40;
+    TArray<uint8> BadHash = Data;
+    BadHash[ContentHashOffset] ^= 0xFF;
+    TestTrue("Corrupted content hash rejected", IsRejected(BadHash));
+
+    TArray<uint8> Truncated = Data;
+    Truncated.SetNum(Data.Num() - 4);
+    TestTrue("Truncated file rejected", IsRejected(Truncated));
+
+    TArray<uint8> Empty;
+    TestTrue("Empty file rejected", IsRejected(Empty));
+
+    TestFalse("Original data rejected", IsRejected(Data));
+    return true;
+}
@@ -192,14 +192,14 @@ AActor* APlayerCharacter::SpawnActorLua(const std::string& ClassName, const FVec
     UClass* SpawnClass = UClass::FindClass(ClassName.c_str());
     if (!SpawnClass)
     {
-        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: Cannot find class '%s'"), ClassName);
+        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: Cannot find class '%s'"), ClassName.c_str());
         return nullptr;
     }
 
-    AActor* NewActor = World->SpawnActor(SpawnClass);
+    AActor* NewActor = World->AcquireActor(SpawnClass);
     if (!NewActor)
     {
-        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: SpawnActor returned null for '%s'"), ClassName);
+        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: SpawnActor returned null for '%s'"), ClassName.c_str());
         return nullptr;
     }
 
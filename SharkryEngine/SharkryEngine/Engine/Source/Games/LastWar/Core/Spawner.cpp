@@ -43,16 +43,16 @@ AActor* ASpawnerActor::SpawnActorLua(const std::string& ClassName, const FVector
 
     if (!SpawnClass)
     {
-        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: Cannot find class '%s'"), ClassName);
+        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: Cannot find class '%s'"), ClassName.c_str());
         return nullptr;
     }
 
-    // 여기서 바로 SpawnActor 호출
-    AActor* NewActor = World->SpawnActor(SpawnClass);
+    // Pool을 사용하는 Class라면 Pool에서 꺼내고, 아니면 SpawnActor
+    AActor* NewActor = World->AcquireActor(SpawnClass);
 
     if (!NewActor)
     {
-        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: SpawnActor returned null for '%s'"), ClassName);
+        UE_LOG(LogLevel::Error, TEXT("SpawnActorLua: SpawnActor returned null for '%s'"), ClassName.c_str());
         return nullptr;
     }
 
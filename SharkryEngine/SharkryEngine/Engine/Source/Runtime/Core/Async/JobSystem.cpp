@@ -0,0 +1,274 @@
+#include "JobSystem.h"
+
+#include <cassert>
+
+namespace
+{
+    /** 현재 스레드의 Queue Index, Worker가 아닌 스레드는 INDEX_NONE */
+    thread_local int32 GWorkerQueueIndex = INDEX_NONE;
+
+    /** 잠들기 전에 Job을 다시 찾아보는 횟수, Tick Group처럼 짧은 간격으로 Job이 들어올 때 깨우는 비용을 줄입니다. */
+    constexpr int32 SpinCountBeforeSleep = 64;
+}
+
+FJobSystem GJobSystem;
+
+void FJobSystem::FJobQueue::Push(const FJob& Job)
+{
+    const uint32 Capacity = static_cast<uint32>(Jobs.Num());
+    if (Tail - Head == Capacity)
+    {
+        // 가득 찼다면 두 배로 늘리고, Head부터 순서대로 옮겨서 원형 버퍼를 다시 폅니다.
+        const uint32 NewCapacity = Capacity == 0 ? 64 : Capacity * 2;
+        TArray<FJob> NewJobs;
+        NewJobs.SetNum(NewCapacity);
+        for (uint32 Index = Head; Index != Tail; ++Index)
+        {
+            NewJobs[Index - Head] = Jobs[Index & (Capacity - 1)];
+        }
+        Jobs = std::move(NewJobs);
+        Tail -= Head;
+        Head = 0;
+    }
+
+    Jobs[Tail & (Jobs.Num() - 1)] = Job;
+    ++Tail;
+}
+
+bool FJobSystem::FJobQueue::PopBack(FJob& OutJob)
+{
+    if (Head == Tail)
+    {
+        return false;
+    }
+    --Tail;
+    OutJob = Jobs[Tail & (Jobs.Num() - 1)];
+    return true;
+}
+
+bool FJobSystem::FJobQueue::PopFront(FJob& OutJob)
+{
+    if (Head == Tail)
+    {
+        return false;
+    }
+    OutJob = Jobs[Head & (Jobs.Num() - 1)];
+    ++Head;
+    return true;
+}
+
+FJobSystem::~FJobSystem()
+{
+    Shutdown();
+}
+
+void FJobSystem::Initialize(int32 InNumWorkers)
+{
+    assert(Queues.IsEmpty());
+
+    if (InNumWorkers < 0)
+    {
+        InNumWorkers = std::max(static_cast<int32>(std::thread::hardware_concurrency()) - 1, 0);
+    }
+
+    NumWorkers = InNumWorkers;
+    bStopping = false;
+
+    Queues.Reserve(NumWorkers + 1);
+    for (int32 Index = 0; Index <= NumWorkers; ++Index)
+    {
+        Queues.Add(new FJobQueue);
+    }
+
+    Workers.Reserve(NumWorkers);
+    for (int32 Index = 1; Index <= NumWorkers; ++Index)
+    {
+        Workers.Emplace([this, Index]() { WorkerMain(Index); });
+    }
+}
+
+void FJobSystem::Shutdown()
+{
+    if (Queues.IsEmpty())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard Lock(SleepMutex);
+        bStopping = true;
+    }
+    SleepCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.Empty();
+
+    // Worker 없이 남은 Job은 여기서 마저 실행해서 기다리는 Counter가 끝나도록 합니다.
+    FJob Job;
+    while (TryGetJob(0, Job))
+    {
+        ExecuteJob(Job);
+    }
+
+    for (FJobQueue* Queue : Queues)
+    {
+        delete Queue;
+    }
+    Queues.Empty();
+    NumWorkers = 0;
+}
+
+bool FJobSystem::IsInWorkerThread()
+{
+    return GWorkerQueueIndex != INDEX_NONE;
+}
+
+int32 FJobSystem::GetCurrentQueueIndex()
+{
+    return GWorkerQueueIndex != INDEX_NONE ? GWorkerQueueIndex : 0;
+}
+
+void FJobSystem::Dispatch(FJobFunction Function, const void* Context, int32 BeginIndex, int32 EndIndex, FJobCounter& Counter)
+{
+    if (Queues.IsEmpty())
+    {
+        // Initialize 전이라면 바로 실행합니다.
+        Function(Context, BeginIndex, EndIndex);
+        return;
+    }
+
+    Counter.NumPending.fetch_add(1, std::memory_order_relaxed);
+
+    FJobQueue* Queue = Queues[GetCurrentQueueIndex()];
+    {
+        std::lock_guard Lock(Queue->Mutex);
+        Queue->Push(FJob{ Function, Context, BeginIndex, EndIndex, &Counter });
+    }
+    NumQueuedJobs.fetch_add(1, std::memory_order_release);
+
+    WakeWorkers();
+}
+
+void FJobSystem::DispatchBatches(FJobFunction Function, const void* Context, int32 Num, int32 NumBatches, FJobCounter& Counter)
+{
+    Counter.NumPending.fetch_add(NumBatches, std::memory_order_relaxed);
+
+    // 현재 스레드의 Queue부터 돌아가며 넣어서, 각 스레드가 훔치지 않고도 자기 몫을 바로 시작할 수 있도록 합니다.
+    const int32 NumQueues = Queues.Num();
+    const int32 FirstQueue = GetCurrentQueueIndex();
+    for (int32 QueueOffset = 0; QueueOffset < NumQueues && QueueOffset < NumBatches; ++QueueOffset)
+    {
+        FJobQueue* Queue = Queues[(FirstQueue + QueueOffset) % NumQueues];
+        std::lock_guard Lock(Queue->Mutex);
+        for (int32 BatchIndex = QueueOffset; BatchIndex < NumBatches; BatchIndex += NumQueues)
+        {
+            const int32 BeginIndex = static_cast<int32>(static_cast<int64>(Num) * BatchIndex / NumBatches);
+            const int32 EndIndex = static_cast<int32>(static_cast<int64>(Num) * (BatchIndex + 1) / NumBatches);
+            Queue->Push(FJob{ Function, Context, BeginIndex, EndIndex, &Counter });
+        }
+    }
+    NumQueuedJobs.fetch_add(NumBatches, std::memory_order_release);
+
+    WakeWorkers();
+}
+
+void FJobSystem::Wait(FJobCounter& Counter)
+{
+    const int32 QueueIndex = GetCurrentQueueIndex();
+    while (!Counter.IsDone())
+    {
+        FJob Job;
+        if (!Queues.IsEmpty() && TryGetJob(QueueIndex, Job))
+        {
+            ExecuteJob(Job);
+        }
+        else
+        {
+            // 남은 Job이 모두 다른 스레드에서 실행중
+            std::this_thread::yield();
+        }
+    }
+}
+
+bool FJobSystem::TryGetJob(int32 QueueIndex, FJob& OutJob)
+{
+    if (NumQueuedJobs.load(std::memory_order_acquire) <= 0)
+    {
+        return false;
+    }
+
+    const int32 NumQueues = Queues.Num();
+    for (int32 Offset = 0; Offset < NumQueues; ++Offset)
+    {
+        FJobQueue* Queue = Queues[(QueueIndex + Offset) % NumQueues];
+        std::lock_guard Lock(Queue->Mutex);
+
+        // 자기 Queue는 최근에 넣은 Job부터 꺼내서 캐시에 남아있는 데이터를 이어서 사용합니다.
+        if (Offset == 0 ? Queue->PopBack(OutJob) : Queue->PopFront(OutJob))
+        {
+            NumQueuedJobs.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void FJobSystem::ExecuteJob(const FJob& Job)
+{
+    Job.Function(Job.Context, Job.BeginIndex, Job.EndIndex);
+    Job.Counter->NumPending.fetch_sub(1, std::memory_order_release);
+}
+
+void FJobSystem::WakeWorkers()
+{
+    if (NumWorkers == 0)
+    {
+        return;
+    }
+
+    // 잠들기 직전의 Worker가 알림을 놓치지 않도록, Lock을 잡았다 놓은 뒤에 깨웁니다.
+    {
+        std::lock_guard Lock(SleepMutex);
+    }
+    SleepCondition.notify_all();
+}
+
+void FJobSystem::WorkerMain(int32 QueueIndex)
+{
+    GWorkerQueueIndex = QueueIndex;
+
+    int32 SpinCount = 0;
+    while (true)
+    {
+        FJob Job;
+        if (TryGetJob(QueueIndex, Job))
+        {
+            ExecuteJob(Job);
+            SpinCount = 0;
+            continue;
+        }
+
+        if (++SpinCount < SpinCountBeforeSleep)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        SpinCount = 0;
+
+        std::unique_lock Lock(SleepMutex);
+        SleepCondition.wait(Lock, [this]()
+        {
+            return bStopping.load() || NumQueuedJobs.load(std::memory_order_acquire) > 0;
+        });
+
+        if (bStopping && NumQueuedJobs.load(std::memory_order_acquire) <= 0)
+        {
+            break;
+        }
+    }
+
+    GWorkerQueueIndex = INDEX_NONE;
+}
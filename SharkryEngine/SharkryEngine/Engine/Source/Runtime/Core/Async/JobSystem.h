@@ -0,0 +1,172 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+/** Dispatch한 Job들이 모두 끝났는지 확인하는 카운터, Wait에 넘겨서 완료를 기다립니다. */
+class FJobCounter
+{
+public:
+    FJobCounter() = default;
+
+    FJobCounter(const FJobCounter&) = delete;
+    FJobCounter& operator=(const FJobCounter&) = delete;
+
+    bool IsDone() const { return NumPending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class FJobSystem;
+
+    std::atomic<int32> NumPending = 0;
+};
+
+/**
+ * Work Stealing 방식의 Job Scheduler
+ *
+ * 호출한 스레드(Game Thread)와 Worker 스레드가 각자 Job Queue를 가지고, 자기 Queue는 뒤에서부터 꺼내고
+ * 비어있으면 다른 스레드의 Queue 앞에서부터 훔쳐옵니다. Job이 오래 걸리는 스레드의 몫을 먼저 끝난 스레드가 가져가므로,
+ * Job마다 비용이 달라도 모든 스레드가 고르게 일합니다.
+ *
+ * Job은 함수 포인터와 Index 구간만 가지므로 Dispatch할 때 메모리를 할당하지 않습니다.
+ * Wait하는 스레드도 Job을 실행하므로, Job 안에서 다시 ParallelFor를 호출해도 교착되지 않습니다.
+ */
+class FJobSystem
+{
+public:
+    /** Job 함수, [BeginIndex, EndIndex) 구간을 처리합니다. */
+    using FJobFunction = void (*)(const void* Context, int32 BeginIndex, int32 EndIndex);
+
+    /** ParallelFor가 스레드 하나당 나누는 Batch 수, 많을수록 고르게 나눠지지만 Queue 접근이 늘어납니다. */
+    static constexpr int32 BatchesPerThread = 4;
+
+    FJobSystem() = default;
+    ~FJobSystem();
+
+    FJobSystem(const FJobSystem&) = delete;
+    FJobSystem& operator=(const FJobSystem&) = delete;
+
+    /**
+     * Worker 스레드를 생성합니다.
+     * @param InNumWorkers Worker 스레드 수, 음수라면 (논리 코어 수 - 1)개를 생성합니다. 0이면 모든 Job을 호출한 스레드에서 실행합니다.
+     */
+    void Initialize(int32 InNumWorkers = -1);
+
+    /** Queue에 남은 Job을 모두 실행한 뒤 Worker 스레드를 종료합니다. */
+    void Shutdown();
+
+    int32 GetNumWorkers() const { return NumWorkers; }
+
+    /** 호출한 스레드를 포함해서 Job을 실행하는 스레드 수 */
+    int32 GetNumThreads() const { return NumWorkers + 1; }
+
+    /** 현재 스레드가 Worker 스레드인지 확인합니다. */
+    static bool IsInWorkerThread();
+
+    /**
+     * [BeginIndex, EndIndex) 구간을 처리하는 Job 하나를 현재 스레드의 Queue에 넣습니다.
+     * Context는 Job이 끝날 때까지 유효해야 합니다.
+     */
+    void Dispatch(FJobFunction Function, const void* Context, int32 BeginIndex, int32 EndIndex, FJobCounter& Counter);
+
+    /** Counter의 Job이 모두 끝날 때까지 기다립니다. 기다리는 동안 Queue에 남은 Job을 대신 실행합니다. */
+    void Wait(FJobCounter& Counter);
+
+    /**
+     * [0, Num) 구간을 나눠 Body(BeginIndex, EndIndex)를 여러 스레드에서 실행하고, 모두 끝날 때까지 기다립니다.
+     * @param MinBatchSize Batch 하나에 들어가는 최소 Index 수, 처리 비용이 작을수록 크게 잡습니다.
+     */
+    template <typename FuncType>
+        requires std::is_invocable_v<const FuncType&, int32, int32>
+    void ParallelFor(int32 Num, int32 MinBatchSize, const FuncType& Body);
+
+private:
+    struct FJob
+    {
+        FJobFunction Function = nullptr;
+        const void* Context = nullptr;
+        int32 BeginIndex = 0;
+        int32 EndIndex = 0;
+        FJobCounter* Counter = nullptr;
+    };
+
+    /** 스레드 하나의 Job Queue, 주인은 뒤에서 꺼내고 다른 스레드는 앞에서 훔쳐갑니다. */
+    struct FJobQueue
+    {
+        std::mutex Mutex;
+
+        /** 원형 버퍼, 크기는 항상 2의 거듭제곱입니다. */
+        TArray<FJob> Jobs;
+        uint32 Head = 0;
+        uint32 Tail = 0;
+
+        void Push(const FJob& Job);
+        bool PopBack(FJob& OutJob);
+        bool PopFront(FJob& OutJob);
+    };
+
+    template <typename FuncType>
+    static void InvokeParallelForBody(const void* Context, int32 BeginIndex, int32 EndIndex)
+    {
+        (*static_cast<const FuncType*>(Context))(BeginIndex, EndIndex);
+    }
+
+    /** [0, Num)을 NumBatches개로 나눠 모든 스레드의 Queue에 고르게 넣습니다. */
+    void DispatchBatches(FJobFunction Function, const void* Context, int32 Num, int32 NumBatches, FJobCounter& Counter);
+
+    /** 자기 Queue에서 꺼내거나, 없으면 다른 Queue에서 훔쳐옵니다. */
+    bool TryGetJob(int32 QueueIndex, FJob& OutJob);
+
+    void ExecuteJob(const FJob& Job);
+
+    void WakeWorkers();
+
+    void WorkerMain(int32 QueueIndex);
+
+    /** 현재 스레드의 Queue Index, Worker가 아닌 스레드는 0번 Queue를 사용합니다. */
+    static int32 GetCurrentQueueIndex();
+
+private:
+    int32 NumWorkers = 0;
+
+    /** 0번은 Worker가 아닌 스레드의 Queue, 나머지는 Worker마다 하나씩 */
+    TArray<FJobQueue*> Queues;
+
+    TArray<std::thread> Workers;
+
+    /** 모든 Queue에 들어있는 Job 수, Worker가 잠들지 판단할 때 사용합니다. */
+    std::atomic<int32> NumQueuedJobs = 0;
+
+    std::mutex SleepMutex;
+    std::condition_variable SleepCondition;
+    std::atomic<bool> bStopping = false;
+};
+
+extern FJobSystem GJobSystem;
+
+
+template <typename FuncType>
+    requires std::is_invocable_v<const FuncType&, int32, int32>
+void FJobSystem::ParallelFor(int32 Num, int32 MinBatchSize, const FuncType& Body)
+{
+    if (Num <= 0)
+    {
+        return;
+    }
+
+    MinBatchSize = std::max(MinBatchSize, 1);
+    const int32 NumBatches = std::min((Num + MinBatchSize - 1) / MinBatchSize, GetNumThreads() * BatchesPerThread);
+    if (NumBatches <= 1 || NumWorkers == 0)
+    {
+        Body(0, Num);
+        return;
+    }
+
+    FJobCounter Counter;
+    DispatchBatches(&InvokeParallelForBody<FuncType>, &Body, Num, NumBatches, Counter);
+    Wait(Counter);
+}
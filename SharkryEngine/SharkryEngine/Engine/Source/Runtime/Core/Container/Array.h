@@ -104,6 +104,9 @@ public:
     /** Array의 Capacity를 가져옵니다. */
     SizeType Len() const;
 
+    /** Array가 할당한 메모리 크기(Byte)를 가져옵니다. */
+    size_t GetAllocatedSize() const;
+
 	/** Array의 Size를 Number로 설정합니다. */
 	void SetNum(SizeType Number);
 	void Empty(SizeType Number);
@@ -327,6 +330,12 @@ typename TArray<T, Allocator>::SizeType TArray<T, Allocator>::Len() const
     return ContainerPrivate.capacity();
 }
 
+template <typename T, typename Allocator>
+size_t TArray<T, Allocator>::GetAllocatedSize() const
+{
+    return ContainerPrivate.capacity() * sizeof(T);
+}
+
 template <typename T, typename Allocator>
 void TArray<T, Allocator>::SetNum(SizeType Number)
 {
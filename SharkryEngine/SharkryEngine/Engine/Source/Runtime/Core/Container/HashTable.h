@@ -0,0 +1,597 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <emmintrin.h>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "ContainerAllocator.h"
+#include "CoreMiscDefines.h"
+
+
+/**
+ * Hash Table의 Slot 상태를 나타내는 Control Byte
+ * 사용중인 Slot은 Hash의 하위 7bit(0 ~ 127)를 저장하고, 나머지 상태는 음수로 표현합니다.
+ */
+namespace EHashControl
+{
+enum Type : int8
+{
+    Empty = -128,
+    Deleted = -2,
+    /** Control 배열의 끝, 순회를 멈추는 용도 */
+    Sentinel = -1,
+};
+}
+
+
+/**
+ * std::hash는 포인터나 정수를 그대로 반환하는 경우가 많아서 상위 bit까지 고르게 섞어줍니다.
+ * 2의 거듭제곱 크기의 Table에서 하위 bit만 Index로 사용하기 전에 거칩니다.
+ */
+inline size_t MixHash(size_t InHash)
+{
+    uint64 Hash = static_cast<uint64>(InHash);
+    Hash ^= Hash >> 32;
+    Hash *= 0x9E3779B97F4A7C15ull;
+    Hash ^= Hash >> 29;
+    return static_cast<size_t>(Hash);
+}
+
+
+/** SSE2 레지스터 하나로 Control Byte 16개를 한 번에 비교합니다. */
+struct FHashControlGroup
+{
+    static constexpr int32 Width = 16;
+
+    explicit FHashControlGroup(const int8* InControl)
+        : Control(_mm_loadu_si128(reinterpret_cast<const __m128i*>(InControl)))
+    {
+    }
+
+    /** H2와 일치하는 Slot들의 Bit Mask */
+    uint32 Match(int8 H2) const
+    {
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(H2), Control)));
+    }
+
+    /** 비어있는 Slot들의 Bit Mask */
+    uint32 MatchEmpty() const
+    {
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(EHashControl::Empty), Control)));
+    }
+
+    /** 비어있거나 삭제된 Slot들의 Bit Mask, Sentinel보다 작은 값이 해당합니다. */
+    uint32 MatchEmptyOrDeleted() const
+    {
+        return static_cast<uint32>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(EHashControl::Sentinel), Control)));
+    }
+
+    /** 앞에서부터 연속으로 비어있거나 삭제된 Slot 수 */
+    uint32 CountLeadingEmptyOrDeleted() const
+    {
+        return static_cast<uint32>(std::countr_one(MatchEmptyOrDeleted()));
+    }
+
+    __m128i Control;
+};
+
+
+/**
+ * Open Addressing 방식의 Hash Table (Swiss Table)
+ *
+ * Element를 Node 없이 하나의 배열에 직접 저장하고, Slot마다 1Byte의 Control Byte를 둡니다.
+ * 탐색은 Control Byte 16개를 SSE2로 한 번에 비교한 뒤 후보 Slot의 Key만 비교하므로,
+ * std::unordered_map처럼 Node를 따라가는 포인터 추적이 없습니다.
+ *
+ * 삭제된 Slot은 Tombstone으로 남기므로 삭제가 다른 Element를 옮기지 않고,
+ * 순회 순서는 Rehash가 일어나기 전까지 유지됩니다.
+ *
+ * @tparam SlotType 저장할 Element 타입
+ * @tparam KeyFuncs ElementKeyType과 GetKey, GetKeyHash, Matches를 제공하는 타입
+ * @tparam Allocator 메모리 할당에 사용할 Allocator, uint8로 rebind해서 사용합니다.
+ *
+ * @note Element의 주소는 Rehash 시 바뀌므로, 삽입 이후에는 이전에 얻은 포인터를 사용하면 안됩니다.
+ */
+template <typename SlotType, typename KeyFuncs, typename Allocator = FDefaultAllocator<uint8>>
+class THashTable
+{
+public:
+    using KeyType = typename KeyFuncs::ElementKeyType;
+    using ByteAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<uint8>;
+
+    static_assert(alignof(SlotType) <= 16, "THashTable does not support over-aligned element types.");
+
+    /** 삽입 결과 */
+    struct FInsertResult
+    {
+        int32 Index;
+        SlotType* Element;
+        bool bInserted;
+    };
+
+    template <bool bConst>
+    class TIterator
+    {
+    public:
+        using ElementType = std::conditional_t<bConst, const SlotType, SlotType>;
+
+        TIterator() = default;
+        TIterator(const int8* InControl, ElementType* InSlot)
+            : Control(InControl), Slot(InSlot)
+        {
+            SkipEmptyOrDeleted();
+        }
+
+        ElementType& operator*() const { return *Slot; }
+        ElementType* operator->() const { return Slot; }
+
+        TIterator& operator++()
+        {
+            ++Control;
+            ++Slot;
+            SkipEmptyOrDeleted();
+            return *this;
+        }
+
+        bool operator==(const TIterator& Other) const { return Control == Other.Control; }
+        bool operator!=(const TIterator& Other) const { return Control != Other.Control; }
+
+    private:
+        void SkipEmptyOrDeleted()
+        {
+            if (!Control)
+            {
+                return;
+            }
+
+            // Sentinel은 Empty/Deleted가 아니므로 배열 끝에서 멈춥니다.
+            while (*Control < EHashControl::Sentinel)
+            {
+                const uint32 Shift = FHashControlGroup(Control).CountLeadingEmptyOrDeleted();
+                Control += Shift;
+                Slot += Shift;
+            }
+        }
+
+        const int8* Control = nullptr;
+        ElementType* Slot = nullptr;
+    };
+
+    using Iterator = TIterator<false>;
+    using ConstIterator = TIterator<true>;
+
+public:
+    THashTable() = default;
+
+    THashTable(const THashTable& Other)
+    {
+        CopyFrom(Other);
+    }
+
+    THashTable(THashTable&& Other) noexcept
+        : Control(std::exchange(Other.Control, nullptr))
+        , Slots(std::exchange(Other.Slots, nullptr))
+        , Capacity(std::exchange(Other.Capacity, 0))
+        , Size(std::exchange(Other.Size, 0))
+        , GrowthLeft(std::exchange(Other.GrowthLeft, 0))
+    {
+    }
+
+    THashTable& operator=(const THashTable& Other)
+    {
+        if (this != &Other)
+        {
+            DestroyAndFree();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    THashTable& operator=(THashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAndFree();
+            Control = std::exchange(Other.Control, nullptr);
+            Slots = std::exchange(Other.Slots, nullptr);
+            Capacity = std::exchange(Other.Capacity, 0);
+            Size = std::exchange(Other.Size, 0);
+            GrowthLeft = std::exchange(Other.GrowthLeft, 0);
+        }
+        return *this;
+    }
+
+    ~THashTable()
+    {
+        DestroyAndFree();
+    }
+
+public:
+    Iterator begin() noexcept { return Iterator(Control, Slots); }
+    Iterator end() noexcept { return Iterator(Control ? Control + Capacity : nullptr, nullptr); }
+    ConstIterator begin() const noexcept { return ConstIterator(Control, Slots); }
+    ConstIterator end() const noexcept { return ConstIterator(Control ? Control + Capacity : nullptr, nullptr); }
+
+    /** Find로 얻은 Element를 가리키는 Iterator를 만듭니다. */
+    Iterator CreateIterator(SlotType* Element) noexcept { return Iterator(Control + (Element - Slots), Element); }
+    ConstIterator CreateIterator(const SlotType* Element) const noexcept { return ConstIterator(Control + (Element - Slots), Element); }
+
+    int32 Num() const { return Size; }
+    bool IsEmpty() const { return Size == 0; }
+
+    /** 할당된 Slot 수 */
+    int32 GetCapacity() const { return Capacity; }
+
+    /** Table이 할당한 메모리 크기(Byte) */
+    size_t GetAllocatedSize() const { return Capacity > 0 ? GetAllocationLayout(Capacity).TotalSize : 0; }
+
+    SlotType* Find(const KeyType& Key)
+    {
+        const int32 Index = FindIndex(Key, HashKey(Key));
+        return Index != INDEX_NONE ? &Slots[Index] : nullptr;
+    }
+
+    const SlotType* Find(const KeyType& Key) const
+    {
+        const int32 Index = FindIndex(Key, HashKey(Key));
+        return Index != INDEX_NONE ? &Slots[Index] : nullptr;
+    }
+
+    bool Contains(const KeyType& Key) const
+    {
+        return FindIndex(Key, HashKey(Key)) != INDEX_NONE;
+    }
+
+    /**
+     * Key가 없을 때만 Args로 Element를 생성해서 삽입합니다.
+     * @return Key에 해당하는 Element와 새로 삽입 되었는지 여부
+     */
+    template <typename... ArgsType>
+    FInsertResult FindOrEmplace(const KeyType& Key, ArgsType&&... Args)
+    {
+        const size_t Hash = HashKey(Key);
+
+        const int32 ExistingIndex = FindIndex(Key, Hash);
+        if (ExistingIndex != INDEX_NONE)
+        {
+            return { ExistingIndex, &Slots[ExistingIndex], false };
+        }
+
+        const int32 Index = PrepareInsert(Hash);
+        SlotType* Element = new (&Slots[Index]) SlotType(std::forward<ArgsType>(Args)...);
+        return { Index, Element, true };
+    }
+
+    /** Key에 해당하는 Element를 제거합니다. */
+    bool Remove(const KeyType& Key)
+    {
+        const int32 Index = FindIndex(Key, HashKey(Key));
+        if (Index == INDEX_NONE)
+        {
+            return false;
+        }
+
+        EraseAt(Index);
+        return true;
+    }
+
+    /** 모든 Element를 제거합니다. 할당된 메모리는 유지합니다. */
+    void Empty()
+    {
+        if (Capacity == 0)
+        {
+            return;
+        }
+
+        DestroyElements();
+        ResetControl();
+        Size = 0;
+        GrowthLeft = CapacityToGrowth(Capacity);
+    }
+
+    /** 모든 Element를 제거하고, Number개를 Rehash 없이 담을 수 있도록 공간을 확보합니다. */
+    void Empty(int32 Number)
+    {
+        Empty();
+        Reserve(Number);
+    }
+
+    /** Number개의 Element를 Rehash 없이 담을 수 있도록 공간을 확보합니다. */
+    void Reserve(int32 Number)
+    {
+        if (Number > Size + GrowthLeft)
+        {
+            Resize(NormalizeCapacity(GrowthToLowerBoundCapacity(Number)));
+        }
+    }
+
+private:
+    /** 첫 할당 시의 Capacity, Group 하나 크기 */
+    static constexpr int32 MinCapacity = FHashControlGroup::Width - 1;
+    static constexpr int32 NumClonedBytes = FHashControlGroup::Width - 1;
+
+    /** Group 단위로 증가하는 삼각수 탐색 순서, 2의 거듭제곱 크기에서 모든 Group을 한 번씩 방문합니다. */
+    struct FProbeSequence
+    {
+        FProbeSequence(size_t Hash, int32 InMask)
+            : Mask(static_cast<size_t>(InMask)), Offset(Hash & static_cast<size_t>(InMask))
+        {
+        }
+
+        size_t GetOffset(uint32 GroupIndex) const { return (Offset + GroupIndex) & Mask; }
+
+        void Next()
+        {
+            Index += FHashControlGroup::Width;
+            Offset = (Offset + Index) & Mask;
+        }
+
+        size_t Mask;
+        size_t Offset;
+        size_t Index = 0;
+    };
+
+    struct FAllocationLayout
+    {
+        size_t SlotOffset;
+        size_t TotalSize;
+    };
+
+    static size_t HashKey(const KeyType& Key)
+    {
+        return MixHash(KeyFuncs::GetKeyHash(Key));
+    }
+
+    static size_t H1(size_t Hash) { return Hash >> 7; }
+    static int8 H2(size_t Hash) { return static_cast<int8>(Hash & 0x7F); }
+
+    /** 최대 Load Factor 7/8 */
+    static int32 CapacityToGrowth(int32 InCapacity) { return InCapacity - InCapacity / 8; }
+    static int32 GrowthToLowerBoundCapacity(int32 Growth) { return Growth + (Growth - 1) / 7; }
+
+    /** 2^N - 1 형태의 Capacity로 맞춥니다. */
+    static int32 NormalizeCapacity(int32 InCapacity)
+    {
+        const uint32 Required = static_cast<uint32>(std::max(InCapacity, MinCapacity));
+        return static_cast<int32>(std::bit_ceil(Required + 1) - 1);
+    }
+
+    static FAllocationLayout GetAllocationLayout(int32 InCapacity)
+    {
+        const size_t ControlSize = static_cast<size_t>(InCapacity) + 1 + NumClonedBytes;
+        const size_t SlotOffset = (ControlSize + alignof(SlotType) - 1) & ~(alignof(SlotType) - 1);
+        return { SlotOffset, SlotOffset + sizeof(SlotType) * static_cast<size_t>(InCapacity) };
+    }
+
+    int32 FindIndex(const KeyType& Key, size_t Hash) const
+    {
+        if (Capacity == 0)
+        {
+            return INDEX_NONE;
+        }
+
+        const int8 HashH2 = H2(Hash);
+        FProbeSequence Sequence(H1(Hash), Capacity);
+        while (true)
+        {
+            const FHashControlGroup Group(Control + Sequence.Offset);
+            for (uint32 Mask = Group.Match(HashH2); Mask != 0; Mask &= Mask - 1)
+            {
+                const size_t Index = Sequence.GetOffset(std::countr_zero(Mask));
+                if (KeyFuncs::Matches(KeyFuncs::GetKey(Slots[Index]), Key))
+                {
+                    return static_cast<int32>(Index);
+                }
+            }
+
+            // 빈 Slot이 있는 Group에서 찾지 못했다면 더 이상 탐색할 필요가 없습니다.
+            if (Group.MatchEmpty() != 0)
+            {
+                return INDEX_NONE;
+            }
+
+            Sequence.Next();
+        }
+    }
+
+    int32 FindFirstNonFull(size_t Hash) const
+    {
+        FProbeSequence Sequence(H1(Hash), Capacity);
+        while (true)
+        {
+            const uint32 Mask = FHashControlGroup(Control + Sequence.Offset).MatchEmptyOrDeleted();
+            if (Mask != 0)
+            {
+                return static_cast<int32>(Sequence.GetOffset(std::countr_zero(Mask)));
+            }
+            Sequence.Next();
+        }
+    }
+
+    /** Hash가 들어갈 Slot을 확보하고 Control Byte를 기록합니다. Element 생성은 호출자가 합니다. */
+    int32 PrepareInsert(size_t Hash)
+    {
+        int32 Target = Capacity > 0 ? FindFirstNonFull(Hash) : INDEX_NONE;
+
+        // Tombstone을 재사용하는 경우에는 여유 공간이 줄어들지 않습니다.
+        if (Target == INDEX_NONE || (GrowthLeft == 0 && Control[Target] != EHashControl::Deleted))
+        {
+            RehashAndGrowIfNecessary();
+            Target = FindFirstNonFull(Hash);
+        }
+
+        ++Size;
+        GrowthLeft -= Control[Target] == EHashControl::Empty ? 1 : 0;
+        SetControl(Target, H2(Hash));
+        return Target;
+    }
+
+    void EraseAt(int32 Index)
+    {
+        std::destroy_at(&Slots[Index]);
+        --Size;
+
+        // 이 Slot 주변에 Group 크기만큼 연속으로 찬 구간이 없었다면, 어떤 탐색도 이 Slot을 지나쳐 가지 않았으므로 Empty로 되돌립니다.
+        const int32 IndexBefore = (Index - FHashControlGroup::Width) & Capacity;
+        const uint32 EmptyAfter = FHashControlGroup(Control + Index).MatchEmpty();
+        const uint32 EmptyBefore = FHashControlGroup(Control + IndexBefore).MatchEmpty();
+        const bool bWasNeverFull = EmptyBefore != 0 && EmptyAfter != 0
+            && std::countr_zero(EmptyAfter) + std::countl_zero(static_cast<uint16>(EmptyBefore)) < FHashControlGroup::Width;
+
+        if (bWasNeverFull)
+        {
+            SetControl(Index, EHashControl::Empty);
+            ++GrowthLeft;
+        }
+        else
+        {
+            SetControl(Index, EHashControl::Deleted);
+        }
+    }
+
+    void RehashAndGrowIfNecessary()
+    {
+        if (Capacity == 0)
+        {
+            Resize(MinCapacity);
+        }
+        else if (Size <= CapacityToGrowth(Capacity) / 2)
+        {
+            // Tombstone이 대부분이라면 크기를 유지한 채로 정리만 합니다.
+            Resize(Capacity);
+        }
+        else
+        {
+            Resize(Capacity * 2 + 1);
+        }
+    }
+
+    void Resize(int32 NewCapacity)
+    {
+        int8* OldControl = Control;
+        SlotType* OldSlots = Slots;
+        const int32 OldCapacity = Capacity;
+
+        Allocate(NewCapacity);
+
+        for (int32 Index = 0; Index < OldCapacity; ++Index)
+        {
+            if (OldControl[Index] >= 0)
+            {
+                SlotType& OldSlot = OldSlots[Index];
+                const size_t Hash = HashKey(KeyFuncs::GetKey(OldSlot));
+                const int32 Target = FindFirstNonFull(Hash);
+                SetControl(Target, H2(Hash));
+                new (&Slots[Target]) SlotType(std::move(OldSlot));
+                std::destroy_at(&OldSlot);
+            }
+        }
+
+        GrowthLeft = CapacityToGrowth(Capacity) - Size;
+
+        if (OldCapacity > 0)
+        {
+            Deallocate(OldControl, OldCapacity);
+        }
+    }
+
+    /** Capacity 크기의 빈 Table을 할당합니다. Size는 변경하지 않습니다. */
+    void Allocate(int32 NewCapacity)
+    {
+        const FAllocationLayout Layout = GetAllocationLayout(NewCapacity);
+
+        ByteAllocator Alloc;
+        uint8* Memory = Alloc.allocate(Layout.TotalSize);
+
+        Control = reinterpret_cast<int8*>(Memory);
+        Slots = reinterpret_cast<SlotType*>(Memory + Layout.SlotOffset);
+        Capacity = NewCapacity;
+        ResetControl();
+    }
+
+    void Deallocate(int8* InControl, int32 InCapacity)
+    {
+        ByteAllocator Alloc;
+        Alloc.deallocate(reinterpret_cast<uint8*>(InControl), GetAllocationLayout(InCapacity).TotalSize);
+    }
+
+    void ResetControl()
+    {
+        std::memset(Control, EHashControl::Empty, static_cast<size_t>(Capacity) + 1 + NumClonedBytes);
+        Control[Capacity] = EHashControl::Sentinel;
+    }
+
+    /** Control Byte를 기록하고, 배열 끝에서 Group을 읽을 수 있도록 앞쪽 Byte의 복제본도 함께 갱신합니다. */
+    void SetControl(int32 Index, int8 Value)
+    {
+        Control[Index] = Value;
+        Control[((Index - NumClonedBytes) & Capacity) + (NumClonedBytes & Capacity)] = Value;
+    }
+
+    void DestroyElements()
+    {
+        if constexpr (!std::is_trivially_destructible_v<SlotType>)
+        {
+            for (int32 Index = 0; Index < Capacity; ++Index)
+            {
+                if (Control[Index] >= 0)
+                {
+                    std::destroy_at(&Slots[Index]);
+                }
+            }
+        }
+    }
+
+    void DestroyAndFree()
+    {
+        if (Capacity > 0)
+        {
+            DestroyElements();
+            Deallocate(Control, Capacity);
+        }
+
+        Control = nullptr;
+        Slots = nullptr;
+        Capacity = 0;
+        Size = 0;
+        GrowthLeft = 0;
+    }
+
+    /** 같은 Capacity로 할당해서 Control Byte와 Element를 그대로 복사하므로 순회 순서도 같습니다. */
+    void CopyFrom(const THashTable& Other)
+    {
+        if (Other.Capacity == 0)
+        {
+            return;
+        }
+
+        Allocate(Other.Capacity);
+        std::memcpy(Control, Other.Control, static_cast<size_t>(Capacity) + 1 + NumClonedBytes);
+
+        for (int32 Index = 0; Index < Capacity; ++Index)
+        {
+            if (Control[Index] >= 0)
+            {
+                new (&Slots[Index]) SlotType(Other.Slots[Index]);
+            }
+        }
+
+        Size = Other.Size;
+        GrowthLeft = Other.GrowthLeft;
+    }
+
+private:
+    int8* Control = nullptr;
+    SlotType* Slots = nullptr;
+
+    /** 2^N - 1, 할당되지 않았다면 0 */
+    int32 Capacity = 0;
+    int32 Size = 0;
+
+    /** Rehash 없이 더 삽입할 수 있는 Element 수 */
+    int32 GrowthLeft = 0;
+};
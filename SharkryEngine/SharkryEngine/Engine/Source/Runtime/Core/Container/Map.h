@@ -1,29 +1,64 @@
 #pragma once
-#include <unordered_map>
+#include <cassert>
 #include "Container/Array.h"
 #include "ContainerAllocator.h"
+#include "HashTable.h"
 #include "Pair.h"
 #include "Serialization/Archive.h"
 
 
+/**
+ * Key-Value 쌍을 THashTable(Swiss Table)에 직접 저장하는 Map
+ *
+ * @note Value는 Node 없이 Table 배열에 들어있으므로, Add/Emplace/FindOrAdd/operator[]로 새 Key가 삽입되어
+ *       Rehash가 일어나면 모든 Value의 주소가 바뀝니다.
+ *       Find/operator[]로 얻은 포인터나 참조, Iterator는 다음 삽입 전까지만 사용하고, 오래 들고 있어야 한다면
+ *       Key를 다시 찾거나 Reserve로 Rehash가 일어나지 않도록 미리 공간을 확보해야 합니다.
+ *       이미 있는 Key에 대한 Add와 Remove는 다른 Value를 옮기지 않습니다.
+ */
 template <typename KeyType, typename ValueType, typename Allocator = FDefaultAllocator<std::pair<const KeyType, ValueType>>>
 class TMap
 {
 public:
     using PairType = TPair<const KeyType, ValueType>;
-    using MapType = std::unordered_map<KeyType, ValueType, std::hash<KeyType>, std::equal_to<KeyType>, Allocator>;
-    using SizeType = typename MapType::size_type;
+    using SizeType = typename std::allocator_traits<Allocator>::size_type;
 
 private:
-    MapType ContainerPrivate;
+    /** Table에 실제로 저장되는 Element, Rehash 시 Key를 이동할 수 있도록 const를 붙이지 않고 PairType과 같은 배치를 사용합니다. */
+    struct FElement
+    {
+        template <typename InitKeyType, typename... InitValueTypes>
+            requires (!std::is_same_v<std::decay_t<InitKeyType>, FElement>)
+        FElement(InitKeyType&& InKey, InitValueTypes&&... InValue)
+            : Key(std::forward<InitKeyType>(InKey))
+            , Value(std::forward<InitValueTypes>(InValue)...)
+        {
+        }
+
+        KeyType Key;
+        ValueType Value;
+    };
+
+    struct FKeyFuncs
+    {
+        using ElementKeyType = KeyType;
+
+        static const KeyType& GetKey(const FElement& Element) { return Element.Key; }
+        static size_t GetKeyHash(const KeyType& Key) { return std::hash<KeyType>{}(Key); }
+        static bool Matches(const KeyType& A, const KeyType& B) { return A == B; }
+    };
+
+    using HashTableType = THashTable<FElement, FKeyFuncs, Allocator>;
+
+    HashTableType ContainerPrivate;
 
 public:
     class Iterator
     {
     private:
-        typename MapType::iterator InnerIt;
+        typename HashTableType::Iterator InnerIt;
     public:
-        Iterator(typename MapType::iterator it) : InnerIt(std::move(it)) {}
+        Iterator(typename HashTableType::Iterator it) : InnerIt(std::move(it)) {}
         PairType& operator*() { return reinterpret_cast<PairType&>(*InnerIt); }
         PairType* operator->() { return reinterpret_cast<PairType*>(&(*InnerIt)); }
         Iterator& operator++() { ++InnerIt; return *this; }
@@ -33,9 +68,9 @@ public:
     class ConstIterator
     {
     private:
-        typename MapType::const_iterator InnerIt;
+        typename HashTableType::ConstIterator InnerIt;
     public:
-        ConstIterator(typename MapType::const_iterator it) : InnerIt(it) {}
+        ConstIterator(typename HashTableType::ConstIterator it) : InnerIt(it) {}
         const PairType& operator*() const { return reinterpret_cast<const PairType&>(*InnerIt); }
         const PairType* operator->() const { return reinterpret_cast<const PairType*>(&(*InnerIt)); }
         ConstIterator& operator++() { ++InnerIt; return *this; }
@@ -49,9 +84,6 @@ public:
     ConstIterator begin() const noexcept { return ConstIterator(ContainerPrivate.begin()); }
     ConstIterator end() const noexcept { return ConstIterator(ContainerPrivate.end()); }
 
-    MapType& GetContainerPrivate() { return ContainerPrivate; }
-    const MapType& GetContainerPrivate() const { return ContainerPrivate; }
-
     // 생성자 및 소멸자
     TMap() = default;
     ~TMap() = default;
@@ -85,17 +117,23 @@ public:
     // 요소 접근 및 수정
     ValueType& operator[](const KeyType& Key)
     {
-        return ContainerPrivate[Key];
+        return ContainerPrivate.FindOrEmplace(Key, Key).Element->Value;
     }
 
     const ValueType& operator[](const KeyType& Key) const
     {
-        return ContainerPrivate.at(Key);
+        const ValueType* Value = Find(Key);
+        assert(Value && "TMap::operator[] const: Key not found");
+        return *Value;
     }
 
     void Add(const KeyType& Key, const ValueType& Value)
     {
-        ContainerPrivate.insert_or_assign(Key, Value);
+        auto Result = ContainerPrivate.FindOrEmplace(Key, Key, Value);
+        if (!Result.bInserted)
+        {
+            Result.Element->Value = Value;
+        }
     }
 
     /**
@@ -107,86 +145,100 @@ public:
     template <typename InitKeyType = KeyType, typename InitValueType = ValueType>
     ValueType& Emplace(InitKeyType&& InKey, InitValueType&& InValue)
     {
-        auto result = ContainerPrivate.emplace(std::forward<InitKeyType>(InKey), std::forward<InitValueType>(InValue));
-    	return result.first->second;
+        if constexpr (std::is_same_v<std::decay_t<InitKeyType>, KeyType>)
+        {
+            return ContainerPrivate.FindOrEmplace(InKey, std::forward<InitKeyType>(InKey), std::forward<InitValueType>(InValue)).Element->Value;
+        }
+        else
+        {
+            KeyType Key(std::forward<InitKeyType>(InKey));
+            return ContainerPrivate.FindOrEmplace(Key, std::move(Key), std::forward<InitValueType>(InValue)).Element->Value;
+        }
     }
 
 	// Key만 넣고, Value는 기본값으로 삽입
 	template <typename InitKeyType = KeyType>
     ValueType& Emplace(InitKeyType&& InKey)
     {
-        auto result = ContainerPrivate.emplace(std::forward<InitKeyType>(InKey), ValueType{});
-    	return result.first->second;
+        if constexpr (std::is_same_v<std::decay_t<InitKeyType>, KeyType>)
+        {
+            return ContainerPrivate.FindOrEmplace(InKey, std::forward<InitKeyType>(InKey)).Element->Value;
+        }
+        else
+        {
+            KeyType Key(std::forward<InitKeyType>(InKey));
+            return ContainerPrivate.FindOrEmplace(Key, std::move(Key)).Element->Value;
+        }
     }
 
     void Remove(const KeyType& Key)
     {
-        ContainerPrivate.erase(Key);
+        ContainerPrivate.Remove(Key);
     }
 
     void Empty()
     {
-        ContainerPrivate.clear();
+        ContainerPrivate.Empty();
     }
 
     void Empty(SizeType Number)
     {
-        ContainerPrivate.clear();
-        ContainerPrivate.reserve(Number);
+        ContainerPrivate.Empty(static_cast<int32>(Number));
     }
 
     // 검색 및 조회
     bool Contains(const KeyType& Key) const
     {
-        return ContainerPrivate.contains(Key);
+        return ContainerPrivate.Contains(Key);
     }
 
     const ValueType* Find(const KeyType& Key) const
     {
-        auto it = ContainerPrivate.find(Key);
-        return it != ContainerPrivate.end() ? &(it->second) : nullptr;
+        const FElement* Element = ContainerPrivate.Find(Key);
+        return Element ? &Element->Value : nullptr;
     }
 
     ValueType* Find(const KeyType& Key)
     {
-        auto it = ContainerPrivate.find(Key);
-        return it != ContainerPrivate.end() ? &(it->second) : nullptr;
+        FElement* Element = ContainerPrivate.Find(Key);
+        return Element ? &Element->Value : nullptr;
     }
 
     ValueType& FindOrAdd(const KeyType& Key)
     {
-        if (ValueType* Value = Find(Key))
-        {
-            return *Value;
-        }
-        return Emplace(Key);
+        return ContainerPrivate.FindOrEmplace(Key, Key).Element->Value;
     }
 
     // 크기 관련
     SizeType Num() const
     {
-        return ContainerPrivate.size();
+        return static_cast<SizeType>(ContainerPrivate.Num());
     }
 
     bool IsEmpty() const
     {
-        return ContainerPrivate.empty();
+        return ContainerPrivate.IsEmpty();
     }
 
     // 용량 관련
     void Reserve(SizeType Number)
     {
-        ContainerPrivate.reserve(Number);
+        ContainerPrivate.Reserve(static_cast<int32>(Number));
     }
     void GetKeys(TArray<KeyType>& OutKeys) const
     {
-        OutKeys.Empty(ContainerPrivate.size()); // 배열을 비우고 필요한 만큼 예약
-        OutKeys.Reserve(ContainerPrivate.size()); // 용량 확보 (TArray 구현에 따라 필요 없을 수 있음)
-        for (const auto& Pair : ContainerPrivate) // 내부 std::unordered_map 순회
+        OutKeys.Empty(ContainerPrivate.Num()); // 배열을 비우고 필요한 만큼 예약
+        for (const FElement& Element : ContainerPrivate)
         {
-            OutKeys.Add(Pair.first); // 각 요소의 키(first)를 TArray에 추가
+            OutKeys.Add(Element.Key);
         }
     }
+
+    /** Table이 할당한 메모리 크기(Byte) */
+    size_t GetAllocatedSize() const
+    {
+        return ContainerPrivate.GetAllocatedSize();
+    }
 };
 
 template <typename KeyType, typename ValueType, typename Allocator>
@@ -1,35 +1,75 @@
 ﻿#pragma once
-#include <unordered_set>
+#include <bit>
+#include <utility>
 
 #include "Array.h"
 #include "ContainerAllocator.h"
+#include "HashTable.h"
+#include "SparseArray.h"
 
 
+/**
+ * 중복 없는 Element 집합
+ *
+ * Element는 TSparseArray에 저장하고, Hash Bucket은 Element Index의 연결 리스트로 구성합니다.
+ * Add가 반환한 Index는 해당 Element가 제거될 때까지 바뀌지 않으므로, 직접 접근이나 제거에 사용할 수 있습니다.
+ */
 template <typename T, typename Hasher = std::hash<T>, typename Allocator = FDefaultAllocator<T>>
 class TSet
 {
 private:
-    using SetType = std::unordered_set<T, Hasher, std::equal_to<>, Allocator>;
     using ElementType = T;
 
-    SetType ContainerPrivate;
+    struct FSetElement
+    {
+        template <typename InitType>
+            requires (!std::is_same_v<std::decay_t<InitType>, FSetElement>)
+        explicit FSetElement(InitType&& InValue)
+            : Value(std::forward<InitType>(InValue))
+        {
+        }
+
+        T Value;
+
+        /** 같은 Bucket에 있는 다음 Element의 Index */
+        int32 HashNextId = INDEX_NONE;
+    };
+
+    using ElementArrayType = TSparseArray<FSetElement, typename std::allocator_traits<Allocator>::template rebind_alloc<FSetElement>>;
+
+    /** Bucket 수의 최솟값, 항상 2의 거듭제곱을 유지합니다. */
+    static constexpr int32 MinHashSize = 8;
 
 public:
     using SizeType = typename Allocator::SizeType;
-    using Iterator = typename SetType::iterator;
-    using ConstIterator = typename SetType::const_iterator;
 
-    SetType& GetContainerPrivate() { return ContainerPrivate; }
-    const SetType& GetContainerPrivate() const { return ContainerPrivate; }
+    /** Element는 Hash Key이므로 Iterator로 수정할 수 없습니다. */
+    class ConstIterator
+    {
+    public:
+        ConstIterator(typename ElementArrayType::ConstIterator InIt) : InnerIt(InIt) {}
+
+        const T& operator*() const { return (*InnerIt).Value; }
+        const T* operator->() const { return &(*InnerIt).Value; }
+        ConstIterator& operator++() { ++InnerIt; return *this; }
+        bool operator==(const ConstIterator& Other) const { return InnerIt == Other.InnerIt; }
+        bool operator!=(const ConstIterator& Other) const { return InnerIt != Other.InnerIt; }
+
+        /** 현재 Element의 Index */
+        int32 GetIndex() const { return InnerIt.GetIndex(); }
+
+    private:
+        typename ElementArrayType::ConstIterator InnerIt;
+    };
+
+    using Iterator = ConstIterator;
 
     // 기본 생성자
     TSet() = default;
 
     // Iterator 관련 메서드
-    Iterator begin() noexcept { return ContainerPrivate.begin(); }
-    Iterator end() noexcept { return ContainerPrivate.end(); }
-    ConstIterator begin() const noexcept { return ContainerPrivate.begin(); }
-    ConstIterator end() const noexcept { return ContainerPrivate.end(); }
+    ConstIterator begin() const noexcept { return ConstIterator(Elements.begin()); }
+    ConstIterator end() const noexcept { return ConstIterator(Elements.end()); }
 
     // Add
     int32 Add(const T& Item) { return Emplace(Item); }
@@ -44,45 +84,199 @@ public:
     template<typename ArgsType = T>
     int32 Emplace(ArgsType&& Args) 
     { 
-        auto iter = ContainerPrivate.emplace(std::forward<ArgsType>(Args));
-    	return std::distance(ContainerPrivate.begin(), iter.first);
+        if constexpr (std::is_same_v<std::decay_t<ArgsType>, T>)
+        {
+            return EmplaceUnique(GetKeyHash(Args), std::forward<ArgsType>(Args));
+        }
+        else
+        {
+            T Item(std::forward<ArgsType>(Args));
+            return EmplaceUnique(GetKeyHash(Item), std::move(Item));
+        }
     }
 
     // Num (개수)
-    SizeType Num() const { return static_cast<SizeType>(ContainerPrivate.size()); }
+    SizeType Num() const { return static_cast<SizeType>(Elements.Num()); }
 
     // Find
-    Iterator Find(const T& Item) { return ContainerPrivate.find(Item); }
-    ConstIterator Find(const T& Item) const { return ContainerPrivate.find(Item); }
+    ConstIterator Find(const T& Item) const
+    {
+        const int32 Index = FindId(Item);
+        return Index != INDEX_NONE ? ConstIterator(Elements.CreateIterator(Index)) : end();
+    }
+
+    /**
+     * Item의 Index를 찾습니다.
+     * @return Item의 Index, 없다면 INDEX_NONE
+     */
+    int32 FindId(const T& Item) const
+    {
+        if (Hash.IsEmpty())
+        {
+            return INDEX_NONE;
+        }
+
+        for (int32 Index = GetBucket(GetKeyHash(Item)); Index != INDEX_NONE; Index = Elements[Index].HashNextId)
+        {
+            if (Elements[Index].Value == Item)
+            {
+                return Index;
+            }
+        }
+        return INDEX_NONE;
+    }
 
 	// Contains
-	bool Contains(const T& Item) const { return ContainerPrivate.contains(Item); }
+	bool Contains(const T& Item) const { return FindId(Item) != INDEX_NONE; }
+
+    /** Add가 반환한 Index로 Element에 접근합니다. */
+    const T& operator[](int32 Index) const { return Elements[Index].Value; }
+
+    /** Index가 사용중인 Element를 가리키는지 확인합니다. */
+    bool IsValidIndex(int32 Index) const { return Elements.IsValidIndex(Index); }
+
+    /** 지금까지 사용된 가장 큰 Index + 1 */
+    int32 GetMaxIndex() const { return Elements.GetMaxIndex(); }
 
     // Array (TArray로 반환)
     TArray<T, Allocator> Array() const
     {
         TArray<T, Allocator> Result;
         Result.Reserve(Num());
-        for (const auto& Item : ContainerPrivate)
+        for (const FSetElement& Element : Elements)
         {
-            Result.Add(Item);
+            Result.Add(Element.Value);
         }
         return Result;
     }
 
     // Remove
-    SizeType Remove(const T& Item) { return static_cast<SizeType>(ContainerPrivate.erase(Item)); }
+    SizeType Remove(const T& Item)
+    {
+        const int32 Index = FindId(Item);
+        if (Index == INDEX_NONE)
+        {
+            return 0;
+        }
+
+        RemoveAt(Index);
+        return 1;
+    }
+
+    /** Index의 Element를 제거합니다. 다른 Element의 Index는 바뀌지 않습니다. */
+    void RemoveAt(int32 Index)
+    {
+        // Bucket의 연결 리스트에서 Index를 떼어냅니다.
+        int32* Link = &GetBucket(GetKeyHash(Elements[Index].Value));
+        while (*Link != Index)
+        {
+            Link = &Elements[*Link].HashNextId;
+        }
+        *Link = Elements[Index].HashNextId;
+
+        Elements.RemoveAt(Index);
+    }
 
     // Empty
-    void Empty() { ContainerPrivate.clear(); }
+    void Empty()
+    {
+        Elements.Empty();
+        Hash.Empty();
+    }
+
     void Empty(SizeType Number)
     {
-        ContainerPrivate.clear();
-        ContainerPrivate.reserve(Number);
+        Empty();
+        Reserve(Number);
+    }
+
+    /** Number개의 Element를 재할당 없이 담을 수 있도록 공간을 확보합니다. */
+    void Reserve(SizeType Number)
+    {
+        Elements.Reserve(static_cast<int32>(Number));
+        if (GetDesiredHashSize(static_cast<int32>(Number)) > static_cast<int32>(Hash.Num()))
+        {
+            Rehash(GetDesiredHashSize(static_cast<int32>(Number)));
+        }
     }
 
     // IsEmpty
-    bool IsEmpty() const { return ContainerPrivate.empty(); }
+    bool IsEmpty() const { return Elements.IsEmpty(); }
+
+    /** Set이 할당한 메모리 크기(Byte) */
+    size_t GetAllocatedSize() const { return Elements.GetAllocatedSize() + Hash.GetAllocatedSize(); }
+
+private:
+    static size_t GetKeyHash(const T& Item)
+    {
+        return MixHash(Hasher{}(Item));
+    }
+
+    /** Element 수 이상인 가장 작은 2의 거듭제곱, Bucket당 평균 Element 수가 1 이하가 됩니다. */
+    static int32 GetDesiredHashSize(int32 NumElements)
+    {
+        return static_cast<int32>(std::bit_ceil(static_cast<uint32>(std::max(NumElements, MinHashSize))));
+    }
+
+    int32& GetBucket(size_t KeyHash)
+    {
+        return Hash[static_cast<int32>(KeyHash & (Hash.Num() - 1))];
+    }
+
+    int32 GetBucket(size_t KeyHash) const
+    {
+        return Hash[static_cast<int32>(KeyHash & (Hash.Num() - 1))];
+    }
+
+    template <typename InitType>
+    int32 EmplaceUnique(size_t KeyHash, InitType&& Item)
+    {
+        if (!Hash.IsEmpty())
+        {
+            for (int32 Index = GetBucket(KeyHash); Index != INDEX_NONE; Index = Elements[Index].HashNextId)
+            {
+                if (Elements[Index].Value == Item)
+                {
+                    return Index;
+                }
+            }
+        }
+
+        const int32 Index = Elements.Emplace(std::forward<InitType>(Item));
+        if (GetDesiredHashSize(Elements.Num()) > static_cast<int32>(Hash.Num()))
+        {
+            // 새 Element도 함께 연결됩니다.
+            Rehash(GetDesiredHashSize(Elements.Num()));
+        }
+        else
+        {
+            int32& Bucket = GetBucket(KeyHash);
+            Elements[Index].HashNextId = Bucket;
+            Bucket = Index;
+        }
+        return Index;
+    }
+
+    /** Bucket 수를 바꾸고 모든 Element를 다시 연결합니다. Element의 Index는 그대로 유지됩니다. */
+    void Rehash(int32 NewHashSize)
+    {
+        Hash.Empty(NewHashSize);
+        Hash.SetNum(NewHashSize);
+        std::fill_n(Hash.GetData(), NewHashSize, static_cast<int32>(INDEX_NONE));
+
+        for (auto It = Elements.begin(); It != Elements.end(); ++It)
+        {
+            int32& Bucket = GetBucket(GetKeyHash(It->Value));
+            It->HashNextId = Bucket;
+            Bucket = It.GetIndex();
+        }
+    }
+
+private:
+    ElementArrayType Elements;
+
+    /** Bucket별 첫 번째 Element의 Index */
+    TArray<int32> Hash;
 };
 
 template <typename ElementType, typename Hasher, class Allocator>
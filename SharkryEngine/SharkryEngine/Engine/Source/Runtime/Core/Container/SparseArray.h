@@ -0,0 +1,327 @@
+#pragma once
+#include <bit>
+#include <cassert>
+#include <memory>
+#include <new>
+#include <utility>
+
+#include "Array.h"
+#include "ContainerAllocator.h"
+#include "CoreMiscDefines.h"
+
+
+/**
+ * 제거해도 다른 Element의 Index가 바뀌지 않는 배열
+ *
+ * 제거된 자리는 빈 칸으로 남겨두고 다음 삽입 때 재사용하므로, Add가 반환한 Index는
+ * 해당 Element가 제거될 때까지 유효합니다. 사용중인 칸은 Bit Flag로 관리하며, 순회 시 빈 칸은 건너뜁니다.
+ *
+ * @tparam ElementType 저장할 Element 타입
+ * @tparam Allocator Element 저장 공간을 할당할 Allocator
+ */
+template <typename ElementType, typename Allocator = FDefaultAllocator<ElementType>>
+class TSparseArray
+{
+private:
+    using ElementAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<ElementType>;
+
+    static constexpr int32 NumBitsPerWord = 32;
+    static constexpr int32 MinCapacity = 16;
+
+public:
+    template <bool bConst>
+    class TIterator
+    {
+    public:
+        using ArrayType = std::conditional_t<bConst, const TSparseArray, TSparseArray>;
+        using ReferenceType = std::conditional_t<bConst, const ElementType&, ElementType&>;
+
+        TIterator(ArrayType& InArray, int32 StartIndex)
+            : Array(&InArray), Index(InArray.FindNextAllocatedIndex(StartIndex))
+        {
+        }
+
+        ReferenceType operator*() const { return (*Array)[Index]; }
+        auto* operator->() const { return &(*Array)[Index]; }
+
+        TIterator& operator++()
+        {
+            Index = Array->FindNextAllocatedIndex(Index + 1);
+            return *this;
+        }
+
+        bool operator==(const TIterator& Other) const { return Index == Other.Index; }
+        bool operator!=(const TIterator& Other) const { return Index != Other.Index; }
+
+        /** 현재 Element의 Index */
+        int32 GetIndex() const { return Index; }
+
+    private:
+        ArrayType* Array;
+        int32 Index;
+    };
+
+    using Iterator = TIterator<false>;
+    using ConstIterator = TIterator<true>;
+
+public:
+    TSparseArray() = default;
+
+    TSparseArray(const TSparseArray& Other)
+    {
+        CopyFrom(Other);
+    }
+
+    TSparseArray(TSparseArray&& Other) noexcept
+        : Data(std::exchange(Other.Data, nullptr))
+        , MaxIndex(std::exchange(Other.MaxIndex, 0))
+        , Capacity(std::exchange(Other.Capacity, 0))
+        , AllocationFlags(std::move(Other.AllocationFlags))
+        , FreeIndices(std::move(Other.FreeIndices))
+    {
+    }
+
+    TSparseArray& operator=(const TSparseArray& Other)
+    {
+        if (this != &Other)
+        {
+            DestroyAndFree();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    TSparseArray& operator=(TSparseArray&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAndFree();
+            Data = std::exchange(Other.Data, nullptr);
+            MaxIndex = std::exchange(Other.MaxIndex, 0);
+            Capacity = std::exchange(Other.Capacity, 0);
+            AllocationFlags = std::move(Other.AllocationFlags);
+            FreeIndices = std::move(Other.FreeIndices);
+        }
+        return *this;
+    }
+
+    ~TSparseArray()
+    {
+        DestroyAndFree();
+    }
+
+public:
+    Iterator begin() { return Iterator(*this, 0); }
+    Iterator end() { return Iterator(*this, MaxIndex); }
+    ConstIterator begin() const { return ConstIterator(*this, 0); }
+    ConstIterator end() const { return ConstIterator(*this, MaxIndex); }
+
+    /** Index의 Element를 가리키는 Iterator를 만듭니다. */
+    Iterator CreateIterator(int32 Index) { return Iterator(*this, Index); }
+    ConstIterator CreateIterator(int32 Index) const { return ConstIterator(*this, Index); }
+
+    ElementType& operator[](int32 Index)
+    {
+        assert(IsValidIndex(Index));
+        return Data[Index];
+    }
+
+    const ElementType& operator[](int32 Index) const
+    {
+        assert(IsValidIndex(Index));
+        return Data[Index];
+    }
+
+    /**
+     * Element를 생성해서 추가합니다. 빈 칸이 있다면 가장 최근에 비워진 칸을 재사용합니다.
+     * @return 추가된 Element의 Index
+     */
+    template <typename... ArgsType>
+    int32 Emplace(ArgsType&&... Args)
+    {
+        int32 Index;
+        if (!FreeIndices.IsEmpty())
+        {
+            Index = FreeIndices[FreeIndices.Num() - 1];
+            FreeIndices.RemoveAt(FreeIndices.Num() - 1);
+        }
+        else
+        {
+            if (MaxIndex == Capacity)
+            {
+                Grow(std::max(Capacity * 2, MinCapacity));
+            }
+            Index = MaxIndex++;
+        }
+
+        new (&Data[Index]) ElementType(std::forward<ArgsType>(Args)...);
+        AllocationFlags[Index / NumBitsPerWord] |= 1u << (Index % NumBitsPerWord);
+        return Index;
+    }
+
+    int32 Add(const ElementType& Item) { return Emplace(Item); }
+    int32 Add(ElementType&& Item) { return Emplace(std::move(Item)); }
+
+    /** Index의 Element를 제거합니다. 다른 Element의 Index는 바뀌지 않습니다. */
+    void RemoveAt(int32 Index)
+    {
+        assert(IsValidIndex(Index));
+        std::destroy_at(&Data[Index]);
+        AllocationFlags[Index / NumBitsPerWord] &= ~(1u << (Index % NumBitsPerWord));
+        FreeIndices.Add(Index);
+    }
+
+    /** Index가 사용중인 Element를 가리키는지 확인합니다. */
+    bool IsValidIndex(int32 Index) const
+    {
+        return Index >= 0 && Index < MaxIndex
+            && (AllocationFlags[Index / NumBitsPerWord] & (1u << (Index % NumBitsPerWord))) != 0;
+    }
+
+    /** 사용중인 Element 수 */
+    int32 Num() const { return MaxIndex - static_cast<int32>(FreeIndices.Num()); }
+
+    /** 지금까지 사용된 가장 큰 Index + 1, 유효한 Index는 항상 이보다 작습니다. */
+    int32 GetMaxIndex() const { return MaxIndex; }
+
+    bool IsEmpty() const { return Num() == 0; }
+
+    /** 모든 Element를 제거합니다. 할당된 메모리는 유지합니다. */
+    void Empty()
+    {
+        DestroyElements();
+        MaxIndex = 0;
+        FreeIndices.Empty();
+        std::fill_n(AllocationFlags.GetData(), AllocationFlags.Num(), 0u);
+    }
+
+    /** 모든 Element를 제거하고, Number개를 재할당 없이 담을 수 있도록 공간을 확보합니다. */
+    void Empty(int32 Number)
+    {
+        Empty();
+        Reserve(Number);
+    }
+
+    /** Number개를 재할당 없이 담을 수 있도록 공간을 확보합니다. */
+    void Reserve(int32 Number)
+    {
+        if (Number > Capacity)
+        {
+            Grow(Number);
+        }
+    }
+
+    /** 할당한 메모리 크기(Byte) */
+    size_t GetAllocatedSize() const
+    {
+        return sizeof(ElementType) * Capacity + AllocationFlags.GetAllocatedSize() + FreeIndices.GetAllocatedSize();
+    }
+
+private:
+    /** StartIndex부터 사용중인 첫 번째 Index를 찾습니다. 없다면 MaxIndex */
+    int32 FindNextAllocatedIndex(int32 StartIndex) const
+    {
+        int32 WordIndex = StartIndex / NumBitsPerWord;
+        const int32 NumWords = (MaxIndex + NumBitsPerWord - 1) / NumBitsPerWord;
+        if (WordIndex >= NumWords)
+        {
+            return MaxIndex;
+        }
+
+        // 시작 위치 이전의 Bit는 무시
+        uint32 Word = AllocationFlags[WordIndex] & (~0u << (StartIndex % NumBitsPerWord));
+        while (Word == 0)
+        {
+            if (++WordIndex >= NumWords)
+            {
+                return MaxIndex;
+            }
+            Word = AllocationFlags[WordIndex];
+        }
+
+        return std::min(WordIndex * NumBitsPerWord + std::countr_zero(Word), MaxIndex);
+    }
+
+    void Grow(int32 NewCapacity)
+    {
+        ElementAllocator Alloc;
+        ElementType* NewData = Alloc.allocate(NewCapacity);
+
+        for (int32 Index = FindNextAllocatedIndex(0); Index < MaxIndex; Index = FindNextAllocatedIndex(Index + 1))
+        {
+            new (&NewData[Index]) ElementType(std::move(Data[Index]));
+            std::destroy_at(&Data[Index]);
+        }
+
+        if (Data)
+        {
+            Alloc.deallocate(Data, Capacity);
+        }
+
+        Data = NewData;
+        Capacity = NewCapacity;
+        AllocationFlags.SetNum((Capacity + NumBitsPerWord - 1) / NumBitsPerWord);
+    }
+
+    void DestroyElements()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+            for (int32 Index = FindNextAllocatedIndex(0); Index < MaxIndex; Index = FindNextAllocatedIndex(Index + 1))
+            {
+                std::destroy_at(&Data[Index]);
+            }
+        }
+    }
+
+    void DestroyAndFree()
+    {
+        if (Data)
+        {
+            DestroyElements();
+
+            ElementAllocator Alloc;
+            Alloc.deallocate(Data, Capacity);
+        }
+
+        Data = nullptr;
+        MaxIndex = 0;
+        Capacity = 0;
+        AllocationFlags.Empty();
+        FreeIndices.Empty();
+    }
+
+    /** Index가 그대로 유지되도록 같은 위치에 복사합니다. */
+    void CopyFrom(const TSparseArray& Other)
+    {
+        if (Other.Capacity == 0)
+        {
+            return;
+        }
+
+        ElementAllocator Alloc;
+        Data = Alloc.allocate(Other.Capacity);
+        Capacity = Other.Capacity;
+        MaxIndex = Other.MaxIndex;
+        AllocationFlags = Other.AllocationFlags;
+        FreeIndices = Other.FreeIndices;
+
+        for (int32 Index = FindNextAllocatedIndex(0); Index < MaxIndex; Index = FindNextAllocatedIndex(Index + 1))
+        {
+            new (&Data[Index]) ElementType(Other.Data[Index]);
+        }
+    }
+
+private:
+    ElementType* Data = nullptr;
+
+    /** 지금까지 사용된 가장 큰 Index + 1 */
+    int32 MaxIndex = 0;
+    int32 Capacity = 0;
+
+    /** 칸마다 사용중인지 여부, 32칸 단위로 묶어서 저장 */
+    TArray<uint32> AllocationFlags;
+
+    /** 재사용할 빈 칸의 Index */
+    TArray<int32> FreeIndices;
+};
@@ -0,0 +1,64 @@
+#include "MappedFile.h"
+
+FMappedFile::~FMappedFile()
+{
+    Close();
+}
+
+bool FMappedFile::Open(const FWString& FilePath)
+{
+    Close();
+
+    HANDLE File = CreateFileW(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (File == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+    FileHandle = File;
+
+    LARGE_INTEGER FileSize;
+    // 크기가 0인 파일은 Mapping을 만들 수 없습니다.
+    if (!GetFileSizeEx(File, &FileSize) || FileSize.QuadPart <= 0)
+    {
+        Close();
+        return false;
+    }
+
+    HANDLE Mapping = CreateFileMappingW(File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (Mapping == nullptr)
+    {
+        Close();
+        return false;
+    }
+    MappingHandle = Mapping;
+
+    Data = static_cast<const uint8*>(MapViewOfFile(Mapping, FILE_MAP_READ, 0, 0, 0));
+    if (Data == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    Size = static_cast<uint64>(FileSize.QuadPart);
+    return true;
+}
+
+void FMappedFile::Close()
+{
+    if (Data)
+    {
+        UnmapViewOfFile(Data);
+        Data = nullptr;
+    }
+    if (MappingHandle)
+    {
+        CloseHandle(MappingHandle);
+        MappingHandle = nullptr;
+    }
+    if (FileHandle)
+    {
+        CloseHandle(FileHandle);
+        FileHandle = nullptr;
+    }
+    Size = 0;
+}
@@ -0,0 +1,37 @@
+#pragma once
+#include "HAL/PlatformType.h"
+#include "Container/String.h"
+
+/**
+ * 파일 전체를 읽기 전용으로 Memory에 Mapping합니다.
+ *
+ * 파일 내용을 Buffer로 복사하지 않고 OS Page Cache를 그대로 가리키므로, 필요한 구간만 직접 복사해서 사용합니다.
+ * Close하거나 소멸하면 GetData()가 가리키던 주소는 더 이상 유효하지 않습니다.
+ */
+class FMappedFile
+{
+public:
+    FMappedFile() = default;
+    ~FMappedFile();
+
+    FMappedFile(const FMappedFile&) = delete;
+    FMappedFile& operator=(const FMappedFile&) = delete;
+
+    /** 이미 열려있다면 닫고 다시 엽니다. 파일이 없거나 비어있다면 false */
+    bool Open(const FWString& FilePath);
+
+    void Close();
+
+    bool IsOpen() const { return Data != nullptr; }
+
+    const uint8* GetData() const { return Data; }
+    uint64 GetSize() const { return Size; }
+
+private:
+    /** Windows HANDLE */
+    void* FileHandle = nullptr;
+    void* MappingHandle = nullptr;
+
+    const uint8* Data = nullptr;
+    uint64 Size = 0;
+};
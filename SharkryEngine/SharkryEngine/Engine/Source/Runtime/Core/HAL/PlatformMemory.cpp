@@ -4,3 +4,5 @@ std::atomic<uint64> FPlatformMemory::ObjectAllocationBytes = 0;
 std::atomic<uint64> FPlatformMemory::ObjectAllocationCount = 0;
 std::atomic<uint64> FPlatformMemory::ContainerAllocationBytes = 0;
 std::atomic<uint64> FPlatformMemory::ContainerAllocationCount = 0;
+std::atomic<uint64> FPlatformMemory::ObjectSlabAllocationBytes = 0;
+std::atomic<uint64> FPlatformMemory::ObjectSlabAllocationCount = 0;
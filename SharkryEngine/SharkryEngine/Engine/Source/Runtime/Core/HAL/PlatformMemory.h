@@ -7,7 +7,10 @@
 enum EAllocationType : uint8
 {
     EAT_Object,
-    EAT_Container
+    EAT_Container,
+
+    /** UObject를 담는 Slab (Slab 안의 Object는 EAT_Object로 따로 집계) */
+    EAT_ObjectSlab
 };
 
 /**
@@ -22,14 +25,17 @@ private:
     static std::atomic<uint64> ObjectAllocationCount;
     static std::atomic<uint64> ContainerAllocationBytes;
     static std::atomic<uint64> ContainerAllocationCount;
+    static std::atomic<uint64> ObjectSlabAllocationBytes;
+    static std::atomic<uint64> ObjectSlabAllocationCount;
 
+public:
+    /** 직접 확보한 메모리를 나눠쓰는 Allocator가 할당 단위마다 통계를 갱신할 때 사용합니다. */
     template <EAllocationType AllocType>
     static void IncrementStats(size_t Size);
 
     template <EAllocationType AllocType>
     static void DecrementStats(size_t Size);
 
-public:
     static void* Memcpy(void* Dest, const void* Src, uint64 Length)
     {
         return std::memcpy(Dest, Src, Length);
@@ -50,6 +56,16 @@ public:
     template <EAllocationType AllocType>
     static void AlignedFree(void* Address, size_t Size);
 
+    /**
+     * OS에서 페이지 단위로 메모리를 직접 할당합니다.
+     * 반환된 주소는 OS 할당 단위(Windows는 64KB)로 정렬되어 있습니다.
+     */
+    template <EAllocationType AllocType>
+    static void* BinnedAllocFromOS(size_t Size);
+
+    template <EAllocationType AllocType>
+    static void BinnedFreeToOS(void* Address, size_t Size);
+
     template <EAllocationType AllocType>
     static uint64 GetAllocationBytes();
 
@@ -74,6 +90,11 @@ void FPlatformMemory::IncrementStats(size_t Size)
         ObjectAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
         ObjectAllocationCount.fetch_add(1, std::memory_order_relaxed);
     }
+    else if constexpr (AllocType == EAT_ObjectSlab)
+    {
+        ObjectSlabAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
+        ObjectSlabAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
     else
     {
         //static_assert(false, "Unknown allocation type");
@@ -97,6 +118,11 @@ void FPlatformMemory::DecrementStats(size_t Size)
         ObjectAllocationBytes.fetch_sub(Size, std::memory_order_relaxed);
         ObjectAllocationCount.fetch_sub(1, std::memory_order_relaxed);
     }
+    else if constexpr (AllocType == EAT_ObjectSlab)
+    {
+        ObjectSlabAllocationBytes.fetch_sub(Size, std::memory_order_relaxed);
+        ObjectSlabAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+    }
     else
     {
         //static_assert(false, "Unknown allocation type");
@@ -151,6 +177,27 @@ void FPlatformMemory::AlignedFree(void* Address, size_t Size)
     }
 }
 
+template <EAllocationType AllocType>
+void* FPlatformMemory::BinnedAllocFromOS(size_t Size)
+{
+    void* Ptr = VirtualAlloc(nullptr, Size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (Ptr)
+    {
+        IncrementStats<AllocType>(Size);
+    }
+    return Ptr;
+}
+
+template <EAllocationType AllocType>
+void FPlatformMemory::BinnedFreeToOS(void* Address, size_t Size)
+{
+    if (Address)
+    {
+        DecrementStats<AllocType>(Size);
+        VirtualFree(Address, 0, MEM_RELEASE);
+    }
+}
+
 template <EAllocationType AllocType>
 uint64 FPlatformMemory::GetAllocationBytes()
 {
@@ -162,6 +209,10 @@ uint64 FPlatformMemory::GetAllocationBytes()
     {
         return ObjectAllocationBytes;
     }
+    else if constexpr (AllocType == EAT_ObjectSlab)
+    {
+        return ObjectSlabAllocationBytes;
+    }
     else
     {
         //static_assert(false, "Unknown AllocationType");
@@ -180,6 +231,10 @@ uint64 FPlatformMemory::GetAllocationCount()
     {
         return ObjectAllocationCount;
     }
+    else if constexpr (AllocType == EAT_ObjectSlab)
+    {
+        return ObjectSlabAllocationCount;
+    }
     else
     {
         //static_assert(false, "Unknown AllocationType");
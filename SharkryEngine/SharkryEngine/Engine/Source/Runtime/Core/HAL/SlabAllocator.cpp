@@ -0,0 +1,162 @@
+#include "SlabAllocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+#include "PlatformMemory.h"
+
+namespace
+{
+    uint32 AlignUp(uint32 Value, uint32 Alignment)
+    {
+        return (Value + Alignment - 1) & ~(Alignment - 1);
+    }
+}
+
+uint64 FSlabAllocatorStats::GetSlabBytes() const
+{
+    return static_cast<uint64>(NumSlabs) * FSlabAllocator::SlabSize;
+}
+
+FSlabAllocator::FSlabAllocator(uint32 InElementSize, uint32 InAlignment)
+    : ElementSize(InElementSize)
+    , Alignment(std::max<uint32>(InAlignment, alignof(void*)))
+{
+    // 반환된 칸에 다음 칸의 주소를 저장하므로 포인터보다 작을 수 없습니다.
+    SlotSize = AlignUp(std::max<uint32>(ElementSize, sizeof(void*)), Alignment);
+    FirstSlotOffset = AlignUp(sizeof(FSlab), Alignment);
+
+    const uint32 ElementsPerSlab = (SlabSize - FirstSlotOffset) / SlotSize;
+    Stats.ElementsPerSlab = ElementsPerSlab >= MinElementsPerSlab ? ElementsPerSlab : 0;
+}
+
+void* FSlabAllocator::Allocate()
+{
+    if (Stats.ElementsPerSlab == 0)
+    {
+        ++Stats.NumElements;
+        return FPlatformMemory::AlignedMalloc<EAT_Object>(ElementSize, Alignment);
+    }
+
+    FSlab* Slab = PartialSlabs;
+    if (!Slab)
+    {
+        Slab = AllocateSlab();
+        if (!Slab)
+        {
+            return nullptr;
+        }
+        LinkPartialSlab(Slab);
+    }
+
+    void* Result;
+    if (Slab->FreeList)
+    {
+        Result = Slab->FreeList;
+        Slab->FreeList = *static_cast<void**>(Result);
+    }
+    else
+    {
+        Result = reinterpret_cast<uint8*>(Slab) + FirstSlotOffset + Slab->NumCarved * SlotSize;
+        ++Slab->NumCarved;
+    }
+
+    // 가득 찬 Slab은 목록에서 빼서 다음 할당이 빈 칸이 있는 Slab으로 가도록 합니다.
+    if (++Slab->NumUsed == Stats.ElementsPerSlab)
+    {
+        UnlinkPartialSlab(Slab);
+    }
+
+    ++Stats.NumElements;
+    FPlatformMemory::IncrementStats<EAT_Object>(ElementSize);
+    return Result;
+}
+
+void FSlabAllocator::Free(void* Ptr)
+{
+    if (!Ptr)
+    {
+        return;
+    }
+
+    --Stats.NumElements;
+
+    if (Stats.ElementsPerSlab == 0)
+    {
+        FPlatformMemory::AlignedFree<EAT_Object>(Ptr, ElementSize);
+        return;
+    }
+
+    FSlab* Slab = GetSlab(Ptr);
+    assert(Slab->NumUsed > 0);
+
+    *static_cast<void**>(Ptr) = Slab->FreeList;
+    Slab->FreeList = Ptr;
+
+    if (Slab->NumUsed-- == Stats.ElementsPerSlab)
+    {
+        // 가득 차 있던 Slab에 빈 칸이 생겼으므로 다시 할당 대상으로 올립니다.
+        LinkPartialSlab(Slab);
+    }
+    else if (Slab->NumUsed == 0 && (Slab->Prev || Slab->Next))
+    {
+        // 빈 Slab은 다른 Slab이 남아있을 때만 반환해서, 생성/제거가 반복될 때 OS 호출이 반복되지 않도록 합니다.
+        UnlinkPartialSlab(Slab);
+        FreeSlab(Slab);
+    }
+
+    FPlatformMemory::DecrementStats<EAT_Object>(ElementSize);
+}
+
+FSlabAllocator::FSlab* FSlabAllocator::AllocateSlab()
+{
+    void* Memory = FPlatformMemory::BinnedAllocFromOS<EAT_ObjectSlab>(SlabSize);
+    if (!Memory)
+    {
+        return nullptr;
+    }
+
+    // GetSlab이 주소의 하위 Bit를 지워서 Slab을 찾으므로 정렬이 보장되어야 합니다.
+    assert(GetSlab(Memory) == Memory);
+
+    ++Stats.NumSlabs;
+    return new (Memory) FSlab;
+}
+
+void FSlabAllocator::FreeSlab(FSlab* Slab)
+{
+    --Stats.NumSlabs;
+    FPlatformMemory::BinnedFreeToOS<EAT_ObjectSlab>(Slab, SlabSize);
+}
+
+void FSlabAllocator::LinkPartialSlab(FSlab* Slab)
+{
+    Slab->Prev = nullptr;
+    Slab->Next = PartialSlabs;
+    if (PartialSlabs)
+    {
+        PartialSlabs->Prev = Slab;
+    }
+    PartialSlabs = Slab;
+}
+
+void FSlabAllocator::UnlinkPartialSlab(FSlab* Slab)
+{
+    if (Slab->Prev)
+    {
+        Slab->Prev->Next = Slab->Next;
+    }
+    else
+    {
+        PartialSlabs = Slab->Next;
+    }
+
+    if (Slab->Next)
+    {
+        Slab->Next->Prev = Slab->Prev;
+    }
+
+    Slab->Prev = nullptr;
+    Slab->Next = nullptr;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+/** Slab Allocator 사용량 */
+struct FSlabAllocatorStats
+{
+    /** 현재 OS에서 할당받아 보유중인 Slab 수 */
+    uint32 NumSlabs = 0;
+
+    /** 현재 살아있는 Element 수 */
+    uint32 NumElements = 0;
+
+    /** Slab 하나에 들어가는 Element 수, 0이면 Slab 없이 하나씩 할당합니다. */
+    uint32 ElementsPerSlab = 0;
+
+    /** 보유중인 Slab의 총 크기(Byte) */
+    uint64 GetSlabBytes() const;
+};
+
+/**
+ * 같은 크기의 Element를 고정 크기 Slab에 모아서 할당하는 Allocator
+ *
+ * Slab은 OS 할당 단위(64KB)로 정렬되어 있어서, 주소의 하위 Bit만 지우면 Element가 속한 Slab을 바로 찾을 수 있습니다.
+ * Slab마다 Free List를 따로 두고, 빈 칸이 있는 Slab부터 채워서 같은 종류의 Element가 인접한 메모리에 모이도록 합니다.
+ * 완전히 빈 Slab은 하나만 남겨두고 OS에 반환합니다.
+ * 소멸자는 Slab을 반환하지 않습니다. 정적 객체의 소멸 순서와 관계없이 Element에 접근할 수 있도록 프로그램 종료 시 OS가 회수합니다.
+ *
+ * @note 스레드 안전하지 않습니다. UObject 생성/제거와 같은 Game Thread에서만 사용합니다.
+ */
+class FSlabAllocator
+{
+public:
+    /** Slab 하나의 크기, Windows의 VirtualAlloc 할당 단위와 같습니다. */
+    static constexpr uint32 SlabSize = 64 * 1024;
+
+    /** Slab 하나에 이보다 적게 들어가는 큰 Element는 Slab 없이 하나씩 할당합니다. */
+    static constexpr uint32 MinElementsPerSlab = 4;
+
+    FSlabAllocator(uint32 InElementSize, uint32 InAlignment);
+    ~FSlabAllocator() = default;
+
+    FSlabAllocator(const FSlabAllocator&) = delete;
+    FSlabAllocator& operator=(const FSlabAllocator&) = delete;
+    FSlabAllocator(FSlabAllocator&&) = delete;
+    FSlabAllocator& operator=(FSlabAllocator&&) = delete;
+
+    /** Element 하나 크기의 초기화되지 않은 메모리를 할당합니다. */
+    void* Allocate();
+
+    /** Allocate로 할당받은 메모리를 반환합니다. 소멸자는 호출자가 먼저 호출해야 합니다. */
+    void Free(void* Ptr);
+
+    const FSlabAllocatorStats& GetStats() const { return Stats; }
+
+private:
+    struct FSlab
+    {
+        /** 빈 칸이 있는 Slab 목록 */
+        FSlab* Prev = nullptr;
+        FSlab* Next = nullptr;
+
+        /** 반환된 칸 목록, 각 칸의 첫 8Byte에 다음 칸의 주소를 저장합니다. */
+        void* FreeList = nullptr;
+
+        /** 사용중인 칸 수 */
+        uint32 NumUsed = 0;
+
+        /** 한번도 사용되지 않은 칸의 시작 Index, 이후 칸은 Free List 없이 순서대로 나눠줍니다. */
+        uint32 NumCarved = 0;
+    };
+
+    FSlab* AllocateSlab();
+    void FreeSlab(FSlab* Slab);
+
+    void LinkPartialSlab(FSlab* Slab);
+    void UnlinkPartialSlab(FSlab* Slab);
+
+    static FSlab* GetSlab(void* Ptr)
+    {
+        return reinterpret_cast<FSlab*>(reinterpret_cast<std::uintptr_t>(Ptr) & ~static_cast<std::uintptr_t>(SlabSize - 1));
+    }
+
+private:
+    uint32 ElementSize;
+    uint32 Alignment;
+
+    /** Alignment를 맞춘 칸 하나의 크기 */
+    uint32 SlotSize = 0;
+
+    /** Slab Header 뒤 첫 번째 칸의 Offset */
+    uint32 FirstSlotOffset = 0;
+
+    /** 빈 칸이 있는 Slab 목록의 머리, 가장 최근에 칸이 반환된 Slab이 앞에 옵니다. */
+    FSlab* PartialSlabs = nullptr;
+
+    FSlabAllocatorStats Stats;
+};
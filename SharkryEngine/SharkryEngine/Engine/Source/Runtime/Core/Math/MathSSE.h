@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include <immintrin.h>
 #include "HAL/PlatformType.h"
+#include "MathUtility.h"
 
 /**
  * @param A0	Selects which element (0-3) from 'A' into 1st slot in the result
@@ -54,6 +55,89 @@ FORCEINLINE VectorRegister4Float VectorMultiplyAdd(
     return VectorAdd(VectorMultiply(Vec1, Vec2), Vec3);
 }
 
+FORCEINLINE VectorRegister4Float VectorSubtract(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_sub_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorNegate(const VectorRegister4Float& Vec)
+{
+    return _mm_sub_ps(_mm_setzero_ps(), Vec);
+}
+
+/** X, Y, Z를 읽고 W는 0으로 채웁니다. */
+FORCEINLINE VectorRegister4Float VectorLoadFloat3(const float* Ptr)
+{
+    return _mm_setr_ps(Ptr[0], Ptr[1], Ptr[2], 0.0f);
+}
+
+/** X, Y, Z만 저장합니다. */
+FORCEINLINE void VectorStoreFloat3(const VectorRegister4Float& Vec, float* Ptr)
+{
+    _mm_storel_pi(reinterpret_cast<__m64*>(Ptr), Vec);
+    _mm_store_ss(Ptr + 2, _mm_movehl_ps(Vec, Vec));
+}
+
+/** 4개 성분의 내적을 모든 성분에 복제합니다. */
+FORCEINLINE VectorRegister4Float VectorDot4(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    VectorRegister4Float Temp = VectorMultiply(Vec1, Vec2);
+    Temp = VectorAdd(Temp, _mm_shuffle_ps(Temp, Temp, SHUFFLEMASK(1, 0, 3, 2)));
+    return VectorAdd(Temp, _mm_shuffle_ps(Temp, Temp, SHUFFLEMASK(2, 3, 0, 1)));
+}
+
+/** X, Y, Z의 외적, W는 0이 됩니다. */
+FORCEINLINE VectorRegister4Float VectorCross(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    // (Vec1 * Vec2.yzx - Vec1.yzx * Vec2).yzx
+    const VectorRegister4Float Vec1YZX = _mm_shuffle_ps(Vec1, Vec1, SHUFFLEMASK(1, 2, 0, 3));
+    const VectorRegister4Float Vec2YZX = _mm_shuffle_ps(Vec2, Vec2, SHUFFLEMASK(1, 2, 0, 3));
+    const VectorRegister4Float Temp = VectorSubtract(VectorMultiply(Vec1, Vec2YZX), VectorMultiply(Vec1YZX, Vec2));
+    return _mm_shuffle_ps(Temp, Temp, SHUFFLEMASK(1, 2, 0, 3));
+}
+
+/** 절댓값이 SMALL_NUMBER 이하인 성분은 0으로 만드는 역수 */
+FORCEINLINE VectorRegister4Float VectorReciprocalSafe(const VectorRegister4Float& Vec)
+{
+    const VectorRegister4Float AbsVec = _mm_andnot_ps(_mm_set1_ps(-0.0f), Vec);
+    const VectorRegister4Float ValidMask = _mm_cmpgt_ps(AbsVec, _mm_set1_ps(SMALL_NUMBER));
+    return _mm_and_ps(ValidMask, _mm_div_ps(_mm_set1_ps(1.0f), Vec));
+}
+
+/**
+ * Quaternion 곱 (X, Y, Z, W 순서), FQuat::operator*와 같이 Quat2를 먼저 적용한 뒤 Quat1을 적용합니다.
+ */
+FORCEINLINE VectorRegister4Float VectorQuaternionMultiply(const VectorRegister4Float& Quat1, const VectorRegister4Float& Quat2)
+{
+    const VectorRegister4Float SignX = _mm_setr_ps(1.0f, -1.0f, 1.0f, -1.0f);
+    const VectorRegister4Float SignY = _mm_setr_ps(1.0f, 1.0f, -1.0f, -1.0f);
+    const VectorRegister4Float SignZ = _mm_setr_ps(-1.0f, 1.0f, 1.0f, -1.0f);
+
+    VectorRegister4Float Result = VectorMultiply(VectorReplicate(Quat1, 3), Quat2);
+    Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 0), SignX), _mm_shuffle_ps(Quat2, Quat2, SHUFFLEMASK(3, 2, 1, 0)), Result);
+    Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 1), SignY), _mm_shuffle_ps(Quat2, Quat2, SHUFFLEMASK(2, 3, 0, 1)), Result);
+    Result = VectorMultiplyAdd(VectorMultiply(VectorReplicate(Quat1, 2), SignZ), _mm_shuffle_ps(Quat2, Quat2, SHUFFLEMASK(1, 0, 3, 2)), Result);
+    return Result;
+}
+
+/** 단위 Quaternion의 역 (켤레) */
+FORCEINLINE VectorRegister4Float VectorQuaternionInverse(const VectorRegister4Float& Quat)
+{
+    return _mm_xor_ps(Quat, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f));
+}
+
+/** 단위 Quaternion으로 벡터를 회전합니다. V' = V + W * T + Q x T, T = 2 * (Q x V) */
+FORCEINLINE VectorRegister4Float VectorQuaternionRotateVector(const VectorRegister4Float& Quat, const VectorRegister4Float& Vec)
+{
+    const VectorRegister4Float T = VectorCross(VectorAdd(Quat, Quat), Vec);
+    return VectorAdd(VectorMultiplyAdd(VectorReplicate(Quat, 3), T, Vec), VectorCross(Quat, T));
+}
+
+FORCEINLINE VectorRegister4Float VectorQuaternionInverseRotateVector(const VectorRegister4Float& Quat, const VectorRegister4Float& Vec)
+{
+    return VectorQuaternionRotateVector(VectorQuaternionInverse(Quat), Vec);
+}
+
 inline void VectorMatrixMultiply(FMatrix* Result, const FMatrix* Matrix1, const FMatrix* Matrix2)
 {
     // 레지스터에 값 로드
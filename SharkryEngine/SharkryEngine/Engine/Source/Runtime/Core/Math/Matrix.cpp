@@ -121,10 +121,16 @@ void FMatrix::RemoveTranslation()
 }
 
 FMatrix FMatrix::Transpose(const FMatrix& Mat) {
+    const VectorRegister4Float* Rows = reinterpret_cast<const VectorRegister4Float*>(&Mat);
+    VectorRegister4Float Row0 = Rows[0], Row1 = Rows[1], Row2 = Rows[2], Row3 = Rows[3];
+    _MM_TRANSPOSE4_PS(Row0, Row1, Row2, Row3);
+
     FMatrix Result;
-    for (int32 i = 0; i < 4; i++)
-        for (int32 j = 0; j < 4; j++)
-            Result.M[i][j] = Mat.M[j][i];
+    VectorRegister4Float* ResultRows = reinterpret_cast<VectorRegister4Float*>(&Result);
+    ResultRows[0] = Row0;
+    ResultRows[1] = Row1;
+    ResultRows[2] = Row2;
+    ResultRows[3] = Row3;
     return Result;
 }
 
@@ -216,6 +222,77 @@ FMatrix FMatrix::Inverse(const FMatrix& Mat)
     return Result;
 }
 
+namespace
+{
+    /** 3x3 역행렬의 행과 Translation 행으로 아핀 역행렬을 채웁니다. T' = -T * Inverse3x3 */
+    FMatrix MakeAffineInverse(VectorRegister4Float Row0, VectorRegister4Float Row1, VectorRegister4Float Row2, const VectorRegister4Float& Translation)
+    {
+        using namespace SSE;
+
+        VectorRegister4Float NewTranslation = VectorMultiply(VectorReplicate(Translation, 0), Row0);
+        NewTranslation = VectorMultiplyAdd(VectorReplicate(Translation, 1), Row1, NewTranslation);
+        NewTranslation = VectorMultiplyAdd(VectorReplicate(Translation, 2), Row2, NewTranslation);
+        NewTranslation = VectorSubtract(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), NewTranslation);
+
+        FMatrix Result;
+        VectorRegister4Float* ResultRows = reinterpret_cast<VectorRegister4Float*>(&Result);
+        ResultRows[0] = Row0;
+        ResultRows[1] = Row1;
+        ResultRows[2] = Row2;
+        ResultRows[3] = NewTranslation;
+        return Result;
+    }
+
+    /** W 성분을 0으로 만드는 Mask */
+    const VectorRegister4Float& GetXYZMask()
+    {
+        static const VectorRegister4Float Mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+        return Mask;
+    }
+}
+
+FMatrix FMatrix::InverseAffine(const FMatrix& Mat)
+{
+    using namespace SSE;
+
+    const VectorRegister4Float* Rows = reinterpret_cast<const VectorRegister4Float*>(&Mat);
+    const VectorRegister4Float Row0 = _mm_and_ps(Rows[0], GetXYZMask());
+    const VectorRegister4Float Row1 = _mm_and_ps(Rows[1], GetXYZMask());
+    const VectorRegister4Float Row2 = _mm_and_ps(Rows[2], GetXYZMask());
+
+    // 여인수 행렬의 행은 나머지 두 행의 외적이고, 역행렬은 여인수 행렬의 전치를 행렬식으로 나눈 값입니다.
+    VectorRegister4Float Cofactor0 = VectorCross(Row1, Row2);
+    VectorRegister4Float Cofactor1 = VectorCross(Row2, Row0);
+    VectorRegister4Float Cofactor2 = VectorCross(Row0, Row1);
+
+    const float Determinant = _mm_cvtss_f32(VectorDot4(Row0, Cofactor0));
+    if (Determinant == 0.0f || !std::isfinite(Determinant))
+    {
+        return Identity;
+    }
+
+    const VectorRegister4Float RDet = _mm_set1_ps(1.0f / Determinant);
+    Cofactor0 = VectorMultiply(Cofactor0, RDet);
+    Cofactor1 = VectorMultiply(Cofactor1, RDet);
+    Cofactor2 = VectorMultiply(Cofactor2, RDet);
+    VectorRegister4Float Zero = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(Cofactor0, Cofactor1, Cofactor2, Zero);
+
+    return MakeAffineInverse(Cofactor0, Cofactor1, Cofactor2, Rows[3]);
+}
+
+FMatrix FMatrix::InverseOrthonormal(const FMatrix& Mat)
+{
+    const VectorRegister4Float* Rows = reinterpret_cast<const VectorRegister4Float*>(&Mat);
+    VectorRegister4Float Row0 = _mm_and_ps(Rows[0], GetXYZMask());
+    VectorRegister4Float Row1 = _mm_and_ps(Rows[1], GetXYZMask());
+    VectorRegister4Float Row2 = _mm_and_ps(Rows[2], GetXYZMask());
+    VectorRegister4Float Zero = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(Row0, Row1, Row2, Zero);
+
+    return MakeAffineInverse(Row0, Row1, Row2, Rows[3]);
+}
+
 FMatrix FMatrix::CreateRotationMatrix(float roll, float pitch, float yaw)
 {
     float radRoll = roll * (PI / 180.0f);
@@ -318,6 +395,26 @@ FVector FMatrix::TransformPosition(const FVector& vector) const
     return w != 0.0f ? FVector{x / w, y / w, z / w} : FVector{x, y, z};
 }
 
+void FMatrix::TransformPositions(const FVector* InPositions, FVector* OutPositions, int32 NumPositions) const
+{
+    using namespace SSE;
+
+    const VectorRegister4Float* Rows = reinterpret_cast<const VectorRegister4Float*>(this);
+    const VectorRegister4Float Row0 = Rows[0];
+    const VectorRegister4Float Row1 = Rows[1];
+    const VectorRegister4Float Row2 = Rows[2];
+    const VectorRegister4Float Row3 = Rows[3];
+
+    for (int32 Index = 0; Index < NumPositions; ++Index)
+    {
+        const FVector& Position = InPositions[Index];
+        VectorRegister4Float Result = VectorMultiplyAdd(_mm_set1_ps(Position.X), Row0, Row3);
+        Result = VectorMultiplyAdd(_mm_set1_ps(Position.Y), Row1, Result);
+        Result = VectorMultiplyAdd(_mm_set1_ps(Position.Z), Row2, Result);
+        VectorStoreFloat3(Result, &OutPositions[Index].X);
+    }
+}
+
 FMatrix FMatrix::GetScaleMatrix(const FVector& InScale)
 {
     return CreateScaleMatrix(InScale.X, InScale.Y, InScale.Z);
@@ -34,6 +34,15 @@ public:
     void RemoveTranslation();
     static FMatrix Transpose(const FMatrix& Mat);
     static FMatrix Inverse(const FMatrix& Mat);
+
+    /**
+     * 마지막 열이 (0, 0, 0, 1)인 아핀 행렬의 역행렬, 3x3 부분만 외적으로 뒤집어서 Inverse보다 가볍습니다.
+     * Inverse와 같이 특이 행렬이면 Identity를 반환합니다.
+     */
+    static FMatrix InverseAffine(const FMatrix& Mat);
+
+    /** Scale 없이 회전과 이동만 있는 행렬의 역행렬, 3x3 부분을 전치하기만 합니다. */
+    static FMatrix InverseOrthonormal(const FMatrix& Mat);
     static FMatrix CreateRotationMatrix(float roll, float pitch, float yaw);
     static FMatrix CreateScaleMatrix(float scaleX, float scaleY, float scaleZ);
     static FVector TransformVector(const FVector& v, const FMatrix& m);
@@ -43,6 +52,9 @@ public:
     FVector4 TransformFVector4(const FVector4& vector) const;
     FVector TransformPosition(const FVector& vector) const;
 
+    /** 아핀 행렬로 점 배열을 한 번에 변환합니다. W로 나누지 않으므로 투영 행렬에는 TransformPosition을 사용합니다. */
+    void TransformPositions(const FVector* InPositions, FVector* OutPositions, int32 NumPositions) const;
+
     static FMatrix GetScaleMatrix(const FVector& InScale);
     static FMatrix GetTranslationMatrix(const FVector& InPosition);
     static FMatrix GetRotationMatrix(const FRotator& InRotation);
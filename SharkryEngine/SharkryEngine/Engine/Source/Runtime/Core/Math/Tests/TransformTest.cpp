@@ -0,0 +1,254 @@
+#include "Misc/AutomationTest.h"
+#include <cmath>
+#include "WindowsPlatformTime.h"
+#include "Math/Matrix.h"
+#include "Math/Transform.h"
+
+namespace
+{
+    /** 실행마다 같은 Transform이 나오도록 하는 간단한 난수 */
+    struct FTestRandom
+    {
+        uint32 State = 12345u;
+
+        uint32 Next()
+        {
+            State = State * 1664525u + 1013904223u;
+            return State >> 8;
+        }
+
+        float Range(float Min, float Max)
+        {
+            return Min + (Max - Min) * static_cast<float>(Next() & 0xFFFF) / 65535.f;
+        }
+
+        FVector Vector(float Extent)
+        {
+            return FVector(Range(-Extent, Extent), Range(-Extent, Extent), Range(-Extent, Extent));
+        }
+
+        FQuat Rotation()
+        {
+            return FQuat(Range(-1.f, 1.f), Range(-1.f, 1.f), Range(-1.f, 1.f), Range(-1.f, 1.f)).GetSafeNormal();
+        }
+    };
+
+    /** 기존 행렬 함수로 만든 Scale * Rotation * Translation */
+    FMatrix MakeReferenceMatrix(const FQuat& Rotation, const FVector& Translation, const FVector& Scale)
+    {
+        return FMatrix::CreateScaleMatrix(Scale.X, Scale.Y, Scale.Z) * Rotation.ToMatrix() * FMatrix::CreateTranslationMatrix(Translation);
+    }
+
+    /** 두 행렬의 가장 큰 성분 차이를, 값의 크기에 대한 비율로 반환합니다. */
+    float RelativeMatrixError(const FMatrix& A, const FMatrix& B)
+    {
+        float MaxDiff = 0.f;
+        float MaxValue = 1.f;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Col = 0; Col < 4; ++Col)
+            {
+                MaxDiff = std::fmax(MaxDiff, std::fabs(A.M[Row][Col] - B.M[Row][Col]));
+                MaxValue = std::fmax(MaxValue, std::fabs(B.M[Row][Col]));
+            }
+        }
+        return MaxDiff / MaxValue;
+    }
+
+    float RelativeVectorError(const FVector& A, const FVector& B)
+    {
+        const float MaxDiff = std::fmax(std::fabs(A.X - B.X), std::fmax(std::fabs(A.Y - B.Y), std::fabs(A.Z - B.Z)));
+        const float MaxValue = std::fmax(1.f, std::fmax(std::fabs(B.X), std::fmax(std::fabs(B.Y), std::fabs(B.Z))));
+        return MaxDiff / MaxValue;
+    }
+
+    /** 항목마다 가장 큰 오차를 모았다가 허용 오차와 비교합니다. */
+    struct FErrorTracker
+    {
+        const ANSICHAR* Name;
+        float Tolerance;
+        float MaxError = 0.f;
+
+        void Add(float Error) { MaxError = std::fmax(MaxError, Error); }
+    };
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FMatrixInverseAccuracyTest, "Core.Math.Matrix.InverseAccuracy", EAutomationTestType::Unit)
+{
+    constexpr int32 NumCases = 10000;
+
+    FTestRandom Random;
+    FErrorTracker InverseAffineError = { "InverseAffine vs Inverse", 1.e-5f };
+    FErrorTracker InverseAffineIdentityError = { "M * InverseAffine(M) vs Identity", 1.e-5f };
+    FErrorTracker InverseOrthonormalError = { "InverseOrthonormal vs Inverse", 1.e-5f };
+    FErrorTracker InverseOrthonormalIdentityError = { "M * InverseOrthonormal(M) vs Identity", 1.e-5f };
+
+    for (int32 Case = 0; Case < NumCases; ++Case)
+    {
+        const FQuat Rotation = Random.Rotation();
+        const FVector Translation = Random.Vector(100.f);
+        const FVector Scale(Random.Range(0.2f, 3.f), Random.Range(0.2f, 3.f), Random.Range(0.2f, 3.f));
+
+        // 균등하지 않은 Scale이 있는 아핀 행렬
+        const FMatrix Affine = MakeReferenceMatrix(Rotation, Translation, Scale);
+        const FMatrix AffineInverse = FMatrix::InverseAffine(Affine);
+        InverseAffineError.Add(RelativeMatrixError(AffineInverse, FMatrix::Inverse(Affine)));
+        InverseAffineIdentityError.Add(RelativeMatrixError(Affine * AffineInverse, FMatrix::Identity));
+
+        // 회전과 이동만 있는 행렬
+        const FMatrix Rigid = MakeReferenceMatrix(Rotation, Translation, FVector::OneVector);
+        const FMatrix RigidInverse = FMatrix::InverseOrthonormal(Rigid);
+        InverseOrthonormalError.Add(RelativeMatrixError(RigidInverse, FMatrix::Inverse(Rigid)));
+        InverseOrthonormalIdentityError.Add(RelativeMatrixError(Rigid * RigidInverse, FMatrix::Identity));
+    }
+
+    for (const FErrorTracker& Error : { InverseAffineError, InverseAffineIdentityError, InverseOrthonormalError, InverseOrthonormalIdentityError })
+    {
+        TestTrue(Error.Name, Error.MaxError <= Error.Tolerance);
+        AddInfo(FString::Printf(TEXT("%s: max relative error %g"), Error.Name, Error.MaxError));
+    }
+
+    // 특이 행렬은 Inverse와 같이 Identity를 반환합니다.
+    const FMatrix Singular = MakeReferenceMatrix(Random.Rotation(), Random.Vector(100.f), FVector(1.f, 0.f, 2.f));
+    TestTrue("InverseAffine of a singular matrix is Identity", RelativeMatrixError(FMatrix::InverseAffine(Singular), FMatrix::Identity) == 0.f);
+    TestTrue("Inverse of a singular matrix is Identity", RelativeMatrixError(FMatrix::Inverse(Singular), FMatrix::Identity) == 0.f);
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FTransformMatchesMatrixTest, "Core.Math.Transform.MatchesMatrix", EAutomationTestType::Unit)
+{
+    constexpr int32 NumCases = 10000;
+    constexpr int32 NumBatchPositions = 1024;
+
+    FTestRandom Random;
+    FErrorTracker ToMatrixError = { "ToMatrixWithScale vs Scale * Rotation * Translation", 1.e-6f };
+    FErrorTracker PositionError = { "TransformPosition vs FMatrix::TransformPosition", 1.e-5f };
+    FErrorTracker VectorError = { "TransformVector vs FMatrix::TransformVector", 1.e-5f };
+    FErrorTracker NoScaleError = { "TransformVectorNoScale vs FQuat::RotateVector", 1.e-5f };
+    FErrorTracker ComposeError = { "operator* vs matrix product (uniform scale)", 1.e-5f };
+    FErrorTracker InverseError = { "Inverse vs FMatrix::Inverse (uniform scale)", 1.e-5f };
+    FErrorTracker InverseMatrixError = { "ToInverseMatrixWithScale vs FMatrix::Inverse", 1.e-5f };
+    FErrorTracker InversePositionError = { "InverseTransformPosition round trip", 1.e-5f };
+    FErrorTracker RelativeError = { "GetRelativeTransform round trip", 1.e-5f };
+    FErrorTracker DecomposeError = { "FTransform(FMatrix) round trip", 1.e-5f };
+    FErrorTracker BatchError = { "TransformPositions vs TransformPosition", 1.e-6f };
+
+    for (int32 Case = 0; Case < NumCases; ++Case)
+    {
+        const FQuat Rotation = Random.Rotation();
+        const FVector Translation = Random.Vector(100.f);
+        const FVector Scale(Random.Range(0.2f, 3.f), Random.Range(0.2f, 3.f), Random.Range(0.2f, 3.f));
+        const FVector Point = Random.Vector(50.f);
+
+        const FTransform Transform(Rotation, Translation, Scale);
+        const FMatrix Matrix = MakeReferenceMatrix(Rotation, Translation, Scale);
+        ToMatrixError.Add(RelativeMatrixError(Transform.ToMatrixWithScale(), Matrix));
+        PositionError.Add(RelativeVectorError(Transform.TransformPosition(Point), Matrix.TransformPosition(Point)));
+        VectorError.Add(RelativeVectorError(Transform.TransformVector(Point), FMatrix::TransformVector(Point, Matrix)));
+        NoScaleError.Add(RelativeVectorError(Transform.TransformVectorNoScale(Point), Rotation.RotateVector(Point)));
+        InverseMatrixError.Add(RelativeMatrixError(Transform.ToInverseMatrixWithScale(), FMatrix::Inverse(Matrix)));
+        InversePositionError.Add(RelativeVectorError(Transform.InverseTransformPosition(Transform.TransformPosition(Point)), Point));
+        DecomposeError.Add(RelativeMatrixError(FTransform(Matrix).ToMatrixWithScale(), Matrix));
+
+        // 합성과 역변환은 Shear가 생기지 않는 균등 Scale에서만 행렬과 같습니다.
+        const float UniformScale = Random.Range(0.2f, 3.f);
+        const FTransform A(Rotation, Translation, FVector(UniformScale, UniformScale, UniformScale));
+        const FTransform B(Random.Rotation(), Random.Vector(100.f), FVector(1.5f, 1.5f, 1.5f));
+        ComposeError.Add(RelativeMatrixError((A * B).ToMatrixWithScale(), A.ToMatrixWithScale() * B.ToMatrixWithScale()));
+        InverseError.Add(RelativeMatrixError(A.Inverse().ToMatrixWithScale(), FMatrix::Inverse(A.ToMatrixWithScale())));
+        RelativeError.Add(RelativeMatrixError((A * B).GetRelativeTransform(B).ToMatrixWithScale(), A.ToMatrixWithScale()));
+    }
+
+    const FTransform BatchTransform(Random.Rotation(), Random.Vector(10.f), FVector(1.f, 2.f, 3.f));
+    const FMatrix BatchMatrix = BatchTransform.ToMatrixWithScale();
+    TArray<FVector> Positions;
+    TArray<FVector> MatrixOutput;
+    TArray<FVector> TransformOutput;
+    for (int32 Index = 0; Index < NumBatchPositions; ++Index)
+    {
+        Positions.Add(Random.Vector(100.f));
+    }
+    MatrixOutput.SetNum(NumBatchPositions);
+    TransformOutput.SetNum(NumBatchPositions);
+    BatchMatrix.TransformPositions(Positions.GetData(), MatrixOutput.GetData(), NumBatchPositions);
+    BatchTransform.TransformPositions(Positions.GetData(), TransformOutput.GetData(), NumBatchPositions);
+    for (int32 Index = 0; Index < NumBatchPositions; ++Index)
+    {
+        const FVector Expected = BatchMatrix.TransformPosition(Positions[Index]);
+        BatchError.Add(RelativeVectorError(MatrixOutput[Index], Expected));
+        BatchError.Add(RelativeVectorError(TransformOutput[Index], Expected));
+    }
+
+    for (const FErrorTracker& Error : { ToMatrixError, PositionError, VectorError, NoScaleError, ComposeError, InverseError,
+        InverseMatrixError, InversePositionError, RelativeError, DecomposeError, BatchError })
+    {
+        TestTrue(Error.Name, Error.MaxError <= Error.Tolerance);
+        AddInfo(FString::Printf(TEXT("%s: max relative error %g"), Error.Name, Error.MaxError));
+    }
+
+    // Blend는 양 끝에서 입력과 같고, 회전이 q와 -q로 달라도 같은 Transform입니다.
+    const FTransform BlendA(Random.Rotation(), Random.Vector(10.f), FVector(1.f, 1.f, 1.f));
+    const FTransform BlendB(Random.Rotation(), Random.Vector(10.f), FVector(2.f, 2.f, 2.f));
+    TestTrue("Blend at 0 equals A", FTransform::Blend(BlendA, BlendB, 0.f).Equals(BlendA));
+    TestTrue("Blend at 1 equals B", FTransform::Blend(BlendA, BlendB, 1.f).Equals(BlendB));
+
+    const FQuat Rotation = BlendA.GetRotation();
+    const FTransform Negated(FQuat(-Rotation.W, -Rotation.X, -Rotation.Y, -Rotation.Z), BlendA.GetTranslation(), BlendA.GetScale3D());
+    TestTrue("Equals treats q and -q as the same rotation", Negated.Equals(BlendA));
+    TestTrue("Identity * A equals A", (FTransform::Identity * BlendA).Equals(BlendA));
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FMatrixInverseBenchmark, "Core.Math.Matrix.InverseSpeed", EAutomationTestType::Benchmark)
+{
+    constexpr int32 NumMatrices = 1024;
+    constexpr int32 NumCalls = 1000000;
+
+    FTestRandom Random;
+    TArray<FMatrix> Matrices;
+    TArray<FMatrix> RigidMatrices;
+    TArray<FTransform> Transforms;
+    for (int32 Index = 0; Index < NumMatrices; ++Index)
+    {
+        const FQuat Rotation = Random.Rotation();
+        const FVector Translation = Random.Vector(100.f);
+        const FVector Scale(Random.Range(0.5f, 2.f), Random.Range(0.5f, 2.f), Random.Range(0.5f, 2.f));
+        Matrices.Add(MakeReferenceMatrix(Rotation, Translation, Scale));
+        RigidMatrices.Add(MakeReferenceMatrix(Rotation, Translation, FVector::OneVector));
+        Transforms.Add(FTransform(Rotation, Translation, FVector(Scale.X, Scale.X, Scale.X)));
+    }
+
+    // 결과를 모두 더해서 계산이 지워지지 않게 합니다.
+    float Checksum = 0.f;
+    const auto MeasureNs = [&Checksum](auto&& Body)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Call = 0; Call < NumCalls; ++Call)
+        {
+            Checksum += Body(Call & (NumMatrices - 1));
+        }
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) * 1.e6 / NumCalls;
+    };
+
+    const double InverseNs = MeasureNs([&Matrices](int32 Index) { return FMatrix::Inverse(Matrices[Index]).M[3][0]; });
+    const double InverseAffineNs = MeasureNs([&Matrices](int32 Index) { return FMatrix::InverseAffine(Matrices[Index]).M[3][0]; });
+    const double InverseOrthonormalNs = MeasureNs([&RigidMatrices](int32 Index) { return FMatrix::InverseOrthonormal(RigidMatrices[Index]).M[3][0]; });
+    const double NormalMatrixBeforeNs = MeasureNs([&Matrices](int32 Index) { return FMatrix::Transpose(FMatrix::Inverse(Matrices[Index])).M[0][3]; });
+    const double NormalMatrixAfterNs = MeasureNs([&Matrices](int32 Index) { return FMatrix::Transpose(FMatrix::InverseAffine(Matrices[Index])).M[0][3]; });
+    const double MatrixComposeNs = MeasureNs([&Matrices](int32 Index) { return (Matrices[Index] * Matrices[(Index + 1) & (NumMatrices - 1)]).M[3][0]; });
+    const double TransformComposeNs = MeasureNs([&Transforms](int32 Index) { return (Transforms[Index] * Transforms[(Index + 1) & (NumMatrices - 1)]).GetTranslation().X; });
+    const double TransformInverseNs = MeasureNs([&Transforms](int32 Index) { return Transforms[Index].Inverse().GetTranslation().X; });
+
+    AddInfo(FString::Printf(TEXT("FMatrix::Inverse:                         %.2f ns"), InverseNs));
+    AddInfo(FString::Printf(TEXT("FMatrix::InverseAffine:                   %.2f ns"), InverseAffineNs));
+    AddInfo(FString::Printf(TEXT("FMatrix::InverseOrthonormal:              %.2f ns"), InverseOrthonormalNs));
+    AddInfo(FString::Printf(TEXT("Normal matrix, Transpose(Inverse):        %.2f ns"), NormalMatrixBeforeNs));
+    AddInfo(FString::Printf(TEXT("Normal matrix, Transpose(InverseAffine):  %.2f ns"), NormalMatrixAfterNs));
+    AddInfo(FString::Printf(TEXT("FMatrix * FMatrix:                        %.2f ns"), MatrixComposeNs));
+    AddInfo(FString::Printf(TEXT("FTransform * FTransform:                  %.2f ns"), TransformComposeNs));
+    AddInfo(FString::Printf(TEXT("FTransform::Inverse:                      %.2f ns (checksum %f)"), TransformInverseNs, Checksum));
+    return true;
+}
@@ -0,0 +1,273 @@
+#include "Transform.h"
+
+#include "Rotator.h"
+
+using namespace SSE;
+
+namespace
+{
+    VectorRegister4Float LoadQuat(const FQuat& Quat)
+    {
+        return _mm_setr_ps(Quat.X, Quat.Y, Quat.Z, Quat.W);
+    }
+
+    VectorRegister4Float LoadVector(const FVector& Vector)
+    {
+        return VectorLoadFloat3(&Vector.X);
+    }
+
+    FVector StoreVector(const VectorRegister4Float& Vector)
+    {
+        FVector Result;
+        VectorStoreFloat3(Vector, &Result.X);
+        return Result;
+    }
+}
+
+const FTransform FTransform::Identity;
+
+FTransform::FTransform()
+    : Rotation(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f))
+    , Translation(_mm_setzero_ps())
+    , Scale3D(_mm_setr_ps(1.0f, 1.0f, 1.0f, 0.0f))
+{
+}
+
+FTransform::FTransform(const FVector& InTranslation)
+    : Rotation(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f))
+    , Translation(LoadVector(InTranslation))
+    , Scale3D(_mm_setr_ps(1.0f, 1.0f, 1.0f, 0.0f))
+{
+}
+
+FTransform::FTransform(const FQuat& InRotation)
+    : Rotation(LoadQuat(InRotation))
+    , Translation(_mm_setzero_ps())
+    , Scale3D(_mm_setr_ps(1.0f, 1.0f, 1.0f, 0.0f))
+{
+}
+
+FTransform::FTransform(const FQuat& InRotation, const FVector& InTranslation, const FVector& InScale3D)
+    : Rotation(LoadQuat(InRotation))
+    , Translation(LoadVector(InTranslation))
+    , Scale3D(LoadVector(InScale3D))
+{
+}
+
+FTransform::FTransform(const FRotator& InRotation, const FVector& InTranslation, const FVector& InScale3D)
+    : FTransform(InRotation.ToQuaternion(), InTranslation, InScale3D)
+{
+}
+
+FTransform::FTransform(const FMatrix& InMatrix)
+{
+    FMatrix RotationMatrix = InMatrix.GetMatrixWithoutScale();
+    FVector Scale = InMatrix.GetScaleVector();
+
+    // 좌우가 뒤집힌 행렬은 한 축의 Scale을 음수로 두어야 회전 행렬이 됩니다.
+    if (InMatrix.Determinant() < 0.0f)
+    {
+        Scale.X = -Scale.X;
+        RotationMatrix.M[0][0] = -RotationMatrix.M[0][0];
+        RotationMatrix.M[0][1] = -RotationMatrix.M[0][1];
+        RotationMatrix.M[0][2] = -RotationMatrix.M[0][2];
+    }
+
+    Rotation = LoadQuat(FQuat(RotationMatrix).GetSafeNormal());
+    Translation = LoadVector(InMatrix.GetTranslationVector());
+    Scale3D = LoadVector(Scale);
+}
+
+FTransform FTransform::operator*(const FTransform& Other) const
+{
+    // P' = Other.R(Other.S * (R(S * P) + T)) + Other.T
+    const VectorRegister4Float NewRotation = VectorQuaternionMultiply(Other.Rotation, Rotation);
+    const VectorRegister4Float NewScale3D = VectorMultiply(Scale3D, Other.Scale3D);
+    const VectorRegister4Float NewTranslation = VectorAdd(VectorQuaternionRotateVector(Other.Rotation, VectorMultiply(Other.Scale3D, Translation)), Other.Translation);
+    return FTransform(NewRotation, NewTranslation, NewScale3D);
+}
+
+FTransform& FTransform::operator*=(const FTransform& Other)
+{
+    *this = *this * Other;
+    return *this;
+}
+
+FTransform FTransform::Inverse() const
+{
+    const VectorRegister4Float InvRotation = VectorQuaternionInverse(Rotation);
+    const VectorRegister4Float InvScale3D = VectorReciprocalSafe(Scale3D);
+    const VectorRegister4Float InvTranslation = VectorQuaternionRotateVector(InvRotation, VectorMultiply(InvScale3D, VectorNegate(Translation)));
+    return FTransform(InvRotation, InvTranslation, InvScale3D);
+}
+
+FTransform FTransform::GetRelativeTransform(const FTransform& Other) const
+{
+    // this = Result * Other 이므로 Result.S = S / Other.S, Result.R = Other.R^-1 * R, Result.T = Other.R^-1(T - Other.T) / Other.S
+    const VectorRegister4Float InvOtherScale3D = VectorReciprocalSafe(Other.Scale3D);
+    const VectorRegister4Float InvOtherRotation = VectorQuaternionInverse(Other.Rotation);
+
+    const VectorRegister4Float NewScale3D = VectorMultiply(Scale3D, InvOtherScale3D);
+    const VectorRegister4Float NewRotation = VectorQuaternionMultiply(InvOtherRotation, Rotation);
+    const VectorRegister4Float NewTranslation = VectorMultiply(VectorQuaternionRotateVector(InvOtherRotation, VectorSubtract(Translation, Other.Translation)), InvOtherScale3D);
+    return FTransform(NewRotation, NewTranslation, NewScale3D);
+}
+
+FTransform FTransform::Blend(const FTransform& A, const FTransform& B, float Alpha)
+{
+    const VectorRegister4Float AlphaVec = _mm_set1_ps(Alpha);
+    const VectorRegister4Float OneMinusAlpha = _mm_set1_ps(1.0f - Alpha);
+
+    const VectorRegister4Float NewTranslation = VectorMultiplyAdd(A.Translation, OneMinusAlpha, VectorMultiply(B.Translation, AlphaVec));
+    const VectorRegister4Float NewScale3D = VectorMultiplyAdd(A.Scale3D, OneMinusAlpha, VectorMultiply(B.Scale3D, AlphaVec));
+
+    // 두 Quaternion이 반대 방향이면 B를 뒤집어서 짧은 쪽으로 보간합니다.
+    const VectorRegister4Float SignMask = _mm_and_ps(VectorDot4(A.Rotation, B.Rotation), _mm_set1_ps(-0.0f));
+    const VectorRegister4Float RotationB = _mm_xor_ps(B.Rotation, SignMask);
+    const VectorRegister4Float BlendedRotation = VectorMultiplyAdd(A.Rotation, OneMinusAlpha, VectorMultiply(RotationB, AlphaVec));
+
+    const VectorRegister4Float LengthSquared = VectorDot4(BlendedRotation, BlendedRotation);
+    const VectorRegister4Float NewRotation = _mm_div_ps(BlendedRotation, _mm_sqrt_ps(LengthSquared));
+    return FTransform(NewRotation, NewTranslation, NewScale3D);
+}
+
+FVector FTransform::TransformPosition(const FVector& Position) const
+{
+    const VectorRegister4Float Scaled = VectorMultiply(Scale3D, LoadVector(Position));
+    return StoreVector(VectorAdd(VectorQuaternionRotateVector(Rotation, Scaled), Translation));
+}
+
+FVector FTransform::TransformVector(const FVector& Vector) const
+{
+    const VectorRegister4Float Scaled = VectorMultiply(Scale3D, LoadVector(Vector));
+    return StoreVector(VectorQuaternionRotateVector(Rotation, Scaled));
+}
+
+FVector FTransform::TransformVectorNoScale(const FVector& Vector) const
+{
+    return StoreVector(VectorQuaternionRotateVector(Rotation, LoadVector(Vector)));
+}
+
+FVector FTransform::InverseTransformPosition(const FVector& Position) const
+{
+    const VectorRegister4Float Translated = VectorSubtract(LoadVector(Position), Translation);
+    return StoreVector(VectorMultiply(VectorQuaternionInverseRotateVector(Rotation, Translated), VectorReciprocalSafe(Scale3D)));
+}
+
+FVector FTransform::InverseTransformVector(const FVector& Vector) const
+{
+    return StoreVector(VectorMultiply(VectorQuaternionInverseRotateVector(Rotation, LoadVector(Vector)), VectorReciprocalSafe(Scale3D)));
+}
+
+void FTransform::TransformPositions(const FVector* InPositions, FVector* OutPositions, int32 NumPositions) const
+{
+    VectorRegister4Float AxisX, AxisY, AxisZ;
+    GetScaledAxes(AxisX, AxisY, AxisZ);
+
+    for (int32 Index = 0; Index < NumPositions; ++Index)
+    {
+        const FVector& Position = InPositions[Index];
+        VectorRegister4Float Result = VectorMultiplyAdd(_mm_set1_ps(Position.X), AxisX, Translation);
+        Result = VectorMultiplyAdd(_mm_set1_ps(Position.Y), AxisY, Result);
+        Result = VectorMultiplyAdd(_mm_set1_ps(Position.Z), AxisZ, Result);
+        VectorStoreFloat3(Result, &OutPositions[Index].X);
+    }
+}
+
+FMatrix FTransform::ToMatrixWithScale() const
+{
+    FMatrix Result;
+    VectorRegister4Float* Rows = reinterpret_cast<VectorRegister4Float*>(&Result);
+    GetScaledAxes(Rows[0], Rows[1], Rows[2]);
+    Rows[3] = _mm_or_ps(Translation, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+    return Result;
+}
+
+FMatrix FTransform::ToMatrixNoScale() const
+{
+    FMatrix Result = GetRotation().ToMatrix();
+    Result.SetOrigin(GetTranslation());
+    return Result;
+}
+
+FMatrix FTransform::ToInverseMatrixWithScale() const
+{
+    // (S * R * T)^-1 = T^-1 * R^T * S^-1, 3x3 부분은 회전 행렬의 전치에 열마다 1 / Scale을 곱한 값입니다.
+    const FMatrix RotationMatrix = GetRotation().ToMatrix();
+    const VectorRegister4Float InvScale3D = VectorReciprocalSafe(Scale3D);
+    VectorRegister4Float Row0 = _mm_load_ps(RotationMatrix.M[0]);
+    VectorRegister4Float Row1 = _mm_load_ps(RotationMatrix.M[1]);
+    VectorRegister4Float Row2 = _mm_load_ps(RotationMatrix.M[2]);
+    VectorRegister4Float Row3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(Row0, Row1, Row2, Row3);
+    Row0 = VectorMultiply(Row0, InvScale3D);
+    Row1 = VectorMultiply(Row1, InvScale3D);
+    Row2 = VectorMultiply(Row2, InvScale3D);
+
+    VectorRegister4Float NewTranslation = VectorMultiply(VectorReplicate(Translation, 0), Row0);
+    NewTranslation = VectorMultiplyAdd(VectorReplicate(Translation, 1), Row1, NewTranslation);
+    NewTranslation = VectorMultiplyAdd(VectorReplicate(Translation, 2), Row2, NewTranslation);
+
+    FMatrix Result;
+    VectorRegister4Float* Rows = reinterpret_cast<VectorRegister4Float*>(&Result);
+    Rows[0] = Row0;
+    Rows[1] = Row1;
+    Rows[2] = Row2;
+    Rows[3] = VectorSubtract(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), NewTranslation);
+    return Result;
+}
+
+FQuat FTransform::GetRotation() const
+{
+    alignas(16) float Values[4];
+    _mm_store_ps(Values, Rotation);
+    return FQuat(Values[3], Values[0], Values[1], Values[2]);
+}
+
+FVector FTransform::GetTranslation() const
+{
+    return StoreVector(Translation);
+}
+
+FVector FTransform::GetScale3D() const
+{
+    return StoreVector(Scale3D);
+}
+
+void FTransform::SetRotation(const FQuat& InRotation)
+{
+    Rotation = LoadQuat(InRotation);
+}
+
+void FTransform::SetTranslation(const FVector& InTranslation)
+{
+    Translation = LoadVector(InTranslation);
+}
+
+void FTransform::SetScale3D(const FVector& InScale3D)
+{
+    Scale3D = LoadVector(InScale3D);
+}
+
+bool FTransform::Equals(const FTransform& Other, float Tolerance) const
+{
+    const VectorRegister4Float ToleranceVec = _mm_set1_ps(Tolerance);
+    const VectorRegister4Float AbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const auto IsNear = [&ToleranceVec, &AbsMask](const VectorRegister4Float& A, const VectorRegister4Float& B)
+    {
+        const VectorRegister4Float Diff = _mm_and_ps(VectorSubtract(A, B), AbsMask);
+        return _mm_movemask_ps(_mm_cmple_ps(Diff, ToleranceVec)) == 0xF;
+    };
+
+    return IsNear(Translation, Other.Translation)
+        && IsNear(Scale3D, Other.Scale3D)
+        && (IsNear(Rotation, Other.Rotation) || IsNear(Rotation, VectorNegate(Other.Rotation)));
+}
+
+void FTransform::GetScaledAxes(VectorRegister4Float& OutAxisX, VectorRegister4Float& OutAxisY, VectorRegister4Float& OutAxisZ) const
+{
+    // 각 축을 회전한 결과가 회전 행렬의 행입니다.
+    OutAxisX = VectorMultiply(VectorQuaternionRotateVector(Rotation, _mm_setr_ps(1.0f, 0.0f, 0.0f, 0.0f)), VectorReplicate(Scale3D, 0));
+    OutAxisY = VectorMultiply(VectorQuaternionRotateVector(Rotation, _mm_setr_ps(0.0f, 1.0f, 0.0f, 0.0f)), VectorReplicate(Scale3D, 1));
+    OutAxisZ = VectorMultiply(VectorQuaternionRotateVector(Rotation, _mm_setr_ps(0.0f, 0.0f, 1.0f, 0.0f)), VectorReplicate(Scale3D, 2));
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "MathSSE.h"
+#include "Matrix.h"
+#include "Quat.h"
+#include "Vector.h"
+
+struct FRotator;
+
+/**
+ * 회전(Quaternion), 이동, 3D Scale로 이루어진 Transform
+ *
+ * 세 값을 SSE Register로 들고 있어서 합성, 역변환, 보간, 점 변환을 4x4 행렬 곱 없이 처리합니다.
+ * FMatrix와 같은 행 벡터 기준이므로 A * B는 A를 먼저 적용한 뒤 B를 적용하고, ToMatrixWithScale()은 Scale * Rotation * Translation과 같습니다.
+ * 균등하지 않은 Scale과 회전이 함께 합성되면 행렬에서는 Shear가 생기지만 FTransform은 표현할 수 없으므로,
+ * 그 경우 operator*와 Inverse는 FMatrix로 계산한 결과와 다릅니다.
+ */
+struct alignas(16) FTransform
+{
+public:
+    static const FTransform Identity;
+
+    FTransform();
+    explicit FTransform(const FVector& InTranslation);
+    explicit FTransform(const FQuat& InRotation);
+    FTransform(const FQuat& InRotation, const FVector& InTranslation, const FVector& InScale3D = FVector::OneVector);
+    FTransform(const FRotator& InRotation, const FVector& InTranslation, const FVector& InScale3D = FVector::OneVector);
+
+    /** Scale, 회전, 이동으로 분해합니다. Shear는 버립니다. */
+    explicit FTransform(const FMatrix& InMatrix);
+
+    /** this를 적용한 뒤 Other를 적용하는 Transform */
+    FTransform operator*(const FTransform& Other) const;
+    FTransform& operator*=(const FTransform& Other);
+
+    /** 역변환, Scale이 0에 가까운 축은 0으로 둡니다. */
+    FTransform Inverse() const;
+
+    /** Other 기준으로 나타낸 this, this = Result * Other */
+    FTransform GetRelativeTransform(const FTransform& Other) const;
+
+    /** 이동과 Scale은 선형 보간하고, 회전은 가까운 쪽으로 정규화 선형 보간(NLerp)합니다. */
+    static FTransform Blend(const FTransform& A, const FTransform& B, float Alpha);
+
+    FVector TransformPosition(const FVector& Position) const;
+    FVector TransformVector(const FVector& Vector) const;
+    FVector TransformVectorNoScale(const FVector& Vector) const;
+
+    /** Scale이 균등하지 않아도 정확한 역변환 */
+    FVector InverseTransformPosition(const FVector& Position) const;
+    FVector InverseTransformVector(const FVector& Vector) const;
+
+    /** 점 배열을 한 번에 변환합니다. 행렬로 한 번 바꾼 뒤 점마다 곱셈 3번으로 처리합니다. */
+    void TransformPositions(const FVector* InPositions, FVector* OutPositions, int32 NumPositions) const;
+
+    FMatrix ToMatrixWithScale() const;
+    FMatrix ToMatrixNoScale() const;
+
+    /** ToMatrixWithScale()의 역행렬 */
+    FMatrix ToInverseMatrixWithScale() const;
+
+    FQuat GetRotation() const;
+    FVector GetTranslation() const;
+    FVector GetScale3D() const;
+
+    void SetRotation(const FQuat& InRotation);
+    void SetTranslation(const FVector& InTranslation);
+    void SetScale3D(const FVector& InScale3D);
+
+    /** 회전이 q와 -q로 달라도 같은 회전이면 같다고 봅니다. */
+    bool Equals(const FTransform& Other, float Tolerance = KINDA_SMALL_NUMBER) const;
+
+private:
+    FTransform(const VectorRegister4Float& InRotation, const VectorRegister4Float& InTranslation, const VectorRegister4Float& InScale3D)
+        : Rotation(InRotation)
+        , Translation(InTranslation)
+        , Scale3D(InScale3D)
+    {}
+
+    /** 회전 행렬의 행에 Scale을 곱한 3x3 부분, W는 0 */
+    void GetScaledAxes(VectorRegister4Float& OutAxisX, VectorRegister4Float& OutAxisY, VectorRegister4Float& OutAxisZ) const;
+
+private:
+    /** X, Y, Z, W 순서의 단위 Quaternion */
+    VectorRegister4Float Rotation;
+
+    /** W는 0 */
+    VectorRegister4Float Translation;
+
+    /** W는 0 */
+    VectorRegister4Float Scale3D;
+};
@@ -0,0 +1,163 @@
+#include "AutomationTest.h"
+#include <cmath>
+#include "Container/CString.h"
+#include "WindowsPlatformTime.h"
+
+
+FAutomationTestBase::FAutomationTestBase(const ANSICHAR* InTestName, EAutomationTestType InTestType)
+    : TestName(InTestName)
+    , TestType(InTestType)
+{
+    FAutomationTestFramework::Get().RegisterTest(this);
+}
+
+void FAutomationTestBase::ClearExecutionInfo()
+{
+    Errors.Empty();
+    Infos.Empty();
+}
+
+void FAutomationTestBase::AddError(const FString& Message)
+{
+    Errors.Add(Message);
+}
+
+void FAutomationTestBase::AddInfo(const FString& Message)
+{
+    Infos.Add(Message);
+}
+
+bool FAutomationTestBase::TestTrue(const ANSICHAR* What, bool bValue)
+{
+    if (!bValue)
+    {
+        AddError(FString::Printf(TEXT("%s: expected true"), What));
+    }
+    return bValue;
+}
+
+bool FAutomationTestBase::TestFalse(const ANSICHAR* What, bool bValue)
+{
+    if (bValue)
+    {
+        AddError(FString::Printf(TEXT("%s: expected false"), What));
+    }
+    return !bValue;
+}
+
+bool FAutomationTestBase::TestNull(const ANSICHAR* What, const void* Pointer)
+{
+    if (Pointer)
+    {
+        AddError(FString::Printf(TEXT("%s: expected nullptr"), What));
+    }
+    return Pointer == nullptr;
+}
+
+bool FAutomationTestBase::TestNotNull(const ANSICHAR* What, const void* Pointer)
+{
+    if (!Pointer)
+    {
+        AddError(FString::Printf(TEXT("%s: expected not nullptr"), What));
+    }
+    return Pointer != nullptr;
+}
+
+bool FAutomationTestBase::TestEqual(const ANSICHAR* What, int64 Actual, int64 Expected)
+{
+    if (Actual != Expected)
+    {
+        AddError(FString::Printf(TEXT("%s: expected %lld, got %lld"), What, Expected, Actual));
+        return false;
+    }
+    return true;
+}
+
+bool FAutomationTestBase::TestEqual(const ANSICHAR* What, float Actual, float Expected, float Tolerance)
+{
+    // NaN도 실패로 보도록 부정 조건으로 비교합니다.
+    if (!(std::fabs(Actual - Expected) <= Tolerance))
+    {
+        AddError(FString::Printf(TEXT("%s: expected %f, got %f (tolerance %g)"), What, Expected, Actual, Tolerance));
+        return false;
+    }
+    return true;
+}
+
+FAutomationTestFramework& FAutomationTestFramework::Get()
+{
+    // 테스트는 다른 번역 단위의 정적 초기화에서 등록되므로, 처음 사용할 때 생성합니다.
+    static FAutomationTestFramework Framework;
+    return Framework;
+}
+
+void FAutomationTestFramework::RegisterTest(FAutomationTestBase* Test)
+{
+    Tests.Add(Test);
+}
+
+int32 FAutomationTestFramework::RunTests(const FString& Filter, EAutomationTestType TestType, TArray<FAutomationTestResult>& OutResults)
+{
+    // 등록 순서는 링크 순서에 따라 달라지므로, 결과를 비교하기 쉽도록 이름 순으로 실행합니다.
+    TArray<FAutomationTestBase*> SortedTests = Tests;
+    SortedTests.Sort([](const FAutomationTestBase* A, const FAutomationTestBase* B)
+    {
+        return FCString::Strcmp(*A->GetTestName(), *B->GetTestName()) < 0;
+    });
+
+    int32 NumFailed = 0;
+    for (FAutomationTestBase* Test : SortedTests)
+    {
+        if (Test->GetTestType() != TestType)
+        {
+            continue;
+        }
+        if (!Filter.IsEmpty() && !Test->GetTestName().Contains(Filter))
+        {
+            continue;
+        }
+
+        Test->ClearExecutionInfo();
+
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        const bool bReturned = Test->RunTest();
+        const uint64 EndCycles = FPlatformTime::Cycles64();
+
+        FAutomationTestResult& Result = OutResults[OutResults.Add(FAutomationTestResult())];
+        Result.TestName = Test->GetTestName();
+        Result.TestType = Test->GetTestType();
+        Result.bSuccess = bReturned && Test->GetErrors().IsEmpty();
+        Result.DurationMs = FPlatformTime::ToMilliseconds(EndCycles - StartCycles);
+        Result.Errors = Test->GetErrors();
+        Result.Infos = Test->GetInfos();
+
+        if (!Result.bSuccess)
+        {
+            ++NumFailed;
+        }
+    }
+    return NumFailed;
+}
+
+void FAutomationTestFramework::FormatResults(const TArray<FAutomationTestResult>& Results, TArray<FString>& OutLines)
+{
+    int32 NumFailed = 0;
+    for (const FAutomationTestResult& Result : Results)
+    {
+        OutLines.Add(FString::Printf(TEXT("[%s] %s (%.2f ms)"), Result.bSuccess ? TEXT("OK") : TEXT("FAIL"), *Result.TestName, Result.DurationMs));
+        for (const FString& Error : Result.Errors)
+        {
+            OutLines.Add(FString::Printf(TEXT("    Error: %s"), *Error));
+        }
+        for (const FString& Info : Result.Infos)
+        {
+            OutLines.Add(FString::Printf(TEXT("    %s"), *Info));
+        }
+
+        if (!Result.bSuccess)
+        {
+            ++NumFailed;
+        }
+    }
+    OutLines.Add(FString::Printf(TEXT("%d tests, %d failed"), Results.Num(), NumFailed));
+}
@@ -0,0 +1,124 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+
+/** Automation Test의 종류 */
+enum class EAutomationTestType : uint8
+{
+    /** 결과가 기대값과 같은지 확인하는 테스트 */
+    Unit,
+
+    /** 수행 시간을 재서 Info로 남기는 테스트, 실패 조건은 결과 검증에만 사용합니다. 따로 요청할 때만 실행합니다. */
+    Benchmark,
+};
+
+/**
+ * 엔진 안에서 실행되는 테스트의 기반 클래스
+ *
+ * IMPLEMENT_AUTOMATION_TEST로 정의한 테스트는 정적 초기화 때 FAutomationTestFramework에 등록되고,
+ * 콘솔의 automation 명령이나 -automation 실행 인자로 이름 필터에 맞는 것만 실행됩니다.
+ * Test 함수는 실패해도 중단하지 않고 Error를 쌓으므로, 한 번의 실행으로 실패한 조건을 모두 볼 수 있습니다.
+ */
+class FAutomationTestBase
+{
+public:
+    FAutomationTestBase(const ANSICHAR* InTestName, EAutomationTestType InTestType);
+    virtual ~FAutomationTestBase() = default;
+
+    FAutomationTestBase(const FAutomationTestBase&) = delete;
+    FAutomationTestBase& operator=(const FAutomationTestBase&) = delete;
+
+    /** 테스트 본문, false를 반환하거나 Error가 하나라도 있으면 실패입니다. */
+    virtual bool RunTest() = 0;
+
+    const FString& GetTestName() const { return TestName; }
+    EAutomationTestType GetTestType() const { return TestType; }
+
+    const TArray<FString>& GetErrors() const { return Errors; }
+    const TArray<FString>& GetInfos() const { return Infos; }
+
+    /** 이전 실행에서 쌓인 Error와 Info를 지웁니다. */
+    void ClearExecutionInfo();
+
+    void AddError(const FString& Message);
+    void AddInfo(const FString& Message);
+
+    bool TestTrue(const ANSICHAR* What, bool bValue);
+    bool TestFalse(const ANSICHAR* What, bool bValue);
+    bool TestNull(const ANSICHAR* What, const void* Pointer);
+    bool TestNotNull(const ANSICHAR* What, const void* Pointer);
+    bool TestEqual(const ANSICHAR* What, int64 Actual, int64 Expected);
+    bool TestEqual(const ANSICHAR* What, int32 Actual, int32 Expected) { return TestEqual(What, static_cast<int64>(Actual), static_cast<int64>(Expected)); }
+    bool TestEqual(const ANSICHAR* What, float Actual, float Expected, float Tolerance = 1.e-4f);
+
+private:
+    FString TestName;
+    EAutomationTestType TestType;
+
+    TArray<FString> Errors;
+    TArray<FString> Infos;
+};
+
+
+/** 테스트 하나의 실행 결과 */
+struct FAutomationTestResult
+{
+    FString TestName;
+    EAutomationTestType TestType = EAutomationTestType::Unit;
+    bool bSuccess = false;
+    double DurationMs = 0.0;
+    TArray<FString> Errors;
+    TArray<FString> Infos;
+};
+
+
+/** 등록된 Automation Test 목록 */
+class FAutomationTestFramework
+{
+public:
+    static FAutomationTestFramework& Get();
+
+    void RegisterTest(FAutomationTestBase* Test);
+
+    const TArray<FAutomationTestBase*>& GetTests() const { return Tests; }
+
+    /**
+     * TestType이고 이름에 Filter가 포함된 테스트를 이름 순으로 실행합니다.
+     * @param Filter 비어있으면 TestType의 모든 테스트
+     * @return 실패한 테스트 수
+     */
+    int32 RunTests(const FString& Filter, EAutomationTestType TestType, TArray<FAutomationTestResult>& OutResults);
+
+    /** 결과마다 요약 한 줄과 Error, Info를 한 줄씩 OutLines에 추가합니다. */
+    static void FormatResults(const TArray<FAutomationTestResult>& Results, TArray<FString>& OutLines);
+
+private:
+    FAutomationTestFramework() = default;
+
+    TArray<FAutomationTestBase*> Tests;
+};
+
+
+/**
+ * Automation Test를 정의하고 등록합니다. 매크로 뒤에 RunTest의 본문을 이어서 작성합니다.
+ *
+ * IMPLEMENT_AUTOMATION_TEST(FMyTest, "Engine.My.Test", EAutomationTestType::Unit)
+ * {
+ *     TestTrue("Value", bValue);
+ *     return true;
+ * }
+ */
+#define IMPLEMENT_AUTOMATION_TEST(TClass, PrettyName, TestType) \
+    class TClass : public FAutomationTestBase \
+    { \
+    public: \
+        TClass() : FAutomationTestBase(PrettyName, TestType) {} \
+        virtual bool RunTest() override; \
+    }; \
+    namespace \
+    { \
+        TClass TClass##Instance; \
+    } \
+    bool TClass::RunTest()
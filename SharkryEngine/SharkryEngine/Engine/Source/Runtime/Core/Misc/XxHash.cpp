@@ -0,0 +1,72 @@
+#include "XxHash.h"
+
+#include <cstring>
+
+
+uint64 FXxHash64::HashBuffer(const void* InData, uint64 Size, uint64 Seed)
+{
+    constexpr uint64 Prime1 = 11400714785074694791ull;
+    constexpr uint64 Prime2 = 14029467366897019727ull;
+    constexpr uint64 Prime3 = 1609587929392839161ull;
+    constexpr uint64 Prime4 = 9650029242287828579ull;
+    constexpr uint64 Prime5 = 2870177450012600261ull;
+
+    const auto RotateLeft = [](uint64 Value, int32 Bits) { return (Value << Bits) | (Value >> (64 - Bits)); };
+    const auto Read64 = [](const uint8* Ptr) { uint64 Value; std::memcpy(&Value, Ptr, sizeof(Value)); return Value; };
+    const auto Read32 = [](const uint8* Ptr) { uint32 Value; std::memcpy(&Value, Ptr, sizeof(Value)); return Value; };
+    const auto Round = [&RotateLeft](uint64 Acc, uint64 Input) { return RotateLeft(Acc + Input * Prime2, 31) * Prime1; };
+    const auto MergeRound = [&Round](uint64 Acc, uint64 Value) { return (Acc ^ Round(0, Value)) * Prime1 + Prime4; };
+
+    const uint8* Ptr = static_cast<const uint8*>(InData);
+    const uint8* End = Ptr + Size;
+    uint64 Hash;
+
+    if (Size >= 32)
+    {
+        uint64 Acc1 = Seed + Prime1 + Prime2;
+        uint64 Acc2 = Seed + Prime2;
+        uint64 Acc3 = Seed;
+        uint64 Acc4 = Seed - Prime1;
+        for (; End - Ptr >= 32; Ptr += 32)
+        {
+            Acc1 = Round(Acc1, Read64(Ptr));
+            Acc2 = Round(Acc2, Read64(Ptr + 8));
+            Acc3 = Round(Acc3, Read64(Ptr + 16));
+            Acc4 = Round(Acc4, Read64(Ptr + 24));
+        }
+        Hash = RotateLeft(Acc1, 1) + RotateLeft(Acc2, 7) + RotateLeft(Acc3, 12) + RotateLeft(Acc4, 18);
+        Hash = MergeRound(Hash, Acc1);
+        Hash = MergeRound(Hash, Acc2);
+        Hash = MergeRound(Hash, Acc3);
+        Hash = MergeRound(Hash, Acc4);
+    }
+    else
+    {
+        Hash = Seed + Prime5;
+    }
+
+    Hash += Size;
+    for (; End - Ptr >= 8; Ptr += 8)
+    {
+        Hash ^= Round(0, Read64(Ptr));
+        Hash = RotateLeft(Hash, 27) * Prime1 + Prime4;
+    }
+    if (End - Ptr >= 4)
+    {
+        Hash ^= static_cast<uint64>(Read32(Ptr)) * Prime1;
+        Hash = RotateLeft(Hash, 23) * Prime2 + Prime3;
+        Ptr += 4;
+    }
+    for (; Ptr < End; ++Ptr)
+    {
+        Hash ^= *Ptr * Prime5;
+        Hash = RotateLeft(Hash, 11) * Prime1;
+    }
+
+    Hash ^= Hash >> 33;
+    Hash *= Prime2;
+    Hash ^= Hash >> 29;
+    Hash *= Prime3;
+    Hash ^= Hash >> 32;
+    return Hash;
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+/** 파일 내용이 손상되었는지 확인하는 데 쓰는 64bit Hash (XXH64) */
+struct FXxHash64
+{
+    /**
+     * Data의 Size Byte를 Hash합니다. 8 Byte씩 4갈래로 읽습니다.
+     * @param Seed 이전 구간의 Hash를 넘기면 여러 구간을 이어서 Hash할 수 있습니다.
+     */
+    static uint64 HashBuffer(const void* Data, uint64 Size, uint64 Seed = 0);
+};
@@ -1,6 +1,7 @@
 #pragma once
 #include <cassert>
 #include <concepts>
+#include "Class.h"
 #include "Object.h"
 
 
@@ -20,7 +21,8 @@ FORCEINLINE To* Cast(From* Src)
 		else
 		{
 			// Src가 원래 From이었는지? (down casting)
-			if (((const UObject*)Src)->IsA<To>())
+			// IsChildOf가 인라인이므로 IsA를 거치지 않고 바로 비교합니다.
+			if (((const UObject*)Src)->GetClass()->IsChildOf(To::StaticClass()))
 			{
 				return (To*)Src;
 			}
@@ -16,25 +16,25 @@ UClass::UClass(
     : ClassCTOR(InCTOR)
     , ClassSize(InClassSize)
     , ClassAlignment(InAlignment)
+    , ObjectAllocator(InClassSize, InAlignment)
     , SuperClass(InSuperClass)
 {
     NamePrivate = InClassName;
-}
 
-bool UClass::IsChildOf(const UClass* SomeBase) const
-{
-    assert(this);
-    if (!SomeBase) return false;
+    // 부모 클래스는 생성자 인자를 평가할 때 이미 생성되어 있으므로, 부모의 조상 목록을 그대로 이어받습니다.
+    // 클래스가 언제 등록되든 자기 목록만 만들면 되므로 다른 클래스를 다시 계산할 필요가 없습니다.
+    if (SuperClass)
+    {
+        ClassBaseChain = SuperClass->ClassBaseChain;
+        ClassDepth = SuperClass->ClassDepth + 1;
+    }
+    ClassBaseChain.Add(this);
 
-    // Super의 Super를 반복하면서 
-    for (const UClass* TempClass = this; TempClass; TempClass=TempClass->GetSuperClass())
+    // 자기 자신과 모든 부모 클래스의 파생 클래스 목록에 등록
+    for (UClass* Class = this; Class; Class = Class->SuperClass)
     {
-        if (TempClass == SomeBase)
-        {
-            return true;
-        }
+        Class->DerivedClasses.Add(this);
     }
-    return false;
 }
 
 UObject* UClass::GetDefaultObject() const
@@ -2,6 +2,7 @@
 #include <concepts>
 #include "Object.h"
 #include "Property.h"
+#include "HAL/SlabAllocator.h"
 
 
 class FArchive;
@@ -43,13 +44,33 @@ public:
     uint32 GetClassSize() const { return ClassSize; }
     uint32 GetClassAlignment() const { return ClassAlignment; }
 
-    /** SomeBase의 자식 클래스인지 확인합니다. */
-    bool IsChildOf(const UClass* SomeBase) const;
+    /**
+     * SomeBase의 자식 클래스인지 확인합니다.
+     * 상속 체인을 따라가지 않고, SomeBase의 상속 깊이에 있는 조상과 비교합니다.
+     */
+    bool IsChildOf(const UClass* SomeBase) const
+    {
+        return SomeBase
+            && SomeBase->ClassDepth <= ClassDepth
+            && ClassBaseChain[SomeBase->ClassDepth] == SomeBase;
+    }
 
     template <typename T>
         requires std::derived_from<T, UObject>
     bool IsChildOf() const;
 
+    /** 자기 자신을 포함한 모든 파생 클래스 목록, 0번은 항상 자기 자신입니다. */
+    const TArray<UClass*>& GetDerivedClasses() const { return DerivedClasses; }
+
+    /**
+     * 이 클래스로 생성된 Object 목록 (파생 클래스 미포함)
+     * @note 제거된 Object의 자리는 CompactClassObjectLists가 호출될 때까지 nullptr로 남아있습니다.
+     */
+    const TArray<UObject*>& GetClassObjects() const { return ClassObjects; }
+
+    /** 이 클래스의 Object가 한번이라도 생성된 적이 있는지 여부 */
+    bool HasEverInstanced() const { return bHasEverInstanced; }
+
     /**
      * 부모의 UClass를 가져옵니다.
      *
@@ -57,6 +78,9 @@ public:
      */
     UClass* GetSuperClass() const { return SuperClass; }
 
+    /** 상속 깊이, UObject는 0 */
+    uint32 GetClassDepth() const { return ClassDepth; }
+
     UObject* GetDefaultObject() const;
 
     template <typename T>
@@ -65,6 +89,15 @@ public:
 
     const TArray<FProperty>& GetProperties() const { return Properties; }
 
+    /**
+     * 이 클래스의 Object 하나를 담을 메모리를 클래스 전용 Slab에서 할당합니다.
+     * ClassCTOR가 사용하며, 반환은 소멸자를 호출한 뒤 FreeObjectMemory로 합니다.
+     */
+    void* AllocateObjectMemory() { return ObjectAllocator.Allocate(); }
+    void FreeObjectMemory(void* Ptr) { ObjectAllocator.Free(Ptr); }
+
+    const FSlabAllocatorStats& GetObjectAllocatorStats() const { return ObjectAllocator.GetStats(); }
+
     /**
      * UClass에 Property를 추가합니다
      * @param Prop 추가할 Property
@@ -82,13 +115,29 @@ public:
     ClassConstructorType ClassCTOR;
 
 private:
+    friend struct FUObjectHashTables;
+
     uint32 ClassSize;
     uint32 ClassAlignment;
 
+    /** 이 클래스의 Object만 담는 Slab Allocator */
+    FSlabAllocator ObjectAllocator;
+
     UClass* SuperClass = nullptr;
     UObject* ClassDefaultObject = nullptr;
 
+    /** 최상위 클래스부터 자기 자신까지의 조상 목록, [ClassDepth]는 항상 자기 자신입니다. */
+    TArray<const UClass*> ClassBaseChain;
+    uint32 ClassDepth = 0;
+
     TArray<FProperty> Properties;
+
+    TArray<UClass*> DerivedClasses;
+    TArray<UObject*> ClassObjects;
+
+    /** ClassObjects에 nullptr 구멍이 남아있는지 여부 */
+    bool bClassObjectsDirty = false;
+    bool bHasEverInstanced = false;
 };
 
 template <typename T>
@@ -1,11 +1,14 @@
 #include "NameTypes.h"
 
 #include <assert.h>
-#include <atomic>
+#include <cstddef>
 #include <cwchar>
+#include <cwctype>
 #include <mutex>
-#include "Core/Container/Map.h"
+#include <shared_mutex>
+#include "Core/Container/Array.h"
 #include "Core/Container/String.h"
+#include "Core/HAL/PlatformMemory.h"
 
 
 enum ENameCase : uint8
@@ -14,32 +17,11 @@ enum ENameCase : uint8
 	CaseSensitive // 대소문자 구분
 };
 
-/** ANSICAHR나 WIDECHAR를 담는 인터페이스 비슷한 클래스 */
-struct FNameStringView
-{
-	FNameStringView() : Data(nullptr), Len(0), bIsWide(false) {}
-	FNameStringView(const ANSICHAR* Str, uint32 InLen) : Ansi(Str), Len(InLen), bIsWide(false) {}
-	FNameStringView(const WIDECHAR* Str, uint32 InLen) : Wide(Str), Len(InLen), bIsWide(true) {}
-	FNameStringView(const void* InData, uint32 InLen, bool bInIsWide) : Data(InData), Len(InLen), bIsWide(bInIsWide) {}
-
-	union
-	{
-		const void* Data;
-		const ANSICHAR* Ansi;
-		const WIDECHAR* Wide;
-	};
-
-	uint32 Len;
-	bool bIsWide;
-
-	bool IsAnsi() const { return !bIsWide; }
-};
-
 
-/** FName의 Hash값을 담는 클래스, FNameEntry에서 사용 */
+/** Name Pool에서 Entry의 위치, 상위 bit는 Block Index, 하위 bit는 Block 내 Offset입니다. */
 struct FNameEntryId
 {
-	uint32 Value = 0;  // 비교 문자열이 있는 해시
+	uint32 Value = 0;  // 0은 "None" Entry
 
 	bool IsNone() const { return !Value; }
 
@@ -67,9 +49,13 @@ struct FNameEntryHeader
 };
 
 
+/**
+ * Name Pool의 Block에 저장되는 가변 길이 Entry
+ * 문자열은 실제 길이 + Null 문자만큼만 할당되므로, 배열 크기는 최대 길이를 나타낼 뿐입니다.
+ */
 struct FNameEntry
 {
-	FNameEntryId ComparisonId; // 비교 문자열이 있는 해시
+	FNameEntryId ComparisonId; // 대소문자를 무시하고 비교할 때 사용하는 Entry
 	FNameEntryHeader Header;   // Name의 정보
 
 	union
@@ -78,219 +64,304 @@ struct FNameEntry
 		WIDECHAR WideName[NAME_SIZE];
 	};
 
-	void StoreName(const ANSICHAR* InName, uint32 Len)
+	bool IsWide() const { return Header.IsWide; }
+
+	FNameStringView GetView() const
 	{
-		memcpy(AnsiName, InName, sizeof(ANSICHAR) * Len);
-		AnsiName[Len] = '\0';
+		return IsWide() ? FNameStringView{WideName, Header.Len} : FNameStringView{AnsiName, Header.Len};
 	}
 
-	void StoreName(const WIDECHAR* InName, uint32 Len)
+	/** Len 길이의 문자열을 담는 Entry의 크기 */
+	static uint32 GetSize(uint32 Len, bool bIsWide)
 	{
-		memcpy(WideName, InName, sizeof(WIDECHAR) * Len);
-		WideName[Len] = '\0';
+		return static_cast<uint32>(offsetof(FNameEntry, AnsiName)) + (Len + 1) * (bIsWide ? sizeof(WIDECHAR) : sizeof(ANSICHAR));
 	}
 };
 
+
 namespace
 {
-template <typename CharType>
-uint32 HashString(const CharType* Str)
+template <ENameCase Sensitivity, typename CharType>
+uint32 FoldChar(CharType Char)
 {
-	// djb2 문자열 해싱 알고리즘
-	uint32 Hash = 5381;
-	while (*Str)
+	if constexpr (Sensitivity == CaseSensitive)
 	{
-		Hash = ((Hash << 5) + Hash) + *Str;
-		++Str;
+		return static_cast<uint32>(Char);
+	}
+	else if constexpr (std::is_same_v<CharType, WIDECHAR>)
+	{
+		return static_cast<uint32>(towlower(Char));
+	}
+	else
+	{
+		// ANSI는 ASCII 범위만 변환하므로 Locale 조회가 필요 없습니다.
+		const uint32 Code = static_cast<uint8>(Char);
+		return Code - 'A' < 26u ? Code + ('a' - 'A') : Code;
 	}
-	return Hash;
 }
 
+/** 대소문자를 무시한 FNV-1a Hash, 대소문자를 구분하는 Pool도 같은 값을 사용하므로 한 번만 계산합니다. */
 template <typename CharType>
-uint32 HashStringLower(const CharType* Str, uint32 InLen)
+uint32 HashNameIgnoreCase(const CharType* Str, uint32 Len)
 {
-	CharType LowerStr[NAME_SIZE];
-	if constexpr (std::is_same_v<CharType, wchar_t>)
+	uint32 Hash = 2166136261u;
+	for (uint32 i = 0; i < Len; ++i)
 	{
-		for (uint32 i = 0; i < InLen; i++)
-		{
-			LowerStr[i] = towlower(Str[i]);
-		}
-		LowerStr[InLen] = '\0';
+		Hash = (Hash ^ FoldChar<IgnoreCase>(Str[i])) * 16777619u;
 	}
-	else
+	return Hash;
+}
+
+template <ENameCase Sensitivity, typename CharTypeA, typename CharTypeB>
+bool EqualsName(const CharTypeA* A, const CharTypeB* B, uint32 Len)
+{
+	for (uint32 i = 0; i < Len; ++i)
 	{
-		for (uint32 i = 0; i < InLen; ++i)
+		if (FoldChar<Sensitivity>(A[i]) != FoldChar<Sensitivity>(B[i]))
 		{
-			LowerStr[i] = static_cast<CharType>(tolower(Str[i]));
+			return false;
 		}
-		LowerStr[InLen] = '\0';
 	}
-	return HashString(LowerStr);
+	return true;
 }
 
 template <ENameCase Sensitivity>
-uint32 HashName(FNameStringView InName);
-
-template <>
-uint32 HashName<IgnoreCase>(FNameStringView InName)
+bool EqualsName(const FNameStringView& A, const FNameStringView& B)
 {
-	return InName.IsAnsi() ? HashStringLower(InName.Ansi, InName.Len) : HashStringLower(InName.Wide, InName.Len);
-}
+	if (A.Len != B.Len)
+	{
+		return false;
+	}
 
-template <>
-uint32 HashName<CaseSensitive>(FNameStringView InName)
-{
-	return InName.IsAnsi() ? HashString(InName.Ansi) : HashString(InName.Wide);
+	if (A.IsAnsi())
+	{
+		return B.IsAnsi() ? EqualsName<Sensitivity>(A.Ansi, B.Ansi, A.Len) : EqualsName<Sensitivity>(A.Ansi, B.Wide, A.Len);
+	}
+	return B.IsAnsi() ? EqualsName<Sensitivity>(A.Wide, B.Ansi, A.Len) : EqualsName<Sensitivity>(A.Wide, B.Wide, A.Len);
 }
 }
 
-template <ENameCase Sensitivity>
+
+/** Pool에서 찾거나 저장할 Name과 그 Hash */
 struct FNameValue
 {
 	explicit FNameValue(FNameStringView InName)
 		: Name(InName)
-		, Hash(HashName<Sensitivity>(InName))
+		, Hash(InName.IsAnsi() ? HashNameIgnoreCase(InName.Ansi, InName.Len) : HashNameIgnoreCase(InName.Wide, InName.Len))
 	{}
 
 	FNameStringView Name;
 	uint32 Hash;
-	FNameEntryId ComparisonId = {};
 };
 
-using FNameComparisonValue = FNameValue<IgnoreCase>;
-using FNameDisplayValue = FNameValue<CaseSensitive>;
 
-/** Open Addressing을 이용한 커스텀 Hash Set 이었는데, Hash 충돌 문제로 사용 못함 */
-#pragma region Deprecated Pool Shard
-#if 0  // NOLINT(readability-avoid-unconditional-preprocessor-if)
-template <ENameCase Sensitivity>
-class FNamePoolShard
+/**
+ * FNameEntry를 Block 단위로 이어 붙여 저장하는 Arena
+ *
+ * Block은 해제되거나 이동하지 않으므로, Id로 Entry를 찾는 Resolve는 Lock 없이 수행합니다.
+ * Id를 얻은 스레드는 이미 Shard의 Lock을 통해 Entry 기록 이후의 상태를 보고 있습니다.
+ */
+class FNameEntryAllocator
 {
-	template <typename T>
-	using Vec = std::vector<T, FDefaultAllocator<T>>;
+public:
+	static constexpr uint32 Stride = alignof(FNameEntry);
+	static constexpr uint32 BlockOffsetBits = 16;
+	static constexpr uint32 BlockOffsetMask = (1u << BlockOffsetBits) - 1;
+	static constexpr uint32 BlockSizeBytes = Stride << BlockOffsetBits;
+	static constexpr uint32 MaxBlocks = 1u << 13;
 
-	// 요소 상태를 나타내는 enum
-	enum class ESlotState : uint8
-	{
-		Empty,    // 비어있는 슬롯
-		Occupied, // 사용 중인 슬롯
-		Deleted   // 삭제된 슬롯
-	};
+	/** Shard에서 빈 Slot을 나타내는 값, MaxBlocks 때문에 실제 Id로는 나올 수 없습니다. */
+	static constexpr uint32 InvalidId = ~0u;
 
-	// 슬롯 구조체
-	struct FSlot
+	FNameEntryAllocator()
 	{
-		FNameEntry Value;   // 저장된 값
-		ESlotState State;    // 슬롯의 상태
-
-		FSlot()
-			: Value()
-			, State(ESlotState::Empty)
-		{
-		}
-
-		bool Used() const
-		{
-			return State == ESlotState::Occupied;
-		}
+		Blocks[0] = static_cast<uint8*>(FPlatformMemory::Malloc<EAT_Container>(BlockSizeBytes));
+	}
 
-		void SetValue(const FNameEntry& InValue)
+	~FNameEntryAllocator()
+	{
+		for (uint32 BlockIndex = 0; BlockIndex <= CurrentBlock; ++BlockIndex)
 		{
-			Value = InValue;
-			State = ESlotState::Occupied;
+			FPlatformMemory::Free<EAT_Container>(Blocks[BlockIndex], BlockSizeBytes);
 		}
-	};
+	}
 
-private:
-	mutable Vec<FSlot> Slots;
-	std::atomic<uint32> ElementCount; // 총 요소 개수
-	float MaxLoadFactorValue;        // 최대 부하 계수
+	FNameEntryAllocator(const FNameEntryAllocator&) = delete;
+	FNameEntryAllocator& operator=(const FNameEntryAllocator&) = delete;
 
-	mutable std::mutex Mutex;
+	const FNameEntry& Resolve(FNameEntryId Id) const
+	{
+		return *reinterpret_cast<const FNameEntry*>(Blocks[Id.Value >> BlockOffsetBits] + (Id.Value & BlockOffsetMask) * Stride);
+	}
 
-	// 해시 테이블 리사이징 및 리해싱
-	void Rehash(uint32 NewCapacity)
+	/**
+	 * Name을 새 Entry로 저장합니다.
+	 * @param ComparisonId 비교용 Entry, None이라면 자기 자신을 비교용 Entry로 사용합니다.
+	 */
+	FNameEntryId Create(const FNameStringView& Name, FNameEntryId ComparisonId)
 	{
-		Vec<FSlot> OldSlots = std::move(Slots);
-		Slots.clear();
-		Slots.resize(NewCapacity);
+		const uint32 Size = (FNameEntry::GetSize(Name.Len, Name.bIsWide) + Stride - 1) & ~(Stride - 1);
 
-		ElementCount = 0;
-		for (const auto& Slot : OldSlots)
+		uint32 BlockIndex;
+		uint32 ByteOffset;
 		{
-			if (Slot.State == ESlotState::Occupied)
+			std::lock_guard Lock(Mutex);
+			if (CurrentByteCursor + Size > BlockSizeBytes)
 			{
-				Slots[Slot.Value.ComparisonId.Value & Slots.size()] = Slot;
+				assert(CurrentBlock + 1 < MaxBlocks && "FName pool is full");
+				Blocks[++CurrentBlock] = static_cast<uint8*>(FPlatformMemory::Malloc<EAT_Container>(BlockSizeBytes));
+				CurrentByteCursor = 0;
 			}
+
+			BlockIndex = CurrentBlock;
+			ByteOffset = CurrentByteCursor;
+			CurrentByteCursor += Size;
 		}
+
+		const FNameEntryId Id = {(BlockIndex << BlockOffsetBits) | (ByteOffset / Stride)};
+
+		FNameEntry* Entry = reinterpret_cast<FNameEntry*>(Blocks[BlockIndex] + ByteOffset);
+		Entry->ComparisonId = ComparisonId ? ComparisonId : Id;
+		Entry->Header = {
+			.IsWide = Name.bIsWide,
+			.Len = static_cast<uint16>(Name.Len)
+		};
+		if (Name.bIsWide)
+		{
+			memcpy(Entry->WideName, Name.Wide, sizeof(WIDECHAR) * Name.Len);
+			Entry->WideName[Name.Len] = L'\0';
+		}
+		else
+		{
+			memcpy(Entry->AnsiName, Name.Ansi, sizeof(ANSICHAR) * Name.Len);
+			Entry->AnsiName[Name.Len] = '\0';
+		}
+
+		return Id;
 	}
 
-public:
-	FNamePoolShard(int32 InitCapacity = 1024, float InMaxLoadFactor = 0.75f)
-		: Slots(InitCapacity)
-		, ElementCount(0)
-		, MaxLoadFactorValue(InMaxLoadFactor)
+	/** 사용중인 Block의 메모리 크기(Byte) */
+	size_t GetAllocatedSize() const
 	{
+		return static_cast<size_t>(CurrentBlock + 1) * BlockSizeBytes;
 	}
 
-	FSlot& Probe(uint32 InHash) const
+private:
+	std::mutex Mutex;
+	uint32 CurrentBlock = 0;
+	uint32 CurrentByteCursor = 0;
+	uint8* Blocks[MaxBlocks] = {};
+};
+
+
+/**
+ * Name의 Hash로 Entry Id를 찾는 Open Addressing Table
+ * Hash가 같더라도 문자열을 직접 비교하므로, Hash 충돌로 다른 Name이 같은 Id를 가지는 일은 없습니다.
+ */
+template <ENameCase Sensitivity>
+class FNamePoolShard
+{
+	struct FNameSlot
 	{
-		return Slots[InHash & Slots.size()-1];
+		uint32 Hash = 0;
+		uint32 Id = FNameEntryAllocator::InvalidId;
+
+		bool IsUsed() const { return Id != FNameEntryAllocator::InvalidId; }
+	};
+
+	static constexpr int32 InitialCapacity = 256;
+
+public:
+	FNamePoolShard()
+	{
+		Slots.SetNum(InitialCapacity);
 	}
 
-	FNameEntryId Find(const FNameValue<Sensitivity>& Value) const
+	/** Value와 같은 Name을 찾습니다. 여러 스레드가 동시에 찾을 수 있습니다. */
+	bool Find(const FNameEntryAllocator& Entries, const FNameValue& Value, FNameEntryId& OutId) const
 	{
-		FNameEntryId Result;
-		{
-			std::lock_guard _(Mutex);
+		std::shared_lock Lock(Mutex);
 
-			const FSlot& Slot = Probe(Value.Hash);
-			Result = Slot.Value.ComparisonId;
-		}
-		return Result;
+		const FNameSlot& Slot = Slots[Probe(Entries, Value)];
+		OutId = {Slot.Id};
+		return Slot.IsUsed();
 	}
 
-	FNameEntryId Insert(const FNameValue<Sensitivity>& Value)
+	/** Value와 같은 Name을 찾고, 없다면 CreateFunc로 만든 Entry를 등록합니다. */
+	template <typename CreateFuncType>
+	FNameEntryId FindOrAdd(const FNameEntryAllocator& Entries, const FNameValue& Value, const CreateFuncType& CreateFunc)
 	{
-		// 부하 계수 확인 및 필요시 리해싱
-		if (ElementCount >= Slots.size() * MaxLoadFactorValue)
+		std::unique_lock Lock(Mutex);
+
+		FNameSlot& Slot = Slots[Probe(Entries, Value)];
+		if (Slot.IsUsed())
 		{
-			Rehash(Slots.size() * 2);
+			return {Slot.Id};
 		}
 
-		std::lock_guard _(Mutex);
-		FSlot& Slot = Probe(Value.Hash);
+		const FNameEntryId Id = CreateFunc();
+		Slot = {Value.Hash, Id.Value};
 
-		if (Slot.Used())
+		// 최대 Load Factor 3/4
+		if (++NumUsed * 4 > Slots.Num() * 3)
 		{
-			return Slot.Value.ComparisonId;
+			Grow();
 		}
+		return Id;
+	}
 
-		// 요소 삽입
-		FNameEntry Entry;
-		Entry.ComparisonId = Value.ComparisonId;
-		Entry.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
+private:
+	/** Value와 같은 Name이 있는 Slot, 없다면 Value가 들어갈 빈 Slot의 Index */
+	int32 Probe(const FNameEntryAllocator& Entries, const FNameValue& Value) const
+	{
+		const uint32 Mask = Slots.Num() - 1;
+		for (uint32 Index = Value.Hash & Mask; ; Index = (Index + 1) & Mask)
 		{
-			Entry.StoreName(Value.Name.Wide, Value.Name.Len);
+			const FNameSlot& Slot = Slots[Index];
+			if (!Slot.IsUsed()
+				|| (Slot.Hash == Value.Hash && EqualsName<Sensitivity>(Entries.Resolve({Slot.Id}).GetView(), Value.Name)))
+			{
+				return static_cast<int32>(Index);
+			}
 		}
-		else
+	}
+
+	void Grow()
+	{
+		TArray<FNameSlot> OldSlots = std::move(Slots);
+		Slots = TArray<FNameSlot>();
+		Slots.SetNum(OldSlots.Num() * 2);
+
+		// 중복이 없으므로 문자열 비교 없이 Hash만으로 재배치합니다.
+		const uint32 Mask = Slots.Num() - 1;
+		for (const FNameSlot& OldSlot : OldSlots)
 		{
-			Entry.StoreName(Value.Name.Ansi, Value.Name.Len);
+			if (OldSlot.IsUsed())
+			{
+				uint32 Index = OldSlot.Hash & Mask;
+				while (Slots[Index].IsUsed())
+				{
+					Index = (Index + 1) & Mask;
+				}
+				Slots[Index] = OldSlot;
+			}
 		}
-		Slot.SetValue(Entry);
-		ElementCount.fetch_add(1, std::memory_order_relaxed);
-		return {Value.Hash};
 	}
+
+private:
+	mutable std::shared_mutex Mutex;
+	TArray<FNameSlot> Slots;
+	int32 NumUsed = 0;
 };
-#endif
-#pragma endregion Deprecated Pool Shard
 
-struct FNamePool
+
+/**
+ * FName 문자열을 저장하는 전역 Pool
+ *
+ * 문자열은 FNameEntryAllocator에 한 번만 저장하고, Hash의 상위 bit로 고른 Shard에서 Id를 찾습니다.
+ * Shard마다 Lock이 따로 있어서 여러 스레드에서 FName을 동시에 만들 수 있습니다.
+ */
+class FNamePool
 {
 public:
     static FNamePool& Get()
@@ -299,65 +370,68 @@ public:
         return Instance;
     }
 
+	struct FNameIds
+	{
+		FNameEntryId DisplayId;
+		FNameEntryId ComparisonId;
+	};
+
 private:
-	// FNamePoolShard<CaseSensitive> DisplayPool;
-	// FNamePoolShard<IgnoreCase> ComparisonPool;
+	static constexpr uint32 NumShardBits = 4;
+	static constexpr uint32 NumShards = 1u << NumShardBits;
 
-	TMap<uint32, FNameEntry> DisplayPool;
-	TMap<uint32, FNameEntry> ComparisonPool;
+	FNameEntryAllocator Entries;
+	FNamePoolShard<IgnoreCase> ComparisonShards[NumShards];
+	FNamePoolShard<CaseSensitive> DisplayShards[NumShards];
 
-private:
-	template <ENameCase Sensitivity>
-	FNameEntry MakeEntry(const FNameValue<Sensitivity>& Value) const
-	{
-		FNameEntry Result;
-		Result.ComparisonId = Value.ComparisonId;
-		Result.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
-		{
-			Result.StoreName(Value.Name.Wide, Value.Name.Len);
-		}
-		else
-		{
-			Result.StoreName(Value.Name.Ansi, Value.Name.Len);
-		}
-		return Result;
+	FNamePool()
+	{
+		// 가장 먼저 저장해서 Id 0이 "None"을 가리키도록 합니다.
+		[[maybe_unused]] const FNameIds NoneIds = Store({"None", 4});
+		assert(NoneIds.DisplayId.IsNone() && NoneIds.ComparisonId.IsNone());
 	}
 
 public:
-	/** Hash로 원본 문자열을 가져옵니다. */
-	FNameEntry Resolve(uint32 Hash) const
+	/** Id로 Entry를 가져옵니다. Lock 없이 Block을 직접 읽습니다. */
+	const FNameEntry& Resolve(FNameEntryId Id) const
 	{
-		return *DisplayPool.Find(Hash);
+		return Entries.Resolve(Id);
 	}
 
 	/**
-	 * 문자열을 찾거나, 없으면 Hash화 해서 저장합니다.
+	 * 문자열을 찾거나, 없으면 Pool에 저장합니다.
 	 *
-	 * @return DisplayName의 Hash
+	 * @return 원본 문자열 Entry와 비교용 Entry의 Id
 	 */
-	FNameEntryId FindOrStoreString(const FNameStringView& Name)
+	FNameIds Store(const FNameStringView& Name)
 	{
-		// DisplayPool에 같은 문자열이 있다면, 문자열의 Hash 반환
-		FNameDisplayValue DisplayValue{Name};
-		if (DisplayPool.Find(DisplayValue.Hash))
+		const FNameValue Value{Name};
+		const uint32 ShardIndex = Value.Hash >> (32 - NumShardBits);
+
+		// 대부분 이미 등록된 Name이므로 Shared Lock으로 먼저 찾아봅니다.
+		FNamePoolShard<CaseSensitive>& DisplayShard = DisplayShards[ShardIndex];
+		FNameEntryId DisplayId;
+		if (DisplayShard.Find(Entries, Value, DisplayId))
 		{
-			return {DisplayValue.Hash};
+			return {DisplayId, Entries.Resolve(DisplayId).ComparisonId};
 		}
 
-		const FNameComparisonValue ComparisonValue{Name};
-		if (!ComparisonPool.Find(ComparisonValue.Hash))
+		const FNameEntryId ComparisonId = ComparisonShards[ShardIndex].FindOrAdd(Entries, Value, [&]()
 		{
-			const FNameEntry Entry = MakeEntry(ComparisonValue);
-			ComparisonPool.Add(ComparisonValue.Hash, Entry);
-		}
+			return Entries.Create(Name, {});
+		});
 
-		DisplayValue.ComparisonId = {ComparisonValue.Hash};
-		DisplayPool.Add(DisplayValue.Hash, MakeEntry(DisplayValue));
-		return {DisplayValue.Hash};
+		DisplayId = DisplayShard.FindOrAdd(Entries, Value, [&]()
+		{
+			// 대소문자까지 같다면 비교용 Entry를 그대로 사용합니다.
+			if (EqualsName<CaseSensitive>(Entries.Resolve(ComparisonId).GetView(), Name))
+			{
+				return ComparisonId;
+			}
+			return Entries.Create(Name, ComparisonId);
+		});
+
+		return {DisplayId, ComparisonId};
 	}
 };
 
@@ -391,21 +465,39 @@ struct FNameHelper
 			return {};
 		}
 
-		const FNameEntryId DisplayId = FNamePool::Get().FindOrStoreString({Char, Len});
+		if (Len == 0)
+		{
+			return {};
+		}
 
-		FName Result;
-		Result.DisplayIndex = DisplayId.Value;
-		Result.ComparisonIndex = ResolveComparisonId(DisplayId).Value;
-		return Result;
+		if constexpr (std::is_same_v<CharType, wchar_t>)
+		{
+			// ASCII로만 이루어진 문자열은 ANSI로 저장해서 ToString과 View가 변환 없이 동작하도록 합니다.
+			ANSICHAR AnsiName[NAME_SIZE];
+			for (uint32 i = 0; i < Len; ++i)
+			{
+				if (static_cast<uint32>(Char[i]) >= 0x80)
+				{
+					return MakeFName(FNameStringView{Char, Len});
+				}
+				AnsiName[i] = static_cast<ANSICHAR>(Char[i]);
+			}
+			return MakeFName(FNameStringView{AnsiName, Len});
+		}
+		else
+		{
+			return MakeFName(FNameStringView{Char, Len});
+		}
 	}
 
-	static FNameEntryId ResolveComparisonId(FNameEntryId DisplayId)
+	static FName MakeFName(const FNameStringView& Name)
 	{
-		if (DisplayId.IsNone())
-		{
-			return {};
-		}
-		return FNamePool::Get().Resolve(DisplayId.Value).ComparisonId;
+		const FNamePool::FNameIds Ids = FNamePool::Get().Store(Name);
+
+		FName Result;
+		Result.DisplayIndex = Ids.DisplayId.Value;
+		Result.ComparisonIndex = Ids.ComparisonId.Value;
+		return Result;
 	}
 };
 
@@ -436,12 +528,13 @@ FString FName::ToString() const
 		return {TEXT("None")};
 	}
 
-	// TODO: WIDECHAR에 대응 해야함
-	FNameEntry Entry = FNamePool::Get().Resolve(DisplayIndex);
-	return {
-		// Entry.Header.IsWide ? Entry.WideName : Entry.AnsiName
-		Entry.AnsiName
-	};
+	const FNameEntry& Entry = FNamePool::Get().Resolve({DisplayIndex});
+	return Entry.IsWide() ? FString(Entry.WideName) : FString(Entry.AnsiName);
+}
+
+FNameStringView FName::GetDisplayNameView() const
+{
+	return FNamePool::Get().Resolve({DisplayIndex}).GetView();
 }
 
 bool FName::operator==(const FName& Other) const
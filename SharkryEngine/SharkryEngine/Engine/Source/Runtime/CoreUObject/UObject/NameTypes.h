@@ -8,12 +8,36 @@ enum ENameNone : uint8 { NAME_None = 0 };
 /** Maximum size of name, including the null terminator. */
 enum : uint16 { NAME_SIZE = 256 };
 
+/**
+ * ANSICAHR나 WIDECHAR를 담는 인터페이스 비슷한 클래스
+ * FName에서 얻은 View는 Name Pool의 메모리를 직접 가리키며, Pool은 Entry를 해제하지 않으므로 항상 유효합니다.
+ */
+struct FNameStringView
+{
+    FNameStringView() : Data(nullptr), Len(0), bIsWide(false) {}
+    FNameStringView(const ANSICHAR* Str, uint32 InLen) : Ansi(Str), Len(InLen), bIsWide(false) {}
+    FNameStringView(const WIDECHAR* Str, uint32 InLen) : Wide(Str), Len(InLen), bIsWide(true) {}
+    FNameStringView(const void* InData, uint32 InLen, bool bInIsWide) : Data(InData), Len(InLen), bIsWide(bInIsWide) {}
+
+    union
+    {
+        const void* Data;
+        const ANSICHAR* Ansi;
+        const WIDECHAR* Wide;
+    };
+
+    uint32 Len;
+    bool bIsWide;
+
+    bool IsAnsi() const { return !bIsWide; }
+};
+
 class FName
 {
     friend struct FNameHelper;
 
-    uint32 DisplayIndex;    // 원본 문자열의 Hash
-    uint32 ComparisonIndex; // 비교시 사용되는 Hash
+    uint32 DisplayIndex;    // 원본 문자열 Entry의 위치
+    uint32 ComparisonIndex; // 비교시 사용되는 Entry의 위치, 대소문자만 다른 Name끼리 같은 값을 가집니다.
 
 public:
     FName() : DisplayIndex(NAME_None), ComparisonIndex(NAME_None) {}
@@ -23,6 +47,9 @@ public:
     FName(const FString& Name);
 
     FString ToString() const;
+
+    /** 복사 없이 Name Pool에 저장된 원본 문자열을 가져옵니다. 문자열은 Null 문자로 끝납니다. */
+    FNameStringView GetDisplayNameView() const;
     uint32 GetDisplayIndex() const { return DisplayIndex; }
     uint32 GetComparisonIndex() const { return ComparisonIndex; }
     bool IsNone() { return DisplayIndex == NAME_None && ComparisonIndex == NAME_None; }
@@ -14,7 +14,7 @@ UClass* UObject::StaticClass()
         nullptr,
         []() -> UObject*
         {
-            void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(sizeof(UObject));
+            void* RawMemory = StaticClass()->AllocateObjectMemory();
             ::new (RawMemory) UObject;
             return static_cast<UObject*>(RawMemory);
         }
@@ -1,4 +1,5 @@
 #pragma once
+#include <cassert>
 #include "EngineLoop.h"
 #include "NameTypes.h"
 
@@ -27,9 +28,12 @@ private:
     friend class FObjectFactory;
     friend class FSceneMgr;
     friend class UClass;
+    friend struct FUObjectHashTables;
+    friend class FUObjectArray;
 
     uint32 UUID;
     uint32 InternalIndex; // Index of GUObjectArray
+    int32 ClassObjectIndex = INDEX_NONE; // Index of UClass::ClassObjects
 
     FName NamePrivate;
     UClass* ClassPrivate = nullptr;
@@ -70,24 +74,19 @@ public:
     }
 
 public:
-    void* operator new(size_t size)
+    /**
+     * UObject는 FObjectFactory::ConstructObject로만 생성합니다.
+     * 메모리는 ClassCTOR가 클래스별 Slab에서 할당하고 ProcessPendingDestroyObjects가 같은 Slab으로 반환하므로,
+     * new로 만든 Heap 메모리가 Slab에 섞이지 않도록 막습니다.
+     */
+    void* operator new(size_t) = delete;
+
+    /**
+     * 가상 소멸자가 요구해서 선언만 유지합니다. Object는 GUObjectArray.MarkRemoveObject로 제거하므로 호출되면 안 됩니다.
+     */
+    void operator delete(void*)
     {
-        //UE_LOG(LogLevel::Display, "UObject Created : %d", size);
-
-        void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(size);
-        UE_LOG(
-            LogLevel::Display,
-            "TotalAllocationBytes : %d, TotalAllocationCount : %d",
-            FPlatformMemory::GetAllocationBytes<EAT_Object>(),
-            FPlatformMemory::GetAllocationCount<EAT_Object>()
-        );
-        return RawMemory;
-    }
-
-    void operator delete(void* ptr, size_t size)
-    {
-        //UE_LOG(LogLevel::Display, "UObject Deleted : %d", size);
-        FPlatformMemory::Free<EAT_Object>(ptr, size);
+        assert(false && "UObject must be removed with GUObjectArray.MarkRemoveObject");
     }
 
     FVector4 EncodeUUID() const {
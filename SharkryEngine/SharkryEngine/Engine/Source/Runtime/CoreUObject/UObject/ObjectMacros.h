@@ -36,7 +36,7 @@ public: \
             static_cast<uint32>(alignof(TClass)), \
             TSuperClass::StaticClass(), \
             []() -> UObject* { \
-                void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(sizeof(TClass)); \
+                void* RawMemory = TClass::StaticClass()->AllocateObjectMemory(); \
                 ::new (RawMemory) TClass; \
                 return static_cast<UObject*>(RawMemory); \
             } \
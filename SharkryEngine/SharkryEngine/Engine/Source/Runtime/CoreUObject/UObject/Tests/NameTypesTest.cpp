@@ -0,0 +1,240 @@
+#include "Misc/AutomationTest.h"
+#include <atomic>
+#include <thread>
+#include "WindowsPlatformTime.h"
+#include "Container/String.h"
+#include "UObject/NameTypes.h"
+
+namespace
+{
+    /** Name Pool은 전역이고 Entry를 지우지 않으므로, 테스트마다 다른 접두사로 처음 보는 Name을 만듭니다. */
+    struct FTestNames
+    {
+        TArray<FString> Display;    // 원본 문자열
+        TArray<FString> OtherCase;  // 대소문자만 다른 문자열
+        TArray<FString> Wide;       // ASCII가 아닌 문자가 섞인 문자열
+
+        FTestNames(const TCHAR* Prefix, int32 NumNames)
+        {
+            Display.SetNum(NumNames);
+            OtherCase.SetNum(NumNames);
+            Wide.SetNum(NumNames);
+            for (int32 Index = 0; Index < NumNames; ++Index)
+            {
+                Display[Index] = FString::Printf(TEXT("%s_StaticMeshComponent_%d"), Prefix, Index);
+                OtherCase[Index] = FString::Printf(TEXT("%s_STATICMESHCOMPONENT_%d"), Prefix, Index);
+                Wide[Index] = FString::Printf(TEXT("%s_\u00C9tat_%d"), Prefix, Index);
+            }
+        }
+    };
+
+    /**
+     * NumThreads개의 스레드가 동시에 Body(ThreadIndex)를 실행합니다.
+     * Job System은 Worker가 없으면 호출한 스레드에서 모두 실행하므로, 경합을 확실히 만들기 위해 스레드를 직접 만듭니다.
+     */
+    template <typename FuncType>
+    void RunOnThreads(int32 NumThreads, const FuncType& Body)
+    {
+        std::atomic<int32> NumReady = 0;
+        TArray<std::thread> Threads;
+        Threads.Reserve(NumThreads);
+        for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+        {
+            Threads.Emplace([&Body, &NumReady, NumThreads, ThreadIndex]()
+            {
+                // 모든 스레드가 준비된 뒤에 시작해야 같은 Name을 동시에 만드는 경우가 생깁니다.
+                NumReady.fetch_add(1);
+                while (NumReady.load() < NumThreads)
+                {
+                    std::this_thread::yield();
+                }
+                Body(ThreadIndex);
+            });
+        }
+        for (std::thread& Thread : Threads)
+        {
+            Thread.join();
+        }
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FNameConcurrentStoreTest, "CoreUObject.Name.ConcurrentStore", EAutomationTestType::Unit)
+{
+    constexpr int32 NumThreads = 8;
+    constexpr int32 NumNames = 1 << 14; // 2의 거듭제곱이라 홀수 Stride로 돌면 모든 Index를 한 번씩 지납니다.
+
+    // Shard가 여러 번 커지고 Allocator가 새 Block을 잡을 만큼 많은 Name을 모든 스레드가 서로 다른 순서로 만듭니다.
+    const FTestNames Names(TEXT("NameStress"), NumNames);
+    TArray<TArray<FName>> DisplayNames;
+    TArray<TArray<FName>> OtherCaseNames;
+    TArray<TArray<FName>> WideNames;
+    DisplayNames.SetNum(NumThreads);
+    OtherCaseNames.SetNum(NumThreads);
+    WideNames.SetNum(NumThreads);
+    for (int32 ThreadIndex = 0; ThreadIndex < NumThreads; ++ThreadIndex)
+    {
+        DisplayNames[ThreadIndex].SetNum(NumNames);
+        OtherCaseNames[ThreadIndex].SetNum(NumNames);
+        WideNames[ThreadIndex].SetNum(NumNames);
+    }
+
+    // 만드는 동안 이미 만든 Name의 문자열을 읽어서, Lock 없는 Resolve가 새 Block 할당과 겹쳐도 안전한지 확인합니다.
+    std::atomic<int32> NumWrongReads = 0;
+    RunOnThreads(NumThreads, [&](int32 ThreadIndex)
+    {
+        const int32 Stride = ThreadIndex * 2 + 1;
+        int32 NumLocalWrongReads = 0;
+        for (int32 Step = 0; Step < NumNames; ++Step)
+        {
+            const int32 Index = static_cast<int32>((static_cast<int64>(Step) * Stride + ThreadIndex * 997) % NumNames);
+            if (ThreadIndex % 2 == 0)
+            {
+                DisplayNames[ThreadIndex][Index] = FName(Names.Display[Index]);
+                OtherCaseNames[ThreadIndex][Index] = FName(Names.OtherCase[Index]);
+            }
+            else
+            {
+                OtherCaseNames[ThreadIndex][Index] = FName(Names.OtherCase[Index]);
+                DisplayNames[ThreadIndex][Index] = FName(Names.Display[Index]);
+            }
+            WideNames[ThreadIndex][Index] = FName(Names.Wide[Index]);
+
+            NumLocalWrongReads += DisplayNames[ThreadIndex][Index].ToString().Equals(Names.Display[Index]) ? 0 : 1;
+        }
+        NumWrongReads.fetch_add(NumLocalWrongReads);
+    });
+    TestEqual("Names read back wrong while other threads were storing", NumWrongReads.load(), 0);
+
+    // 모든 스레드가 같은 문자열에 같은 Index를 받고, 대소문자만 다르면 비교용 Index만 같아야 합니다.
+    int32 NumDisplayMismatches = 0;
+    int32 NumComparisonMismatches = 0;
+    int32 NumCaseNotIgnored = 0;
+    int32 NumCaseMerged = 0;
+    int32 NumWrongStrings = 0;
+    for (int32 Index = 0; Index < NumNames; ++Index)
+    {
+        const FName& Display = DisplayNames[0][Index];
+        const FName& OtherCase = OtherCaseNames[0][Index];
+        const FName& Wide = WideNames[0][Index];
+        for (int32 ThreadIndex = 1; ThreadIndex < NumThreads; ++ThreadIndex)
+        {
+            NumDisplayMismatches += DisplayNames[ThreadIndex][Index].GetDisplayIndex() != Display.GetDisplayIndex() ? 1 : 0;
+            NumDisplayMismatches += OtherCaseNames[ThreadIndex][Index].GetDisplayIndex() != OtherCase.GetDisplayIndex() ? 1 : 0;
+            NumDisplayMismatches += WideNames[ThreadIndex][Index].GetDisplayIndex() != Wide.GetDisplayIndex() ? 1 : 0;
+            NumComparisonMismatches += DisplayNames[ThreadIndex][Index] != Display ? 1 : 0;
+            NumComparisonMismatches += WideNames[ThreadIndex][Index] != Wide ? 1 : 0;
+        }
+
+        NumCaseNotIgnored += Display != OtherCase ? 1 : 0;
+        NumCaseMerged += Display.GetDisplayIndex() == OtherCase.GetDisplayIndex() ? 1 : 0;
+        NumWrongStrings += Display.ToString().Equals(Names.Display[Index]) ? 0 : 1;
+        NumWrongStrings += OtherCase.ToString().Equals(Names.OtherCase[Index]) ? 0 : 1;
+        NumWrongStrings += Wide.ToString().Equals(Names.Wide[Index]) ? 0 : 1;
+    }
+    TestEqual("Display indices that differ between threads", NumDisplayMismatches, 0);
+    TestEqual("Comparison indices that differ between threads", NumComparisonMismatches, 0);
+    TestEqual("Case variants that compare different", NumCaseNotIgnored, 0);
+    TestEqual("Case variants that share a display string", NumCaseMerged, 0);
+    TestEqual("Names whose string changed", NumWrongStrings, 0);
+
+    // 서로 다른 Name은 Hash가 같아도 다른 Index를 받아야 합니다.
+    int32 NumCollisions = 0;
+    TArray<uint8> SeenComparisonIndices;
+    for (int32 Index = 0; Index < NumNames; ++Index)
+    {
+        for (const FName& Name : { DisplayNames[0][Index], WideNames[0][Index] })
+        {
+            const uint32 ComparisonIndex = Name.GetComparisonIndex();
+            if (ComparisonIndex >= static_cast<uint32>(SeenComparisonIndices.Num()))
+            {
+                SeenComparisonIndices.SetNum(ComparisonIndex + 1);
+            }
+            NumCollisions += SeenComparisonIndices[ComparisonIndex] ? 1 : 0;
+            SeenComparisonIndices[ComparisonIndex] = 1;
+        }
+    }
+    TestEqual("Different names with the same comparison index", NumCollisions, 0);
+
+    TestTrue("Empty string is None", FName("") == NAME_None);
+    TestTrue("\"None\" is None", FName(TEXT("none")) == NAME_None);
+    TestTrue("Ansi and wide names share an entry", FName("NameStress_StaticMeshComponent_0").GetDisplayIndex() == DisplayNames[0][0].GetDisplayIndex());
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FNameBenchmark, "CoreUObject.Name.Speed", EAutomationTestType::Benchmark)
+{
+    constexpr int32 NumNames = 100000;
+    constexpr int32 NumRepeats = 10;
+    constexpr int32 ThreadCounts[] = { 1, 2, 4, 8 };
+
+    // 호출할 때마다 다른 접두사를 써서, 여러 번 실행해도 처음 만드는 비용을 잽니다.
+    static int32 NumRuns = 0;
+    const FTestNames Names(*FString::Printf(TEXT("NameBench%d"), NumRuns++), NumNames);
+
+    TArray<FName> StoredNames;
+    StoredNames.SetNum(NumNames);
+    uint64 StartCycles = FPlatformTime::Cycles64();
+    for (int32 Index = 0; Index < NumNames; ++Index)
+    {
+        StoredNames[Index] = FName(Names.Display[Index]);
+    }
+    const double CreateNs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) * 1.e6 / NumNames;
+
+    // 대부분의 FName 생성은 이미 있는 Name을 찾는 것이므로, Shared Lock 경로의 비용을 잽니다.
+    int32 NumEqual = 0;
+    StartCycles = FPlatformTime::Cycles64();
+    for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+    {
+        for (int32 Index = 0; Index < NumNames; ++Index)
+        {
+            NumEqual += FName(Names.Display[Index]) == StoredNames[Index] ? 1 : 0;
+        }
+    }
+    const double FindNs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) * 1.e6 / (NumNames * NumRepeats);
+
+    uint64 TotalLength = 0;
+    StartCycles = FPlatformTime::Cycles64();
+    for (int32 Repeat = 0; Repeat < NumRepeats; ++Repeat)
+    {
+        for (int32 Index = 0; Index < NumNames; ++Index)
+        {
+            TotalLength += StoredNames[Index].GetDisplayNameView().Len;
+        }
+    }
+    const double ViewNs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) * 1.e6 / (NumNames * NumRepeats);
+
+    StartCycles = FPlatformTime::Cycles64();
+    for (int32 Index = 0; Index < NumNames; ++Index)
+    {
+        TotalLength += StoredNames[Index].ToString().Len();
+    }
+    const double ToStringNs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) * 1.e6 / NumNames;
+
+    AddInfo(FString::Printf(TEXT("%d names: create %.1f ns, find existing %.1f ns, view %.1f ns, ToString %.1f ns"),
+        NumNames, CreateNs, FindNs, ViewNs, ToStringNs));
+
+    // 스레드 수를 늘려도 Shard마다 Lock이 따로 있으므로 처리량이 함께 늘어야 합니다.
+    for (const int32 NumThreads : ThreadCounts)
+    {
+        std::atomic<int32> NumFound = 0;
+        StartCycles = FPlatformTime::Cycles64();
+        RunOnThreads(NumThreads, [&](int32 ThreadIndex)
+        {
+            int32 NumLocalFound = 0;
+            for (int32 Step = 0; Step < NumNames; ++Step)
+            {
+                const int32 Index = (Step + ThreadIndex * (NumNames / NumThreads)) % NumNames;
+                NumLocalFound += FName(Names.Display[Index]) == StoredNames[Index] ? 1 : 0;
+            }
+            NumFound.fetch_add(NumLocalFound);
+        });
+        const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        AddInfo(FString::Printf(TEXT("%d threads: %.2f M finds/s (%d found)"),
+            NumThreads, NumThreads * NumNames / (ElapsedMs * 1.e3), NumFound.load()));
+    }
+    AddInfo(FString::Printf(TEXT("Checksum %d, %llu"), NumEqual, TotalLength));
+    return true;
+}
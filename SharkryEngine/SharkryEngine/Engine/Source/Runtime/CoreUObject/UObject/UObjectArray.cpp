@@ -1,28 +1,75 @@
 ﻿#include "UObjectArray.h"
 #include "Object.h"
+#include "Class.h"
 #include "UObjectHash.h"
 
+#include <memory>
+
 
 void FUObjectArray::AddObject(UObject* Object)
 {
-    ObjObjects.Add(Object);
+    const int32 Index = ObjObjects.Add(Object);
+    Object->InternalIndex = Index;
+
+    if (Index >= ObjectSerialNumbers.Num())
+    {
+        ObjectSerialNumbers.SetNum(ObjObjects.GetMaxIndex());
+    }
+    ObjectSerialNumbers[Index] = ++MasterSerialNumber;
+
     AddToClassMap(Object);
 }
 
 void FUObjectArray::MarkRemoveObject(UObject* Object)
 {
-    ObjObjects.Remove(Object);
+    // Add가 반환한 Index로 제거하므로 다른 Object와 비교할 필요가 없습니다.
+    const int32 Index = static_cast<int32>(Object->InternalIndex);
+    if (!ObjObjects.IsValidIndex(Index) || ObjObjects[Index] != Object)
+    {
+        // 이미 배열에서 빠졌다면 제거 대기 목록에도 들어있으므로, 목록을 검색하지 않고 중복을 걸러냅니다.
+        return;
+    }
+
+    ObjObjects.RemoveAt(Index);
+    Object->InternalIndex = INDEX_NONE;
+
+    // 이 자리를 가리키던 Weak Pointer는 이 시점부터 무효가 됩니다.
+    ObjectSerialNumbers[Index] = 0;
+
     RemoveFromClassMap(Object);  // UObjectHashTable에서 Object를 제외
-    PendingDestroyObjects.AddUnique(Object);
+    PendingDestroyObjects.Add(Object);
 }
 
 void FUObjectArray::ProcessPendingDestroyObjects()
 {
-    for (UObject* Object : PendingDestroyObjects)
+    // 소멸자에서 다른 Object를 제거 대기 목록에 넣을 수 있으므로, 목록을 떼어낸 뒤 순회하고 새로 쌓인 만큼 반복합니다.
+    while (!PendingDestroyObjects.IsEmpty())
     {
-        delete Object;
+        TArray<UObject*> DestroyBatch = std::move(PendingDestroyObjects);
+        PendingDestroyObjects.Empty();
+
+        for (UObject* Object : DestroyBatch)
+        {
+            // ClassCTOR가 클래스별 Slab에서 할당했으므로, 소멸자만 호출하고 메모리는 같은 클래스의 Allocator로 반환합니다.
+            UClass* Class = Object->GetClass();
+            std::destroy_at(Object);
+            Class->FreeObjectMemory(Object);
+        }
     }
-    PendingDestroyObjects.Empty();
+
+    // 순회가 끝난 시점에 클래스별 Object 목록의 빈 자리 정리
+    CompactClassObjectLists();
+}
+
+void FUObjectArray::ReissueSerialNumber(const UObject* Object)
+{
+    const int32 Index = static_cast<int32>(Object->InternalIndex);
+    if (!ObjObjects.IsValidIndex(Index) || ObjObjects[Index] != Object)
+    {
+        return;
+    }
+
+    ObjectSerialNumbers[Index] = ++MasterSerialNumber;
 }
 
 FUObjectArray GUObjectArray;
@@ -10,10 +10,43 @@ class FUObjectArray
 {
 public:
     void AddObject(UObject* Object);
+
+    /**
+     * Object를 배열에서 빼고 제거 대기 목록에 넣습니다. 실제 소멸은 ProcessPendingDestroyObjects에서 한 번에 처리합니다.
+     * 이미 제거 대기중인 Object는 무시합니다.
+     */
     void MarkRemoveObject(UObject* Object);
 
     void ProcessPendingDestroyObjects();
 
+    /**
+     * Object가 있는 자리에 새 Serial Number를 발급합니다.
+     * 제거하지 않고 다른 용도로 재사용하는 Object(Pool에 반환된 Actor 등)에 호출하면, 그 전에 만든 Weak Pointer는 nullptr를 반환합니다.
+     * 배열에 없는 Object는 무시합니다.
+     */
+    void ReissueSerialNumber(const UObject* Object);
+
+    /** Index 자리에 있는 Object, 비어있다면 nullptr */
+    UObject* GetObjectAt(int32 Index) const
+    {
+        return ObjObjects.IsValidIndex(Index) ? ObjObjects[Index] : nullptr;
+    }
+
+    /**
+     * Index 자리에 있는 Object의 Serial Number, 비어있다면 0
+     * Object마다 새로운 번호가 붙으므로, 같은 Index가 다른 Object에 재사용되어도 번호로 구분할 수 있습니다.
+     */
+    int32 GetSerialNumber(int32 Index) const
+    {
+        return Index >= 0 && Index < ObjectSerialNumbers.Num() ? ObjectSerialNumbers[Index] : 0;
+    }
+
+    /** Index, SerialNumber가 가리키던 Object가 아직 제거되지 않았는지 확인합니다. */
+    bool IsValid(int32 Index, int32 SerialNumber) const
+    {
+        return SerialNumber != 0 && GetSerialNumber(Index) == SerialNumber;
+    }
+
     TSet<UObject*>& GetObjectItemArrayUnsafe()
     {
         return ObjObjects;
@@ -27,6 +60,12 @@ public:
 private:
     TSet<UObject*> ObjObjects;
     TArray<UObject*> PendingDestroyObjects;
+
+    /** ObjObjects의 Index별 Serial Number, TWeakObjectPtr의 유효성 판정에 사용합니다. */
+    TArray<int32> ObjectSerialNumbers;
+
+    /** 마지막으로 발급한 Serial Number, 0은 빈 자리를 뜻하므로 1부터 발급합니다. */
+    int32 MasterSerialNumber = 0;
 };
 
 extern FUObjectArray GUObjectArray;
@@ -2,11 +2,12 @@
 #include <cassert>
 #include "Object.h"
 #include "Class.h"
-#include "Container/Map.h"
-#include "Container/Set.h"
 
 /**
  * 모든 UObject의 정보를 담고 있는 HashTable
+ *
+ * Object 목록은 각 UClass가 직접 들고 있고(UClass::ClassObjects),
+ * Object는 그 목록에서의 Index를 기억하므로 추가/제거가 O(1)입니다.
  */
 struct FUObjectHashTables
 {
@@ -16,101 +17,108 @@ struct FUObjectHashTables
         return Singleton;
     }
 
-    TMap<UClass*, TSet<UClass*>> ClassToChildListMap;
-    TMap<UClass*, TSet<UObject*>> ClassToObjectListMap;
-};
+    /** 제거된 자리가 남아있는 클래스 목록 */
+    TArray<UClass*> DirtyClasses;
 
-/** Helper function that returns all the children of the specified class recursively */
-template <typename ClassType, typename ArrayAllocator>
-static void RecursivelyPopulateDerivedClasses(FUObjectHashTables& ThreadHash, const UClass* ParentClass, TArray<ClassType, ArrayAllocator>& OutAllDerivedClass)
-{
-    // Start search with the parent class at virtual index Num-1, then continue searching from index Num as things are added
-    int32 SearchIndex = OutAllDerivedClass.Num() - 1;
-    const UClass* SearchClass = ParentClass;
+    void AddObject(UObject* Object)
+    {
+        UClass* Class = Object->GetClass();
+        assert(Object->ClassObjectIndex == INDEX_NONE);
+
+        Object->ClassObjectIndex = Class->ClassObjects.Add(Object);
+        Class->bHasEverInstanced = true;
+    }
 
-    while (true)
+    void RemoveObject(UObject* Object)
     {
-        if (TSet<UClass*>* ChildSet = ThreadHash.ClassToChildListMap.Find(const_cast<UClass*>(SearchClass)))
+        UClass* Class = Object->GetClass();
+        const int32 Index = Object->ClassObjectIndex;
+        if (Index == INDEX_NONE)
         {
-            OutAllDerivedClass.Reserve(OutAllDerivedClass.Num() + ChildSet->Num());
-            for (UClass* ChildClass : *ChildSet)
-            {
-                OutAllDerivedClass.Add(ChildClass);
-            }
+            return;
         }
 
-        // Now search at next index, if it has been filled in by code above
-        ++SearchIndex;
+        assert(Class->ClassObjects[Index] == Object);
+        Class->ClassObjects[Index] = nullptr;
+        Object->ClassObjectIndex = INDEX_NONE;
 
-        if (SearchIndex < OutAllDerivedClass.Num())
+        if (!Class->bClassObjectsDirty)
         {
-            SearchClass = OutAllDerivedClass[SearchIndex];			
+            Class->bClassObjectsDirty = true;
+            DirtyClasses.Add(Class);
         }
-        else
+    }
+
+    void Compact()
+    {
+        for (UClass* Class : DirtyClasses)
         {
-            return;
+            TArray<UObject*>& Objects = Class->ClassObjects;
+            for (int32 Index = 0; Index < Objects.Num();)
+            {
+                if (Objects[Index])
+                {
+                    ++Index;
+                    continue;
+                }
+
+                // 빈 자리를 마지막 Object로 채우기
+                UObject* Last = Objects[Objects.Num() - 1];
+                Objects.SetNum(Objects.Num() - 1);
+
+                if (Last && Index < Objects.Num())
+                {
+                    Objects[Index] = Last;
+                    Last->ClassObjectIndex = Index;
+                    ++Index;
+                }
+            }
+            Class->bClassObjectsDirty = false;
         }
+        DirtyClasses.Empty();
     }
-}
+};
 
 void AddToClassMap(UObject* Object)
 {
     assert(Object->GetClass());
-    FUObjectHashTables& HashTable = FUObjectHashTables::Get();
-
-    UClass* Class = Object->GetClass();
-    HashTable.ClassToObjectListMap.FindOrAdd(Class).Add(Object);
-
-    for (UClass* SuperClass = Class->GetSuperClass(); SuperClass;)
-    {
-        HashTable.ClassToChildListMap.FindOrAdd(SuperClass).Add(Class);
-    
-        Class = SuperClass;
-        SuperClass = SuperClass->GetSuperClass();
-    }
+    FUObjectHashTables::Get().AddObject(Object);
 }
 
 void RemoveFromClassMap(UObject* Object)
 {
     assert(Object->GetClass());
-    FUObjectHashTables& HashTable = FUObjectHashTables::Get();
-
-    TSet<UObject*>& ObjectSet = HashTable.ClassToObjectListMap.FindOrAdd(Object->GetClass());
-    int32 NumRemoved = ObjectSet.Remove(Object);
+    FUObjectHashTables::Get().RemoveObject(Object);
+}
 
-    if (NumRemoved == 0)
-    {
-        HashTable.ClassToObjectListMap.Remove(Object->GetClass());
-    }
+void CompactClassObjectLists()
+{
+    FUObjectHashTables::Get().Compact();
 }
 
 void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results)
 {
     Results.Add(ClassToLookFor);
 
-    FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-    RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, Results);
+    for (UClass* ChildClass : ClassToLookFor->GetDerivedClasses())
+    {
+        if (ChildClass != ClassToLookFor && ChildClass->HasEverInstanced())
+        {
+            Results.Add(ChildClass);
+        }
+    }
 }
 
 void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses)
 {
-    // Most classes searched for have around 10 subclasses, some have hundreds
-    TArray<const UClass*> ClassesToSearch;
-    ClassesToSearch.Add(ClassToLookFor);
-
-    FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-
-    if (bIncludeDerivedClasses)
-    {
-        RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, ClassesToSearch);
-    }
-
+    const TArray<UClass*>& DerivedClasses = ClassToLookFor->GetDerivedClasses();
+    const int32 NumClasses = bIncludeDerivedClasses ? DerivedClasses.Num() : 1;
 
-    for (const UClass* SearchClass : ClassesToSearch)
+    for (int32 ClassIndex = 0; ClassIndex < NumClasses; ++ClassIndex)
     {
-        if (TSet<UObject*>* List = ThreadHash.ClassToObjectListMap.Find(const_cast<UClass*>(SearchClass)))
+        for (UObject* Object : DerivedClasses[ClassIndex]->GetClassObjects())
         {
-            for (const auto& Object : *List)
+            if (Object)
             {
                 Results.Add(Object);
             }
@@ -15,13 +15,19 @@ void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results,
 /** FUObjectHashTables에 Object의 정보를 저장합니다. */
 void AddToClassMap(UObject* Object);
 
-/** FUObjectHashTables에 저장된 Object정보를 제거합니다. */
+/**
+ * FUObjectHashTables에 저장된 Object정보를 제거합니다.
+ * @note 순회중인 TObjectIterator가 깨지지 않도록 자리만 비워두고, 실제 정리는 CompactClassObjectLists에서 합니다.
+ */
 void RemoveFromClassMap(UObject* Object);
 
+/** RemoveFromClassMap으로 비워진 자리를 Swap-Remove로 정리합니다. 순회중이 아닐 때만 호출해야 합니다. */
+void CompactClassObjectLists();
+
 /**
  * ClassToLookFor와 일치하는 자식 UClass를 반환합니다.
  * @param ClassToLookFor 찾을 자식클래스의 부모 클래스
  * @param Results ClassToLookFor의 파생클래스가 담길 목록
- * TODO: GetClassMap 사용해서 Spawn 안 된 UClass도 찾기
+ * @note 한번이라도 Object가 생성된 적이 있는 클래스만 반환합니다.
  */
 void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results);
\ No newline at end of file
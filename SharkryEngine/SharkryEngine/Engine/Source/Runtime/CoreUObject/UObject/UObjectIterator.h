@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include "Object.h"
+#include "Class.h"
 #include "UObjectHash.h"
 #include "Container/Array.h"
 
@@ -8,6 +9,11 @@
 
 /**
  * 특정 타입의 UObject 인스턴스를 순회하기 위한 반복자 클래스입니다.
+ *
+ * 각 UClass가 들고 있는 Object 목록을 복사 없이 직접 순회하며, 반복자 자체도 할당하지 않습니다.
+ * 순회 도중 제거된 Object는 nullptr로 남아 건너뜁니다.
+ * 클래스의 목록에 들어설 때 그 클래스의 Object 개수를 기록하고 거기까지만 순회하므로,
+ * 순회중인 클래스에 새로 생성된 Object는 방문하지 않습니다. 아직 들어서지 않은 클래스의 새 Object는 방문할 수 있습니다.
  * 
  * @tparam T 순회할 UObject 타입 또는 그 파생 클래스
  */
@@ -23,15 +29,22 @@ public:
 
     /** Begin 생성자 */
     explicit TObjectIterator(bool bIncludeDerivedClasses = true)
-        : Index(-1)
+        : Classes(&T::StaticClass()->GetDerivedClasses())
+        , NumClasses(bIncludeDerivedClasses ? Classes->Num() : 1)
+        , ClassIndex(0)
+        , Index(-1)
+        , NumObjects(NumClasses > 0 ? (*Classes)[0]->GetClassObjects().Num() : 0)
     {
-        GetObjectsOfClass(T::StaticClass(), ObjectArray, bIncludeDerivedClasses);
         Advance();
     }
 
     /** End 생성자 */
     TObjectIterator(EEndTagType, const TObjectIterator& Begin)
-        : Index(Begin.ObjectArray.Num())
+        : Classes(Begin.Classes)
+        , NumClasses(Begin.NumClasses)
+        , ClassIndex(Begin.NumClasses)
+        , Index(-1)
+        , NumObjects(0)
     {
     }
 
@@ -50,31 +63,50 @@ public:
         return (T*)GetObject();
     }
 
-    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return Index == Rhs.Index; }
-    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return Index != Rhs.Index; }
+    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return ClassIndex == Rhs.ClassIndex && Index == Rhs.Index; }
+    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return !(*this == Rhs); }
 
 protected:
     UObject* GetObject() const 
     { 
-        return ObjectArray[Index];
+        return (*Classes)[ClassIndex]->GetClassObjects()[Index];
     }
 
     bool Advance()
     {
-        while(++Index < ObjectArray.Num())
+        while (ClassIndex < NumClasses)
         {
-            if (GetObject())
+            const TArray<UObject*>& Objects = (*Classes)[ClassIndex]->GetClassObjects();
+            while (++Index < NumObjects)
             {
-                return true;
+                if (Objects[Index])
+                {
+                    return true;
+                }
             }
+
+            // 다음 클래스에 들어설 때 그 클래스의 Object 개수를 기록합니다.
+            if (++ClassIndex < NumClasses)
+            {
+                NumObjects = (*Classes)[ClassIndex]->GetClassObjects().Num();
+            }
+            Index = -1;
         }
         return false;
     }
 
 protected:
-    /** Results from the GetObjectsOfClass query */
-    TArray<UObject*> ObjectArray;
+    /** 순회할 클래스 목록 (T와 T의 파생 클래스) */
+    const TArray<UClass*>* Classes;
+
+    /** 순회할 클래스 개수, 파생 클래스를 포함하지 않으면 1 */
+    int32 NumClasses;
+
+    int32 ClassIndex;
     int32 Index;
+
+    /** 현재 클래스에 들어설 때의 Object 개수, 새 Object는 목록 뒤에만 추가되므로 이 개수까지만 순회합니다. */
+    int32 NumObjects;
 };
 
 
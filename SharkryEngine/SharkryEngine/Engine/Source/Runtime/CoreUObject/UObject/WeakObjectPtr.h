@@ -0,0 +1,129 @@
+#pragma once
+#include <concepts>
+#include "Object.h"
+#include "UObjectArray.h"
+
+
+/**
+ * Object를 소유하지 않고 가리키는 Pointer
+ *
+ * GUObjectArray의 Index와 Serial Number를 저장하고, Get할 때마다 해당 자리의 Serial Number와 비교합니다.
+ * Object가 제거 대기 목록에 들어간 순간부터 nullptr를 반환하므로, 제거된 Object에 접근하지 않습니다.
+ * 같은 Index가 새 Object에 재사용되어도 Serial Number가 다르므로 새 Object를 가리키지 않습니다.
+ */
+struct FWeakObjectPtr
+{
+    FWeakObjectPtr() = default;
+
+    FWeakObjectPtr(const UObject* Object)
+    {
+        *this = Object;
+    }
+
+    FWeakObjectPtr& operator=(const UObject* Object)
+    {
+        const int32 Index = Object ? static_cast<int32>(Object->GetInternalIndex()) : INDEX_NONE;
+        const int32 SerialNumber = GUObjectArray.GetSerialNumber(Index);
+        if (SerialNumber != 0 && GUObjectArray.GetObjectAt(Index) == Object)
+        {
+            ObjectIndex = Index;
+            ObjectSerialNumber = SerialNumber;
+        }
+        else
+        {
+            // 이미 제거 대기중인 Object는 처음부터 가리키지 않습니다.
+            Reset();
+        }
+        return *this;
+    }
+
+    void Reset()
+    {
+        ObjectIndex = INDEX_NONE;
+        ObjectSerialNumber = 0;
+    }
+
+    /** 가리키는 Object, 제거되었다면 nullptr */
+    UObject* Get() const
+    {
+        return IsValid() ? GUObjectArray.GetObjectAt(ObjectIndex) : nullptr;
+    }
+
+    bool IsValid() const
+    {
+        return GUObjectArray.IsValid(ObjectIndex, ObjectSerialNumber);
+    }
+
+    /** 한번도 Object를 가리킨 적 없거나 Reset된 상태인지 확인합니다. 제거된 Object를 가리키던 경우는 false입니다. */
+    bool IsExplicitlyNull() const
+    {
+        return ObjectIndex == INDEX_NONE;
+    }
+
+    /** 둘 다 제거되었더라도 원래 같은 Object를 가리켰다면 같습니다. */
+    bool operator==(const FWeakObjectPtr& Other) const
+    {
+        return ObjectIndex == Other.ObjectIndex && ObjectSerialNumber == Other.ObjectSerialNumber;
+    }
+
+private:
+    int32 ObjectIndex = INDEX_NONE;
+    int32 ObjectSerialNumber = 0;
+};
+
+
+/**
+ * 타입이 있는 FWeakObjectPtr
+ *
+ * T는 선언 시점에 불완전한 타입이어도 되고, T*를 대입하거나 Get하는 곳에서만 완전한 타입이 필요합니다.
+ */
+template <typename T>
+class TWeakObjectPtr
+{
+public:
+    TWeakObjectPtr() = default;
+    TWeakObjectPtr(std::nullptr_t) {}
+
+    template <typename U>
+        requires std::convertible_to<U*, T*>
+    TWeakObjectPtr(U* Object)
+        : WeakPtr(static_cast<const UObject*>(static_cast<T*>(Object)))
+    {
+    }
+
+    template <typename U>
+        requires std::convertible_to<U*, T*>
+    TWeakObjectPtr(const TWeakObjectPtr<U>& Other)
+        : WeakPtr(Other.WeakPtr)
+    {
+    }
+
+    template <typename U>
+        requires std::convertible_to<U*, T*>
+    TWeakObjectPtr& operator=(U* Object)
+    {
+        WeakPtr = static_cast<const UObject*>(static_cast<T*>(Object));
+        return *this;
+    }
+
+    void Reset() { WeakPtr.Reset(); }
+
+    /** 가리키는 Object, 제거되었다면 nullptr */
+    T* Get() const { return static_cast<T*>(WeakPtr.Get()); }
+
+    bool IsValid() const { return WeakPtr.IsValid(); }
+    bool IsExplicitlyNull() const { return WeakPtr.IsExplicitlyNull(); }
+
+    T* operator->() const { return Get(); }
+    T& operator*() const { return *Get(); }
+    explicit operator bool() const { return IsValid(); }
+
+    template <typename U>
+    bool operator==(const TWeakObjectPtr<U>& Other) const { return WeakPtr == Other.WeakPtr; }
+
+private:
+    template <typename U>
+    friend class TWeakObjectPtr;
+
+    FWeakObjectPtr WeakPtr;
+};
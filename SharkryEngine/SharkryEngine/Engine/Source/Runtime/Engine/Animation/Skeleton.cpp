@@ -8,6 +8,14 @@ void FAnimationPoseData::Resize(int32 NumBones)
     BoneTransformDirtyFlags.SetNum(NumBones);
 }
 
+uint64 FAnimationPoseData::GetAllocatedSize() const
+{
+    return LocalTransforms.GetAllocatedSize()
+        + GlobalTransforms.GetAllocatedSize()
+        + SkinningMatrices.GetAllocatedSize()
+        + BoneTransformDirtyFlags.GetAllocatedSize();
+}
+
 void FAnimationPoseData::MarkAllDirty()
 {
     for (int32 i = 0; i < BoneTransformDirtyFlags.Num(); ++i)
@@ -78,9 +86,9 @@ void USkeleton::AddBone(const FName Name, int32 ParentIdx, const FMatrix& InGlob
     ReferenceSkeleton.RefBonePose.Add(InGlobalBindPose);
 
     // 현재 포즈 크기 조정
-    CurrentPose.Resize(BoneTree.Num());
+    RefPose.Resize(BoneTree.Num());
     bProcessingOrderCacheDirty = true; // 본 구조 변경 시 캐시 더티 처리
-    CurrentPose.MarkAllDirty();      // 새로 본이 추가/변경되었으므로 모든 포즈를 다시 계산해야 함
+    RefPose.MarkAllDirty();      // 새로 본이 추가/변경되었으므로 모든 포즈를 다시 계산해야 함
 }
 void USkeleton::AddBone(const FName Name, const FName ParentName, const FMatrix BindTransform, const FMatrix& InTransformMatrix)
 {
@@ -103,25 +111,25 @@ void USkeleton::AddBone(const FName Name, const FName ParentName, const FMatrix
     AddBone(Name, ParentIdx, BindTransform, InTransformMatrix);
 }
 
-void USkeleton::MarkBoneAndChildrenDirty(int32 BoneIndex)
+void USkeleton::MarkBoneAndChildrenDirty(FAnimationPoseData& Pose, int32 BoneIndex) const
 {
-    if (!BoneTree.IsValidIndex(BoneIndex) || !CurrentPose.BoneTransformDirtyFlags.IsValidIndex(BoneIndex))
+    if (!BoneTree.IsValidIndex(BoneIndex) || !Pose.BoneTransformDirtyFlags.IsValidIndex(BoneIndex))
     {
         return;
     }
 
     TArray<int32> Queue;
     Queue.Add(BoneIndex);
-    CurrentPose.bAnyBoneTransformDirty = true;
+    Pose.bAnyBoneTransformDirty = true;
 
     int32 Head = 0;
     while (Head < Queue.Num())
     {
         int32 CurrentDirtyBoneIndex = Queue[Head++];
-        if (CurrentPose.BoneTransformDirtyFlags.IsValidIndex(CurrentDirtyBoneIndex) &&
-            !CurrentPose.BoneTransformDirtyFlags[CurrentDirtyBoneIndex]) // 아직 dirty가 아니면
+        if (Pose.BoneTransformDirtyFlags.IsValidIndex(CurrentDirtyBoneIndex) &&
+            !Pose.BoneTransformDirtyFlags[CurrentDirtyBoneIndex]) // 아직 dirty가 아니면
         {
-            CurrentPose.BoneTransformDirtyFlags[CurrentDirtyBoneIndex] = true;
+            Pose.BoneTransformDirtyFlags[CurrentDirtyBoneIndex] = true;
             if (BoneTree.IsValidIndex(CurrentDirtyBoneIndex)) { // BoneTree 접근 전 유효성 검사
                 for (int32 ChildIdx : BoneTree[CurrentDirtyBoneIndex].ChildBoneIndices)
                 {
@@ -132,6 +140,13 @@ void USkeleton::MarkBoneAndChildrenDirty(int32 BoneIndex)
     }
 }
 
+void USkeleton::InitializePose(FAnimationPoseData& OutPose) const
+{
+    OutPose = RefPose;
+    OutPose.Resize(BoneTree.Num());
+    OutPose.MarkAllDirty();
+}
+
 void USkeleton::FinalizeBoneHierarchy()
 {
     // 각 본의 ChildBoneIndices 채우기
@@ -148,7 +163,7 @@ void USkeleton::FinalizeBoneHierarchy()
         }
     }
     CalculateAndCacheProcessingOrder_Internal(); // 처리 순서 캐시 업데이트
-    CurrentPose.MarkAllDirty();                  // 전체 업데이트 필요 표시
+    RefPose.MarkAllDirty();                  // 전체 업데이트 필요 표시
 }
 
 uint32 USkeleton::GetBoneIndex(const FName Name) const
@@ -238,7 +253,7 @@ void USkeleton::UpdateCurrentPose(const TArray<FMatrix>& LocalAnimationTransform
     //}
 }
 
-TArray<int32> USkeleton::GetProcessingOrder()
+const TArray<int32>& USkeleton::GetProcessingOrder() const
 {
     return CachedProcessingOrder;
 }
@@ -43,6 +43,7 @@ struct FSkeletonToMeshLinkup
 };
 
 // Pose data of current animation
+// 본 속성별로 배열을 나눠 저장(SoA)하며, SkeletalMeshComponent 인스턴스마다 하나씩 가집니다.
 struct FAnimationPoseData
 {
     // 각 본의 로컬 변환 행렬 (애니메이션 적용 후)
@@ -56,10 +57,13 @@ struct FAnimationPoseData
     
     TArray<uint8> BoneTransformDirtyFlags;
     
-    bool bAnyBoneTransformDirty;      
+    bool bAnyBoneTransformDirty = false;
 
     void Resize(int32 NumBones);
     void MarkAllDirty();
+
+    /** 포즈 버퍼들이 할당한 메모리 크기(Byte) */
+    uint64 GetAllocatedSize() const;
 };
 
 class USkeleton : public UObject
@@ -79,9 +83,9 @@ public:
     // Mesh - Skeleton index cache 나중에 필요 시 사용
     TArray<FSkeletonToMeshLinkup> LinkupCache;
 
-    // 현재 애니메이션 포즈 데이터 - Unreal기준 USkeleton에 없으나 임시 사용
-    // 본 변형으로 자세가 변경된 경우 여기서 참조
-    FAnimationPoseData CurrentPose;
+    // 바인드 포즈로 계산된 기준 포즈 - 인스턴스 포즈의 초기값
+    // 실제 자세는 컴포넌트마다 가지는 FAnimationPoseData에 저장
+    FAnimationPoseData RefPose;
 
 public:
     USkeleton();
@@ -100,9 +104,12 @@ public:
     void AddBone(const FName Name, const FName ParentName, const FMatrix BindTransform, const FMatrix& InTransformMatrix);
 
     // Dirty Flag 관련 함수
-    void MarkBoneAndChildrenDirty(int32 BoneIndex); // 특정 본과 그 자식들을 Dirty로 표시
+    void MarkBoneAndChildrenDirty(FAnimationPoseData& Pose, int32 BoneIndex) const; // 특정 본과 그 자식들을 Dirty로 표시
     void FinalizeBoneHierarchy(); // AddBone이 모두 끝난 후 호출하여 ChildBoneIndices 채우기 등
 
+    // RefPose로 인스턴스 포즈를 초기화
+    void InitializePose(FAnimationPoseData& OutPose) const;
+
     // 본 이름으로 인덱스 가져오기
     uint32 GetBoneIndex(const FName Name) const;
 
@@ -123,7 +130,7 @@ public:
     // 현재 애니메이션 포즈 업데이트
     void UpdateCurrentPose(const TArray<FMatrix>& LocalAnimationTransforms);
 
-    TArray<int32> GetProcessingOrder();
+    const TArray<int32>& GetProcessingOrder() const;
     // 메시-스켈레톤 링크업 데이터 찾기 또는 추가 
     /*const FSkeletonToMeshLinkup& FindOrAddMeshLinkupData(const UObject* InMesh);*/
 
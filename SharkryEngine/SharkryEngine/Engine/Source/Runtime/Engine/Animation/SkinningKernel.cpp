@@ -0,0 +1,175 @@
+#include "SkinningKernel.h"
+#include "FLoaderFBX.h"
+#include "Async/JobSystem.h"
+#include "Math/MathSSE.h"
+
+void FSkinningKernel::BuildNormalMatrices(const TArray<FMatrix>& InSkinningMatrices, TArray<FMatrix>& OutNormalMatrices)
+{
+    const int32 NumBones = InSkinningMatrices.Num();
+    OutNormalMatrices.SetNum(NumBones);
+
+    for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+    {
+        FMatrix NormalMatrix = InSkinningMatrices[BoneIndex];
+        NormalMatrix.RemoveTranslation();
+
+        if (FMath::Abs(NormalMatrix.Determinant()) > SMALL_NUMBER)
+        {
+            // 법선 벡터 변환을 위한 역전치(inverse transpose) 행렬
+            OutNormalMatrices[BoneIndex] = FMatrix::Transpose(FMatrix::InverseAffine(NormalMatrix));
+        }
+        else
+        {
+            OutNormalMatrices[BoneIndex] = FMatrix::Identity;
+        }
+    }
+}
+
+void FSkinningKernel::SkinVertices(
+    const FBX::FSkeletalMeshVertex* InBindVertices,
+    FBX::FSkeletalMeshVertex* OutVertices,
+    int32 VertexCount,
+    const FSkinningBoneMatrices& InBones
+)
+{
+    // 구간마다 출력 영역이 겹치지 않으므로 동기화 없이 기록합니다.
+    // 호출마다 스레드를 만들지 않고 GJobSystem의 Worker에 나눠 맡기며, 작은 메시는 ParallelFor가 호출한 스레드에서 바로 처리합니다.
+    GJobSystem.ParallelFor(VertexCount, MinVerticesPerTask, [=, &InBones](int32 BeginIndex, int32 EndIndex)
+    {
+        SkinVerticesRange(InBindVertices, OutVertices, BeginIndex, EndIndex, InBones);
+    });
+}
+
+void FSkinningKernel::SkinVerticesRange(
+    const FBX::FSkeletalMeshVertex* InBindVertices,
+    FBX::FSkeletalMeshVertex* OutVertices,
+    int32 BeginIndex,
+    int32 EndIndex,
+    const FSkinningBoneMatrices& InBones
+)
+{
+    const uint32 NumBones = static_cast<uint32>(InBones.NumBones);
+    const VectorRegister4Float Zero = _mm_setzero_ps();
+
+    alignas(16) float Position[4];
+    alignas(16) float Normal[4];
+
+    for (int32 i = BeginIndex; i < EndIndex; ++i)
+    {
+        const FBX::FSkeletalMeshVertex& BindVertex = InBindVertices[i];
+        FBX::FSkeletalMeshVertex& SkinnedVertex = OutVertices[i];
+
+        // 초기화: 바인드 포즈 정점의 속성 복사
+        SkinnedVertex = BindVertex;
+
+        // 영향을 주는 본 행렬들을 가중치로 먼저 섞어서 정점 변환을 한 번으로 줄입니다.
+        VectorRegister4Float Skin0 = Zero, Skin1 = Zero, Skin2 = Zero, Skin3 = Zero;
+        VectorRegister4Float Normal0 = Zero, Normal1 = Zero, Normal2 = Zero;
+        float TotalWeight = 0.0f;
+
+        for (int32 j = 0; j < MAX_BONE_INFLUENCES; ++j)
+        {
+            const float Weight = BindVertex.BoneWeights[j];
+            const uint32 BoneIndex = BindVertex.BoneIndices[j];
+            if (Weight <= KINDA_SMALL_NUMBER || BoneIndex >= NumBones)
+            {
+                continue;
+            }
+
+            TotalWeight += Weight;
+
+            const VectorRegister4Float WeightVec = _mm_set1_ps(Weight);
+            const float* SkinRows = &InBones.SkinningMatrices[BoneIndex].M[0][0];
+            const float* NormalRows = &InBones.NormalMatrices[BoneIndex].M[0][0];
+
+            Skin0 = SSE::VectorMultiplyAdd(WeightVec, _mm_load_ps(SkinRows + 0), Skin0);
+            Skin1 = SSE::VectorMultiplyAdd(WeightVec, _mm_load_ps(SkinRows + 4), Skin1);
+            Skin2 = SSE::VectorMultiplyAdd(WeightVec, _mm_load_ps(SkinRows + 8), Skin2);
+            Skin3 = SSE::VectorMultiplyAdd(WeightVec, _mm_load_ps(SkinRows + 12), Skin3);
+
+            Normal0 = SSE::VectorMultiplyAdd(WeightVec, _mm_load_ps(NormalRows + 0), Normal0);
+            Normal1 = SSE::VectorMultiplyAdd(WeightVec, _mm_load_ps(NormalRows + 4), Normal1);
+            Normal2 = SSE::VectorMultiplyAdd(WeightVec, _mm_load_ps(NormalRows + 8), Normal2);
+        }
+
+        // 해당 정점에 영향을 주는 본이 없으면 바인드 포즈 그대로 사용
+        if (TotalWeight <= KINDA_SMALL_NUMBER)
+        {
+            continue;
+        }
+
+        // 행 벡터 기준: P' = x * Row0 + y * Row1 + z * Row2 + Row3
+        VectorRegister4Float SkinnedPosition = SSE::VectorMultiplyAdd(_mm_set1_ps(BindVertex.Position.X), Skin0, Skin3);
+        SkinnedPosition = SSE::VectorMultiplyAdd(_mm_set1_ps(BindVertex.Position.Y), Skin1, SkinnedPosition);
+        SkinnedPosition = SSE::VectorMultiplyAdd(_mm_set1_ps(BindVertex.Position.Z), Skin2, SkinnedPosition);
+
+        VectorRegister4Float SkinnedNormal = SSE::VectorMultiply(_mm_set1_ps(BindVertex.Normal.X), Normal0);
+        SkinnedNormal = SSE::VectorMultiplyAdd(_mm_set1_ps(BindVertex.Normal.Y), Normal1, SkinnedNormal);
+        SkinnedNormal = SSE::VectorMultiplyAdd(_mm_set1_ps(BindVertex.Normal.Z), Normal2, SkinnedNormal);
+
+        // 가중치 합이 1이 아니면 정규화
+        if (!FMath::IsNearlyEqual(TotalWeight, 1.0f))
+        {
+            const VectorRegister4Float InvWeight = _mm_set1_ps(1.0f / TotalWeight);
+            SkinnedPosition = SSE::VectorMultiply(SkinnedPosition, InvWeight);
+            SkinnedNormal = SSE::VectorMultiply(SkinnedNormal, InvWeight);
+        }
+
+        _mm_store_ps(Position, SkinnedPosition);
+        _mm_store_ps(Normal, SkinnedNormal);
+
+        SkinnedVertex.Position = FVector(Position[0], Position[1], Position[2]);
+        SkinnedVertex.Normal = FVector(Normal[0], Normal[1], Normal[2]).GetSafeNormal();
+    }
+}
+
+void FSkinningKernel::SkinVerticesScalar(
+    const FBX::FSkeletalMeshVertex* InBindVertices,
+    FBX::FSkeletalMeshVertex* OutVertices,
+    int32 VertexCount,
+    const FSkinningBoneMatrices& InBones
+)
+{
+    const uint32 NumBones = static_cast<uint32>(InBones.NumBones);
+
+    for (int32 i = 0; i < VertexCount; ++i)
+    {
+        const FBX::FSkeletalMeshVertex& BindVertex = InBindVertices[i];
+        FBX::FSkeletalMeshVertex& SkinnedVertex = OutVertices[i];
+
+        SkinnedVertex = BindVertex;
+
+        FVector SkinnedPosition = FVector::ZeroVector;
+        FVector SkinnedNormal = FVector::ZeroVector;
+        float TotalWeight = 0.0f;
+
+        for (int32 j = 0; j < MAX_BONE_INFLUENCES; ++j)
+        {
+            const float Weight = BindVertex.BoneWeights[j];
+            const uint32 BoneIndex = BindVertex.BoneIndices[j];
+            if (Weight <= KINDA_SMALL_NUMBER || BoneIndex >= NumBones)
+            {
+                continue;
+            }
+
+            TotalWeight += Weight;
+            SkinnedPosition += InBones.SkinningMatrices[BoneIndex].TransformPosition(BindVertex.Position) * Weight;
+            SkinnedNormal += FMatrix::TransformVector(BindVertex.Normal, InBones.NormalMatrices[BoneIndex]) * Weight;
+        }
+
+        if (TotalWeight <= KINDA_SMALL_NUMBER)
+        {
+            continue;
+        }
+
+        if (!FMath::IsNearlyEqual(TotalWeight, 1.0f))
+        {
+            const float InvWeight = 1.0f / TotalWeight;
+            SkinnedPosition *= InvWeight;
+            SkinnedNormal *= InvWeight;
+        }
+
+        SkinnedVertex.Position = SkinnedPosition;
+        SkinnedVertex.Normal = SkinnedNormal.GetSafeNormal();
+    }
+}
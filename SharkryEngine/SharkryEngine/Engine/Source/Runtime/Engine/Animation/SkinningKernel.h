@@ -0,0 +1,61 @@
+#pragma once
+#include "Math/Matrix.h"
+#include "Container/Array.h"
+
+namespace FBX
+{
+    struct FSkeletalMeshVertex;
+}
+
+/** 스키닝 커널에 넘기는 본 행렬 묶음, 프레임마다 본 단위로 한 번만 계산합니다. */
+struct FSkinningBoneMatrices
+{
+    /** 본별 스키닝 행렬 (아핀 행렬로 가정) */
+    const FMatrix* SkinningMatrices = nullptr;
+
+    /** 본별 법선 행렬 (스키닝 행렬 3x3의 역전치), BuildNormalMatrices로 생성 */
+    const FMatrix* NormalMatrices = nullptr;
+
+    int32 NumBones = 0;
+};
+
+/**
+ * D3D 리소스에 의존하지 않는 CPU 스키닝 커널
+ *
+ * 정점마다 영향을 주는 본 행렬을 가중치로 먼저 섞은 뒤(Linear Blend) SSE로 한 번만 변환하며,
+ * 정점 수가 많으면 구간을 나눠 여러 스레드에서 동시에 처리합니다.
+ * 결과는 호출자가 넘긴 버퍼에 기록하므로 GPU 업로드는 별도 단계에서 수행합니다.
+ */
+struct FSkinningKernel
+{
+    /** Job 하나가 맡는 최소 정점 수, 이보다 작은 메시는 호출한 스레드에서만 처리합니다. */
+    static constexpr int32 MinVerticesPerTask = 8192;
+
+    /** 스키닝 행렬로부터 본별 법선 행렬을 계산합니다. 특이 행렬이면 Identity를 사용합니다. */
+    static void BuildNormalMatrices(const TArray<FMatrix>& InSkinningMatrices, TArray<FMatrix>& OutNormalMatrices);
+
+    /** SSE 커널로 스키닝하며, 정점 수에 따라 워커 스레드로 분할합니다. */
+    static void SkinVertices(
+        const FBX::FSkeletalMeshVertex* InBindVertices,
+        FBX::FSkeletalMeshVertex* OutVertices,
+        int32 VertexCount,
+        const FSkinningBoneMatrices& InBones
+    );
+
+    /** [BeginIndex, EndIndex) 구간을 현재 스레드에서 SSE로 스키닝합니다. */
+    static void SkinVerticesRange(
+        const FBX::FSkeletalMeshVertex* InBindVertices,
+        FBX::FSkeletalMeshVertex* OutVertices,
+        int32 BeginIndex,
+        int32 EndIndex,
+        const FSkinningBoneMatrices& InBones
+    );
+
+    /** 비교 및 검증용 스칼라 구현 */
+    static void SkinVerticesScalar(
+        const FBX::FSkeletalMeshVertex* InBindVertices,
+        FBX::FSkeletalMeshVertex* OutVertices,
+        int32 VertexCount,
+        const FSkinningBoneMatrices& InBones
+    );
+};
@@ -0,0 +1,198 @@
+#include "Misc/AutomationTest.h"
+#include "WindowsPlatformTime.h"
+#include "Async/JobSystem.h"
+#include "Animation/SkinningKernel.h"
+#include "FLoaderFBX.h"
+
+namespace
+{
+    /** 실행마다 같은 본과 정점이 나오도록 하는 간단한 난수 */
+    struct FTestRandom
+    {
+        uint32 State = 12345u;
+
+        uint32 Next()
+        {
+            State = State * 1664525u + 1013904223u;
+            return State >> 8;
+        }
+
+        float Range(float Min, float Max)
+        {
+            return Min + (Max - Min) * static_cast<float>(Next() & 0xFFFF) / 65535.f;
+        }
+    };
+
+    /** 회전, 비균등 Scale, 이동이 섞인 아핀 스키닝 행렬 */
+    void MakeTestBones(int32 NumBones, FTestRandom& Random, TArray<FMatrix>& OutSkinningMatrices)
+    {
+        OutSkinningMatrices.SetNum(NumBones);
+        for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+        {
+            FMatrix Bone = FMatrix::CreateScaleMatrix(Random.Range(0.8f, 1.2f), Random.Range(0.8f, 1.2f), Random.Range(0.8f, 1.2f))
+                * FMatrix::CreateRotationMatrix(Random.Range(-90.f, 90.f), Random.Range(-90.f, 90.f), Random.Range(-90.f, 90.f));
+            Bone.M[3][0] = Random.Range(-1.f, 1.f);
+            Bone.M[3][1] = Random.Range(-1.f, 1.f);
+            Bone.M[3][2] = Random.Range(-1.f, 1.f);
+            OutSkinningMatrices[BoneIndex] = Bone;
+        }
+    }
+
+    /**
+     * 가중치 합이 1이 아니거나, 0인 가중치와 범위 밖 본 Index가 섞인 정점
+     * 몇 개는 영향을 주는 본이 하나도 없어서 바인드 포즈를 그대로 써야 합니다.
+     */
+    void MakeTestVertices(int32 NumVertices, int32 NumBones, FTestRandom& Random, TArray<FBX::FSkeletalMeshVertex>& OutVertices)
+    {
+        OutVertices.SetNum(NumVertices);
+        for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+        {
+            FBX::FSkeletalMeshVertex& Vertex = OutVertices[VertexIndex];
+            Vertex = FBX::FSkeletalMeshVertex();
+            Vertex.Position = FVector(Random.Range(-10.f, 10.f), Random.Range(-10.f, 10.f), Random.Range(-10.f, 10.f));
+            Vertex.Normal = FVector(Random.Range(-1.f, 1.f), Random.Range(-1.f, 1.f), Random.Range(-1.f, 1.f)).GetSafeNormal();
+            if (VertexIndex % 97 == 0)
+            {
+                continue;
+            }
+
+            for (int32 Influence = 0; Influence < MAX_BONE_INFLUENCES; ++Influence)
+            {
+                Vertex.BoneIndices[Influence] = Random.Next() % (NumBones + 2);
+                Vertex.BoneWeights[Influence] = Random.Next() % 5 == 0 ? 0.f : Random.Range(0.f, 1.f);
+            }
+        }
+    }
+
+    float MaxDistance(const FVector& A, const FVector& B, float Current)
+    {
+        return FMath::Max(Current, (A - B).Length());
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FSkinningKernelMatchesScalarTest, "Engine.Animation.SkinningKernel.MatchesScalar", EAutomationTestType::Unit)
+{
+    constexpr int32 NumBones = 60;
+    constexpr int32 NumVertices = FSkinningKernel::MinVerticesPerTask * 3 + 123;
+    constexpr float PositionTolerance = 1.e-4f;
+    constexpr float NormalTolerance = 1.e-5f;
+
+    FTestRandom Random;
+    TArray<FMatrix> SkinningMatrices;
+    MakeTestBones(NumBones, Random, SkinningMatrices);
+    TArray<FBX::FSkeletalMeshVertex> BindVertices;
+    MakeTestVertices(NumVertices, NumBones, Random, BindVertices);
+
+    TArray<FMatrix> NormalMatrices;
+    FSkinningKernel::BuildNormalMatrices(SkinningMatrices, NormalMatrices);
+    TestEqual("Normal matrices", NormalMatrices.Num(), NumBones);
+
+    FSkinningBoneMatrices Bones;
+    Bones.SkinningMatrices = SkinningMatrices.GetData();
+    Bones.NormalMatrices = NormalMatrices.GetData();
+    Bones.NumBones = NumBones;
+
+    TArray<FBX::FSkeletalMeshVertex> ScalarVertices;
+    TArray<FBX::FSkeletalMeshVertex> RangeVertices;
+    TArray<FBX::FSkeletalMeshVertex> ParallelVertices;
+    ScalarVertices.SetNum(NumVertices);
+    RangeVertices.SetNum(NumVertices);
+    ParallelVertices.SetNum(NumVertices);
+    FSkinningKernel::SkinVerticesScalar(BindVertices.GetData(), ScalarVertices.GetData(), NumVertices, Bones);
+    FSkinningKernel::SkinVerticesRange(BindVertices.GetData(), RangeVertices.GetData(), 0, NumVertices, Bones);
+    FSkinningKernel::SkinVertices(BindVertices.GetData(), ParallelVertices.GetData(), NumVertices, Bones);
+
+    // SSE 커널은 행렬을 먼저 섞고 한 번만 변환하므로 연산 순서가 달라, 스칼라 결과와 부동소수점 오차만큼 다를 수 있습니다.
+    float MaxRangePositionError = 0.f;
+    float MaxRangeNormalError = 0.f;
+    int32 NumParallelMismatches = 0;
+    int32 NumUnskinnedChanged = 0;
+    int32 NumAttributesChanged = 0;
+    for (int32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
+    {
+        const FBX::FSkeletalMeshVertex& Scalar = ScalarVertices[VertexIndex];
+        const FBX::FSkeletalMeshVertex& Range = RangeVertices[VertexIndex];
+        const FBX::FSkeletalMeshVertex& Parallel = ParallelVertices[VertexIndex];
+        MaxRangePositionError = MaxDistance(Scalar.Position, Range.Position, MaxRangePositionError);
+        MaxRangeNormalError = MaxDistance(Scalar.Normal, Range.Normal, MaxRangeNormalError);
+
+        // 여러 스레드로 나눠도 정점마다 같은 SSE 코드를 실행하므로 결과가 똑같아야 합니다.
+        NumParallelMismatches += Range.Position != Parallel.Position || Range.Normal != Parallel.Normal ? 1 : 0;
+
+        if (VertexIndex % 97 == 0)
+        {
+            NumUnskinnedChanged += Range.Position != BindVertices[VertexIndex].Position || Range.Normal != BindVertices[VertexIndex].Normal ? 1 : 0;
+        }
+        NumAttributesChanged += Range.TexCoord != BindVertices[VertexIndex].TexCoord || Range.BoneIndices[0] != BindVertices[VertexIndex].BoneIndices[0] ? 1 : 0;
+    }
+
+    TestTrue("SSE positions match the scalar path", MaxRangePositionError <= PositionTolerance);
+    TestTrue("SSE normals match the scalar path", MaxRangeNormalError <= NormalTolerance);
+    TestEqual("Vertices that differ between SkinVertices and SkinVerticesRange", NumParallelMismatches, 0);
+    TestEqual("Vertices without bone influences that moved", NumUnskinnedChanged, 0);
+    TestEqual("Vertices whose other attributes changed", NumAttributesChanged, 0);
+    AddInfo(FString::Printf(TEXT("Max error against the scalar path: position %g, normal %g"), MaxRangePositionError, MaxRangeNormalError));
+
+    // 특이 행렬의 법선 행렬은 Identity로 대신합니다.
+    TArray<FMatrix> SingularMatrices;
+    SingularMatrices.Add(FMatrix::CreateScaleMatrix(1.f, 0.f, 1.f));
+    FSkinningKernel::BuildNormalMatrices(SingularMatrices, NormalMatrices);
+    TestTrue("Normal matrix of a singular bone", NormalMatrices[0] == FMatrix::Identity);
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FSkinningKernelBenchmark, "Engine.Animation.SkinningKernel.Speed", EAutomationTestType::Benchmark)
+{
+    constexpr int32 NumBones = 80;
+    constexpr int32 VertexCounts[] = { 5000, 50000, 200000 };
+    constexpr int32 NumRuns = 10;
+
+    for (const int32 NumVertices : VertexCounts)
+    {
+        FTestRandom Random;
+        TArray<FMatrix> SkinningMatrices;
+        MakeTestBones(NumBones, Random, SkinningMatrices);
+        TArray<FBX::FSkeletalMeshVertex> BindVertices;
+        MakeTestVertices(NumVertices, NumBones, Random, BindVertices);
+
+        TArray<FMatrix> NormalMatrices;
+        FSkinningKernel::BuildNormalMatrices(SkinningMatrices, NormalMatrices);
+
+        FSkinningBoneMatrices Bones;
+        Bones.SkinningMatrices = SkinningMatrices.GetData();
+        Bones.NormalMatrices = NormalMatrices.GetData();
+        Bones.NumBones = NumBones;
+
+        TArray<FBX::FSkeletalMeshVertex> SkinnedVertices;
+        SkinnedVertices.SetNum(NumVertices);
+
+        // 각 방식의 가장 빠른 실행 시간을 비교합니다.
+        double ScalarMs = 0.0;
+        double SSEMs = 0.0;
+        double ParallelMs = 0.0;
+        for (int32 Run = 0; Run < NumRuns; ++Run)
+        {
+            uint64 StartCycles = FPlatformTime::Cycles64();
+            FSkinningKernel::SkinVerticesScalar(BindVertices.GetData(), SkinnedVertices.GetData(), NumVertices, Bones);
+            const double RunScalarMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+            StartCycles = FPlatformTime::Cycles64();
+            FSkinningKernel::SkinVerticesRange(BindVertices.GetData(), SkinnedVertices.GetData(), 0, NumVertices, Bones);
+            const double RunSSEMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+            StartCycles = FPlatformTime::Cycles64();
+            FSkinningKernel::SkinVertices(BindVertices.GetData(), SkinnedVertices.GetData(), NumVertices, Bones);
+            const double RunParallelMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+            ScalarMs = Run == 0 ? RunScalarMs : FMath::Min(ScalarMs, RunScalarMs);
+            SSEMs = Run == 0 ? RunSSEMs : FMath::Min(SSEMs, RunSSEMs);
+            ParallelMs = Run == 0 ? RunParallelMs : FMath::Min(ParallelMs, RunParallelMs);
+        }
+
+        AddInfo(FString::Printf(TEXT("%d vertices, %d bones: scalar %.3f ms, SSE %.3f ms (x%.2f), SSE with %d job threads %.3f ms (x%.2f)"),
+            NumVertices, NumBones, ScalarMs, SSEMs, ScalarMs / SSEMs, GJobSystem.GetNumThreads(), ParallelMs, ScalarMs / ParallelMs));
+    }
+    return true;
+}
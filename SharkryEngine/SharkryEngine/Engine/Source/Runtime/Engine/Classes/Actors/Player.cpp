@@ -424,7 +424,7 @@ void UEditorPlayer::ControlRotation(USceneComponent* Component, UGizmoBaseCompon
         return;
     }
 
-    FMatrix CurrentLocalMatrix = SkeletalMesh->GetBoneLocalMatrix(Skeleton->BoneNameToIndex[SelectedBone->Name]);
+    FMatrix CurrentLocalMatrix = SkeletalMesh->GetBoneLocalMatrix(SkeletalComp->GetPose(), Skeleton->BoneNameToIndex[SelectedBone->Name]);
     // Quat - ToMatrix로 바로 적용 시 포지션이 원점으로 가는 문제가 있음(Why)
     FVector LocalPos = CurrentLocalMatrix.GetTranslationVector();
     FRotator LocalRot = FRotator(CurrentLocalMatrix.ToQuat() * RotationDelta);
@@ -435,12 +435,10 @@ void UEditorPlayer::ControlRotation(USceneComponent* Component, UGizmoBaseCompon
         FMatrix::GetRotationMatrix(LocalRot) *
         FMatrix::GetTranslationMatrix(LocalPos);
     // 5. 새로운 로컬 변환 설정
-    if (SkeletalMesh->SetBoneLocalMatrix(Skeleton->BoneNameToIndex[SelectedBone->Name], NewLocalMatrix))
+    if (SkeletalMesh->SetBoneLocalMatrix(SkeletalComp->GetPose(), Skeleton->BoneNameToIndex[SelectedBone->Name], NewLocalMatrix))
     {
         // 6. 스켈레톤 전체 월드 변환 업데이트 (로컬 변경 후 필수)
-        SkeletalMesh->UpdateWorldTransforms();
-
-        SkeletalMesh->UpdateAndApplySkinning();
+        SkeletalComp->RefreshBoneTransforms();
     }
 #else
     // 쿼터니언의 곱 순서는 delta * current 가 맞음.
@@ -1,6 +1,13 @@
 #include "ActorComponent.h"
 
 #include "GameFramework/Actor.h"
+#include "World/World.h"
+
+UActorComponent::UActorComponent()
+{
+    // 대부분의 Component는 Tick에서 할 일이 없으므로, 필요한 Class만 켜서 Tick 목록을 작게 유지합니다.
+    PrimaryComponentTick.bCanEverTick = false;
+}
 
 
 UObject* UActorComponent::Duplicate(UObject* InOuter)
@@ -10,6 +17,7 @@ UObject* UActorComponent::Duplicate(UObject* InOuter)
     NewComponent->OwnerPrivate = OwnerPrivate;
     NewComponent->bIsActive = bIsActive;
     NewComponent->bAutoActive = bAutoActive;
+    NewComponent->PrimaryComponentTick = PrimaryComponentTick;
 
     return NewComponent;
 }
@@ -79,6 +87,10 @@ void UActorComponent::UninitializeComponent()
     bHasBeenInitialized = false;
 }
 
+void UActorComponent::ResetForReuse()
+{
+}
+
 void UActorComponent::BeginPlay()
 {
     bHasBegunPlay = true;
@@ -136,12 +148,44 @@ void UActorComponent::DestroyComponent(bool bPromoteChildren)
 
 void UActorComponent::Activate()
 {
-    // TODO: Tick 다시 재생
+    SetComponentTickEnabled(true);
     bIsActive = true;
 }
 
 void UActorComponent::Deactivate()
 {
-    // TODO: Tick 멈추기
+    SetComponentTickEnabled(false);
     bIsActive = false;
 }
+
+void UActorComponent::SetComponentTickEnabled(bool bEnabled)
+{
+    if (PrimaryComponentTick.bTickEnabled == bEnabled)
+    {
+        return;
+    }
+
+    PrimaryComponentTick.bTickEnabled = bEnabled;
+
+    if (PrimaryComponentTick.bCanEverTick)
+    {
+        MarkOwnerTickListsDirty();
+    }
+}
+
+void UActorComponent::SetComponentTickInterval(float TickInterval)
+{
+    PrimaryComponentTick.TickInterval = std::max(TickInterval, 0.0f);
+    PrimaryComponentTick.AccumulatedDeltaTime = 0.0f;
+}
+
+void UActorComponent::MarkOwnerTickListsDirty() const
+{
+    if (const AActor* MyOwner = GetOwner())
+    {
+        if (UWorld* World = MyOwner->GetWorld())
+        {
+            World->GetTickTaskManager().MarkTickListsDirty();
+        }
+    }
+}
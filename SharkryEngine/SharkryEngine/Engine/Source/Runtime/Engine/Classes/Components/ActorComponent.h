@@ -13,7 +13,7 @@ private:
     friend class AActor;
 
 public:
-    UActorComponent() = default;
+    UActorComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
 
@@ -42,6 +42,12 @@ public:
     /** Component가 제거되었을 때 호출됩니다. */
     virtual void OnComponentDestroyed();
 
+    /**
+     * Owner Actor가 Actor Pool에서 다시 꺼내질 때 InitializeComponent 이전에 호출됩니다.
+     * 이전에 Spawn되었을 때 Tick 동안 바뀐 값을 새로 Spawn한 Component와 같게 되돌립니다.
+     */
+    virtual void ResetForReuse();
+
     /**
      * Ends gameplay for this component.
      * Called from AActor::EndPlay only
@@ -64,8 +70,27 @@ public:
     /** Component가 현재 활성화 중인지 여부를 반환합니다. */
     bool IsActive() const { return bIsActive; }
 
-    void Activate();
-    void Deactivate();
+    /** Component가 제거중인지 여부를 반환합니다. */
+    bool IsBeingDestroyed() const { return bIsBeingDestroyed; }
+
+    virtual void Activate();
+    virtual void Deactivate();
+
+    /**
+     * Tick을 켜거나 끕니다. 꺼진 Component는 World의 Tick 목록에서 빠지므로 매 프레임 비용이 없습니다.
+     * 목록은 다음 프레임 시작 시 다시 모으므로 Game Thread에서 호출해야 합니다.
+     */
+    void SetComponentTickEnabled(bool bEnabled);
+
+    /** bCanEverTick이고 Tick이 켜져 있는지 여부를 반환합니다. */
+    bool IsComponentTickEnabled() const { return PrimaryComponentTick.IsTickFunctionEnabled(); }
+
+    /** Tick 사이의 최소 간격(초)을 설정합니다. 0이면 매 프레임 Tick합니다. */
+    void SetComponentTickInterval(float TickInterval);
+
+private:
+    /** Owner가 속한 World의 Tick 목록을 다음 프레임에 다시 모으도록 표시합니다. */
+    void MarkOwnerTickListsDirty() const;
 
 private:
     AActor* OwnerPrivate;
@@ -85,4 +110,7 @@ private:
 public:
     /** Component가 초기화 되었을 때, 자동으로 활성화할지 여부 */
     uint8 bAutoActive : 1 = true;
+
+    /** TickComponent의 실행 Group과 스레드 설정, bCanEverTick의 기본값은 false입니다. */
+    FTickFunction PrimaryComponentTick;
 };
@@ -9,6 +9,7 @@
 
 ULuaScriptComponent::ULuaScriptComponent()
 {
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 UObject* ULuaScriptComponent::Duplicate(UObject* InOuter)
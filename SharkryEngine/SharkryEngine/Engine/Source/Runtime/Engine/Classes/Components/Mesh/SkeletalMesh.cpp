@@ -4,6 +4,8 @@
 #include "FLoaderFBX.h"
 #include "Container/String.h"
 #include "UObject/ObjectFactory.h"
+#include "Engine/Animation/SkinningKernel.h"
+#include "Stats/Stats.h"
 //#include " Skeleton.h" // USkeleton 클래스 포함
 
 
@@ -16,12 +18,6 @@ USkeletalMesh::~USkeletalMesh()
 {
     if (SkeletalMeshRenderData == nullptr) return;
 
-    if (SkeletalMeshRenderData->DynamicVertexBuffer)
-    {
-        SkeletalMeshRenderData->DynamicVertexBuffer->Release();
-        SkeletalMeshRenderData->DynamicVertexBuffer = nullptr;
-    }
-
     if (SkeletalMeshRenderData->IndexBuffer)
     {
         SkeletalMeshRenderData->IndexBuffer->Release();
@@ -60,18 +56,18 @@ int32 USkeletalMesh::GetBoneIndexByName(const FName& BoneName) const
     return Skeleton->GetBoneIndex(BoneName);
 }
 
-FMatrix USkeletalMesh::GetBoneLocalMatrix(uint32 BoneIndex) const
+FMatrix USkeletalMesh::GetBoneLocalMatrix(const FAnimationPoseData& Pose, uint32 BoneIndex) const
 {
-    if (!Skeleton || !Skeleton->BoneTree.IsValidIndex(BoneIndex))
+    if (!Skeleton || !Skeleton->BoneTree.IsValidIndex(BoneIndex) || !Pose.LocalTransforms.IsValidIndex(BoneIndex))
     {
         return FMatrix::Identity;
     }
-    return Skeleton->CurrentPose.LocalTransforms[BoneIndex];
+    return Pose.LocalTransforms[BoneIndex];
 }
 
-bool USkeletalMesh::SetBoneLocalMatrix(uint32 BoneIndex, const FMatrix& NewLocalMatrix)
+bool USkeletalMesh::SetBoneLocalMatrix(FAnimationPoseData& Pose, uint32 BoneIndex, const FMatrix& NewLocalMatrix) const
 {
-    if (!Skeleton || !Skeleton->BoneTree.IsValidIndex(BoneIndex))
+    if (!Skeleton || !Skeleton->BoneTree.IsValidIndex(BoneIndex) || !Pose.LocalTransforms.IsValidIndex(BoneIndex))
     {
         return false;
     }
@@ -80,7 +76,7 @@ bool USkeletalMesh::SetBoneLocalMatrix(uint32 BoneIndex, const FMatrix& NewLocal
     {
         for (int c = 0; c < 4; ++c)
         {
-            if (!FMath::IsNearlyEqual(Skeleton->CurrentPose.LocalTransforms[BoneIndex].M[r][c], NewLocalMatrix.M[r][c])) 
+            if (!FMath::IsNearlyEqual(Pose.LocalTransforms[BoneIndex].M[r][c], NewLocalMatrix.M[r][c])) 
             {
                 bChanged = true;
                 break;
@@ -92,23 +88,23 @@ bool USkeletalMesh::SetBoneLocalMatrix(uint32 BoneIndex, const FMatrix& NewLocal
 
     if (bChanged)
     {
-        Skeleton->CurrentPose.LocalTransforms[BoneIndex] = NewLocalMatrix;
-        Skeleton->MarkBoneAndChildrenDirty(BoneIndex); // 변경된 본과 자식들을 dirty로 표시
+        Pose.LocalTransforms[BoneIndex] = NewLocalMatrix;
+        Skeleton->MarkBoneAndChildrenDirty(Pose, BoneIndex); // 변경된 본과 자식들을 dirty로 표시
     }
      return true;
 }
 
 // 회전만 변경하는 새로운 함수 추가
-bool USkeletalMesh::SetBoneRotation(uint32 BoneIndex, const FMatrix& RotationMatrix)
+bool USkeletalMesh::SetBoneRotation(FAnimationPoseData& Pose, uint32 BoneIndex, const FMatrix& RotationMatrix) const
 {
-    if (!Skeleton || !Skeleton->BoneTree.IsValidIndex(BoneIndex))
+    if (!Skeleton || !Skeleton->BoneTree.IsValidIndex(BoneIndex) || !Pose.LocalTransforms.IsValidIndex(BoneIndex))
     {
         return false;
     }
     
     // 기존 행렬에서 이동 성분을 추출
-    FVector Translation = Skeleton->CurrentPose.LocalTransforms[BoneIndex].GetTranslationVector();
-    FVector Scale = Skeleton->CurrentPose.LocalTransforms[BoneIndex].GetScaleVector();
+    FVector Translation = Pose.LocalTransforms[BoneIndex].GetTranslationVector();
+    FVector Scale = Pose.LocalTransforms[BoneIndex].GetScaleVector();
     
     // 회전 행렬에서 회전 성분만 추출하여 사용
     FMatrix RotationOnly = RotationMatrix;
@@ -131,200 +127,122 @@ bool USkeletalMesh::SetBoneRotation(uint32 BoneIndex, const FMatrix& RotationMat
     NewTransform.M[3][2] = Translation.Z;
     
     // 새 행렬로 본 업데이트
-    return SetBoneLocalMatrix(BoneIndex, NewTransform);
+    return SetBoneLocalMatrix(Pose, BoneIndex, NewTransform);
+}
+
+void USkeletalMesh::UpdateWorldTransforms(FAnimationPoseData& Pose) const
+{
+    FAnimationPoseData* Poses[] = { &Pose };
+    UpdateWorldTransforms_Internal(Poses, 1);
+}
+
+void USkeletalMesh::UpdateWorldTransforms(const TArray<FAnimationPoseData*>& Poses) const
+{
+    UpdateWorldTransforms_Internal(Poses.GetData(), Poses.Num());
 }
 
-void USkeletalMesh::UpdateWorldTransforms()
+void USkeletalMesh::UpdateWorldTransforms_Internal(FAnimationPoseData* const* Poses, int32 NumPoses) const
 {
     if (!Skeleton || Skeleton->BoneTree.IsEmpty()) return;
 
-    // Dirty 플래그가 설정된 본이 없으면 업데이트 건너뛰기
-    if (!Skeleton->CurrentPose.bAnyBoneTransformDirty)
+    // 스켈레톤으로부터 캐시된 처리 순서 가져오기
+    const TArray<int32>& CurrentProcessingOrder = Skeleton->GetProcessingOrder();
+    if (CurrentProcessingOrder.IsEmpty())
     {
         return;
     }
 
-    // 스켈레톤으로부터 캐시된 처리 순서 가져오기
-    const TArray<int32>& CurrentProcessingOrder = Skeleton->GetProcessingOrder();
-
-    if (CurrentProcessingOrder.IsEmpty() && !Skeleton->BoneTree.IsEmpty()) 
+    // Dirty 본이 있고 본 개수가 맞는 포즈만 골라냄
+    const int32 NumBones = Skeleton->BoneTree.Num();
+    TArray<FAnimationPoseData*> DirtyPoses;
+    DirtyPoses.Reserve(NumPoses);
+    for (int32 PoseIndex = 0; PoseIndex < NumPoses; ++PoseIndex)
     {
-         return;
+        FAnimationPoseData* Pose = Poses[PoseIndex];
+        if (Pose && Pose->bAnyBoneTransformDirty &&
+            Pose->LocalTransforms.Num() == NumBones &&
+            Pose->GlobalTransforms.Num() == NumBones &&
+            Pose->SkinningMatrices.Num() == NumBones &&
+            Pose->BoneTransformDirtyFlags.Num() == NumBones)
+        {
+            DirtyPoses.Add(Pose);
+        }
     }
 
-    bool bActuallyUpdatedAny = false; 
-    // 실제로 업데이트된 본이 있는지 추적
+    if (DirtyPoses.IsEmpty())
+    {
+        return;
+    }
 
-    // 순서대로 월드 변환 계산
+    // 본 순서를 바깥에, 인스턴스를 안쪽에 두어 본마다 공유 데이터(부모, 바인드 행렬)를 한 번만 계산
     for (int32 BoneIndex : CurrentProcessingOrder)
     {
-        // 배열 접근 전 유효성 검사
-        if (!Skeleton->BoneTree.IsValidIndex(BoneIndex) ||
-            !Skeleton->CurrentPose.LocalTransforms.IsValidIndex(BoneIndex) ||
-            !Skeleton->CurrentPose.GlobalTransforms.IsValidIndex(BoneIndex) ||
-            !Skeleton->CurrentPose.SkinningMatrices.IsValidIndex(BoneIndex) ||
-            !Skeleton->CurrentPose.BoneTransformDirtyFlags.IsValidIndex(BoneIndex))
+        if (!Skeleton->BoneTree.IsValidIndex(BoneIndex))
         {
-             continue;
+            continue;
         }
 
-        // 이 본이 dirty하거나, (또는 부모가 dirty해서 자식도 업데이트해야 하는 경우 - MarkBoneAndChildrenDirty에서 처리됨)
-        if (Skeleton->CurrentPose.BoneTransformDirtyFlags[BoneIndex])
-        {
-            bActuallyUpdatedAny = true;
+        const int32 ParentIdx = Skeleton->BoneTree[BoneIndex].ParentIndex;
+        const bool bHasParent = ParentIdx != INDEX_NONE && Skeleton->BoneTree.IsValidIndex(ParentIdx);
+
+        // 스키닝 행렬 = 지오메트리 오프셋 * 인버스 바인드 포즈 * 애니메이션 행렬, 앞의 두 항은 인스턴스와 무관
+        const FMatrix BindOffset = Skeleton->GetGeometryOffsetTransform(BoneIndex) * Skeleton->GetInverseBindTransform(BoneIndex);
 
-            const FBoneNode& CurrentBone = Skeleton->BoneTree[BoneIndex];
-            const FMatrix& LocalTransform = Skeleton->CurrentPose.LocalTransforms[BoneIndex];
-            int32 ParentIdx = CurrentBone.ParentIndex;
+        for (FAnimationPoseData* Pose : DirtyPoses)
+        {
+            // 부모가 dirty하면 MarkBoneAndChildrenDirty에서 자식도 dirty로 표시됨
+            if (!Pose->BoneTransformDirtyFlags[BoneIndex])
+            {
+                continue;
+            }
 
-            if (ParentIdx != INDEX_NONE)
+            const FMatrix& LocalTransform = Pose->LocalTransforms[BoneIndex];
+            if (bHasParent)
             {
-                // 부모의 GlobalTransform은 ProcessingOrder에 의해 이미 최신 상태여야 함.
-                // (만약 부모가 dirty였다면 이전에 이미 업데이트 되었음)
-                if (!Skeleton->CurrentPose.GlobalTransforms.IsValidIndex(ParentIdx)) 
-                {
-                    Skeleton->CurrentPose.GlobalTransforms[BoneIndex] = LocalTransform;
-                }
-                else 
-                {
-                    const FMatrix& ParentGlobalTransform = Skeleton->CurrentPose.GlobalTransforms[ParentIdx];
-                    Skeleton->CurrentPose.GlobalTransforms[BoneIndex] = LocalTransform * ParentGlobalTransform;
-                }
+                // 부모의 GlobalTransform은 ProcessingOrder에 의해 이미 최신 상태
+                Pose->GlobalTransforms[BoneIndex] = LocalTransform * Pose->GlobalTransforms[ParentIdx];
             }
             else
             {
-                Skeleton->CurrentPose.GlobalTransforms[BoneIndex] = LocalTransform;
+                Pose->GlobalTransforms[BoneIndex] = LocalTransform;
             }
 
-            Skeleton->CurrentPose.SkinningMatrices[BoneIndex] =
-                Skeleton->CalculateSkinningMatrix(BoneIndex, Skeleton->CurrentPose.GlobalTransforms[BoneIndex]);
-
-            Skeleton->CurrentPose.BoneTransformDirtyFlags[BoneIndex] = false; // 업데이트 완료 후 플래그 해제
+            Pose->SkinningMatrices[BoneIndex] = BindOffset * Pose->GlobalTransforms[BoneIndex];
+            Pose->BoneTransformDirtyFlags[BoneIndex] = false; // 업데이트 완료 후 플래그 해제
         }
     }
 
-    if (bActuallyUpdatedAny) 
-    { 
-        // 실제로 업데이트된 본이 있었던 경우에만 전체 플래그 해제
-        // 모든 dirty 본이 처리되었는지 확인 후 bAnyBoneTransformDirty를 false로 설정해야 함.
-        // 간단하게는, 업데이트가 발생했다면 false로 설정.
-        // 더 정확하게는, 모든 BoneTransformDirtyFlags가 false인지 확인 후 설정.
-        // 하지만 MarkBoneAndChildrenDirty에서 bAnyBoneTransformDirty를 true로 설정했으므로,
-        // 업데이트가 한 번이라도 수행되면 false로 설정해도 무방.
-        bool StillDirty = false;
-        for (bool DirtyFlag : Skeleton->CurrentPose.BoneTransformDirtyFlags) 
-        {
-            if (DirtyFlag) 
-            {
-                StillDirty = true;
-                break;
-            }
-        }
-        if (!StillDirty) 
-        {
-            Skeleton->CurrentPose.bAnyBoneTransformDirty = false;
-        }
+    // ProcessingOrder는 모든 본을 포함하므로 순회가 끝나면 dirty 본이 남지 않음
+    for (FAnimationPoseData* Pose : DirtyPoses)
+    {
+        Pose->bAnyBoneTransformDirty = false;
     }
 }
 
-bool USkeletalMesh::UpdateAndApplySkinning()
+bool USkeletalMesh::UpdateSkinning(const FAnimationPoseData& Pose, TArray<FMatrix>& OutNormalMatrices, TArray<FBX::FSkeletalMeshVertex>& OutVertices) const
 {
-    if (!SkeletalMeshRenderData || !SkeletalMeshRenderData->DynamicVertexBuffer ||
-        SkeletalMeshRenderData->BindPoseVertices.IsEmpty() || !Skeleton || Skeleton->BoneTree.IsEmpty())
+    if (!SkeletalMeshRenderData || SkeletalMeshRenderData->BindPoseVertices.IsEmpty() ||
+        !Skeleton || Skeleton->BoneTree.IsEmpty())
     {
         return false;
     }
 
-    ID3D11DeviceContext* DeviceContext = GEngineLoop.GraphicDevice.DeviceContext;
-    // 버퍼 매핑
-    D3D11_MAPPED_SUBRESOURCE MappedResource;
-    HRESULT hr = DeviceContext->Map(SkeletalMeshRenderData->DynamicVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
-    if (FAILED(hr)) return false;
+    QUICK_SCOPE_CYCLE_COUNTER(CPUSkinning_CPU)
 
-    FBX::FSkeletalMeshVertex* SkinnedVertices = static_cast<FBX::FSkeletalMeshVertex*>(MappedResource.pData);
-    const TArray<FBX::FSkeletalMeshVertex>& BindVertices = SkeletalMeshRenderData->BindPoseVertices;
-    const int32 VertexCount = BindVertices.Num();
+    const TArray<FMatrix>& SkinningMatrices = Pose.SkinningMatrices;
 
-    // 스키닝 계산
-    for (int32 i = 0; i < VertexCount; ++i)
-    {
-        const FBX::FSkeletalMeshVertex& BindVertex = BindVertices[i];
-        FBX::FSkeletalMeshVertex& SkinnedVertex = SkinnedVertices[i];
-        
-        // 초기화: 바인드 포즈 정점의 속성 복사
-        SkinnedVertex = BindVertex;
-        
-        // 해당 정점에 영향을 주는 본이 없으면 바인드 포즈 그대로 사용
-        bool bHasInfluence = false;
-        for (int32 j = 0; j < MAX_BONE_INFLUENCES; ++j)
-        {
-            if (BindVertex.BoneWeights[j] > KINDA_SMALL_NUMBER &&
-                Skeleton->BoneTree.IsValidIndex(static_cast<int32>(BindVertex.BoneIndices[j])))
-            {
-                bHasInfluence = true;
-                break;
-            }
-        }
-        
-        if (!bHasInfluence) continue;
-        
-        // 가중 합산을 위한 초기화
-        FVector SkinnedPosition = FVector::ZeroVector;
-        FVector SkinnedNormal = FVector::ZeroVector;
-        
-        // 각 본의 영향력을 합산
-        float TotalWeight = 0.0f;
-        for (int32 j = 0; j < MAX_BONE_INFLUENCES; ++j)
-        {
-            float Weight = BindVertex.BoneWeights[j];
-            if (Weight <= KINDA_SMALL_NUMBER) continue;
-            
-            int32 BoneIndex = static_cast<int32>(BindVertex.BoneIndices[j]);
-            if (!Skeleton->BoneTree.IsValidIndex(BoneIndex)) continue;
-            
-            TotalWeight += Weight;
-            
-            // 스키닝 행렬 적용
-            const FMatrix& SkinMatrix = Skeleton->CurrentPose.SkinningMatrices[BoneIndex];
-            
-            // 위치 변환
-            SkinnedPosition += SkinMatrix.TransformPosition(BindVertex.Position) * Weight;
-            
-            // 법선 변환 (위치 변환과 다름)
-            FMatrix NormalMatrix = SkinMatrix;
-            NormalMatrix.RemoveTranslation();
-            
-            if (FMath::Abs(NormalMatrix.Determinant()) > SMALL_NUMBER)
-            {
-                // 법선 벡터 변환을 위한 역전치(inverse transpose) 행렬 계산
-                FMatrix InvTranspose = FMatrix::Transpose(FMatrix::Inverse(NormalMatrix));
-                SkinnedNormal += FMatrix::TransformVector(BindVertex.Normal, InvTranspose) * Weight;
-            }
-            else
-            {
-                SkinnedNormal += BindVertex.Normal * Weight;
-            }
-        }
-        
-        // 가중치 합이 1에 가까워야 함 (부동소수점 오차 허용)
-        if (TotalWeight > KINDA_SMALL_NUMBER)
-        {
-            if (!FMath::IsNearlyEqual(TotalWeight, 1.0f))
-            {
-                // 가중치 합이 1이 아니면 정규화
-                float InvWeight = 1.0f / TotalWeight;
-                SkinnedPosition *= InvWeight;
-                SkinnedNormal *= InvWeight;
-            }
-            
-            // 최종 결과 적용
-            SkinnedVertex.Position = SkinnedPosition;
-            SkinnedVertex.Normal = SkinnedNormal.GetSafeNormal();
-        }
-    }
+    // 법선 행렬은 정점마다가 아니라 본마다 한 번만 계산
+    FSkinningKernel::BuildNormalMatrices(SkinningMatrices, OutNormalMatrices);
+
+    FSkinningBoneMatrices Bones;
+    Bones.SkinningMatrices = SkinningMatrices.GetData();
+    Bones.NormalMatrices = OutNormalMatrices.GetData();
+    Bones.NumBones = std::min(SkinningMatrices.Num(), Skeleton->BoneTree.Num());
 
-    // 버퍼 언매핑
-    DeviceContext->Unmap(SkeletalMeshRenderData->DynamicVertexBuffer, 0);
+    const TArray<FBX::FSkeletalMeshVertex>& BindVertices = SkeletalMeshRenderData->BindPoseVertices;
+    OutVertices.SetNum(BindVertices.Num());
+
+    FSkinningKernel::SkinVertices(BindVertices.GetData(), OutVertices.GetData(), BindVertices.Num(), Bones);
     return true;
 }
 
@@ -367,8 +285,6 @@ void USkeletalMesh::SetData(FBX::FSkeletalMeshRenderData* renderData)
 
     if (verticeNum <= 0) return;
 
-    SkeletalMeshRenderData->DynamicVertexBuffer = FEngineLoop::Renderer.CreateDynamicVertexBuffer(SkeletalMeshRenderData->MeshName, SkeletalMeshRenderData->BindPoseVertices);
-
     uint32 indexNum = SkeletalMeshRenderData->Indices.Num();
     if (indexNum > 0)
         SkeletalMeshRenderData->IndexBuffer = FEngineLoop::Renderer.CreateImmutableIndexBuffer(SkeletalMeshRenderData->MeshName, SkeletalMeshRenderData->Indices);
@@ -7,6 +7,7 @@
 namespace FBX
 {
     struct FSkeletalMeshRenderData;
+    struct FSkeletalMeshVertex;
 }
 
 class USkeletalMesh : public UObject
@@ -26,18 +27,33 @@ public:
     void GetUsedMaterials(TArray<UMaterial*>& Out) const;
     FBX::FSkeletalMeshRenderData* GetRenderData() const { return SkeletalMeshRenderData; }
     int32 GetBoneIndexByName(const FName& BoneName) const;
-    FMatrix GetBoneLocalMatrix(uint32 BoneIndex) const;
+
+    // 포즈는 컴포넌트 인스턴스마다 따로 가지므로 대상 포즈를 인자로 받습니다.
+    FMatrix GetBoneLocalMatrix(const FAnimationPoseData& Pose, uint32 BoneIndex) const;
    
-    bool SetBoneLocalMatrix(uint32 BoneIndex, const FMatrix& NewLocalMatrix);
-    bool SetBoneRotation(uint32 BoneIndex, const FMatrix& RotationMatrix);
-    void UpdateWorldTransforms();
-    bool UpdateAndApplySkinning();
+    bool SetBoneLocalMatrix(FAnimationPoseData& Pose, uint32 BoneIndex, const FMatrix& NewLocalMatrix) const;
+    bool SetBoneRotation(FAnimationPoseData& Pose, uint32 BoneIndex, const FMatrix& RotationMatrix) const;
+
+    /** Pose에서 Dirty인 본들의 글로벌 변환과 스키닝 행렬을 갱신합니다. */
+    void UpdateWorldTransforms(FAnimationPoseData& Pose) const;
+
+    /** 이 메시를 쓰는 여러 인스턴스의 포즈를 ProcessingOrder 한 번 순회로 함께 갱신합니다. */
+    void UpdateWorldTransforms(const TArray<FAnimationPoseData*>& Poses) const;
+
+    /**
+     * Pose로 CPU 스키닝을 수행해서 OutVertices에 기록합니다.
+     * 같은 메시를 쓰는 컴포넌트마다 자세가 다르므로 결과와 법선 행렬 Scratch는 호출한 쪽이 소유합니다.
+     */
+    bool UpdateSkinning(const FAnimationPoseData& Pose, TArray<FMatrix>& OutNormalMatrices, TArray<FBX::FSkeletalMeshVertex>& OutVertices) const;
     bool GetBoneNames(TArray<FName>& OutBoneNames) const;
     //ObjectName은 경로까지 포함
     FWString GetObjectName() const;
 
     void SetData(FBX::FSkeletalMeshRenderData* renderData);
 
+private:
+    void UpdateWorldTransforms_Internal(FAnimationPoseData* const* Poses, int32 NumPoses) const;
+
 private:
     FBX::FSkeletalMeshRenderData* SkeletalMeshRenderData = nullptr;
     TArray<FStaticMaterial*> materials;
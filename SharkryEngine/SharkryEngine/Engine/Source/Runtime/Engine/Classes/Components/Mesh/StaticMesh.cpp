@@ -17,6 +17,13 @@ UStaticMesh::~UStaticMesh()
         staticMeshRenderData->IndexBuffer->Release();
         staticMeshRenderData->IndexBuffer = nullptr;
     }
+
+    for (OBJ::FStaticMeshLODData& LOD : staticMeshRenderData->LODs) {
+        if (LOD.IndexBuffer) {
+            LOD.IndexBuffer->Release();
+            LOD.IndexBuffer = nullptr;
+        }
+    }
 }
 
 UObject* UStaticMesh::Duplicate(UObject* InOuter)
@@ -56,6 +63,13 @@ void UStaticMesh::SetData(OBJ::FStaticMeshRenderData* renderData)
     if (indexNum > 0)
         staticMeshRenderData->IndexBuffer = FEngineLoop::Renderer.CreateImmutableIndexBuffer(staticMeshRenderData->DisplayName, staticMeshRenderData->Indices);
 
+    // LOD는 LOD 0의 Vertex Buffer를 같이 쓰고 Index Buffer만 따로 만듭니다.
+    for (int32 lodIndex = 0; lodIndex < staticMeshRenderData->LODs.Num(); lodIndex++) {
+        OBJ::FStaticMeshLODData& LOD = staticMeshRenderData->LODs[lodIndex];
+        if (LOD.Indices.Num() > 0)
+            LOD.IndexBuffer = FEngineLoop::Renderer.CreateImmutableIndexBuffer(FString::Printf(TEXT("%s_LOD%d"), *staticMeshRenderData->DisplayName, lodIndex + 1), LOD.Indices);
+    }
+
     for (int materialIndex = 0; materialIndex < staticMeshRenderData->Materials.Num(); materialIndex++) {
         FStaticMaterial* newMaterialSlot = new FStaticMaterial();
         UMaterial* newMaterial = FManagerOBJ::CreateMaterial(staticMeshRenderData->Materials[materialIndex]);
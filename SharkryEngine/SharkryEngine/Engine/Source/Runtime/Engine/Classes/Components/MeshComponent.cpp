@@ -55,6 +55,7 @@ void UMeshComponent::SetMaterial(uint32 ElementIndex, UMaterial* Material)
     if (OverrideMaterials.IsValidIndex(ElementIndex) == false) return;
 
     OverrideMaterials[ElementIndex] = Material;
+    MarkRenderStateDirty();
 }
 
 void UMeshComponent::SetMaterialByName(FName MaterialSlotName, UMaterial* Material)
@@ -8,6 +8,9 @@ UParticleSubUVComponent::UParticleSubUVComponent()
 {
     SetType(StaticClass()->GetName());
     bIsLoop = true;
+
+    // 재생이 끝나 Deactivate되면 Tick 목록에서 빠지고, 다시 Activate하면 돌아옵니다.
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 // Duplicate: 버퍼 포인터는 복사하지 않고 애니메이션 상태만 복제
@@ -1,8 +1,8 @@
 #include "PrimitiveComponent.h"
 #include "UObject/Casts.h"
-#include "UObject/UObjectIterator.h"
 #include "Shapes/ShapeComponent.h"
 #include "Classes/GameFramework/Actor.h"
+#include "World/World.h"
 
 UObject* UPrimitiveComponent::Duplicate(UObject* InOuter)
 {
@@ -16,6 +16,22 @@ void UPrimitiveComponent::TickComponent(float DeltaTime)
     Super::TickComponent(DeltaTime);
 }
 
+void UPrimitiveComponent::Activate()
+{
+    Super::Activate();
+    MarkRenderStateDirty();
+}
+
+void UPrimitiveComponent::Deactivate()
+{
+    Super::Deactivate();
+    MarkRenderStateDirty();
+
+    // 다시 활성화 되었을 때 이전 Overlap으로 EndOverlap이 호출되지 않도록 비웁니다.
+    OverlapInfos.Empty();
+    PreviousOverlapInfos.Empty();
+}
+
 bool UPrimitiveComponent::IntersectRayTriangle(const FVector& RayOrigin, const FVector& RayDirection, const FVector& v0, const FVector& v1, const FVector& v2, float& OutHitDistance) const
 {
     const FVector Edge1 = v1 - v0;
@@ -55,7 +71,7 @@ bool UPrimitiveComponent::IsOverlappingActor(const AActor* Other) const
 {
     for (const FOverlapInfo& Info : OverlapInfos)
     {
-        if (Info.OtherActor == Other)
+        if (Info.OtherActor.Get() == Other)
             return true;
     }
     return false;
@@ -66,19 +82,34 @@ void UPrimitiveComponent::UpdateOverlaps()
     PreviousOverlapInfos = OverlapInfos;
     OverlapInfos.Empty();
 
+    FBoundingBox Bounds;
+    if (!GetOverlapBounds(Bounds))
+    {
+        return;
+    }
+
     AActor* Owner = GetOwner();
-    for (UPrimitiveComponent* Other : TObjectRange<UPrimitiveComponent>())
+    UWorld* World = GetWorld();
+    if (!Owner || !World)
     {
-        if (Other->GetWorld() != Owner->GetWorld()) continue;
-        if (Other == this || !Cast<UShapeComponent>(Other)) continue;
-        if (Owner == Other->GetOwner()) continue;
-        if (!Other->GetOverlapCheck()) continue;
+        return;
+    }
+
+    // Broadphase에서 AABB가 겹치는 Shape만 Narrowphase 검사
+    World->GetCollisionBroadphase().Query(Bounds, [this, Owner](void* UserData)
+    {
+        UShapeComponent* Other = static_cast<UShapeComponent*>(UserData);
+        if (Other == this || Owner == Other->GetOwner() || !Other->GetOverlapCheck())
+        {
+            return true;
+        }
 
         if (CheckOverlap(Other))
         {
             OverlapInfos.Add(FOverlapInfo(Other, Other->GetOwner()));
         }
-    }
+        return true;
+    });
 }
 
 void UPrimitiveComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -106,6 +137,9 @@ void UPrimitiveComponent::SetProperties(const TMap<FString, FString>& InProperti
 
     const FString* AABBmaxStr = InProperties.Find(TEXT("AABB_max"));
     if (AABBmaxStr) AABB.max.InitFromString(*AABBmaxStr);
+
+    // 활성 상태와 AABB를 Setter 없이 바꾸므로 직접 알립니다.
+    MarkRenderStateDirty();
 }
 
 // PrimitiveComponent.cpp
@@ -118,16 +152,17 @@ void UPrimitiveComponent::ProcessOverlaps()
     TSet<AActor*> PreviousOverlappingActors;
     TSet<AActor*> CurrentOverlappingActors;
 
+    // 지난 프레임 이후 제거된 상대는 Get이 nullptr를 반환하므로 자연스럽게 빠집니다.
     for (const FOverlapInfo& Info : PreviousOverlapInfos)
     {
-        if (Info.OtherActor)
-            PreviousOverlappingActors.Add(Info.OtherActor);
+        if (AActor* OtherActor = Info.OtherActor.Get())
+            PreviousOverlappingActors.Add(OtherActor);
     }
 
     for (const FOverlapInfo& Info : OverlapInfos)
     {
-        if (Info.OtherActor)
-            CurrentOverlappingActors.Add(Info.OtherActor);
+        if (AActor* OtherActor = Info.OtherActor.Get())
+            CurrentOverlappingActors.Add(OtherActor);
     }
 
     for (AActor* OtherActor : CurrentOverlappingActors)
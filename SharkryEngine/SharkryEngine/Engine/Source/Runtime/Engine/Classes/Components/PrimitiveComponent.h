@@ -11,6 +11,8 @@ public:
 
     virtual UObject* Duplicate(UObject* InOuter) override;
     virtual void TickComponent(float DeltaTime) override;
+    virtual void Activate() override;
+    virtual void Deactivate() override;
 
     bool IntersectRayTriangle(const FVector& RayOrigin, const FVector& RayDirection, const FVector& v0, const FVector& v1, const FVector& v2, float& OutHitDistance) const;
 
@@ -37,6 +39,12 @@ public:
     void UpdateOverlaps();
     virtual bool CheckOverlap(const UPrimitiveComponent* Other) const { return false; }
 
+    /**
+     * Overlap 검사에 사용할 World 공간 Bounds를 반환합니다.
+     * @return Overlap 검사 대상이 아니라면 false
+     */
+    virtual bool GetOverlapBounds(FBoundingBox& OutBounds) const { return false; }
+
     bool GetOverlapCheck() const { return bOverlapCheck; }
     void SetOverlapCheck(bool bInOverlapCheck) { bOverlapCheck = bInOverlapCheck; }
 
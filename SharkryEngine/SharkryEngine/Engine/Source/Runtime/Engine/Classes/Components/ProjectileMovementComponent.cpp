@@ -1,5 +1,6 @@
 #include "ProjectileMovementComponent.h"
 #include "GameFramework/Actor.h"
+#include "World/World.h"
 
 UProjectileMovementComponent::UProjectileMovementComponent()
 {
@@ -9,6 +10,12 @@ UProjectileMovementComponent::UProjectileMovementComponent()
     Velocity = FVector(0.f, 0.f, 0.f);
     ProjectileLifetime = 10.0f; // 기본 생명주기 설정
     AccumulatedTime = 0;
+
+    // Owner의 위치만 바꾸므로 다른 Projectile과 동시에 Tick할 수 있습니다.
+    // Owner가 다른 Actor와 Attach로 이어져 있으면 FTickTaskManager가 Game Thread에서 Tick합니다.
+    PrimaryComponentTick.bCanEverTick = true;
+    PrimaryComponentTick.TickGroup = TG_DuringPhysics;
+    PrimaryComponentTick.bRunOnAnyThread = true;
 }
 
 UProjectileMovementComponent::~UProjectileMovementComponent()
@@ -33,10 +40,20 @@ UObject* UProjectileMovementComponent::Duplicate(UObject* InOuter)
 
 void UProjectileMovementComponent::BeginPlay()
 {
+    Super::BeginPlay();
+
     FVector Forward = GetOwner()->GetActorForwardVector();
     Velocity = Forward * InitialSpeed;
 }
 
+void UProjectileMovementComponent::ResetForReuse()
+{
+    Super::ResetForReuse();
+
+    AccumulatedTime = 0.0f;
+    Velocity = FVector(0.f, 0.f, 0.f);
+}
+
 void UProjectileMovementComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
@@ -57,9 +74,12 @@ void UProjectileMovementComponent::TickComponent(float DeltaTime)
     AccumulatedTime += DeltaTime;
     if (AccumulatedTime >= ProjectileLifetime)
     {
-        if (GetOwner())
+        AActor* Owner = GetOwner();
+        UWorld* World = Owner ? Owner->GetWorld() : nullptr;
+        if (World)
         {
-            GetOwner()->Destroy();
+            // Worker 스레드에서 실행중일 수 있으므로 World를 바꾸는 Destroy는 Game Thread로 넘깁니다.
+            World->GetTickTaskManager().QueueGameThreadTask([Owner]() { Owner->Destroy(); });
         }
     }
 }
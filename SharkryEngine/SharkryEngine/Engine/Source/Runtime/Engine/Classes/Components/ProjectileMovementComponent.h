@@ -32,6 +32,9 @@ public:
 
     virtual void BeginPlay() override;
 
+    /** 이전 Spawn에서 지난 시간과 속도를 지웁니다. 속도는 BeginPlay에서 다시 정합니다. */
+    virtual void ResetForReuse() override;
+
 
     virtual void TickComponent(float DeltaTime) override;
 
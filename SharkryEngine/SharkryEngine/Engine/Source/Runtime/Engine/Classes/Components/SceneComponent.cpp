@@ -4,6 +4,8 @@
 #include "Math/Rotator.h"
 #include "Math/JungleMath.h"
 #include "Math/Quat.h"
+#include "World/RenderScene.h"
+#include "World/World.h"
 #include "UObject/Casts.h"
 #include "UObject/ObjectFactory.h"
 
@@ -61,6 +63,7 @@ void USceneComponent::SetProperties(const TMap<FString, FString>& InProperties)
     {
         RelativeScale3D.InitFromString(*TempStr);
     }
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::TickComponent(float DeltaTime)
@@ -148,18 +151,20 @@ FVector USceneComponent::GetUpVector() const
 void USceneComponent::AddLocation(const FVector& InAddValue)
 {
 	RelativeLocation = RelativeLocation + InAddValue;
-
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::AddRotation(const FRotator& InAddValue)
 {
 	RelativeRotation = RelativeRotation + InAddValue;
     RelativeRotation.Normalize();
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::AddScale(const FVector& InAddValue)
 {
 	RelativeScale3D = RelativeScale3D + InAddValue;
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::AttachToComponent(USceneComponent* InParent)
@@ -168,18 +173,22 @@ void USceneComponent::AttachToComponent(USceneComponent* InParent)
     if (AttachParent)
     {
         AttachParent->AttachChildren.Remove(this);
+        NotifyAttachmentCrossesActors(AttachParent);
     }
+    NotifyAttachmentCrossesActors(InParent);
 
     // InParent도 nullptr이면 부모를 nullptr로 설정
     if (InParent == nullptr)
     {
         AttachParent = nullptr;
+        MarkWorldTransformDirty();
         return;
     }
 
 
     // 새로운 부모 설정
     AttachParent = InParent;
+    MarkWorldTransformDirty();
 
     // 부모의 자식 리스트에 추가
     if (!InParent->AttachChildren.Contains(this))
@@ -198,6 +207,22 @@ void USceneComponent::DetachFromComponent(USceneComponent* Target)
     }
 
     Target->AttachChildren.Remove(this);
+    NotifyAttachmentCrossesActors(Target);
+    MarkWorldTransformDirty();
+}
+
+void USceneComponent::NotifyAttachmentCrossesActors(const USceneComponent* Other) const
+{
+    const AActor* Owner = GetOwner();
+    if (!Other || !Owner || Other->GetOwner() == Owner)
+    {
+        return;
+    }
+
+    if (UWorld* World = Owner->GetWorld())
+    {
+        World->GetTickTaskManager().MarkTickListsDirty();
+    }
 }
 
 void USceneComponent::SetRelativeRotation(const FRotator& InRotation)
@@ -210,6 +235,7 @@ void USceneComponent::SetRelativeRotation(const FQuat& InQuat)
     FQuat NormalizedQuat = InQuat.GetSafeNormal();
     RelativeRotation = NormalizedQuat.Rotator();
     RelativeRotation.Normalize();
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::SetWorldLocation(const FVector& InLocation)
@@ -219,10 +245,11 @@ void USceneComponent::SetWorldLocation(const FVector& InLocation)
     if (AttachParent)
     {
         FMatrix ParentMatrix = AttachParent->GetWorldMatrix().GetMatrixWithoutScale();
-        NewRelativeMatrix = NewRelativeMatrix * FMatrix::Inverse(ParentMatrix);
+        NewRelativeMatrix = NewRelativeMatrix * FMatrix::InverseOrthonormal(ParentMatrix);
     }
     FVector NewRelativeLocation = NewRelativeMatrix.GetTranslationVector();
     RelativeLocation = NewRelativeLocation;
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::SetWorldRotation(const FRotator& InRotation)
@@ -237,11 +264,12 @@ void USceneComponent::SetWorldRotation(const FQuat& InQuat)
     if (AttachParent)
     {
         FMatrix ParentMatrix = AttachParent->GetWorldMatrix().GetMatrixWithoutScale();
-        NewRelativeMatrix = NewRelativeMatrix * FMatrix::Inverse(ParentMatrix);
+        NewRelativeMatrix = NewRelativeMatrix * FMatrix::InverseOrthonormal(ParentMatrix);
     }
     FQuat NewRelativeRotation = FQuat(NewRelativeMatrix);
     RelativeRotation = FRotator(NewRelativeRotation);
     RelativeRotation.Normalize();   
+    MarkWorldTransformDirty();
 }
 
 void USceneComponent::SetWorldScale3D(const FVector& InScale)
@@ -251,10 +279,11 @@ void USceneComponent::SetWorldScale3D(const FVector& InScale)
     if (AttachParent)
     {
         FMatrix ParentMatrix = FMatrix::GetScaleMatrix(AttachParent->RelativeScale3D);
-        NewRelativeMatrix = NewRelativeMatrix * FMatrix::Inverse(ParentMatrix);
+        NewRelativeMatrix = NewRelativeMatrix * FMatrix::InverseAffine(ParentMatrix);
     }
     FVector NewRelativeScale = NewRelativeMatrix.GetScaleVector();
     RelativeScale3D = NewRelativeScale;
+    MarkWorldTransformDirty();
 }
 
 FVector USceneComponent::GetWorldLocation() const
@@ -289,7 +318,27 @@ FMatrix USceneComponent::GetTranslationMatrix() const
     return FMatrix::GetTranslationMatrix(RelativeLocation);
 }
 
-FMatrix USceneComponent::GetWorldMatrix() const
+const FMatrix& USceneComponent::GetWorldMatrix() const
+{
+    if (bWorldTransformDirty)
+    {
+        // 부모가 Dirty면 자식도 Dirty이므로, Dirty인 조상까지만 거슬러 올라가서 갱신됨
+        if (AttachParent)
+        {
+            AttachParent->GetWorldMatrix();
+        }
+        UpdateWorldTransform();
+    }
+    return CachedWorldMatrix;
+}
+
+const FMatrix& USceneComponent::GetWorldInverseTransposeMatrix() const
+{
+    GetWorldMatrix();
+    return CachedWorldInverseTransposeMatrix;
+}
+
+FMatrix USceneComponent::CalcWorldMatrixUncached() const
 {
     FMatrix ScaleMat = GetScaleMatrix();
     FMatrix RotationMat = GetRotationMatrix();
@@ -312,6 +361,102 @@ FMatrix USceneComponent::GetWorldMatrix() const
     return ScaleMat * RTMat;
 }
 
+void USceneComponent::UpdateWorldTransform() const
+{
+    // World = (S_self * S_parent * ...) * (RT_self * RT_parent * ...)
+    FVector WorldScale3D = RelativeScale3D;
+    FMatrix WorldRTMatrix = GetRotationMatrix() * GetTranslationMatrix();
+    if (AttachParent)
+    {
+        WorldScale3D = WorldScale3D * AttachParent->CachedWorldScale3D;
+        WorldRTMatrix = WorldRTMatrix * AttachParent->CachedWorldRTMatrix;
+    }
+
+    CachedWorldScale3D = WorldScale3D;
+    CachedWorldRTMatrix = WorldRTMatrix;
+    CachedWorldMatrix = FMatrix::GetScaleMatrix(WorldScale3D) * WorldRTMatrix;
+    CachedWorldInverseTransposeMatrix = FMatrix::Transpose(FMatrix::InverseAffine(CachedWorldMatrix));
+    bWorldTransformDirty = false;
+}
+
+void USceneComponent::MarkWorldTransformDirty()
+{
+    // Tree 갱신이 이 컴포넌트까지 내려오도록 조상들에 표시합니다.
+    // 새로 Attach된 컴포넌트는 처음부터 Dirty이므로, 이미 Dirty여도 표시하고 이미 표시된 조상에서 멈춥니다.
+    for (USceneComponent* Parent = AttachParent; Parent && !Parent->bHasDirtyDescendant; Parent = Parent->AttachParent)
+    {
+        Parent->bHasDirtyDescendant = true;
+    }
+
+    // 이미 Dirty면 하위도 모두 Dirty 상태
+    if (bWorldTransformDirty)
+    {
+        return;
+    }
+
+    bWorldTransformDirty = true;
+    if (FRenderScene* RenderScene = RenderSceneHandle.Scene)
+    {
+        RenderScene->MarkProxyDirty(this, false);
+    }
+
+    // Attach 계층은 얕으므로 Stack을 할당하지 않고 재귀로 내려갑니다. 이미 Dirty인 자식은 바로 돌아옵니다.
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->MarkWorldTransformDirty();
+        }
+    }
+}
+
+void USceneComponent::UpdateWorldTransformTree()
+{
+    if (!bWorldTransformDirty && !bHasDirtyDescendant)
+    {
+        return;
+    }
+
+    // 조상 캐시가 최신인지 먼저 보장
+    if (AttachParent)
+    {
+        AttachParent->GetWorldMatrix();
+    }
+
+    UpdateWorldTransformSubtree();
+}
+
+void USceneComponent::UpdateWorldTransformSubtree()
+{
+    // Dirty면 하위도 모두 Dirty이므로 전부 내려가고, 아니라면 Dirty인 자손이 있을 때만 내려갑니다.
+    if (bWorldTransformDirty)
+    {
+        UpdateWorldTransform();
+    }
+    else if (!bHasDirtyDescendant)
+    {
+        return;
+    }
+    bHasDirtyDescendant = false;
+
+    // Attach 계층은 얕으므로 Stack을 할당하지 않고 재귀로 내려갑니다. 부모를 먼저 갱신했으므로 자식은 최신 부모 캐시를 읽습니다.
+    for (USceneComponent* Child : AttachChildren)
+    {
+        if (Child)
+        {
+            Child->UpdateWorldTransformSubtree();
+        }
+    }
+}
+
+void USceneComponent::MarkRenderStateDirty()
+{
+    if (FRenderScene* RenderScene = RenderSceneHandle.Scene)
+    {
+        RenderScene->MarkProxyDirty(this, true);
+    }
+}
+
 FMatrix USceneComponent::GetWorldRTMatrix() const
 {
     FMatrix RotationMat = FMatrix::GetRotationMatrix(RelativeRotation);
@@ -343,7 +488,10 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent)
             ) 
         )
     {
+        NotifyAttachmentCrossesActors(AttachParent);
+        NotifyAttachmentCrossesActors(InParent);
         AttachParent = InParent;
+        MarkWorldTransformDirty();
 
         // TODO: .AddUnique의 실행 위치를 RegisterComponent로 바꾸거나 해야할 듯
         InParent->AttachChildren.AddUnique(this);
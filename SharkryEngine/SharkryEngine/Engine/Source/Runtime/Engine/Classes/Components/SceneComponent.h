@@ -1,12 +1,54 @@
 #pragma once
+#include <atomic>
 #include "ActorComponent.h"
 #include "Math/Rotator.h"
 #include "UObject/ObjectMacros.h"
 
+class FRenderScene;
+
+/**
+ * Component가 등록된 FRenderScene과 그 안의 위치, FRenderScene만 읽고 씁니다.
+ * Worker 스레드에서 Tick하는 Component도 Transform을 바꾸므로, 대기 목록 등록과 Dirty 표시는 Atomic으로 합니다.
+ */
+struct FRenderSceneHandle
+{
+    FRenderSceneHandle() = default;
+    FRenderSceneHandle(const FRenderSceneHandle& Other) { *this = Other; }
+    FRenderSceneHandle& operator=(const FRenderSceneHandle& Other)
+    {
+        Scene = Other.Scene;
+        ProxyIndex = Other.ProxyIndex;
+        PendingUpdateIndex = Other.PendingUpdateIndex;
+        ProxyType = Other.ProxyType;
+        bPendingUpdate.store(Other.bPendingUpdate.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        bRenderStateDirty.store(Other.bRenderStateDirty.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    FRenderScene* Scene = nullptr;
+
+    /** Component 종류별 목록에서의 Index, Proxy가 없다면 INDEX_NONE */
+    int32 ProxyIndex = INDEX_NONE;
+
+    /** 갱신 대기 목록에서의 Index, 대기중이 아니라면 INDEX_NONE. bPendingUpdate를 차지한 스레드만 씁니다. */
+    int32 PendingUpdateIndex = INDEX_NONE;
+
+    /** ERenderProxyType */
+    uint8 ProxyType = 0;
+
+    /** 갱신 대기 목록에 들어갔는지 여부, exchange로 차지한 스레드 하나만 목록의 자리를 받습니다. */
+    std::atomic<bool> bPendingUpdate = false;
+
+    /** Transform 외의 Mesh, Material, 활성 상태도 다시 읽어야 하는지 여부 */
+    std::atomic<bool> bRenderStateDirty = false;
+};
+
 class USceneComponent : public UActorComponent
 {
     DECLARE_CLASS(USceneComponent, UActorComponent)
 
+    friend class FRenderScene;
+
 public:
     USceneComponent();
 
@@ -36,10 +78,10 @@ public:
     void DetachFromComponent(USceneComponent* Target);
 
 public:
-    void SetRelativeLocation(const FVector& InLocation) { RelativeLocation = InLocation; }
+    void SetRelativeLocation(const FVector& InLocation) { RelativeLocation = InLocation; MarkWorldTransformDirty(); }
     void SetRelativeRotation(const FRotator& InRotation);
     void SetRelativeRotation(const FQuat& InQuat);
-    void SetRelativeScale3D(const FVector& InScale) { RelativeScale3D = InScale; }
+    void SetRelativeScale3D(const FVector& InScale) { RelativeScale3D = InScale; MarkWorldTransformDirty(); }
     
     FVector GetRelativeLocation() const { return RelativeLocation; }
     FRotator GetRelativeRotation() const { return RelativeRotation; }
@@ -58,9 +100,46 @@ public:
     FMatrix GetRotationMatrix() const;
     FMatrix GetTranslationMatrix() const;
 
-    FMatrix GetWorldMatrix() const;
+    /** 캐시된 Component-To-World 행렬, Dirty면 부모부터 다시 계산합니다. */
+    const FMatrix& GetWorldMatrix() const;
+
+    /** 캐시된 World 행렬의 역전치 (법선 변환용) */
+    const FMatrix& GetWorldInverseTransposeMatrix() const;
+
+    /** 캐시를 거치지 않고 부모를 따라 올라가며 World 행렬을 계산합니다. */
+    FMatrix CalcWorldMatrixUncached() const;
+
     FMatrix GetWorldRTMatrix() const;
 
+    /** 이 컴포넌트와 AttachChildren 하위 전체의 World 변환 캐시를 Dirty로 표시합니다. */
+    void MarkWorldTransformDirty();
+    bool IsWorldTransformDirty() const { return bWorldTransformDirty; }
+
+    /**
+     * 이 컴포넌트를 루트로 하는 서브트리에서 Dirty인 World 변환을 부모 우선 순서로 갱신합니다.
+     * Dirty인 자손이 없는 서브트리는 내려가지 않으므로, 움직이지 않은 Actor는 루트만 확인하고 끝납니다.
+     */
+    void UpdateWorldTransformTree();
+
+    /**
+     * Mesh, Material, 활성 상태처럼 Render Proxy에 캐시된 값이 바뀌었음을 Render Scene에 알립니다.
+     * Transform은 MarkWorldTransformDirty가 알아서 알립니다.
+     */
+    void MarkRenderStateDirty();
+
+private:
+    /** 부모 캐시가 최신이라는 가정하에 이 컴포넌트의 캐시를 갱신합니다. */
+    void UpdateWorldTransform() const;
+
+    /** UpdateWorldTransformTree의 재귀 부분, 부모 캐시는 이미 최신입니다. */
+    void UpdateWorldTransformSubtree();
+
+    /**
+     * Other가 다른 Actor의 Component라면 Tick 목록을 다시 모으도록 알립니다.
+     * 다른 Actor와 Attach로 이어진 Actor의 Component는 Worker에서 Tick하지 않으므로, 이어지거나 끊길 때 목록이 바뀝니다.
+     */
+    void NotifyAttachmentCrossesActors(const USceneComponent* Other) const;
+
 protected:
     /** 부모 컴포넌트로부터 상대적인 위치 */
     UPROPERTY
@@ -80,4 +159,25 @@ protected:
 
     UPROPERTY
     (TArray<USceneComponent*>, AttachChildren);
+
+private:
+    //~ World 변환 캐시, 부모가 Dirty면 자식도 항상 Dirty
+    /** 자신과 조상들의 Scale 누적 */
+    mutable FVector CachedWorldScale3D = FVector::OneVector;
+
+    /** 자신과 조상들의 Rotation * Translation 누적 */
+    mutable FMatrix CachedWorldRTMatrix = FMatrix::Identity;
+
+    mutable FMatrix CachedWorldMatrix = FMatrix::Identity;
+    mutable FMatrix CachedWorldInverseTransposeMatrix = FMatrix::Identity;
+    mutable bool bWorldTransformDirty = true;
+
+    /**
+     * AttachChildren 하위 어딘가에 Dirty인 컴포넌트가 있을 수 있는지 여부
+     * 컴포넌트가 Dirty가 될 때 조상들에 세우고 UpdateWorldTransformTree가 내려가면서 내립니다.
+     * GetWorldMatrix가 중간의 캐시만 갱신해도 내리지 않으므로, 실제보다 많이 세워져 있을 수는 있어도 빠지지는 않습니다.
+     */
+    bool bHasDirtyDescendant = false;
+
+    FRenderSceneHandle RenderSceneHandle;
 };
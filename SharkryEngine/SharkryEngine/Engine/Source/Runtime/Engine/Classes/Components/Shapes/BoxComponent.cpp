@@ -63,5 +63,18 @@ FBox UBoxComponent::GetWorldBox() const
     return Box;
 }
 
+FBoundingBox UBoxComponent::CalcWorldBounds() const
+{
+    const FBox Box = GetWorldBox();
 
-
+    // OBB를 감싸는 AABB의 반지름 = 각 축에 투영된 Extent의 합
+    const FVector AxisX = Box.GetAxisX() * Box.Extent.X;
+    const FVector AxisY = Box.GetAxisY() * Box.Extent.Y;
+    const FVector AxisZ = Box.GetAxisZ() * Box.Extent.Z;
+    const FVector HalfSize(
+        FMath::Abs(AxisX.X) + FMath::Abs(AxisY.X) + FMath::Abs(AxisZ.X),
+        FMath::Abs(AxisX.Y) + FMath::Abs(AxisY.Y) + FMath::Abs(AxisZ.Y),
+        FMath::Abs(AxisX.Z) + FMath::Abs(AxisY.Z) + FMath::Abs(AxisZ.Z)
+    );
+    return FBoundingBox(Box.Center - HalfSize, Box.Center + HalfSize);
+}
@@ -22,6 +22,7 @@ public:
    
 public:
     virtual bool CheckOverlap(const UPrimitiveComponent* Other) const override;
+    virtual FBoundingBox CalcWorldBounds() const override;
 
     FBox GetWorldBox() const;
   
@@ -72,3 +72,11 @@ FCapsule UCapsuleComponent::ToFCapsule() const
 
     return FCapsule(Center, Up, HalfHeight, Radius, Rotation);
 }
+
+FBoundingBox UCapsuleComponent::CalcWorldBounds() const
+{
+    // 회전과 무관하게 캡슐 전체를 감싸는 구의 AABB
+    const FVector Center = GetWorldLocation();
+    const FVector HalfSize(CapsuleHalfHeight + CapsuleRadius);
+    return FBoundingBox(Center - HalfSize, Center + HalfSize);
+}
@@ -18,6 +18,7 @@ public:
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
 public:
     virtual bool CheckOverlap(const UPrimitiveComponent* Other) const override;
+    virtual FBoundingBox CalcWorldBounds() const override;
 
     FVector GetStartPoint() const
     {
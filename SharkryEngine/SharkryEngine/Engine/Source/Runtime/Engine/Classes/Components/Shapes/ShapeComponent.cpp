@@ -1,6 +1,7 @@
 #include "ShapeComponent.h"
 
 #include "UObject/Casts.h"
+#include "World/CollisionBroadphase.h"
 
 UObject* UShapeComponent::Duplicate(UObject* InOuter)
 {
@@ -42,3 +43,57 @@ void UShapeComponent::SetProperties(const TMap<FString, FString>& InProperties)
     }
 }
 
+void UShapeComponent::OnComponentDestroyed()
+{
+    Super::OnComponentDestroyed();
+    RemoveBroadphaseProxy();
+}
+
+void UShapeComponent::Deactivate()
+{
+    Super::Deactivate();
+    RemoveBroadphaseProxy();
+}
+
+bool UShapeComponent::GetOverlapBounds(FBoundingBox& OutBounds) const
+{
+    if (BroadphaseProxyId == INDEX_NONE)
+    {
+        return false;
+    }
+
+    OutBounds = CachedWorldBounds;
+    return true;
+}
+
+FBoundingBox UShapeComponent::CalcWorldBounds() const
+{
+    const FVector Location = GetWorldLocation();
+    return FBoundingBox(Location, Location);
+}
+
+void UShapeComponent::UpdateBroadphaseProxy(FCollisionBroadphase& Broadphase)
+{
+    CachedWorldBounds = CalcWorldBounds();
+
+    if (OwningBroadphase != &Broadphase)
+    {
+        RemoveBroadphaseProxy();
+        BroadphaseProxyId = Broadphase.CreateProxy(CachedWorldBounds, this);
+        OwningBroadphase = &Broadphase;
+    }
+    else
+    {
+        Broadphase.MoveProxy(BroadphaseProxyId, CachedWorldBounds);
+    }
+}
+
+void UShapeComponent::RemoveBroadphaseProxy()
+{
+    if (OwningBroadphase && BroadphaseProxyId != INDEX_NONE)
+    {
+        OwningBroadphase->DestroyProxy(BroadphaseProxyId);
+    }
+    BroadphaseProxyId = INDEX_NONE;
+    OwningBroadphase = nullptr;
+}
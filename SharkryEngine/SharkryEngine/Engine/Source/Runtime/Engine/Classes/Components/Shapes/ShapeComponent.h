@@ -2,6 +2,8 @@
 
 #include "Components/PrimitiveComponent.h"
 
+class FCollisionBroadphase;
+
 class UShapeComponent : public UPrimitiveComponent
 {
     DECLARE_CLASS(UShapeComponent, UPrimitiveComponent)
@@ -14,6 +16,9 @@ public:
     virtual void SetProperties(const TMap<FString, FString>& InProperties) override;
     virtual void GetProperties(TMap<FString, FString>& OutProperties) const override;
 
+    virtual void OnComponentDestroyed() override;
+    virtual void Deactivate() override;
+
 public:
     FColor GetShapeColor() const { return ShapeColor; }
     void SetShapeColor(const FColor& InColor) { ShapeColor = InColor; }
@@ -22,9 +27,28 @@ public:
 
 public:
     virtual bool CheckOverlap(const UPrimitiveComponent* Other) const override { return false; }
+    virtual bool GetOverlapBounds(FBoundingBox& OutBounds) const override;
+
+    /** Shape를 감싸는 World 공간 AABB를 계산합니다. */
+    virtual FBoundingBox CalcWorldBounds() const;
+
+    /** World의 Broadphase에 등록된 Proxy Id, 등록되지 않았다면 INDEX_NONE */
+    int32 GetBroadphaseProxyId() const { return BroadphaseProxyId; }
+
+    /** World의 Broadphase에 Shape를 등록하거나, 이미 등록되어 있다면 Bounds를 갱신합니다. */
+    void UpdateBroadphaseProxy(FCollisionBroadphase& Broadphase);
+
+    /** World의 Broadphase에서 Shape를 제거합니다. */
+    void RemoveBroadphaseProxy();
 
 private:
     FColor ShapeColor;
     bool bDrawOnlyIfSelected;
+
+    /** 마지막으로 계산한 World AABB, UpdateBroadphaseProxy에서 갱신됨 */
+    FBoundingBox CachedWorldBounds;
+
+    int32 BroadphaseProxyId = INDEX_NONE;
+    FCollisionBroadphase* OwningBroadphase = nullptr;
 };
 
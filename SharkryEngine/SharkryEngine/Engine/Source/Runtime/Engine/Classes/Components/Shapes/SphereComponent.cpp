@@ -69,3 +69,10 @@ void USphereComponent::GetProperties(TMap<FString, FString>& OutProperties) cons
     Super::GetProperties(OutProperties);
     OutProperties.Add(TEXT("SphereRadius"), FString::SanitizeFloat(SphereRadius));
 }
+
+FBoundingBox USphereComponent::CalcWorldBounds() const
+{
+    const FVector Center = GetWorldLocation();
+    const FVector HalfSize(SphereRadius);
+    return FBoundingBox(Center - HalfSize, Center + HalfSize);
+}
@@ -23,6 +23,7 @@ public:
 
 public:
     virtual bool CheckOverlap(const UPrimitiveComponent* Other) const override;
+    virtual FBoundingBox CalcWorldBounds() const override;
 private:
     float SphereRadius = 0;
 };
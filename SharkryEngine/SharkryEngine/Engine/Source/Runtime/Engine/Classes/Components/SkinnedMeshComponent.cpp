@@ -7,11 +7,19 @@
 
 #include "GameFramework/Actor.h"
 
+USkinnedMeshComponent::~USkinnedMeshComponent()
+{
+    ReleaseSkinnedVertexBuffer();
+}
+
 UObject* USkinnedMeshComponent::Duplicate(UObject* InOuter)
 {
     ThisClass* NewComponent = Cast<ThisClass>(Super::Duplicate(InOuter));
     NewComponent->selectedSubMeshIndex = selectedSubMeshIndex;
     NewComponent->SkeletalMesh = SkeletalMesh;
+    NewComponent->Pose = Pose;
+    // Vertex Buffer는 복제하지 않고 새 컴포넌트가 자기 포즈로 다시 만듭니다.
+    NewComponent->RefreshBoneTransforms();
     return NewComponent;
 }
 
@@ -136,18 +144,85 @@ int USkinnedMeshComponent::CheckRayIntersection(const FVector& InRayOrigin, cons
 
 void USkinnedMeshComponent::SetSkeletalMesh(USkeletalMesh* value)
 {
+    if (SkeletalMesh != value)
+    {
+        // 정점 수가 다른 메시로 바뀔 수 있으므로 이전 메시 기준으로 만든 버퍼는 버립니다.
+        ReleaseSkinnedVertexBuffer();
+        SkinnedVertices.Empty();
+    }
     SkeletalMesh = value;
     if (SkeletalMesh == nullptr)
     {
         OverrideMaterials.SetNum(0);
         AABB = FBoundingBox(FVector::ZeroVector, FVector::ZeroVector);
+        Pose = FAnimationPoseData();
     }
     else
     {
         OverrideMaterials.SetNum(value->GetMaterials().Num());
         AABB = FBoundingBox(SkeletalMesh->GetRenderData()->Bounds.min, SkeletalMesh->GetRenderData()->Bounds.max);
-        SkeletalMesh->UpdateWorldTransforms();
-        SkeletalMesh->UpdateAndApplySkinning();
+        if (SkeletalMesh->Skeleton)
+        {
+            SkeletalMesh->Skeleton->InitializePose(Pose);
+        }
+        RefreshBoneTransforms();
+    }
+    MarkRenderStateDirty();
+}
+
+void USkinnedMeshComponent::RefreshBoneTransforms()
+{
+    if (SkeletalMesh == nullptr)
+    {
+        return;
+    }
 
+    SkeletalMesh->UpdateWorldTransforms(Pose);
+    if (SkeletalMesh->UpdateSkinning(Pose, BoneNormalMatrices, SkinnedVertices))
+    {
+        UploadSkinnedVertices();
+    }
+}
+
+bool USkinnedMeshComponent::UploadSkinnedVertices()
+{
+    if (SkinnedVertices.IsEmpty())
+    {
+        return false;
+    }
+
+    if (SkinnedVertexBuffer == nullptr)
+    {
+        D3D11_BUFFER_DESC BufferDesc = {};
+        BufferDesc.Usage = D3D11_USAGE_DYNAMIC;
+        BufferDesc.ByteWidth = sizeof(FBX::FSkeletalMeshVertex) * SkinnedVertices.Num();
+        BufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        BufferDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+        D3D11_SUBRESOURCE_DATA InitData = {};
+        InitData.pSysMem = SkinnedVertices.GetData();
+
+        // Buffer Manager의 Pool은 이름으로 공유되므로 인스턴스 버퍼는 컴포넌트가 직접 만들고 해제합니다.
+        HRESULT hr = FEngineLoop::GraphicDevice.Device->CreateBuffer(&BufferDesc, &InitData, &SkinnedVertexBuffer);
+        return SUCCEEDED(hr);
+    }
+
+    ID3D11DeviceContext* DeviceContext = FEngineLoop::GraphicDevice.DeviceContext;
+    D3D11_MAPPED_SUBRESOURCE MappedResource;
+    HRESULT hr = DeviceContext->Map(SkinnedVertexBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
+    if (FAILED(hr)) return false;
+
+    std::memcpy(MappedResource.pData, SkinnedVertices.GetData(), sizeof(FBX::FSkeletalMeshVertex) * SkinnedVertices.Num());
+
+    DeviceContext->Unmap(SkinnedVertexBuffer, 0);
+    return true;
+}
+
+void USkinnedMeshComponent::ReleaseSkinnedVertexBuffer()
+{
+    if (SkinnedVertexBuffer)
+    {
+        SkinnedVertexBuffer->Release();
+        SkinnedVertexBuffer = nullptr;
     }
 }
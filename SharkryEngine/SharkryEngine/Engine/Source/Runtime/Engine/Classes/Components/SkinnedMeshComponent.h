@@ -8,6 +8,7 @@ class USkinnedMeshComponent : public UMeshComponent
 
 public:
     USkinnedMeshComponent() = default;
+    virtual ~USkinnedMeshComponent() override;
 
     virtual UObject* Duplicate(UObject* InOuter) override;
 
@@ -26,8 +27,35 @@ public:
     
     USkeletalMesh* GetSkeletalMesh() const { return SkeletalMesh; }
     void SetSkeletalMesh(USkeletalMesh* value);
+
+    FAnimationPoseData& GetPose() { return Pose; }
+    const FAnimationPoseData& GetPose() const { return Pose; }
+
+    /** 이 인스턴스의 포즈로 본 변환을 갱신하고 스키닝 결과를 업로드합니다. */
+    void RefreshBoneTransforms();
+
+    /** 이 인스턴스의 스키닝 결과가 올라가 있는 Dynamic Vertex Buffer */
+    ID3D11Buffer* GetSkinnedVertexBuffer() const { return SkinnedVertexBuffer; }
+
+    /** 인스턴스 포즈가 차지하는 메모리 크기(Byte) */
+    uint64 GetPoseMemorySize() const { return Pose.GetAllocatedSize(); }
    
 protected:
     USkeletalMesh* SkeletalMesh = nullptr;
     int selectedSubMeshIndex = -1;
+
+    /** 같은 스켈레톤을 공유해도 인스턴스마다 다른 자세를 갖도록 컴포넌트가 소유하는 포즈 */
+    FAnimationPoseData Pose;
+
+private:
+    bool UploadSkinnedVertices();
+    void ReleaseSkinnedVertexBuffer();
+
+    /** CPU 스키닝 결과, 메시를 공유하는 다른 인스턴스와 섞이지 않도록 컴포넌트마다 가짐 */
+    TArray<FBX::FSkeletalMeshVertex> SkinnedVertices;
+
+    /** 스키닝 행렬의 역전치, RefreshBoneTransforms마다 본 단위로 다시 계산 */
+    TArray<FMatrix> BoneNormalMatrices;
+
+    ID3D11Buffer* SkinnedVertexBuffer = nullptr;
 };
@@ -5,6 +5,7 @@
 USkySphereComponent::USkySphereComponent()
 {
     SetType(StaticClass()->GetName());
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 UObject* USkySphereComponent::Duplicate(UObject* InOuter)
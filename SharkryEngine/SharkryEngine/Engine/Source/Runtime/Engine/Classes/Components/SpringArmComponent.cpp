@@ -33,6 +33,8 @@ USpringArmComponent::USpringArmComponent() : Super()
     // bClampToMaxPhysicsDeltaTime = false;
 
     UnfixedCameraPosition = FVector::ZeroVector;
+
+    PrimaryComponentTick.bCanEverTick = true;
 }
 
 void USpringArmComponent::GetProperties(TMap<FString, FString>& OutProperties) const
@@ -41,6 +41,7 @@ public:
             OverrideMaterials.SetNum(value->GetMaterials().Num());
             AABB = FBoundingBox(StaticMesh->GetRenderData()->BoundingBoxMin, StaticMesh->GetRenderData()->BoundingBoxMax);
         }
+        MarkRenderStateDirty();
     }
 
 protected:
@@ -0,0 +1,237 @@
+#include "Misc/AutomationTest.h"
+#include <cmath>
+#include "WindowsPlatformTime.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectArray.h"
+#include "World/World.h"
+
+namespace
+{
+    /** 실행마다 같은 Transform이 나오도록 하는 간단한 난수 */
+    struct FTestRandom
+    {
+        uint32 State = 12345u;
+
+        uint32 Next()
+        {
+            State = State * 1664525u + 1013904223u;
+            return State >> 8;
+        }
+
+        float Range(float Min, float Max)
+        {
+            return Min + (Max - Min) * static_cast<float>(Next() & 0xFFFF) / 65535.f;
+        }
+
+        int32 Index(int32 Num)
+        {
+            return static_cast<int32>(Next() % static_cast<uint32>(Num));
+        }
+    };
+
+    void SetRandomTransform(USceneComponent* Component, FTestRandom& Random)
+    {
+        Component->SetRelativeLocation(FVector(Random.Range(-10.f, 10.f), Random.Range(-10.f, 10.f), Random.Range(-10.f, 10.f)));
+        Component->SetRelativeRotation(FRotator(Random.Range(-90.f, 90.f), Random.Range(-180.f, 180.f), Random.Range(-180.f, 180.f)));
+
+        // 누적 Scale은 성분별 곱이므로, 깊은 계층에서도 값이 커지지 않도록 1 근처로 둡니다.
+        Component->SetRelativeScale3D(FVector(Random.Range(0.8f, 1.25f), Random.Range(0.8f, 1.25f), Random.Range(0.8f, 1.25f)));
+    }
+
+    /** 두 행렬의 가장 큰 성분 차이를, 값의 크기에 대한 비율로 반환합니다. */
+    float RelativeMatrixError(const FMatrix& A, const FMatrix& B)
+    {
+        float MaxDiff = 0.f;
+        float MaxValue = 1.f;
+        for (int32 Row = 0; Row < 4; ++Row)
+        {
+            for (int32 Col = 0; Col < 4; ++Col)
+            {
+                MaxDiff = std::fmax(MaxDiff, std::fabs(A.M[Row][Col] - B.M[Row][Col]));
+                MaxValue = std::fmax(MaxValue, std::fabs(B.M[Row][Col]));
+            }
+        }
+        return MaxDiff / MaxValue;
+    }
+
+    /** Actor마다 Root 아래로 NumComponents개의 컴포넌트를 임의의 부모에 붙인 Tree를 만듭니다. */
+    void BuildRandomTrees(UWorld* World, int32 NumActors, int32 NumComponents, FTestRandom& Random, TArray<USceneComponent*>& OutRoots, TArray<USceneComponent*>& OutComponents)
+    {
+        for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+        {
+            AActor* Actor = World->SpawnActor<AActor>();
+            const int32 FirstIndex = OutComponents.Num();
+            for (int32 Index = 0; Index < NumComponents; ++Index)
+            {
+                USceneComponent* Component = Actor->AddComponent<USceneComponent>();
+                if (Index > 0)
+                {
+                    Component->SetupAttachment(OutComponents[FirstIndex + Random.Index(Index)]);
+                }
+                SetRandomTransform(Component, Random);
+                OutComponents.Add(Component);
+            }
+            OutRoots.Add(OutComponents[FirstIndex]);
+        }
+    }
+
+    /** Root 아래로 Depth개의 컴포넌트가 한 줄로 붙은 Actor를 만들고, 가장 깊은 컴포넌트를 반환합니다. */
+    USceneComponent* BuildChain(UWorld* World, int32 Depth, FTestRandom& Random, USceneComponent*& OutRoot)
+    {
+        AActor* Actor = World->SpawnActor<AActor>();
+        USceneComponent* Parent = nullptr;
+        for (int32 Index = 0; Index < Depth; ++Index)
+        {
+            USceneComponent* Component = Actor->AddComponent<USceneComponent>();
+            if (Parent)
+            {
+                Component->SetupAttachment(Parent);
+            }
+            else
+            {
+                OutRoot = Component;
+            }
+            SetRandomTransform(Component, Random);
+            Parent = Component;
+        }
+        return Parent;
+    }
+
+    void DestroyTestWorld(UWorld* World)
+    {
+        World->Release();
+        GUObjectArray.MarkRemoveObject(World);
+        GUObjectArray.ProcessPendingDestroyObjects();
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FSceneComponentWorldTransformCacheTest, "Engine.Components.SceneComponent.WorldTransformCache", EAutomationTestType::Unit)
+{
+    constexpr int32 NumActors = 32;
+    constexpr int32 NumComponents = 24;
+    constexpr int32 NumRounds = 16;
+    constexpr float Tolerance = 1.e-4f;
+
+    UWorld* World = UWorld::CreateWorld(GEngine, EWorldType::Editor, FString("AutomationTestWorld"));
+    FTestRandom Random;
+
+    TArray<USceneComponent*> Roots;
+    TArray<USceneComponent*> Components;
+    BuildRandomTrees(World, NumActors, NumComponents, Random, Roots, Components);
+
+    for (int32 Round = 0; Round < NumRounds; ++Round)
+    {
+        // 임의의 컴포넌트를 바꾸고, 일부는 Tree 갱신 전에 중간 캐시만 먼저 읽어서 Dirty인 자손이 남은 상태를 만듭니다.
+        for (int32 Index = 0; Index < NumActors; ++Index)
+        {
+            USceneComponent* Component = Components[Random.Index(Components.Num())];
+            SetRandomTransform(Component, Random);
+            if (Random.Index(2) == 0)
+            {
+                Component->GetWorldMatrix();
+            }
+        }
+
+        for (USceneComponent* Root : Roots)
+        {
+            Root->UpdateWorldTransformTree();
+        }
+
+        int32 NumDirty = 0;
+        float MaxError = 0.f;
+        for (const USceneComponent* Component : Components)
+        {
+            NumDirty += Component->IsWorldTransformDirty() ? 1 : 0;
+            MaxError = std::fmax(MaxError, RelativeMatrixError(Component->GetWorldMatrix(), Component->CalcWorldMatrixUncached()));
+        }
+        TestEqual("Components left dirty after UpdateWorldTransformTree", NumDirty, 0);
+        TestTrue("Cached world matrix matches the uncached one", MaxError <= Tolerance);
+        if (MaxError > Tolerance)
+        {
+            AddError(FString::Printf(TEXT("Round %d: relative error %g"), Round, MaxError));
+            break;
+        }
+    }
+
+    DestroyTestWorld(World);
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FSceneComponentWorldTransformBenchmark, "Engine.Components.SceneComponent.WorldTransformDeepChain", EAutomationTestType::Benchmark)
+{
+    constexpr int32 NumChains = 2000;
+    constexpr int32 Depth = 32;
+    constexpr int32 NumIterations = 20;
+
+    UWorld* World = UWorld::CreateWorld(GEngine, EWorldType::Editor, FString("AutomationTestWorld"));
+    FTestRandom Random;
+
+    TArray<USceneComponent*> Roots;
+    TArray<USceneComponent*> Leaves;
+    for (int32 Index = 0; Index < NumChains; ++Index)
+    {
+        USceneComponent* Root = nullptr;
+        Leaves.Add(BuildChain(World, Depth, Random, Root));
+        Roots.Add(Root);
+    }
+
+    auto UpdateAll = [&Roots]()
+    {
+        for (USceneComponent* Root : Roots)
+        {
+            Root->UpdateWorldTransformTree();
+        }
+    };
+    UpdateAll();
+
+    auto Measure = [NumIterations](auto&& Prepare, auto&& Body)
+    {
+        double TotalMs = 0.0;
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            Prepare();
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            Body();
+            TotalMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+        }
+        return TotalMs / NumIterations;
+    };
+
+    const double CleanMs = Measure([] {}, UpdateAll);
+    const double LeafDirtyMs = Measure([&Leaves, &Random]
+    {
+        for (USceneComponent* Leaf : Leaves)
+        {
+            SetRandomTransform(Leaf, Random);
+        }
+    }, UpdateAll);
+    const double RootDirtyMs = Measure([&Roots, &Random]
+    {
+        for (USceneComponent* Root : Roots)
+        {
+            SetRandomTransform(Root, Random);
+        }
+    }, UpdateAll);
+
+    float Checksum = 0.f;
+    const double UncachedMs = Measure([] {}, [&Leaves, &Checksum]
+    {
+        for (const USceneComponent* Leaf : Leaves)
+        {
+            Checksum += Leaf->CalcWorldMatrixUncached().M[3][0];
+        }
+    });
+
+    AddInfo(FString::Printf(TEXT("%d chains x depth %d"), NumChains, Depth));
+    AddInfo(FString::Printf(TEXT("UpdateWorldTransformTree, nothing dirty: %.3f ms"), CleanMs));
+    AddInfo(FString::Printf(TEXT("UpdateWorldTransformTree, leaf dirty:    %.3f ms"), LeafDirtyMs));
+    AddInfo(FString::Printf(TEXT("UpdateWorldTransformTree, root dirty:    %.3f ms"), RootDirtyMs));
+    AddInfo(FString::Printf(TEXT("CalcWorldMatrixUncached for each leaf:   %.3f ms (checksum %f)"), UncachedMs, Checksum));
+
+    DestroyTestWorld(World);
+    return true;
+}
@@ -1,8 +1,8 @@
 #include "AssetManager.h"
 #include "Engine.h"
+#include "UObject/ObjectFactory.h"
 
 #include <filesystem>
-#include "Engine/FLoaderOBJ.h"
 
 bool UAssetManager::IsInitialized()
 {
@@ -19,7 +19,7 @@ UAssetManager& UAssetManager::Get()
     {
         UE_LOG(LogLevel::Error, "Cannot use AssetManager if no AssetManagerClassName is defined!");
         assert(0);
-        return *new UAssetManager; // never calls this
+        return *FObjectFactory::ConstructObject<UAssetManager>(nullptr); // never calls this
     }
 }
 
@@ -32,7 +32,7 @@ void UAssetManager::InitAssetManager()
 {
     AssetRegistry = std::make_unique<FAssetRegistry>();
 
-    LoadObjFiles();
+    ScanAssetRegistry();
 }
 
 const TMap<FName, FAssetInfo>& UAssetManager::GetAssetRegistry()
@@ -40,42 +40,40 @@ const TMap<FName, FAssetInfo>& UAssetManager::GetAssetRegistry()
     return AssetRegistry->PathNameToAssetInfo;
 }
 
-void UAssetManager::LoadObjFiles()
+void UAssetManager::ScanAssetRegistry()
 {
     const std::string BasePathName = "Contents/";
 
-    // Obj 파일 로드
-	
-    for (const auto& Entry : std::filesystem::recursive_directory_iterator(BasePathName))
+    // 파일 크기와 수정 시각은 Directory Entry에 담겨오는 값을 사용해서, 파일마다 따로 열지 않습니다.
+    std::error_code ec;
+    for (const auto& Entry : std::filesystem::recursive_directory_iterator(BasePathName, ec))
     {
-        if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+        if (!Entry.is_regular_file(ec))
         {
-            FAssetInfo NewAssetInfo;
-            NewAssetInfo.AssetName = FName(Entry.path().filename().string());
-            NewAssetInfo.PackagePath = FName(Entry.path().parent_path().string());
-            NewAssetInfo.AssetType = EAssetType::StaticMesh; // obj 파일은 무조건 StaticMesh
-            NewAssetInfo.Size = static_cast<uint32>(std::filesystem::file_size(Entry.path()));
-            
-            AssetRegistry->PathNameToAssetInfo.Add(NewAssetInfo.AssetName, NewAssetInfo);
-            
-            FString MeshName = NewAssetInfo.PackagePath.ToString() + "/" + NewAssetInfo.AssetName.ToString();
-            FManagerOBJ::CreateStaticMesh(MeshName);
-            // ObjFileNames.push_back(UGTLStringLibrary::StringToWString(Entry.path().string()));
-            // FObjManager::LoadObjStaticMeshAsset(UGTLStringLibrary::StringToWString(Entry.path().string()));
+            continue;
         }
 
-        if (Entry.is_regular_file() && Entry.path().extension() == ".csv")
+        const std::filesystem::path Extension = Entry.path().extension();
+
+        FAssetInfo NewAssetInfo;
+        if (Extension == ".obj")
+        {
+            NewAssetInfo.AssetType = EAssetType::StaticMesh; // obj 파일은 무조건 StaticMesh
+        }
+        else if (Extension == ".csv")
         {
-            FAssetInfo NewAssetInfo;
-            NewAssetInfo.AssetName = FName(Entry.path().filename().string());
-            NewAssetInfo.PackagePath = FName(Entry.path().parent_path().string());
             NewAssetInfo.AssetType = EAssetType::Curve;
-            NewAssetInfo.Size = static_cast<uint32>(std::filesystem::file_size(Entry.path()));
-            
-            AssetRegistry->PathNameToAssetInfo.Add(NewAssetInfo.AssetName, NewAssetInfo);
-            
-            // ObjFileNames.push_back(UGTLStringLibrary::StringToWString(Entry.path().string()));
-            // FObjManager::LoadObjStaticMeshAsset(UGTLStringLibrary::StringToWString(Entry.path().string()));
         }
+        else
+        {
+            continue;
+        }
+
+        NewAssetInfo.AssetName = FName(Entry.path().filename().string());
+        NewAssetInfo.PackagePath = FName(Entry.path().parent_path().string());
+        NewAssetInfo.Size = static_cast<uint32>(Entry.file_size(ec));
+        NewAssetInfo.LastWriteTime = Entry.last_write_time(ec).time_since_epoch().count();
+
+        AssetRegistry->PathNameToAssetInfo.Add(NewAssetInfo.AssetName, NewAssetInfo);
     }
 }
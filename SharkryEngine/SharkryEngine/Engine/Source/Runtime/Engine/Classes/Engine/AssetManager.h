@@ -17,6 +17,7 @@ struct FAssetInfo
     FName PackagePath;    // Asset의 패키지 경로
     EAssetType AssetType; // Asset의 타입
     uint32 Size;          // Asset의 크기 (바이트 단위)
+    int64 LastWriteTime;  // Asset 파일을 마지막으로 수정한 시각 (file_time_type의 Tick)
 };
 
 struct FAssetRegistry
@@ -47,5 +48,9 @@ public:
     const TMap<FName, FAssetInfo>& GetAssetRegistry();
 
 public:
-    void LoadObjFiles();
+    /**
+     * Contents 폴더를 돌며 Asset의 경로, 크기, 수정 시각만 Registry에 기록합니다.
+     * Mesh는 여기서 읽지 않고, FManagerOBJ::GetStaticMesh나 RequestStaticMeshAsync로 처음 요청될 때 읽습니다.
+     */
+    void ScanAssetRegistry();
 };
@@ -0,0 +1,178 @@
+#include "AsyncStaticMeshLoader.h"
+
+#include <algorithm>
+
+#include "Define.h"
+#include "Engine/FLoaderOBJ.h"
+
+FAsyncStaticMeshLoader::~FAsyncStaticMeshLoader()
+{
+    Shutdown();
+}
+
+void FAsyncStaticMeshLoader::Request(const FString& PathFileName)
+{
+    {
+        std::lock_guard Lock(Mutex);
+        if (bStopping || Requests.Contains(PathFileName))
+        {
+            return;
+        }
+
+        Requests.Add(PathFileName, FRequest());
+        Queue.Add(PathFileName);
+
+        if (Workers.IsEmpty())
+        {
+            StartWorkers();
+        }
+    }
+    WorkCondition.notify_one();
+}
+
+bool FAsyncStaticMeshLoader::IsPending(const FString& PathFileName) const
+{
+    std::lock_guard Lock(Mutex);
+    return Requests.Contains(PathFileName);
+}
+
+void FAsyncStaticMeshLoader::PopCompleted(TArray<FResult>& OutResults)
+{
+    std::lock_guard Lock(Mutex);
+
+    TArray<FString> DonePaths;
+    for (const auto& [PathFileName, Request] : Requests)
+    {
+        if (Request.State == ERequestState::Done)
+        {
+            OutResults.Add({ PathFileName, Request.RenderData });
+            DonePaths.Add(PathFileName);
+        }
+    }
+
+    for (const FString& PathFileName : DonePaths)
+    {
+        Requests.Remove(PathFileName);
+    }
+}
+
+bool FAsyncStaticMeshLoader::WaitFor(const FString& PathFileName, OBJ::FStaticMeshRenderData*& OutRenderData)
+{
+    std::unique_lock Lock(Mutex);
+
+    FRequest* Request = Requests.Find(PathFileName);
+    if (!Request)
+    {
+        return false;
+    }
+
+    if (Request->State == ERequestState::Queued)
+    {
+        // Queue에는 경로가 남아있지만, Worker는 Requests에 없는 경로를 건너뜁니다.
+        Requests.Remove(PathFileName);
+        Lock.unlock();
+
+        OutRenderData = FManagerOBJ::BuildStaticMeshRenderData(PathFileName);
+        return true;
+    }
+
+    DoneCondition.wait(Lock, [this, &PathFileName]
+    {
+        const FRequest* Current = Requests.Find(PathFileName);
+        return Current && Current->State == ERequestState::Done;
+    });
+
+    OutRenderData = Requests.Find(PathFileName)->RenderData;
+    Requests.Remove(PathFileName);
+    return true;
+}
+
+void FAsyncStaticMeshLoader::Shutdown()
+{
+    {
+        std::lock_guard Lock(Mutex);
+        bStopping = true;
+    }
+    WorkCondition.notify_all();
+
+    for (std::thread& Worker : Workers)
+    {
+        Worker.join();
+    }
+    Workers.Empty();
+
+    // Worker가 모두 끝났으므로 Lock 없이 남은 결과를 정리합니다.
+    for (auto& [PathFileName, Request] : Requests)
+    {
+        delete Request.RenderData;
+    }
+    Requests.Empty();
+    Queue.Empty();
+    NextQueueIndex = 0;
+}
+
+void FAsyncStaticMeshLoader::StartWorkers()
+{
+    const int32 NumCores = static_cast<int32>(std::thread::hardware_concurrency());
+    const int32 NumWorkers = std::clamp(NumCores / 2, 1, MaxNumWorkers);
+
+    for (int32 Index = 0; Index < NumWorkers; ++Index)
+    {
+        Workers.Emplace([this] { WorkerMain(); });
+    }
+}
+
+void FAsyncStaticMeshLoader::WorkerMain()
+{
+    while (true)
+    {
+        FString PathFileName;
+        {
+            std::unique_lock Lock(Mutex);
+            WorkCondition.wait(Lock, [this] { return bStopping || NextQueueIndex < Queue.Num(); });
+            if (bStopping)
+            {
+                return;
+            }
+            if (!PopQueuedRequest(PathFileName))
+            {
+                continue;
+            }
+        }
+
+        OBJ::FStaticMeshRenderData* RenderData = FManagerOBJ::BuildStaticMeshRenderData(PathFileName);
+
+        {
+            std::lock_guard Lock(Mutex);
+            FRequest& Request = *Requests.Find(PathFileName);
+            Request.RenderData = RenderData;
+            Request.State = ERequestState::Done;
+        }
+        DoneCondition.notify_all();
+    }
+}
+
+bool FAsyncStaticMeshLoader::PopQueuedRequest(FString& OutPathFileName)
+{
+    while (NextQueueIndex < Queue.Num())
+    {
+        const FString& PathFileName = Queue[NextQueueIndex++];
+
+        // WaitFor가 먼저 가져갔거나, 끝난 뒤 꺼내고 다시 요청된 경로는 건너뜁니다.
+        FRequest* Request = Requests.Find(PathFileName);
+        if (Request && Request->State == ERequestState::Queued)
+        {
+            Request->State = ERequestState::Loading;
+            OutPathFileName = PathFileName;
+            break;
+        }
+    }
+
+    // 남은 요청이 없다면 Queue를 비워서 계속 자라지 않도록 합니다.
+    if (NextQueueIndex == Queue.Num())
+    {
+        Queue.Empty();
+        NextQueueIndex = 0;
+    }
+    return !OutPathFileName.IsEmpty();
+}
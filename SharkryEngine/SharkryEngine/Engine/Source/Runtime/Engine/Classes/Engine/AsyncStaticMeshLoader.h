@@ -0,0 +1,105 @@
+#pragma once
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+namespace OBJ
+{
+    struct FStaticMeshRenderData;
+}
+
+/**
+ * OBJ Parsing과 Binary Cache 읽기를 Background 스레드에서 처리하는 Loader
+ *
+ * Worker는 FManagerOBJ::BuildStaticMeshRenderData로 파일을 읽어 FStaticMeshRenderData를 만드는 일만 하고,
+ * UStaticMesh, Material, Texture, Buffer 생성처럼 Object나 D3D Device를 건드리는 일은 결과를 꺼낸 Game Thread가 합니다.
+ *
+ * Mesh 하나를 읽는 데 수십 ms가 걸릴 수 있으므로 GJobSystem이 아닌 별도의 스레드를 사용합니다.
+ * GJobSystem에 넣으면 ParallelFor를 기다리는 Game Thread가 Queue에 남은 Load Job을 대신 실행해서 프레임이 멈출 수 있습니다.
+ * Worker 스레드는 처음 요청이 들어올 때 생성합니다.
+ */
+class FAsyncStaticMeshLoader
+{
+public:
+    /** 동시에 Mesh를 읽는 최대 Worker 수, 파일 읽기와 Parsing이 섞여 있으므로 코어를 모두 쓰지 않습니다. */
+    static constexpr int32 MaxNumWorkers = 4;
+
+    struct FResult
+    {
+        FString PathFileName;
+
+        /** 실패했다면 nullptr */
+        OBJ::FStaticMeshRenderData* RenderData = nullptr;
+    };
+
+    FAsyncStaticMeshLoader() = default;
+    ~FAsyncStaticMeshLoader();
+
+    FAsyncStaticMeshLoader(const FAsyncStaticMeshLoader&) = delete;
+    FAsyncStaticMeshLoader& operator=(const FAsyncStaticMeshLoader&) = delete;
+
+    /** 경로를 읽도록 요청합니다. 이미 요청했고 결과를 아직 꺼내지 않은 경로라면 무시합니다. */
+    void Request(const FString& PathFileName);
+
+    /** 요청했지만 결과를 아직 꺼내지 않은 경로라면 true */
+    bool IsPending(const FString& PathFileName) const;
+
+    /** 끝난 요청의 결과를 요청한 순서와 관계없이 모두 꺼냅니다. */
+    void PopCompleted(TArray<FResult>& OutResults);
+
+    /**
+     * 경로의 요청이 끝날 때까지 기다린 뒤 결과를 꺼냅니다.
+     * 아직 Worker가 시작하지 않은 요청이라면 기다리지 않고 호출한 스레드에서 바로 읽습니다.
+     * @return 요청하지 않은 경로라면 false
+     */
+    bool WaitFor(const FString& PathFileName, OBJ::FStaticMeshRenderData*& OutRenderData);
+
+    /** 시작하지 않은 요청은 버리고, 읽고 있는 요청이 끝나면 Worker 스레드를 종료합니다. */
+    void Shutdown();
+
+    int32 GetNumWorkers() const { return Workers.Num(); }
+
+private:
+    enum class ERequestState : uint8
+    {
+        Queued,
+        Loading,
+        Done,
+    };
+
+    struct FRequest
+    {
+        ERequestState State = ERequestState::Queued;
+        OBJ::FStaticMeshRenderData* RenderData = nullptr;
+    };
+
+    void StartWorkers();
+
+    void WorkerMain();
+
+    /** Queue에서 아직 시작하지 않은 요청을 꺼내 Loading으로 바꿉니다. Mutex를 잡은 상태에서 호출합니다. */
+    bool PopQueuedRequest(FString& OutPathFileName);
+
+private:
+    mutable std::mutex Mutex;
+
+    /** Queue에 요청이 들어오거나 종료할 때 Worker를 깨웁니다. */
+    std::condition_variable WorkCondition;
+
+    /** 요청이 끝날 때마다 WaitFor를 깨웁니다. */
+    std::condition_variable DoneCondition;
+
+    /** 요청 순서, [NextQueueIndex, Num) 구간이 남은 요청이고 WaitFor가 먼저 가져간 경로도 들어있습니다. */
+    TArray<FString> Queue;
+    int32 NextQueueIndex = 0;
+
+    TMap<FString, FRequest> Requests;
+
+    TArray<std::thread> Workers;
+    bool bStopping = false;
+};
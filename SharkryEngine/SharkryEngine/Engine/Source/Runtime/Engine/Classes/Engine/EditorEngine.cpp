@@ -4,6 +4,7 @@
 #include "Level.h"
 #include "GameFramework/Actor.h"
 #include "Classes/Engine/AssetManager.h"
+#include "Engine/FLoaderOBJ.h"
 #include "Components/Light/DirectionalLightComponent.h"
 #include "UnrealEd/EditorConfigManager.h"
 #include "GameFramework/PlayerController.h"
@@ -135,11 +136,12 @@ bool UEditorEngine::TryQuit(bool& OutbIsSave)
 
 void UEditorEngine::Release()
 {
+    FManagerOBJ::ShutdownAsyncLoading();
 }
 
 void UEditorEngine::LoadLevel(const FString& FilePath) const
 {
-    SceneManager::LoadSceneFromJsonFile(GetData(FilePath), *ActiveWorld);
+    SceneManager::LoadScene(GetData(FilePath), *ActiveWorld);
 }
 
 void UEditorEngine::SaveLevel(const FString& FilePath) const
@@ -164,65 +166,21 @@ void UEditorEngine::SaveConfig() const
 
 void UEditorEngine::Tick(float DeltaTime)
 {
+    // Background에서 다 읽은 Mesh를 World Tick 전에 UStaticMesh로 만들어서, 이번 프레임부터 그려지도록 합니다.
+    FManagerOBJ::ProcessAsyncLoads();
+
     for (FWorldContext* WorldContext : WorldList)
     {
-        if (WorldContext->WorldType == EWorldType::Editor)
-        {
-            if (UWorld* World = WorldContext->World())
-            {
-                // TODO: World에서 EditorPlayer 제거 후 Tick 호출 제거 필요.
-                World->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
-            }
-        }
-        else if (WorldContext->WorldType == EWorldType::PIE)
-        {
-            if (UWorld* World = WorldContext->World())
-            {
-                World->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor)
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
-            }
-        }
-        else if(WorldContext->WorldType == EWorldType::Viewer)
+        // Actor와 Component의 Tick은 World가 Tick Group 순서대로 실행합니다.
+        // Editor, Viewer World는 IsActorTickInEditor인 Actor만 Tick합니다.
+        if (WorldContext->WorldType == EWorldType::Editor
+            || WorldContext->WorldType == EWorldType::PIE
+            || WorldContext->WorldType == EWorldType::Viewer)
         {
             if (UWorld* World = WorldContext->World())
             {
                 // TODO: World에서 EditorPlayer 제거 후 Tick 호출 제거 필요.
                 World->Tick(DeltaTime);
-                ULevel* Level = World->GetActiveLevel();
-                TArray CachedActors = Level->Actors;
-                if (Level)
-                {
-                    for (AActor* Actor : CachedActors)
-                    {
-                        if (Actor && Actor->IsActorTickInEditor())
-                        {
-                            Actor->Tick(DeltaTime);
-                        }
-                    }
-                }
             }
         }
     }
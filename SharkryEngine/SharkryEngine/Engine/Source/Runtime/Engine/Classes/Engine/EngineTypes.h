@@ -13,3 +13,49 @@ enum Type : uint8
     Quit,
 };
 }
+
+/** Tick이 실행되는 단계, 앞의 Group이 모두 끝난 뒤에 다음 Group이 시작됩니다. */
+enum ETickingGroup : uint8
+{
+    /** 충돌 처리 이전, 입력에 따른 이동 등 */
+    TG_PrePhysics,
+    /** PrePhysics 이후 충돌 처리 이전, 다른 Actor의 결과에 의존하지 않는 이동 등 */
+    TG_DuringPhysics,
+    /** 충돌 처리 이후, 이번 프레임의 Overlap 결과를 사용하는 작업 등 */
+    TG_PostPhysics,
+
+    TG_MAX,
+};
+
+/**
+ * Actor, Component의 Tick 설정
+ * World의 Tick 목록에 들어갈 때 읽으므로, 보통 생성자에서 설정합니다.
+ * 목록에 들어간 뒤 bTickEnabled나 TickGroup을 바꿀 때는 SetComponentTickEnabled처럼 목록을 다시 모으도록 알리는 함수를 사용합니다.
+ */
+struct FTickFunction
+{
+    /** Tick이 실행될 Group */
+    ETickingGroup TickGroup = TG_PrePhysics;
+
+    /** false라면 Tick 목록에 넣지 않습니다. Component는 기본값이 false이고, Tick에서 할 일이 있는 Class만 생성자에서 켭니다. */
+    uint8 bCanEverTick : 1 = true;
+
+    /** 현재 Tick이 켜져 있는지 여부, bCanEverTick과 둘 다 true일 때만 Tick 목록에 넣습니다. */
+    uint8 bTickEnabled : 1 = true;
+
+    /**
+     * true라면 같은 Group의 다른 Component Tick과 함께 Worker 스레드에서 실행됩니다. Component에만 적용됩니다.
+     * 자기 자신과 Owner Actor의 상태만 수정해야 하고, Spawn, Destroy처럼 World를 바꾸는 작업은
+     * FTickTaskManager::QueueGameThreadTask로 Game Thread에 넘겨야 합니다.
+     * Owner가 다른 Actor와 Attach로 이어져 있거나, 같은 Group에 같은 Owner의 병렬 Component가 이미 있으면 Game Thread에서 실행됩니다.
+     */
+    uint8 bRunOnAnyThread : 1 = false;
+
+    /** Tick 사이의 최소 간격(초), 0이면 매 프레임 Tick합니다. 간격이 지나면 그동안 쌓인 DeltaTime을 한번에 넘깁니다. */
+    float TickInterval = 0.0f;
+
+    /** 마지막 Tick 이후 쌓인 시간, FTickTaskManager만 사용합니다. */
+    float AccumulatedDeltaTime = 0.0f;
+
+    bool IsTickFunctionEnabled() const { return bCanEverTick && bTickEnabled; }
+};
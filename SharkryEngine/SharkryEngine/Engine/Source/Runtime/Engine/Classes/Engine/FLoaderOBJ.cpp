@@ -3,16 +3,244 @@
 #include "UObject/ObjectFactory.h"
 #include "Components/Material/Material.h"
 #include "Components/Mesh/StaticMesh.h"
+#include "StaticMeshSimplifier.h"
 
+#include <charconv>
+#include <cstring>
 #include <fstream>
+#include <span>
 #include <sstream>
+#include <string_view>
 
 #include <filesystem> 
 
+namespace
+{
+    /** 파일 전체를 한 번에 읽습니다. 줄마다 읽는 것보다 파일 접근과 복사가 적습니다. */
+    bool ReadFileToBuffer(const FWString& FilePath, TArray<char>& OutBuffer)
+    {
+        std::ifstream File(std::filesystem::path(FilePath), std::ios::binary | std::ios::ate);
+        if (!File)
+        {
+            return false;
+        }
+
+        const std::streamsize Size = File.tellg();
+        if (Size < 0)
+        {
+            return false;
+        }
+
+        OutBuffer.SetNum(static_cast<int32>(Size));
+        File.seekg(0, std::ios::beg);
+        return Size == 0 || File.read(OutBuffer.GetData(), Size).good();
+    }
+
+    /**
+     * Buffer에서 OBJ를 한 줄씩 잘라 읽는 Cursor
+     *
+     * 줄마다 std::string과 std::istringstream을 만들지 않고 Buffer를 직접 읽으며,
+     * 숫자는 Locale과 관계없이 직접 변환합니다. 공백은 istream과 같이 ' ', '\t', '\r', '\v', '\f'를 모두 건너뜁니다.
+     */
+    struct FObjLineCursor
+    {
+        const char* Current = nullptr;
+        const char* LineEnd = nullptr;
+        const char* BufferEnd = nullptr;
+
+        FObjLineCursor(const char* Begin, const char* End)
+            : Current(Begin), LineEnd(Begin), BufferEnd(End)
+        {
+        }
+
+        /** 다음 줄로 넘어갑니다. 남은 줄이 없다면 false */
+        bool NextLine()
+        {
+            if (Current >= BufferEnd)
+            {
+                return false;
+            }
+
+            const void* NewLine = std::memchr(Current, '\n', BufferEnd - Current);
+            LineEnd = NewLine ? static_cast<const char*>(NewLine) : BufferEnd;
+            return true;
+        }
+
+        /** 읽던 줄의 남은 부분과 줄 끝의 '\n'을 넘깁니다. NextLine마다 한 번 호출합니다. */
+        void FinishLine()
+        {
+            Current = LineEnd < BufferEnd ? LineEnd + 1 : BufferEnd;
+            LineEnd = Current;
+        }
+
+        static bool IsSpace(char Char)
+        {
+            return Char == ' ' || Char == '\t' || Char == '\r' || Char == '\v' || Char == '\f';
+        }
+
+        static bool IsDigit(char Char)
+        {
+            return Char >= '0' && Char <= '9';
+        }
+
+        void SkipSpaces()
+        {
+            while (Current < LineEnd && IsSpace(*Current))
+            {
+                ++Current;
+            }
+        }
+
+        /** 공백으로 구분된 다음 Token, 줄에 남은 Token이 없다면 빈 값을 반환합니다. */
+        std::string_view ReadToken()
+        {
+            SkipSpaces();
+            const char* Begin = Current;
+            while (Current < LineEnd && !IsSpace(*Current))
+            {
+                ++Current;
+            }
+            return std::string_view(Begin, Current - Begin);
+        }
+
+        /** 부호가 있는 10진 정수, 숫자가 없다면 false를 반환하고 Cursor를 움직이지 않습니다. */
+        bool ReadInt(int32& OutValue)
+        {
+            const char* Begin = Current;
+            const bool bNegative = Current < LineEnd && *Current == '-';
+            if (Current < LineEnd && (*Current == '-' || *Current == '+'))
+            {
+                ++Current;
+            }
+
+            if (Current >= LineEnd || !IsDigit(*Current))
+            {
+                Current = Begin;
+                return false;
+            }
+
+            int64 Value = 0;
+            while (Current < LineEnd && IsDigit(*Current))
+            {
+                Value = Value * 10 + (*Current - '0');
+                ++Current;
+            }
+            OutValue = static_cast<int32>(bNegative ? -Value : Value);
+            return true;
+        }
+
+        /**
+         * 공백을 건너뛰고 실수를 읽습니다. 읽지 못했다면 0을 반환합니다.
+         *
+         * 유효 숫자가 2^24 미만이고 10의 지수가 10 이하라면 두 값 모두 float로 정확히 표현되므로,
+         * 곱셈이나 나눗셈 한 번의 반올림이 strtof와 같은 결과를 냅니다. OBJ의 좌표는 대부분 여기에 해당하고,
+         * 나머지는 std::from_chars로 읽습니다.
+         */
+        float ReadFloat()
+        {
+            static constexpr float PowersOf10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+            SkipSpaces();
+            if (Current < LineEnd && *Current == '+')
+            {
+                ++Current;
+            }
+
+            const char* Begin = Current;
+            const bool bNegative = Current < LineEnd && *Current == '-';
+            if (bNegative)
+            {
+                ++Current;
+            }
+
+            uint64 Mantissa = 0;
+            int32 Exponent = 0;
+            int32 NumDigits = 0;
+            bool bOverflow = false;
+
+            const auto ReadDigits = [&](bool bFraction)
+            {
+                while (Current < LineEnd && IsDigit(*Current))
+                {
+                    if (Mantissa < 100000000000000000ull)
+                    {
+                        Mantissa = Mantissa * 10 + (*Current - '0');
+                        Exponent -= bFraction ? 1 : 0;
+                    }
+                    else
+                    {
+                        bOverflow = true;
+                    }
+                    ++NumDigits;
+                    ++Current;
+                }
+            };
+
+            ReadDigits(false);
+            if (Current < LineEnd && *Current == '.')
+            {
+                ++Current;
+                ReadDigits(true);
+            }
+
+            if (NumDigits > 0 && Current < LineEnd && (*Current == 'e' || *Current == 'E'))
+            {
+                const char* ExponentBegin = Current++;
+                int32 ExponentValue = 0;
+                if (ReadInt(ExponentValue))
+                {
+                    Exponent += ExponentValue;
+                }
+                else
+                {
+                    Current = ExponentBegin;
+                }
+            }
+
+            if (NumDigits > 0 && !bOverflow && Mantissa < (1ull << 24) && Exponent >= -10 && Exponent <= 10)
+            {
+                float Value = static_cast<float>(Mantissa);
+                Value = Exponent < 0 ? Value / PowersOf10[-Exponent] : Value * PowersOf10[Exponent];
+                return bNegative ? -Value : Value;
+            }
+
+            float Value = 0.f;
+            const std::from_chars_result Result = std::from_chars(Begin, LineEnd, Value);
+            Current = Result.ec == std::errc() || Result.ec == std::errc::result_out_of_range ? Result.ptr : Begin;
+            return Value;
+        }
+    };
+
+    /** 정점 중복 제거에 사용하는 v/vt/vn Index 묶음 */
+    struct FObjVertexKey
+    {
+        uint32 VertexIndex;
+        uint32 UVIndex;
+        uint32 NormalIndex;
+
+        bool operator==(const FObjVertexKey& Other) const
+        {
+            return VertexIndex == Other.VertexIndex && UVIndex == Other.UVIndex && NormalIndex == Other.NormalIndex;
+        }
+    };
+}
+
+template<>
+struct std::hash<FObjVertexKey>
+{
+    size_t operator()(const FObjVertexKey& Key) const noexcept
+    {
+        uint64 Hash = Key.VertexIndex * 0x9E3779B97F4A7C15ull;
+        Hash ^= Key.UVIndex * 0xC2B2AE3D27D4EB4Full;
+        Hash ^= Key.NormalIndex * 0x165667B19E3779F9ull;
+        return static_cast<size_t>(Hash ^ (Hash >> 32));
+    }
+};
+
 bool FLoaderOBJ::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
 {
-    std::ifstream OBJ(ObjFilePath.ToWideString());
-    if (!OBJ)
+    TArray<char> Buffer;
+    if (!ReadFileToBuffer(ObjFilePath.ToWideString(), Buffer))
     {
         return false;
     }
@@ -43,164 +271,149 @@ bool FLoaderOBJ::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
      *       ✅ Triangulated Mesh
      */
 
-    std::string Line;
-
-    while (std::getline(OBJ, Line))
+    FObjLineCursor Cursor(Buffer.GetData(), Buffer.GetData() + Buffer.Num());
+    for (; Cursor.NextLine(); Cursor.FinishLine())
     {
-        if (Line.empty() || Line[0] == '#')
+        if (Cursor.Current == Cursor.LineEnd || *Cursor.Current == '#')
             continue;
 
-        std::istringstream LineStream(Line);
-        std::string Token;
-        LineStream >> Token;
-
-        if (Token == "mtllib")
-        {
-            LineStream >> Line;
-            OutObjInfo.MatName = Line;
-            continue;
-        }
-
-        if (Token == "usemtl")
-        {
-            LineStream >> Line;
-            FString MatName(Line);
-
-            if (!OutObjInfo.MaterialSubsets.IsEmpty())
-            {
-                FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
-                LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
-            }
-
-            FMaterialSubset MaterialSubset;
-            MaterialSubset.MaterialName = MatName;
-            MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
-            MaterialSubset.IndexCount = 0;
-            OutObjInfo.MaterialSubsets.Add(MaterialSubset);
-        }
-
-        if (Token == "g" || Token == "o")
-        {
-            LineStream >> Line;
-            OutObjInfo.GroupName.Add(Line);
-            OutObjInfo.NumOfGroup++;
-        }
+        const std::string_view Token = Cursor.ReadToken();
 
         if (Token == "v") // Vertex
         {
-            float X, Y, Z;
-            LineStream >> X >> Y >> Z;
+            const float X = Cursor.ReadFloat();
+            const float Y = Cursor.ReadFloat();
+            const float Z = Cursor.ReadFloat();
             OutObjInfo.Vertices.Add(FVector(X, Y * -1.f, Z));
             continue;
         }
 
         if (Token == "vn") // Normal
         {
-            float NormalX, NormalY, NormalZ;
-            LineStream >> NormalX >> NormalY >> NormalZ;
+            const float NormalX = Cursor.ReadFloat();
+            const float NormalY = Cursor.ReadFloat();
+            const float NormalZ = Cursor.ReadFloat();
             OutObjInfo.Normals.Add(FVector(NormalX, NormalY * -1.f, NormalZ));
             continue;
         }
 
         if (Token == "vt") // Texture
         {
-            float U, V;
-            LineStream >> U >> V;
+            const float U = Cursor.ReadFloat();
+            const float V = Cursor.ReadFloat();
             OutObjInfo.UVs.Add(FVector2D(U, 1.f - V));
             continue;
         }
 
         if (Token == "f")
         {
-            TArray<uint32> FaceVertexIndices;  // 이번 페이스의 정점 인덱스
-            TArray<uint32> FaceNormalIndices;  // 이번 페이스의 법선 인덱스
-            TArray<uint32> FaceUVIndices; // 이번 페이스의 텍스처 인덱스
+            // 삼각형과 쿼드만 사용하므로 앞의 4개만 저장하고 개수만 셉니다.
+            uint32 FaceVertexIndices[4];  // 이번 페이스의 정점 인덱스
+            uint32 FaceNormalIndices[4];  // 이번 페이스의 법선 인덱스
+            uint32 FaceUVIndices[4]; // 이번 페이스의 텍스처 인덱스
+            int32 NumFaceVertices = 0;
 
-            while (LineStream >> Token)
+            while (true)
             {
-                std::istringstream TokenStream(Token);
-                std::string Part;
-                TArray<std::string> FacePieces;
+                Cursor.SkipSpaces();
+                if (Cursor.Current == Cursor.LineEnd)
+                {
+                    break;
+                }
 
                 uint32 vertexIndex = 0;
                 uint32 textureIndex = UINT32_MAX;
                 uint32 normalIndex = UINT32_MAX;
 
-                // v
-                if (std::getline(TokenStream, Part, '/'))
+                // v/vt/vn, 비어있는 항목은 기본값을 유지합니다.
+                int32 Value;
+                if (Cursor.ReadInt(Value))
+                {
+                    vertexIndex = Value - 1;
+                }
+                if (Cursor.Current < Cursor.LineEnd && *Cursor.Current == '/')
                 {
-                    if (!Part.empty())
+                    ++Cursor.Current;
+                    if (Cursor.ReadInt(Value))
                     {
-                        vertexIndex = std::stoi(Part) - 1;
+                        textureIndex = Value - 1;
+                    }
+                    if (Cursor.Current < Cursor.LineEnd && *Cursor.Current == '/')
+                    {
+                        ++Cursor.Current;
+                        if (Cursor.ReadInt(Value))
+                        {
+                            normalIndex = Value - 1;
+                        }
                     }
                 }
 
-                // vt
-                if (std::getline(TokenStream, Part, '/'))
+                // 숫자 뒤에 남은 문자는 Token 끝까지 무시합니다.
+                while (Cursor.Current < Cursor.LineEnd && !FObjLineCursor::IsSpace(*Cursor.Current))
                 {
-                    if (!Part.empty())
-                    {
-                        textureIndex = std::stoi(Part) - 1;
-                    }
+                    ++Cursor.Current;
                 }
 
-                // vn
-                if (std::getline(TokenStream, Part, '/'))
+                if (NumFaceVertices < 4)
                 {
-                    if (!Part.empty())
-                    {
-                        normalIndex = std::stoi(Part) - 1;
-                    }
+                    FaceVertexIndices[NumFaceVertices] = vertexIndex;
+                    FaceUVIndices[NumFaceVertices] = textureIndex;
+                    FaceNormalIndices[NumFaceVertices] = normalIndex;
                 }
+                ++NumFaceVertices;
+            }
+
+            // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환: 0-2-1, 쿼드는 0-3-2 삼각형을 하나 더 만듭니다.
+            static constexpr int32 TriangleCorners[] = { 0, 2, 1 };
+            static constexpr int32 QuadCorners[] = { 0, 2, 1, 0, 3, 2 };
 
-                FaceVertexIndices.Add(vertexIndex);
-                FaceUVIndices.Add(textureIndex);
-                FaceNormalIndices.Add(normalIndex);
+            std::span<const int32> Corners;
+            if (NumFaceVertices == 3) // 삼각형
+            {
+                Corners = TriangleCorners;
+            }
+            else if (NumFaceVertices == 4) // 쿼드
+            {
+                Corners = QuadCorners;
             }
 
-            if (FaceVertexIndices.Num() == 3) // 삼각형
+            for (const int32 Corner : Corners)
             {
-                // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환: 0-2-1
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
-
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
+                OutObjInfo.VertexIndices.Add(FaceVertexIndices[Corner]);
+                OutObjInfo.UVIndices.Add(FaceUVIndices[Corner]);
+                OutObjInfo.NormalIndices.Add(FaceNormalIndices[Corner]);
             }
-            else if (FaceVertexIndices.Num() == 4) // 쿼드
+            continue;
+        }
+
+        if (Token == "mtllib")
+        {
+            OutObjInfo.MatName = FString(std::string(Cursor.ReadToken()));
+            continue;
+        }
+
+        if (Token == "usemtl")
+        {
+            FString MatName(std::string(Cursor.ReadToken()));
+
+            if (!OutObjInfo.MaterialSubsets.IsEmpty())
             {
-                // 첫 번째 삼각형: 0-2-1
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
-
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
-
-                // 두 번째 삼각형: 0-3-2
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[3]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
-
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[3]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
-
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[3]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+                FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+                LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
             }
+
+            FMaterialSubset MaterialSubset;
+            MaterialSubset.MaterialName = MatName;
+            MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
+            MaterialSubset.IndexCount = 0;
+            OutObjInfo.MaterialSubsets.Add(MaterialSubset);
+            continue;
+        }
+
+        if (Token == "g" || Token == "o")
+        {
+            OutObjInfo.GroupName.Add(FString(std::string(Cursor.ReadToken())));
+            OutObjInfo.NumOfGroup++;
         }
     }
 
@@ -312,8 +525,6 @@ bool FLoaderOBJ::ParseMaterial(FObjInfo& OutObjInfo, OBJ::FStaticMeshRenderData&
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].DiffuseTextureName.ToWideString();
             OutFStaticMesh.Materials[MaterialIndex].DiffuseTexturePath = TexturePath;
             OutFStaticMesh.Materials[MaterialIndex].TextureFlag |= (1 << 1);
-
-            CreateTextureFromFile(OutFStaticMesh.Materials[MaterialIndex].DiffuseTexturePath);
         }
 
         if (Token == "map_Bump")
@@ -333,8 +544,6 @@ bool FLoaderOBJ::ParseMaterial(FObjInfo& OutObjInfo, OBJ::FStaticMeshRenderData&
                     FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].BumpTextureName.ToWideString();
                     OutFStaticMesh.Materials[MaterialIndex].BumpTexturePath = TexturePath;
                     OutFStaticMesh.Materials[MaterialIndex].TextureFlag |= (1 << 2);
-
-                    CreateTextureFromFile(OutFStaticMesh.Materials[MaterialIndex].BumpTexturePath);
                 }
             }
         }
@@ -350,7 +559,15 @@ bool FLoaderOBJ::ConvertToStaticMesh(const FObjInfo& RawData, OBJ::FStaticMeshRe
     OutStaticMesh.DisplayName = RawData.DisplayName;
 
     // 고유 정점을 기반으로 FVertexSimple 배열 생성
-    TMap<std::string, uint32> IndexMap; // 중복 체크용
+    // 중복 체크용, 값은 Vertices의 Index + 1이고 새로 추가된 Key는 0이므로 찾기와 추가를 한 번에 합니다.
+    TMap<FObjVertexKey, uint32> IndexMap;
+    IndexMap.Reserve(RawData.Vertices.Num());
+    OutStaticMesh.Vertices.Reserve(RawData.Vertices.Num());
+    OutStaticMesh.Indices.Reserve(RawData.VertexIndices.Num());
+
+    // Subset은 Index 순서대로 이어져 있으므로, 매번 처음부터 찾지 않고 현재 Subset에서부터 앞으로만 넘깁니다.
+    const TArray<FMaterialSubset>& Subsets = OutStaticMesh.MaterialSubsets;
+    int32 SubsetCursor = 0;
 
     for (int32 i = 0; i < RawData.VertexIndices.Num(); i++)
     {
@@ -358,24 +575,23 @@ bool FLoaderOBJ::ConvertToStaticMesh(const FObjInfo& RawData, OBJ::FStaticMeshRe
         const uint32 UVIndex = RawData.UVIndices[i];
         const uint32 NormalIndex = RawData.NormalIndices[i];
 
+        while (SubsetCursor < Subsets.Num() && static_cast<uint32>(i) >= Subsets[SubsetCursor].IndexStart + Subsets[SubsetCursor].IndexCount)
+        {
+            ++SubsetCursor;
+        }
+
         uint32 MaterialIndex = 0;
-        for (int32 j = 0; j < OutStaticMesh.MaterialSubsets.Num(); j++)
+        if (SubsetCursor < Subsets.Num() && Subsets[SubsetCursor].IndexStart <= static_cast<uint32>(i))
         {
-            const FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[j];
-            if (Subset.IndexStart <= i && i < Subset.IndexStart + Subset.IndexCount)
-            {
-                MaterialIndex = Subset.MaterialIndex;
-                break;
-            }
+            MaterialIndex = Subsets[SubsetCursor].MaterialIndex;
         }
 
-        // 키 생성 (v/vt/vn 조합)
-        std::string Key = std::to_string(VertexIndex) + "/" + std::to_string(UVIndex) + "/" + std::to_string(NormalIndex);
+        uint32& IndexPlusOne = IndexMap.FindOrAdd({ VertexIndex, UVIndex, NormalIndex });
 
         uint32 FinalIndex;
-        if (IndexMap.Contains(Key))
+        if (IndexPlusOne != 0)
         {
-            FinalIndex = IndexMap[Key];
+            FinalIndex = IndexPlusOne - 1;
         }
         else
         {
@@ -401,7 +617,7 @@ bool FLoaderOBJ::ConvertToStaticMesh(const FObjInfo& RawData, OBJ::FStaticMeshRe
             }
 
             FinalIndex = OutStaticMesh.Vertices.Num();
-            IndexMap[Key] = FinalIndex;
+            IndexPlusOne = FinalIndex + 1;
             OutStaticMesh.Vertices.Add(StaticMeshVertex);
         }
 
@@ -513,17 +729,36 @@ void FLoaderOBJ::CalculateTangent(FStaticMeshVertex& PivotVertex, const FStaticM
 
 OBJ::FStaticMeshRenderData* FManagerOBJ::LoadObjStaticMeshAsset(const FString& PathFileName)
 {
-    OBJ::FStaticMeshRenderData* NewStaticMesh = new OBJ::FStaticMeshRenderData();
-
     if (const auto It = ObjStaticMeshMap.Find(PathFileName))
     {
         return *It;
     }
+
+    // Background에서 이미 읽고 있다면 같은 파일을 다시 읽지 않고 그 결과를 사용합니다.
+    OBJ::FStaticMeshRenderData* NewStaticMesh = nullptr;
+    if (!AsyncLoader.WaitFor(PathFileName, NewStaticMesh))
+    {
+        NewStaticMesh = BuildStaticMeshRenderData(PathFileName);
+    }
+
+    if (NewStaticMesh == nullptr)
+    {
+        FailedStaticMeshPaths.Add(PathFileName);
+        return nullptr;
+    }
+
+    FailedStaticMeshPaths.Remove(PathFileName);
+    LoadMaterialTextures(*NewStaticMesh);
+    ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
+    return NewStaticMesh;
+}
+
+OBJ::FStaticMeshRenderData* FManagerOBJ::BuildStaticMeshRenderData(const FString& PathFileName)
+{
     FWString BinaryPath = GetBinaryPath(PathFileName.ToWideString());
 
 
     std::error_code ec;
-    bool bShouldParseObj = true;
     bool bBinaryExists = std::filesystem::exists(BinaryPath, ec);
 
     std::filesystem::file_time_type objTimestamp;
@@ -557,7 +792,6 @@ OBJ::FStaticMeshRenderData* FManagerOBJ::LoadObjStaticMeshAsset(const FString& P
 
     if (ec)
     {
-        bShouldParseObj = true;
         bBinaryExists = false;
         ec.clear();
     }
@@ -567,36 +801,34 @@ OBJ::FStaticMeshRenderData* FManagerOBJ::LoadObjStaticMeshAsset(const FString& P
         binTimestamp = std::filesystem::last_write_time(BinaryPath, ec);
         if (ec)
         {
-            bShouldParseObj = true;
             ec.clear(); // Clear error code
         }
-
         else if (binTimestamp >= newestSource)
         {
             OBJ::FStaticMeshRenderData* LoadedMesh = new OBJ::FStaticMeshRenderData();
             if (LoadStaticMeshFromBinary(BinaryPath, *LoadedMesh))
             {
-                ObjStaticMeshMap[PathFileName] = LoadedMesh;
-                bShouldParseObj = false;
                 return LoadedMesh;
             }
-            else
-            {
-                delete LoadedMesh; // Clean up allocated memory
-                bShouldParseObj = true; // Force parsing
-            }
-        }
-        else
-        {
-            bShouldParseObj = true; // Force parsing
+            delete LoadedMesh; // Clean up allocated memory, Force parsing
         }
     }
 
-    if (bShouldParseObj)
+    // Parse OBJ
+    FObjInfo NewObjInfo;
+    bool Result = FLoaderOBJ::ParseOBJ(PathFileName, NewObjInfo);
+
+    if (!Result)
+    {
+        return nullptr;
+    }
+
+    OBJ::FStaticMeshRenderData* NewStaticMesh = new OBJ::FStaticMeshRenderData();
+
+    // Material, UMaterial은 UStaticMesh::SetData에서 Game Thread가 만듭니다.
+    if (NewObjInfo.MaterialSubsets.Num() > 0)
     {
-        // Parse OBJ
-        FObjInfo NewObjInfo;
-        bool Result = FLoaderOBJ::ParseOBJ(PathFileName, NewObjInfo);
+        Result = FLoaderOBJ::ParseMaterial(NewObjInfo, *NewStaticMesh);
 
         if (!Result)
         {
@@ -604,35 +836,36 @@ OBJ::FStaticMeshRenderData* FManagerOBJ::LoadObjStaticMeshAsset(const FString& P
             return nullptr;
         }
 
-        // Material
-        if (NewObjInfo.MaterialSubsets.Num() > 0)
-        {
-            Result = FLoaderOBJ::ParseMaterial(NewObjInfo, *NewStaticMesh);
+        CombineMaterialIndex(*NewStaticMesh);
+    }
 
-            if (!Result)
-            {
-                delete NewStaticMesh;
-                return nullptr;
-            }
+    // Convert FStaticMeshRenderData
+    Result = FLoaderOBJ::ConvertToStaticMesh(NewObjInfo, *NewStaticMesh);
+    if (!Result)
+    {
+        delete NewStaticMesh;
+        return nullptr;
+    }
 
-            CombineMaterialIndex(*NewStaticMesh);
+    // LOD는 Cook할 때 한 번 만들고 Binary Cache에 함께 저장합니다.
+    FStaticMeshSimplifier::BuildLODs(*NewStaticMesh);
 
-            for (int materialIndex = 0; materialIndex < NewStaticMesh->Materials.Num(); materialIndex++) {
-                CreateMaterial(NewStaticMesh->Materials[materialIndex]);
-            }
-        }
+    SaveStaticMeshToBinary(BinaryPath, *NewStaticMesh); // TODO: refactoring 끝나면 활성화하기
+    return NewStaticMesh;
+}
 
-        // Convert FStaticMeshRenderData
-        Result = FLoaderOBJ::ConvertToStaticMesh(NewObjInfo, *NewStaticMesh);
-        if (!Result)
+void FManagerOBJ::LoadMaterialTextures(const OBJ::FStaticMeshRenderData& StaticMesh)
+{
+    for (const FObjMaterialInfo& Material : StaticMesh.Materials)
+    {
+        for (const FWString* TexturePath : { &Material.DiffuseTexturePath, &Material.AmbientTexturePath, &Material.SpecularTexturePath,
+                                             &Material.BumpTexturePath, &Material.AlphaTexturePath })
         {
-            delete NewStaticMesh;
-            return nullptr;
+            if (!TexturePath->empty())
+            {
+                FLoaderOBJ::CreateTextureFromFile(*TexturePath);
+            }
         }
-
-        SaveStaticMeshToBinary(BinaryPath, *NewStaticMesh); // TODO: refactoring 끝나면 활성화하기
-        ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
-        return NewStaticMesh;
     }
 }
 
@@ -652,291 +885,166 @@ void FManagerOBJ::CombineMaterialIndex(OBJ::FStaticMeshRenderData& OutFStaticMes
     }
 }
 
-bool FManagerOBJ::SaveStaticMeshToBinary(const FWString& FilePath, const OBJ::FStaticMeshRenderData& StaticMesh)
+UMaterial* FManagerOBJ::CreateMaterial(const FObjMaterialInfo& materialInfo)
 {
+    if (materialMap[materialInfo.MaterialName] != nullptr)
+        return materialMap[materialInfo.MaterialName];
+
+    UMaterial* newMaterial = FObjectFactory::ConstructObject<UMaterial>(nullptr); // Material은 Outer가 없이 따로 관리되는 객체이므로 Outer가 없음으로 설정. 추후 Garbage Collection이 추가되면 AssetManager를 생성해서 관리.
+    newMaterial->SetMaterialInfo(materialInfo);
+    materialMap.Add(materialInfo.MaterialName, newMaterial);
+    return newMaterial;
+}
 
-    std::filesystem::path binaryFilePath(FilePath);
+UMaterial* FManagerOBJ::GetMaterial(const FString& name)
+{
+    return materialMap[name];
+}
 
-    std::filesystem::path directoryPath = binaryFilePath.parent_path();
+UStaticMesh* FManagerOBJ::CreateStaticMesh(const FString& filePath)
+{
+    OBJ::FStaticMeshRenderData* StaticMeshRenderData = FManagerOBJ::LoadObjStaticMeshAsset(filePath);
 
-    if (!directoryPath.empty())
+    if (StaticMeshRenderData == nullptr)
     {
-        std::error_code ec;
-        if (!std::filesystem::exists(directoryPath, ec))
-        {
-            if (!std::filesystem::create_directories(directoryPath, ec))
-            {
-                return false;
-            }
-        }
-        else if (ec)
-        {
-            return false;
-        }
+        BroadcastStaticMeshLoaded(filePath, nullptr);
+        return nullptr;
     }
 
-    std::ofstream File(FilePath, std::ios::binary);
-    if (!File.is_open())
+    UStaticMesh* StaticMesh = nullptr;
+    if (UStaticMesh** Found = StaticMeshMap.Find(StaticMeshRenderData->ObjectName))
     {
-        assert("CAN'T SAVE STATIC MESH BINARY FILE");
-        return false;
+        StaticMesh = *Found;
     }
+    else
+    {
+        StaticMesh = FObjectFactory::ConstructObject<UStaticMesh>(nullptr); // TODO: 추후 AssetManager를 생성해서 관리.
+        StaticMesh->SetData(StaticMeshRenderData);
 
-    // Object Name
-    Serializer::WriteFWString(File, StaticMesh.ObjectName);
-
-    // Display Name
-    Serializer::WriteFString(File, StaticMesh.DisplayName);
-
-    // Vertices
-    uint32 VertexCount = StaticMesh.Vertices.Num();
-    File.write(reinterpret_cast<const char*>(&VertexCount), sizeof(VertexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
-
-    // Indices
-    uint32 IndexCount = StaticMesh.Indices.Num();
-    File.write(reinterpret_cast<const char*>(&IndexCount), sizeof(IndexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
+        StaticMeshMap.Add(StaticMeshRenderData->ObjectName, StaticMesh); // TODO: 장기적으로 보면 파일 이름 대신 경로를 Key로 사용하는게 좋음.
+    }
 
-    // Materials
-    uint32 MaterialCount = StaticMesh.Materials.Num();
-    File.write(reinterpret_cast<const char*>(&MaterialCount), sizeof(MaterialCount));
-    for (const FObjMaterialInfo& Material : StaticMesh.Materials)
-    {
-        Serializer::WriteFString(File, Material.MaterialName);
-        File.write(reinterpret_cast<const char*>(&Material.TextureFlag), sizeof(Material.TextureFlag));
-        //File.write(reinterpret_cast<const char*>(&Material.bHasNormalMap), sizeof(Material.bHasNormalMap));
-        File.write(reinterpret_cast<const char*>(&Material.bTransparent), sizeof(Material.bTransparent));
-        File.write(reinterpret_cast<const char*>(&Material.Diffuse), sizeof(Material.Diffuse));
-        File.write(reinterpret_cast<const char*>(&Material.Specular), sizeof(Material.Specular));
-        File.write(reinterpret_cast<const char*>(&Material.Ambient), sizeof(Material.Ambient));
-        File.write(reinterpret_cast<const char*>(&Material.Emissive), sizeof(Material.Emissive));
-        File.write(reinterpret_cast<const char*>(&Material.SpecularScalar), sizeof(Material.SpecularScalar));
-        File.write(reinterpret_cast<const char*>(&Material.DensityScalar), sizeof(Material.DensityScalar));
-        File.write(reinterpret_cast<const char*>(&Material.TransparencyScalar), sizeof(Material.TransparencyScalar));
-        File.write(reinterpret_cast<const char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
-
-        Serializer::WriteFString(File, Material.DiffuseTextureName);
-        Serializer::WriteFWString(File, Material.DiffuseTexturePath);
-        Serializer::WriteFString(File, Material.AmbientTextureName);
-        Serializer::WriteFWString(File, Material.AmbientTexturePath);
-        Serializer::WriteFString(File, Material.SpecularTextureName);
-        Serializer::WriteFWString(File, Material.SpecularTexturePath);
-        Serializer::WriteFString(File, Material.BumpTextureName);
-        Serializer::WriteFWString(File, Material.BumpTexturePath);
-        Serializer::WriteFString(File, Material.AlphaTextureName);
-        Serializer::WriteFWString(File, Material.AlphaTexturePath);
-    }
-
-    // Material Subsets
-    uint32 SubsetCount = StaticMesh.MaterialSubsets.Num();
-    File.write(reinterpret_cast<const char*>(&SubsetCount), sizeof(SubsetCount));
-    for (const FMaterialSubset& Subset : StaticMesh.MaterialSubsets)
-    {
-        Serializer::WriteFString(File, Subset.MaterialName);
-        File.write(reinterpret_cast<const char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
-        File.write(reinterpret_cast<const char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
-        File.write(reinterpret_cast<const char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
-    }
-
-    // Bounding Box
-    File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMin), sizeof(FVector));
-    File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMax), sizeof(FVector));
-
-    File.close();
-    return true;
+    BroadcastStaticMeshLoaded(filePath, StaticMesh);
+    return StaticMesh;
 }
 
-bool FManagerOBJ::LoadStaticMeshFromBinary(const FWString& FilePath, OBJ::FStaticMeshRenderData& OutStaticMesh)
+UStaticMesh* FManagerOBJ::GetStaticMesh(const FWString& name)
 {
-    std::ifstream File(FilePath, std::ios::binary);
-    if (!File.is_open())
+    if (UStaticMesh** Found = StaticMeshMap.Find(name))
     {
-        assert("CAN'T OPEN STATIC MESH BINARY FILE");
-        return false;
+        return *Found;
     }
 
-    TArray<FWString> Textures;
-
-    // Object Name
-    Serializer::ReadFWString(File, OutStaticMesh.ObjectName);
-
-    //// Path Name
-    //Serializer::ReadFWString(File, OutStaticMesh.PathName);
-
-    // Display Name
-    Serializer::ReadFString(File, OutStaticMesh.DisplayName);
-
-    // Vertices
-    uint32 VertexCount = 0;
-    File.read(reinterpret_cast<char*>(&VertexCount), sizeof(VertexCount));
-    OutStaticMesh.Vertices.SetNum(VertexCount);
-    File.read(reinterpret_cast<char*>(OutStaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
-
-    // Indices
-    uint32 IndexCount = 0;
-    File.read(reinterpret_cast<char*>(&IndexCount), sizeof(IndexCount));
-    OutStaticMesh.Indices.SetNum(IndexCount);
-    File.read(reinterpret_cast<char*>(OutStaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
-
-    // Material
-    uint32 MaterialCount = 0;
-    File.read(reinterpret_cast<char*>(&MaterialCount), sizeof(MaterialCount));
-    OutStaticMesh.Materials.SetNum(MaterialCount);
-    for (FObjMaterialInfo& Material : OutStaticMesh.Materials)
+    // 시작할 때 모든 Mesh를 읽지 않으므로, 처음 찾는 Mesh는 여기서 읽습니다.
+    const FString PathFileName(name.c_str());
+    if (FailedStaticMeshPaths.Contains(PathFileName))
     {
-        Serializer::ReadFString(File, Material.MaterialName);
-        File.read(reinterpret_cast<char*>(&Material.TextureFlag), sizeof(Material.TextureFlag));
-        //File.read(reinterpret_cast<char*>(&Material.bHasTexture), sizeof(Material.bHasTexture));
-        //File.read(reinterpret_cast<char*>(&Material.bHasNormalMap), sizeof(Material.bHasNormalMap));
-        File.read(reinterpret_cast<char*>(&Material.bTransparent), sizeof(Material.bTransparent));
-        File.read(reinterpret_cast<char*>(&Material.Diffuse), sizeof(Material.Diffuse));
-        File.read(reinterpret_cast<char*>(&Material.Specular), sizeof(Material.Specular));
-        File.read(reinterpret_cast<char*>(&Material.Ambient), sizeof(Material.Ambient));
-        File.read(reinterpret_cast<char*>(&Material.Emissive), sizeof(Material.Emissive));
-        File.read(reinterpret_cast<char*>(&Material.SpecularScalar), sizeof(Material.SpecularScalar));
-        File.read(reinterpret_cast<char*>(&Material.DensityScalar), sizeof(Material.DensityScalar));
-        File.read(reinterpret_cast<char*>(&Material.TransparencyScalar), sizeof(Material.TransparencyScalar));
-        File.read(reinterpret_cast<char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
-        Serializer::ReadFString(File, Material.DiffuseTextureName);
-        Serializer::ReadFWString(File, Material.DiffuseTexturePath);
-        Serializer::ReadFString(File, Material.AmbientTextureName);
-        Serializer::ReadFWString(File, Material.AmbientTexturePath);
-        Serializer::ReadFString(File, Material.SpecularTextureName);
-        Serializer::ReadFWString(File, Material.SpecularTexturePath);
-        Serializer::ReadFString(File, Material.BumpTextureName);
-        Serializer::ReadFWString(File, Material.BumpTexturePath);
-        Serializer::ReadFString(File, Material.AlphaTextureName);
-        Serializer::ReadFWString(File, Material.AlphaTexturePath);
+        return nullptr;
+    }
+    return CreateStaticMesh(PathFileName);
+}
 
-        if (!Material.DiffuseTexturePath.empty())
-        {
-            Textures.AddUnique(Material.DiffuseTexturePath);
-        }
-        if (!Material.AmbientTexturePath.empty())
-        {
-            Textures.AddUnique(Material.AmbientTexturePath);
-        }
-        if (!Material.SpecularTexturePath.empty())
-        {
-            Textures.AddUnique(Material.SpecularTexturePath);
-        }
-        if (!Material.BumpTexturePath.empty())
-        {
-            Textures.AddUnique(Material.BumpTexturePath);
-        }
-        if (!Material.AlphaTexturePath.empty())
+void FManagerOBJ::RequestStaticMeshAsync(const FString& filePath, std::function<void(UStaticMesh*)> OnLoaded)
+{
+    if (ObjStaticMeshMap.Contains(filePath))
+    {
+        UStaticMesh* StaticMesh = CreateStaticMesh(filePath);
+        if (OnLoaded)
         {
-            Textures.AddUnique(Material.AlphaTexturePath);
+            OnLoaded(StaticMesh);
         }
+        return;
     }
 
-    // Material Subset
-    uint32 SubsetCount = 0;
-    File.read(reinterpret_cast<char*>(&SubsetCount), sizeof(SubsetCount));
-    OutStaticMesh.MaterialSubsets.SetNum(SubsetCount);
-    for (FMaterialSubset& Subset : OutStaticMesh.MaterialSubsets)
+    if (OnLoaded)
     {
-        Serializer::ReadFString(File, Subset.MaterialName);
-        File.read(reinterpret_cast<char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
-        File.read(reinterpret_cast<char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
-        File.read(reinterpret_cast<char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
+        AsyncLoadCallbacks.FindOrAdd(filePath).Add(std::move(OnLoaded));
     }
+    AsyncLoader.Request(filePath);
+}
 
-    // Bounding Box
-    File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMin), sizeof(FVector));
-    File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMax), sizeof(FVector));
-
-    File.close();
-
-    // Texture Load
-    if (Textures.Num() > 0)
+EStaticMeshLoadState FManagerOBJ::GetStaticMeshLoadState(const FString& filePath)
+{
+    if (ObjStaticMeshMap.Contains(filePath))
     {
-        for (const FWString& Texture : Textures)
-        {
-            if (FEngineLoop::ResourceManager.GetTexture(Texture) == nullptr)
-            {
-                FEngineLoop::ResourceManager.LoadTextureFromFile(FEngineLoop::GraphicDevice.Device, nullptr, Texture.c_str());
-            }
-        }
+        return EStaticMeshLoadState::Loaded;
     }
-
-    return true;
+    if (AsyncLoader.IsPending(filePath))
+    {
+        return EStaticMeshLoadState::Loading;
+    }
+    if (FailedStaticMeshPaths.Contains(filePath))
+    {
+        return EStaticMeshLoadState::Failed;
+    }
+    return EStaticMeshLoadState::NotLoaded;
 }
 
-UMaterial* FManagerOBJ::CreateMaterial(const FObjMaterialInfo& materialInfo)
+void FManagerOBJ::ProcessAsyncLoads()
 {
-    if (materialMap[materialInfo.MaterialName] != nullptr)
-        return materialMap[materialInfo.MaterialName];
+    TArray<FAsyncStaticMeshLoader::FResult> Results;
+    AsyncLoader.PopCompleted(Results);
 
-    UMaterial* newMaterial = FObjectFactory::ConstructObject<UMaterial>(nullptr); // Material은 Outer가 없이 따로 관리되는 객체이므로 Outer가 없음으로 설정. 추후 Garbage Collection이 추가되면 AssetManager를 생성해서 관리.
-    newMaterial->SetMaterialInfo(materialInfo);
-    materialMap.Add(materialInfo.MaterialName, newMaterial);
-    return newMaterial;
-}
+    for (const FAsyncStaticMeshLoader::FResult& Result : Results)
+    {
+        if (Result.RenderData == nullptr)
+        {
+            FailedStaticMeshPaths.Add(Result.PathFileName);
+            BroadcastStaticMeshLoaded(Result.PathFileName, nullptr);
+            continue;
+        }
 
-UMaterial* FManagerOBJ::GetMaterial(const FString& name)
-{
-    return materialMap[name];
+        FailedStaticMeshPaths.Remove(Result.PathFileName);
+        LoadMaterialTextures(*Result.RenderData);
+        ObjStaticMeshMap.Add(Result.PathFileName, Result.RenderData);
+
+        // Render Data는 이미 Cache에 있으므로 UStaticMesh와 Buffer만 만들고, 기다리던 곳에 알립니다.
+        CreateStaticMesh(Result.PathFileName);
+    }
 }
 
-UStaticMesh* FManagerOBJ::CreateStaticMesh(const FString& filePath)
+void FManagerOBJ::BroadcastStaticMeshLoaded(const FString& filePath, UStaticMesh* StaticMesh)
 {
-    OBJ::FStaticMeshRenderData* StaticMeshRenderData = FManagerOBJ::LoadObjStaticMeshAsset(filePath);
-
-    if (StaticMeshRenderData == nullptr) return nullptr;
-
-    UStaticMesh* StaticMesh = GetStaticMesh(StaticMeshRenderData->ObjectName);
-    if (StaticMesh != nullptr)
+    TArray<std::function<void(UStaticMesh*)>>* Callbacks = AsyncLoadCallbacks.Find(filePath);
+    if (Callbacks == nullptr)
     {
-        return StaticMesh;
+        return;
     }
 
-    StaticMesh = FObjectFactory::ConstructObject<UStaticMesh>(nullptr); // TODO: 추후 AssetManager를 생성해서 관리.
-    StaticMesh->SetData(StaticMeshRenderData);
-
-    StaticMeshMap.Add(StaticMeshRenderData->ObjectName, StaticMesh); // TODO: 장기적으로 보면 파일 이름 대신 경로를 Key로 사용하는게 좋음.
-    return StaticMesh;
-}
+    // Callback 안에서 다시 요청할 수 있으므로 Map에서 떼어낸 뒤 호출합니다.
+    TArray<std::function<void(UStaticMesh*)>> PendingCallbacks = std::move(*Callbacks);
+    AsyncLoadCallbacks.Remove(filePath);
 
-UStaticMesh* FManagerOBJ::GetStaticMesh(const FWString& name)
-{
-    return StaticMeshMap[name];
+    for (const std::function<void(UStaticMesh*)>& Callback : PendingCallbacks)
+    {
+        Callback(StaticMesh);
+    }
 }
 
 FString FManagerOBJ::ScanObjForMtllib(const FWString& absoluteObjPathW)
 {
-    std::ifstream objFile(absoluteObjPathW);
-    if (!objFile)
+    TArray<char> Buffer;
+    if (!ReadFileToBuffer(absoluteObjPathW, Buffer))
     {
         return "";
     }
 
-    std::string line;
-    std::string mtllibFilename;
-    while (std::getline(objFile, line))
+    FObjLineCursor Cursor(Buffer.GetData(), Buffer.GetData() + Buffer.Num());
+    for (; Cursor.NextLine(); Cursor.FinishLine())
     {
-        if (line.empty() || line[0] == '#')
+        if (Cursor.Current == Cursor.LineEnd || *Cursor.Current == '#')
             continue;
 
-        std::istringstream lineStream(line);
-        std::string token;
-        lineStream >> token;
-
-        if (token == "mtllib")
+        if (Cursor.ReadToken() == "mtllib")
         {
-            if (lineStream >> mtllibFilename)
-            {
-                break;
-            }
-            else
+            const std::string_view mtllibFilename = Cursor.ReadToken();
+            if (!mtllibFilename.empty())
             {
-                mtllibFilename = "";
+                return FString(std::string(mtllibFilename));
             }
         }
     }
-    objFile.close();
-    return mtllibFilename; // Return std::string
+    return "";
 }
 
 
@@ -1,20 +1,32 @@
 #pragma once
+#include <functional>
 
 #include "Define.h"
 #include "EngineLoop.h"
 #include "Container/Map.h"
+#include "Container/Set.h"
+#include "Engine/AsyncStaticMeshLoader.h"
 #include "HAL/PlatformType.h"
 #include "Serialization/Serializer.h"
 
 class UStaticMesh;
 struct FManagerOBJ;
 
+enum class EStaticMeshLoadState : uint8
+{
+    NotLoaded,
+    /** Background에서 읽는 중이거나, Game Thread에서 마무리되기를 기다리는 중 */
+    Loading,
+    Loaded,
+    Failed,
+};
+
 struct FLoaderOBJ
 {
     // Obj Parsing (*.obj to FObjInfo)
     static bool ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo);
 
-    // Material Parsing (*.obj to MaterialInfo)
+    // Material Parsing (*.obj to MaterialInfo), Texture는 경로만 채우고 FManagerOBJ::LoadMaterialTextures에서 읽습니다.
     static bool ParseMaterial(FObjInfo& OutObjInfo, OBJ::FStaticMeshRenderData& OutFStaticMesh);
 
     // Convert the Raw data to Cooked data (FStaticMeshRenderData)
@@ -33,10 +45,21 @@ struct FManagerOBJ
 public:
     static OBJ::FStaticMeshRenderData* LoadObjStaticMeshAsset(const FString& PathFileName);
 
+    /**
+     * Binary Cache가 최신이면 읽고, 아니면 OBJ를 Parsing해서 Binary Cache를 새로 씁니다.
+     * Cache Map, UObject, D3D Device를 건드리지 않으므로 Worker 스레드에서 호출할 수 있습니다.
+     */
+    static OBJ::FStaticMeshRenderData* BuildStaticMeshRenderData(const FString& PathFileName);
+
+    /** Material이 참조하는 Texture를 읽습니다. D3D Device를 사용하므로 Game Thread에서 호출합니다. */
+    static void LoadMaterialTextures(const OBJ::FStaticMeshRenderData& StaticMesh);
+
     static void CombineMaterialIndex(OBJ::FStaticMeshRenderData& OutFStaticMesh);
 
+    /** Cooked Mesh 형식으로 저장합니다. 형식은 StaticMeshBinary.cpp에 정리되어 있습니다. */
     static bool SaveStaticMeshToBinary(const FWString& FilePath, const OBJ::FStaticMeshRenderData& StaticMesh);
 
+    /** 파일을 Mapping해서 읽습니다. 버전이나 Vertex 배치가 다르거나 Hash가 맞지 않는 Cache라면 false */
     static bool LoadStaticMeshFromBinary(const FWString& FilePath, OBJ::FStaticMeshRenderData& OutStaticMesh);
 
     static UMaterial* CreateMaterial(const FObjMaterialInfo& materialInfo);
@@ -51,15 +74,40 @@ public:
 
     static const TMap<FWString, UStaticMesh*>& GetStaticMeshes() { return StaticMeshMap; }
 
+    /** 아직 읽지 않은 Mesh라면 그 자리에서 읽습니다. 읽기에 실패한 경로는 다시 시도하지 않고 nullptr를 반환합니다. */
     static UStaticMesh* GetStaticMesh(const FWString& name);
 
+    /**
+     * Mesh를 Background 스레드에서 읽도록 요청합니다. 이미 읽은 Mesh라면 OnLoaded를 바로 호출합니다.
+     * OnLoaded는 ProcessAsyncLoads에서 UStaticMesh가 만들어진 뒤 Game Thread에서 호출되고, 실패했다면 nullptr를 받습니다.
+     * 끝나기 전에 CreateStaticMesh로 같은 경로를 요청하면 Background 결과를 기다려서 사용합니다.
+     */
+    static void RequestStaticMeshAsync(const FString& filePath, std::function<void(UStaticMesh*)> OnLoaded = nullptr);
+
+    static EStaticMeshLoadState GetStaticMeshLoadState(const FString& filePath);
+
+    /** Background에서 끝난 Mesh의 Texture, Buffer, UStaticMesh를 만듭니다. 매 프레임 Game Thread에서 호출합니다. */
+    static void ProcessAsyncLoads();
+
+    /** Background Loader 스레드를 종료합니다. Engine이 해제될 때 호출합니다. */
+    static void ShutdownAsyncLoading() { AsyncLoader.Shutdown(); }
+
     static int GetStaticMeshNum() { return StaticMeshMap.Num(); }
 private:
     static FString ScanObjForMtllib(const FWString& absoluteObjPathW);
 
     static FWString GetBinaryPath(const FWString& ObjFilePathW);
+
+    /** filePath로 RequestStaticMeshAsync를 호출한 곳에 결과를 알립니다. */
+    static void BroadcastStaticMeshLoaded(const FString& filePath, UStaticMesh* StaticMesh);
 private:
     inline static TMap<FString, OBJ::FStaticMeshRenderData*> ObjStaticMeshMap;
     inline static TMap<FWString, UStaticMesh*> StaticMeshMap;
     inline static TMap<FString, UMaterial*> materialMap;
+
+    /** 읽기에 실패한 경로, GetStaticMesh가 매번 파일을 다시 열지 않도록 기억합니다. */
+    inline static TSet<FString> FailedStaticMeshPaths;
+
+    inline static FAsyncStaticMeshLoader AsyncLoader;
+    inline static TMap<FString, TArray<std::function<void(UStaticMesh*)>>> AsyncLoadCallbacks;
 };
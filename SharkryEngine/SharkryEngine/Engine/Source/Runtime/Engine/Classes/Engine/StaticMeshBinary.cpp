@@ -0,0 +1,651 @@
+#include "FLoaderOBJ.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "HAL/MappedFile.h"
+#include "Misc/XxHash.h"
+
+/*
+ * Cooked Static Mesh 형식
+ *
+ * [FCookedMeshHeader]
+ * [FCookedMeshSection Sections[NumSections]]
+ * [Section] [16 Byte 정렬 Padding] [Section] ...
+ *
+ * Strings   : [uint32 Offsets[NumElements + 1]] [Bytes], FString과 FWString의 문자를 Byte 그대로 저장합니다.
+ * Vertices  : [FStaticMeshVertex[NumElements]]
+ * Indices   : [UINT[NumElements]]
+ * Materials : [FMaterialRecord[NumElements]]
+ * Subsets   : [FSubsetRecord[NumElements]]
+ * LODs       : [FLODRecord[NumElements]], LOD 1부터
+ * LODIndices : [UINT[NumElements]], 모든 LOD의 Index를 이어 붙입니다.
+ * LODSubsets : [FLODSubsetRecord[NumElements]], LOD마다 LOD 0의 Subset 수만큼, Material은 LOD 0의 Subset을 따릅니다.
+ *
+ * Vertex와 Index는 메모리 배치 그대로 저장하므로, Mapping한 파일에서 Section마다 한 번씩 복사하면 읽기가 끝납니다.
+ * 문자열은 Strings Section에 한 번씩 저장하고 Header와 Record는 Index로 참조합니다.
+ *
+ * Section마다 Hash를 Section Table에 저장하고, Header의 ContentHash는 Header와 Section Table을 덮습니다.
+ * Header의 Version, VertexStride, 문자 크기가 현재 Build와 다르거나 Hash가 하나라도 맞지 않으면 읽지 않으므로,
+ * FStaticMeshVertex가 바뀌었거나 쓰다가 끊긴 Cache는 BuildStaticMeshRenderData가 OBJ에서 다시 만듭니다.
+ */
+namespace
+{
+    /** 'SKMS' */
+    constexpr uint32 CookedMeshMagic = 0x534D4B53;
+
+    /** 형식이 바뀌면 올립니다. */
+    constexpr uint32 CookedMeshVersion = 2;
+
+    /** Section 시작 위치의 정렬, Mapping한 주소에서 SIMD로 읽어도 되도록 16 Byte로 맞춥니다. */
+    constexpr uint64 CookedMeshSectionAlignment = 16;
+
+    /** Section Hash를 이어서 계산하는 단위, 복사한 Block이 Cache에 남아있는 동안 Hash하도록 L2보다 작게 잡습니다. */
+    constexpr uint64 CookedMeshHashBlockSize = 64 * 1024;
+
+    enum class ECookedMeshSection : uint32
+    {
+        Strings,
+        Vertices,
+        Indices,
+        Materials,
+        Subsets,
+        LODs,
+        LODIndices,
+        LODSubsets,
+        Count,
+    };
+
+    constexpr uint32 NumCookedMeshSections = static_cast<uint32>(ECookedMeshSection::Count);
+
+    struct FCookedMeshHeader
+    {
+        uint32 Magic;
+        uint32 Version;
+        uint32 VertexStride;
+        uint32 CharSize;
+        uint32 WideCharSize;
+        uint32 NumSections;
+        uint32 ObjectName;
+        uint32 DisplayName;
+        uint64 FileSize;
+        float BoundingBoxMin[3];
+        float BoundingBoxMax[3];
+
+        /** Header에서 이 값 앞까지와 Section Table의 Hash, Section Table에 Section마다 Hash가 있으므로 파일 전체를 덮습니다. */
+        uint64 ContentHash;
+    };
+    static_assert(offsetof(FCookedMeshHeader, ContentHash) + sizeof(uint64) == sizeof(FCookedMeshHeader));
+
+    struct FCookedMeshSection
+    {
+        ECookedMeshSection Type;
+        uint32 NumElements;
+        uint64 Offset;
+        uint64 Size;
+        uint64 Hash;
+    };
+
+    constexpr uint32 NumMaterialTextures = 5;
+
+    struct FMaterialRecord
+    {
+        uint32 MaterialName;
+        uint32 TextureFlag;
+        uint32 bTransparent;
+        float Diffuse[3];
+        float Specular[3];
+        float Ambient[3];
+        float Emissive[3];
+        float SpecularScalar;
+        float DensityScalar;
+        float TransparencyScalar;
+        float BumpMultiplier;
+        uint32 IlluminanceModel;
+
+        /** Diffuse, Ambient, Specular, Bump, Alpha 순서 */
+        uint32 TextureNames[NumMaterialTextures];
+        uint32 TexturePaths[NumMaterialTextures];
+    };
+
+    struct FSubsetRecord
+    {
+        uint32 MaterialName;
+        uint32 IndexStart;
+        uint32 IndexCount;
+        uint32 MaterialIndex;
+    };
+
+    struct FLODRecord
+    {
+        /** LODIndices Section 안의 위치 */
+        uint32 IndexStart;
+        uint32 IndexCount;
+        float Error;
+        float ScreenSize;
+    };
+
+    /** IndexStart는 LOD의 Index 안의 위치 */
+    struct FLODSubsetRecord
+    {
+        uint32 IndexStart;
+        uint32 IndexCount;
+    };
+
+    uint64 AlignUp(uint64 Value, uint64 Alignment)
+    {
+        return (Value + Alignment - 1) & ~(Alignment - 1);
+    }
+
+    /** Header와 Section Table의 Hash, 둘은 파일에서 이어져 있어야 합니다. */
+    uint64 ComputeContentHash(const uint8* FileData, uint32 NumSections)
+    {
+        const uint64 HeaderHash = FXxHash64::HashBuffer(FileData, offsetof(FCookedMeshHeader, ContentHash), 0);
+        return FXxHash64::HashBuffer(FileData + sizeof(FCookedMeshHeader), static_cast<uint64>(NumSections) * sizeof(FCookedMeshSection), HeaderHash);
+    }
+
+    /** Block마다 앞 Block의 Hash를 Seed로 이어서 계산합니다. */
+    uint64 ComputeSectionHash(const uint8* Data, uint64 Size)
+    {
+        uint64 Hash = 0;
+        for (uint64 Offset = 0; Offset < Size; Offset += CookedMeshHashBlockSize)
+        {
+            Hash = FXxHash64::HashBuffer(Data + Offset, std::min(CookedMeshHashBlockSize, Size - Offset), Hash);
+        }
+        return Hash;
+    }
+
+    /**
+     * Mapping한 Section을 Block 단위로 복사하면서 ComputeSectionHash와 같은 Hash를 계산합니다.
+     * 복사한 Block을 바로 Hash하므로 파일을 한 번만 훑습니다.
+     */
+    bool CopySection(void* Dest, const uint8* Source, const FCookedMeshSection& Section)
+    {
+        uint8* DestBytes = static_cast<uint8*>(Dest);
+        uint64 Hash = 0;
+        for (uint64 Offset = 0; Offset < Section.Size; Offset += CookedMeshHashBlockSize)
+        {
+            const uint64 BlockSize = std::min(CookedMeshHashBlockSize, Section.Size - Offset);
+            std::memcpy(DestBytes + Offset, Source + Offset, BlockSize);
+            Hash = FXxHash64::HashBuffer(DestBytes + Offset, BlockSize, Hash);
+        }
+        return Hash == Section.Hash;
+    }
+
+    class FCookedStringTable
+    {
+    public:
+        FCookedStringTable()
+        {
+            Offsets.Add(0);
+        }
+
+        uint32 Add(const FString& String)
+        {
+            return AddBytes(GetData(String), static_cast<uint64>(String.Len()) * sizeof(FString::ElementType));
+        }
+
+        uint32 Add(const FWString& String)
+        {
+            return AddBytes(String.data(), static_cast<uint64>(String.size()) * sizeof(wchar_t));
+        }
+
+        uint64 GetSectionSize() const
+        {
+            return static_cast<uint64>(Offsets.Num()) * sizeof(uint32) + Bytes.Num();
+        }
+
+        TArray<uint32> Offsets;
+        TArray<uint8> Bytes;
+
+    private:
+        uint32 AddBytes(const void* Data, uint64 Size)
+        {
+            const uint32 Index = static_cast<uint32>(Offsets.Num() - 1);
+            const int32 Start = Bytes.Num();
+            Bytes.SetNum(Start + static_cast<int32>(Size));
+            if (Size > 0)
+            {
+                std::memcpy(Bytes.GetData() + Start, Data, Size);
+            }
+            Offsets.Add(static_cast<uint32>(Bytes.Num()));
+            return Index;
+        }
+    };
+
+    /** Mapping한 Strings Section에서 문자열을 꺼냅니다. Index나 Offset이 잘못되었다면 예외를 던집니다. */
+    class FCookedStringView
+    {
+    public:
+        FCookedStringView(const uint8* SectionData, const FCookedMeshSection& Section)
+            : Offsets(SectionData)
+            , NumStrings(Section.NumElements)
+        {
+            const uint64 OffsetsSize = (static_cast<uint64>(NumStrings) + 1) * sizeof(uint32);
+            if (OffsetsSize > Section.Size)
+            {
+                throw std::runtime_error("String table is out of bounds.");
+            }
+            Bytes = SectionData + OffsetsSize;
+            NumBytes = Section.Size - OffsetsSize;
+        }
+
+        void Get(uint32 Index, FString& OutString) const
+        {
+            uint64 Size;
+            const uint8* Data = Find(Index, sizeof(FString::ElementType), Size);
+            auto& Container = OutString.GetContainerPrivate();
+            Container.resize(Size / sizeof(FString::ElementType));
+            if (Size > 0)
+            {
+                std::memcpy(Container.data(), Data, Size);
+            }
+        }
+
+        void Get(uint32 Index, FWString& OutString) const
+        {
+            uint64 Size;
+            const uint8* Data = Find(Index, sizeof(wchar_t), Size);
+            OutString.resize(Size / sizeof(wchar_t));
+            if (Size > 0)
+            {
+                std::memcpy(OutString.data(), Data, Size);
+            }
+        }
+
+    private:
+        const uint8* Find(uint32 Index, uint64 CharSize, uint64& OutSize) const
+        {
+            if (Index >= NumStrings)
+            {
+                throw std::runtime_error("String index is out of bounds.");
+            }
+
+            uint32 Range[2];
+            std::memcpy(Range, Offsets + static_cast<uint64>(Index) * sizeof(uint32), sizeof(Range));
+            if (Range[0] > Range[1] || Range[1] > NumBytes || (Range[1] - Range[0]) % CharSize != 0)
+            {
+                throw std::runtime_error("String range is out of bounds.");
+            }
+
+            OutSize = Range[1] - Range[0];
+            return Bytes + Range[0];
+        }
+
+    private:
+        const uint8* Offsets;
+        uint32 NumStrings;
+        const uint8* Bytes = nullptr;
+        uint64 NumBytes = 0;
+    };
+
+    void CopyVector(float (&Out)[3], const FVector& Vector)
+    {
+        Out[0] = Vector.X;
+        Out[1] = Vector.Y;
+        Out[2] = Vector.Z;
+    }
+
+    FVector ToVector(const float (&Values)[3])
+    {
+        return FVector(Values[0], Values[1], Values[2]);
+    }
+
+    /** FMaterialRecord::TextureNames, TexturePaths와 같은 순서 */
+    template <typename MaterialType>
+    auto GetTextureNames(MaterialType& Material)
+    {
+        return std::array{ &Material.DiffuseTextureName, &Material.AmbientTextureName, &Material.SpecularTextureName,
+                           &Material.BumpTextureName, &Material.AlphaTextureName };
+    }
+
+    template <typename MaterialType>
+    auto GetTexturePaths(MaterialType& Material)
+    {
+        return std::array{ &Material.DiffuseTexturePath, &Material.AmbientTexturePath, &Material.SpecularTexturePath,
+                           &Material.BumpTexturePath, &Material.AlphaTexturePath };
+    }
+}
+
+bool FManagerOBJ::SaveStaticMeshToBinary(const FWString& FilePath, const OBJ::FStaticMeshRenderData& StaticMesh)
+{
+    std::filesystem::path binaryFilePath(FilePath);
+
+    std::filesystem::path directoryPath = binaryFilePath.parent_path();
+
+    if (!directoryPath.empty())
+    {
+        // 여러 Worker가 같은 폴더를 동시에 만들 수 있으므로, 이미 있어서 만들지 않은 경우는 실패로 보지 않습니다.
+        std::error_code ec;
+        std::filesystem::create_directories(directoryPath, ec);
+        if (ec)
+        {
+            return false;
+        }
+    }
+
+    FCookedStringTable StringTable;
+
+    FCookedMeshHeader Header = {};
+    Header.Magic = CookedMeshMagic;
+    Header.Version = CookedMeshVersion;
+    Header.VertexStride = sizeof(FStaticMeshVertex);
+    Header.CharSize = sizeof(FString::ElementType);
+    Header.WideCharSize = sizeof(wchar_t);
+    Header.NumSections = NumCookedMeshSections;
+    Header.ObjectName = StringTable.Add(StaticMesh.ObjectName);
+    Header.DisplayName = StringTable.Add(StaticMesh.DisplayName);
+    CopyVector(Header.BoundingBoxMin, StaticMesh.BoundingBoxMin);
+    CopyVector(Header.BoundingBoxMax, StaticMesh.BoundingBoxMax);
+
+    TArray<FMaterialRecord> MaterialRecords;
+    MaterialRecords.Reserve(StaticMesh.Materials.Num());
+    for (const FObjMaterialInfo& Material : StaticMesh.Materials)
+    {
+        FMaterialRecord Record = {};
+        Record.MaterialName = StringTable.Add(Material.MaterialName);
+        Record.TextureFlag = Material.TextureFlag;
+        Record.bTransparent = Material.bTransparent ? 1 : 0;
+        CopyVector(Record.Diffuse, Material.Diffuse);
+        CopyVector(Record.Specular, Material.Specular);
+        CopyVector(Record.Ambient, Material.Ambient);
+        CopyVector(Record.Emissive, Material.Emissive);
+        Record.SpecularScalar = Material.SpecularScalar;
+        Record.DensityScalar = Material.DensityScalar;
+        Record.TransparencyScalar = Material.TransparencyScalar;
+        Record.BumpMultiplier = Material.BumpMultiplier;
+        Record.IlluminanceModel = Material.IlluminanceModel;
+
+        const auto TextureNames = GetTextureNames(Material);
+        const auto TexturePaths = GetTexturePaths(Material);
+        for (uint32 Index = 0; Index < NumMaterialTextures; ++Index)
+        {
+            Record.TextureNames[Index] = StringTable.Add(*TextureNames[Index]);
+            Record.TexturePaths[Index] = StringTable.Add(*TexturePaths[Index]);
+        }
+        MaterialRecords.Add(Record);
+    }
+
+    TArray<FSubsetRecord> SubsetRecords;
+    SubsetRecords.Reserve(StaticMesh.MaterialSubsets.Num());
+    for (const FMaterialSubset& Subset : StaticMesh.MaterialSubsets)
+    {
+        SubsetRecords.Add({ StringTable.Add(Subset.MaterialName), Subset.IndexStart, Subset.IndexCount, Subset.MaterialIndex });
+    }
+
+    TArray<FLODRecord> LODRecords;
+    TArray<UINT> LODIndices;
+    TArray<FLODSubsetRecord> LODSubsetRecords;
+    LODRecords.Reserve(StaticMesh.LODs.Num());
+    LODSubsetRecords.Reserve(StaticMesh.LODs.Num() * StaticMesh.MaterialSubsets.Num());
+    for (const OBJ::FStaticMeshLODData& LOD : StaticMesh.LODs)
+    {
+        // Subset은 LOD 0과 수와 순서가 같아야 Material을 LOD 0에서 가져올 수 있습니다.
+        if (LOD.MaterialSubsets.Num() != StaticMesh.MaterialSubsets.Num())
+        {
+            return false;
+        }
+
+        LODRecords.Add({ static_cast<uint32>(LODIndices.Num()), static_cast<uint32>(LOD.Indices.Num()), LOD.Error, LOD.ScreenSize });
+        const int32 IndexStart = LODIndices.Num();
+        LODIndices.SetNum(IndexStart + LOD.Indices.Num());
+        if (LOD.Indices.Num() > 0)
+        {
+            std::memcpy(LODIndices.GetData() + IndexStart, LOD.Indices.GetData(), static_cast<uint64>(LOD.Indices.Num()) * sizeof(UINT));
+        }
+        for (const FMaterialSubset& Subset : LOD.MaterialSubsets)
+        {
+            LODSubsetRecords.Add({ Subset.IndexStart, Subset.IndexCount });
+        }
+    }
+
+    // Section 위치를 먼저 정하고, 파일 전체를 한 Buffer에 채워서 한 번에 씁니다.
+    FCookedMeshSection Sections[NumCookedMeshSections];
+    uint64 Offset = AlignUp(sizeof(FCookedMeshHeader) + sizeof(Sections), CookedMeshSectionAlignment);
+    const auto PlaceSection = [&Sections, &Offset](ECookedMeshSection Type, int32 NumElements, uint64 Size)
+    {
+        Sections[static_cast<uint32>(Type)] = { Type, static_cast<uint32>(NumElements), Offset, Size, 0 };
+        Offset = AlignUp(Offset + Size, CookedMeshSectionAlignment);
+    };
+    PlaceSection(ECookedMeshSection::Strings, StringTable.Offsets.Num() - 1, StringTable.GetSectionSize());
+    PlaceSection(ECookedMeshSection::Vertices, StaticMesh.Vertices.Num(), static_cast<uint64>(StaticMesh.Vertices.Num()) * sizeof(FStaticMeshVertex));
+    PlaceSection(ECookedMeshSection::Indices, StaticMesh.Indices.Num(), static_cast<uint64>(StaticMesh.Indices.Num()) * sizeof(UINT));
+    PlaceSection(ECookedMeshSection::Materials, MaterialRecords.Num(), static_cast<uint64>(MaterialRecords.Num()) * sizeof(FMaterialRecord));
+    PlaceSection(ECookedMeshSection::Subsets, SubsetRecords.Num(), static_cast<uint64>(SubsetRecords.Num()) * sizeof(FSubsetRecord));
+    PlaceSection(ECookedMeshSection::LODs, LODRecords.Num(), static_cast<uint64>(LODRecords.Num()) * sizeof(FLODRecord));
+    PlaceSection(ECookedMeshSection::LODIndices, LODIndices.Num(), static_cast<uint64>(LODIndices.Num()) * sizeof(UINT));
+    PlaceSection(ECookedMeshSection::LODSubsets, LODSubsetRecords.Num(), static_cast<uint64>(LODSubsetRecords.Num()) * sizeof(FLODSubsetRecord));
+    Header.FileSize = Offset;
+
+    TArray<uint8> FileData;
+    FileData.SetNum(static_cast<int32>(Header.FileSize));
+    uint8* Data = FileData.GetData();
+
+    const auto WriteSection = [Data, &Sections](ECookedMeshSection Type, const void* Source, uint64 Size, uint64 SectionOffset = 0)
+    {
+        if (Size > 0)
+        {
+            std::memcpy(Data + Sections[static_cast<uint32>(Type)].Offset + SectionOffset, Source, Size);
+        }
+    };
+    const uint64 StringOffsetsSize = static_cast<uint64>(StringTable.Offsets.Num()) * sizeof(uint32);
+    WriteSection(ECookedMeshSection::Strings, StringTable.Offsets.GetData(), StringOffsetsSize);
+    WriteSection(ECookedMeshSection::Strings, StringTable.Bytes.GetData(), StringTable.Bytes.Num(), StringOffsetsSize);
+    WriteSection(ECookedMeshSection::Vertices, StaticMesh.Vertices.GetData(), Sections[static_cast<uint32>(ECookedMeshSection::Vertices)].Size);
+    WriteSection(ECookedMeshSection::Indices, StaticMesh.Indices.GetData(), Sections[static_cast<uint32>(ECookedMeshSection::Indices)].Size);
+    WriteSection(ECookedMeshSection::Materials, MaterialRecords.GetData(), Sections[static_cast<uint32>(ECookedMeshSection::Materials)].Size);
+    WriteSection(ECookedMeshSection::Subsets, SubsetRecords.GetData(), Sections[static_cast<uint32>(ECookedMeshSection::Subsets)].Size);
+    WriteSection(ECookedMeshSection::LODs, LODRecords.GetData(), Sections[static_cast<uint32>(ECookedMeshSection::LODs)].Size);
+    WriteSection(ECookedMeshSection::LODIndices, LODIndices.GetData(), Sections[static_cast<uint32>(ECookedMeshSection::LODIndices)].Size);
+    WriteSection(ECookedMeshSection::LODSubsets, LODSubsetRecords.GetData(), Sections[static_cast<uint32>(ECookedMeshSection::LODSubsets)].Size);
+
+    for (FCookedMeshSection& Section : Sections)
+    {
+        Section.Hash = ComputeSectionHash(Data + Section.Offset, Section.Size);
+    }
+
+    std::memcpy(Data, &Header, sizeof(Header));
+    std::memcpy(Data + sizeof(Header), Sections, sizeof(Sections));
+    Header.ContentHash = ComputeContentHash(Data, Header.NumSections);
+    std::memcpy(Data + offsetof(FCookedMeshHeader, ContentHash), &Header.ContentHash, sizeof(Header.ContentHash));
+
+    std::ofstream File(binaryFilePath, std::ios::binary | std::ios::trunc);
+    if (!File.is_open())
+    {
+        return false;
+    }
+    File.write(reinterpret_cast<const char*>(Data), static_cast<std::streamsize>(Header.FileSize));
+    return File.good();
+}
+
+bool FManagerOBJ::LoadStaticMeshFromBinary(const FWString& FilePath, OBJ::FStaticMeshRenderData& OutStaticMesh)
+{
+    FMappedFile File;
+    if (!File.Open(FilePath) || File.GetSize() < sizeof(FCookedMeshHeader))
+    {
+        return false;
+    }
+    const uint8* Data = File.GetData();
+    const uint64 FileSize = File.GetSize();
+
+    // 이전 형식의 Cache나 다른 Vertex 배치로 만든 Cache는 여기서 걸러집니다.
+    FCookedMeshHeader Header;
+    std::memcpy(&Header, Data, sizeof(Header));
+    if (Header.Magic != CookedMeshMagic || Header.Version != CookedMeshVersion
+        || Header.VertexStride != sizeof(FStaticMeshVertex)
+        || Header.CharSize != sizeof(FString::ElementType) || Header.WideCharSize != sizeof(wchar_t)
+        || Header.FileSize != FileSize
+        || Header.NumSections > (FileSize - sizeof(FCookedMeshHeader)) / sizeof(FCookedMeshSection))
+    {
+        return false;
+    }
+
+    if (Header.ContentHash != ComputeContentHash(Data, Header.NumSections))
+    {
+        return false;
+    }
+
+    const FCookedMeshSection* Sections[NumCookedMeshSections] = {};
+    for (uint32 Index = 0; Index < Header.NumSections; ++Index)
+    {
+        const FCookedMeshSection* Section = reinterpret_cast<const FCookedMeshSection*>(Data + sizeof(FCookedMeshHeader)) + Index;
+        if (Section->Offset % CookedMeshSectionAlignment != 0 || Section->Offset > FileSize || Section->Size > FileSize - Section->Offset)
+        {
+            return false;
+        }
+
+        // 모르는 Section은 건너뜁니다.
+        if (static_cast<uint32>(Section->Type) < NumCookedMeshSections)
+        {
+            Sections[static_cast<uint32>(Section->Type)] = Section;
+        }
+    }
+
+    const auto GetSection = [&Sections](ECookedMeshSection Type, uint64 ElementSize) -> const FCookedMeshSection*
+    {
+        const FCookedMeshSection* Section = Sections[static_cast<uint32>(Type)];
+        if (Section && ElementSize > 0 && Section->Size != static_cast<uint64>(Section->NumElements) * ElementSize)
+        {
+            return nullptr;
+        }
+        return Section;
+    };
+
+    const FCookedMeshSection* StringSection = GetSection(ECookedMeshSection::Strings, 0);
+    const FCookedMeshSection* VertexSection = GetSection(ECookedMeshSection::Vertices, sizeof(FStaticMeshVertex));
+    const FCookedMeshSection* IndexSection = GetSection(ECookedMeshSection::Indices, sizeof(UINT));
+    const FCookedMeshSection* MaterialSection = GetSection(ECookedMeshSection::Materials, sizeof(FMaterialRecord));
+    const FCookedMeshSection* SubsetSection = GetSection(ECookedMeshSection::Subsets, sizeof(FSubsetRecord));
+    const FCookedMeshSection* LODSection = GetSection(ECookedMeshSection::LODs, sizeof(FLODRecord));
+    const FCookedMeshSection* LODIndexSection = GetSection(ECookedMeshSection::LODIndices, sizeof(UINT));
+    const FCookedMeshSection* LODSubsetSection = GetSection(ECookedMeshSection::LODSubsets, sizeof(FLODSubsetRecord));
+    if (!StringSection || !VertexSection || !IndexSection || !MaterialSection || !SubsetSection
+        || !LODSection || !LODIndexSection || !LODSubsetSection
+        || static_cast<uint64>(LODSubsetSection->NumElements) != static_cast<uint64>(LODSection->NumElements) * SubsetSection->NumElements)
+    {
+        return false;
+    }
+
+    // 작은 Section은 먼저 확인하고, Vertex와 Index는 복사하면서 확인합니다.
+    for (const FCookedMeshSection* Section : { StringSection, MaterialSection, SubsetSection, LODSection, LODSubsetSection })
+    {
+        if (ComputeSectionHash(Data + Section->Offset, Section->Size) != Section->Hash)
+        {
+            return false;
+        }
+    }
+
+    try
+    {
+        const FCookedStringView Strings(Data + StringSection->Offset, *StringSection);
+        Strings.Get(Header.ObjectName, OutStaticMesh.ObjectName);
+        Strings.Get(Header.DisplayName, OutStaticMesh.DisplayName);
+
+        // Vertex와 Index는 원소마다 읽지 않고 Mapping한 파일에서 그대로 복사합니다.
+        OutStaticMesh.Vertices.SetNum(static_cast<int32>(VertexSection->NumElements));
+        OutStaticMesh.Indices.SetNum(static_cast<int32>(IndexSection->NumElements));
+        if (!CopySection(OutStaticMesh.Vertices.GetData(), Data + VertexSection->Offset, *VertexSection)
+            || !CopySection(OutStaticMesh.Indices.GetData(), Data + IndexSection->Offset, *IndexSection))
+        {
+            return false;
+        }
+
+        const FMaterialRecord* MaterialRecords = reinterpret_cast<const FMaterialRecord*>(Data + MaterialSection->Offset);
+        OutStaticMesh.Materials.SetNum(static_cast<int32>(MaterialSection->NumElements));
+        for (uint32 Index = 0; Index < MaterialSection->NumElements; ++Index)
+        {
+            const FMaterialRecord& Record = MaterialRecords[Index];
+            FObjMaterialInfo& Material = OutStaticMesh.Materials[static_cast<int32>(Index)];
+            Strings.Get(Record.MaterialName, Material.MaterialName);
+            Material.TextureFlag = Record.TextureFlag;
+            Material.bTransparent = Record.bTransparent != 0;
+            Material.Diffuse = ToVector(Record.Diffuse);
+            Material.Specular = ToVector(Record.Specular);
+            Material.Ambient = ToVector(Record.Ambient);
+            Material.Emissive = ToVector(Record.Emissive);
+            Material.SpecularScalar = Record.SpecularScalar;
+            Material.DensityScalar = Record.DensityScalar;
+            Material.TransparencyScalar = Record.TransparencyScalar;
+            Material.BumpMultiplier = Record.BumpMultiplier;
+            Material.IlluminanceModel = Record.IlluminanceModel;
+
+            const auto TextureNames = GetTextureNames(Material);
+            const auto TexturePaths = GetTexturePaths(Material);
+            for (uint32 TextureIndex = 0; TextureIndex < NumMaterialTextures; ++TextureIndex)
+            {
+                Strings.Get(Record.TextureNames[TextureIndex], *TextureNames[TextureIndex]);
+                Strings.Get(Record.TexturePaths[TextureIndex], *TexturePaths[TextureIndex]);
+            }
+        }
+
+        const FSubsetRecord* SubsetRecords = reinterpret_cast<const FSubsetRecord*>(Data + SubsetSection->Offset);
+        OutStaticMesh.MaterialSubsets.SetNum(static_cast<int32>(SubsetSection->NumElements));
+        for (uint32 Index = 0; Index < SubsetSection->NumElements; ++Index)
+        {
+            const FSubsetRecord& Record = SubsetRecords[Index];
+            FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[static_cast<int32>(Index)];
+            Strings.Get(Record.MaterialName, Subset.MaterialName);
+            Subset.IndexStart = Record.IndexStart;
+            Subset.IndexCount = Record.IndexCount;
+            Subset.MaterialIndex = Record.MaterialIndex;
+        }
+
+        // LOD의 Index는 한 번에 복사해두고 LOD마다 잘라서 옮깁니다.
+        TArray<UINT> LODIndices;
+        LODIndices.SetNum(static_cast<int32>(LODIndexSection->NumElements));
+        if (!CopySection(LODIndices.GetData(), Data + LODIndexSection->Offset, *LODIndexSection))
+        {
+            return false;
+        }
+
+        const FLODRecord* LODRecords = reinterpret_cast<const FLODRecord*>(Data + LODSection->Offset);
+        const FLODSubsetRecord* LODSubsetRecords = reinterpret_cast<const FLODSubsetRecord*>(Data + LODSubsetSection->Offset);
+        OutStaticMesh.LODs.SetNum(static_cast<int32>(LODSection->NumElements));
+        for (uint32 Index = 0; Index < LODSection->NumElements; ++Index)
+        {
+            const FLODRecord& Record = LODRecords[Index];
+            if (Record.IndexStart > LODIndexSection->NumElements || Record.IndexCount > LODIndexSection->NumElements - Record.IndexStart)
+            {
+                return false;
+            }
+
+            OBJ::FStaticMeshLODData& LOD = OutStaticMesh.LODs[static_cast<int32>(Index)];
+            LOD.Indices.SetNum(static_cast<int32>(Record.IndexCount));
+            if (Record.IndexCount > 0)
+            {
+                std::memcpy(LOD.Indices.GetData(), LODIndices.GetData() + Record.IndexStart, static_cast<uint64>(Record.IndexCount) * sizeof(UINT));
+            }
+            LOD.Error = Record.Error;
+            LOD.ScreenSize = Record.ScreenSize;
+
+            LOD.MaterialSubsets = OutStaticMesh.MaterialSubsets;
+            for (uint32 SubsetIndex = 0; SubsetIndex < SubsetSection->NumElements; ++SubsetIndex)
+            {
+                const FLODSubsetRecord& SubsetRecord = LODSubsetRecords[static_cast<uint64>(Index) * SubsetSection->NumElements + SubsetIndex];
+                if (SubsetRecord.IndexStart > Record.IndexCount || SubsetRecord.IndexCount > Record.IndexCount - SubsetRecord.IndexStart)
+                {
+                    return false;
+                }
+
+                FMaterialSubset& Subset = LOD.MaterialSubsets[static_cast<int32>(SubsetIndex)];
+                Subset.IndexStart = SubsetRecord.IndexStart;
+                Subset.IndexCount = SubsetRecord.IndexCount;
+            }
+        }
+    }
+    catch (const std::exception&)
+    {
+        return false;
+    }
+
+    OutStaticMesh.BoundingBoxMin = ToVector(Header.BoundingBoxMin);
+    OutStaticMesh.BoundingBoxMax = ToVector(Header.BoundingBoxMax);
+
+    // Texture는 Game Thread에서 LoadMaterialTextures로 읽습니다.
+    return true;
+}
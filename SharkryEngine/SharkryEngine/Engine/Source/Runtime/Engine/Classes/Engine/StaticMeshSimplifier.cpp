@@ -0,0 +1,801 @@
+#include "StaticMeshSimplifier.h"
+
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include <vector>
+
+#include "Define.h"
+
+namespace
+{
+    /** LOD ScreenSize의 상한, 오차가 0인 LOD는 화면을 덮어도 바꿔 그립니다. */
+    constexpr float MaxLODScreenSize = 100.0f;
+
+    struct FPoint
+    {
+        double X, Y, Z;
+    };
+
+    FPoint Sub(const FPoint& A, const FPoint& B) { return { A.X - B.X, A.Y - B.Y, A.Z - B.Z }; }
+    FPoint Cross(const FPoint& A, const FPoint& B) { return { A.Y * B.Z - A.Z * B.Y, A.Z * B.X - A.X * B.Z, A.X * B.Y - A.Y * B.X }; }
+    double Dot(const FPoint& A, const FPoint& B) { return A.X * B.X + A.Y * B.Y + A.Z * B.Z; }
+
+    /** 평면까지 거리 제곱의 가중합을 위치에 대한 2차식으로 모아둔 대칭 행렬 */
+    struct FQuadric
+    {
+        double A00 = 0, A01 = 0, A02 = 0, A11 = 0, A12 = 0, A22 = 0;
+        double B0 = 0, B1 = 0, B2 = 0;
+        double C = 0;
+        double Weight = 0;
+
+        /** 단위 Normal N과 N·P + D = 0인 평면 */
+        void AddPlane(const FPoint& N, double D, double InWeight)
+        {
+            A00 += InWeight * N.X * N.X; A01 += InWeight * N.X * N.Y; A02 += InWeight * N.X * N.Z;
+            A11 += InWeight * N.Y * N.Y; A12 += InWeight * N.Y * N.Z; A22 += InWeight * N.Z * N.Z;
+            B0 += InWeight * N.X * D; B1 += InWeight * N.Y * D; B2 += InWeight * N.Z * D;
+            C += InWeight * D * D;
+            Weight += InWeight;
+        }
+
+        void Add(const FQuadric& Other)
+        {
+            A00 += Other.A00; A01 += Other.A01; A02 += Other.A02;
+            A11 += Other.A11; A12 += Other.A12; A22 += Other.A22;
+            B0 += Other.B0; B1 += Other.B1; B2 += Other.B2;
+            C += Other.C;
+            Weight += Other.Weight;
+        }
+
+        /** 모은 평면까지 거리 제곱의 가중 평균 */
+        double Evaluate(const FPoint& P) const
+        {
+            const double Value = A00 * P.X * P.X + A11 * P.Y * P.Y + A22 * P.Z * P.Z
+                + 2.0 * (A01 * P.X * P.Y + A02 * P.X * P.Z + A12 * P.Y * P.Z)
+                + 2.0 * (B0 * P.X + B1 * P.Y + B2 * P.Z) + C;
+            return Weight > 0.0 ? std::max(Value, 0.0) / Weight : 0.0;
+        }
+    };
+
+    enum class EPositionKind : uint8
+    {
+        Interior,
+        /** 열린 경계 위, 경계 Edge를 따라서만 옮깁니다. */
+        Border,
+        /** Subset 경계나 Non-Manifold, 옮기지 않고 다른 Vertex가 옮겨오는 목적지로만 씁니다. */
+        Locked,
+    };
+
+    struct FCollapse
+    {
+        float Cost;
+        uint32 From;
+        uint32 To;
+        uint32 Stamp;
+
+        bool operator>(const FCollapse& Other) const { return Cost > Other.Cost; }
+    };
+
+    /** From 위치의 Vertex(Wedge)가 옮겨갈 To 위치의 Vertex */
+    struct FWedgeMapping
+    {
+        uint32 From;
+        uint32 To;
+    };
+
+    /**
+     * 한 Mesh를 줄이는 동안의 상태
+     *
+     * Seam을 함께 옮기기 위해 Collapse는 Vertex가 아닌 위치 단위로 하고, Triangle은 원래 Vertex Index를 가집니다.
+     * 위치는 Bounds 중심과 반지름으로 정규화해서 오차가 Mesh 크기와 관계없이 반지름에 대한 비율이 되도록 합니다.
+     */
+    class FSimplifyContext
+    {
+    public:
+        FSimplifyContext(const OBJ::FStaticMeshRenderData& InMesh, const FStaticMeshLODSettings& InSettings)
+            : Mesh(InMesh)
+            , Settings(InSettings)
+        {
+        }
+
+        bool Initialize();
+
+        /** Triangle 수가 TargetTriangles 이하가 되거나 MaxError 안에서 더 접을 수 없을 때까지 접습니다. */
+        void SimplifyTo(int32 TargetTriangles);
+
+        /** 지금 남은 Triangle을 Subset 순서로 모아 LOD를 만듭니다. */
+        void MakeLOD(OBJ::FStaticMeshLODData& OutLOD) const;
+
+        int32 GetNumTriangles() const { return NumAliveTriangles; }
+        float GetError() const { return static_cast<float>(std::sqrt(MaxCollapseCost)); }
+
+        FStaticMeshSimplifyStats Stats;
+
+    private:
+        void BuildPositions();
+        void BuildTriangles();
+        void ClassifyPositions();
+        void BuildQuadrics();
+
+        uint32 GetPosition(uint32 TriangleIndex, int32 Corner) const { return CornerPositions[TriangleIndex * 3 + Corner]; }
+        bool TriangleHasPosition(uint32 TriangleIndex, uint32 Position) const;
+
+        /** 죽은 Triangle을 목록에서 뺍니다. */
+        void CompactTriangles(uint32 Position);
+
+        void GatherNeighbors(uint32 Position, TArray<uint32>& OutNeighbors) const;
+
+        /** Triangle에서 Position이 있는 Corner, Triangle이 Position을 써야 합니다. */
+        int32 FindCorner(uint32 TriangleIndex, uint32 Position) const;
+
+        static const FWedgeMapping* FindMapping(const TArray<FWedgeMapping>& Mappings, uint32 FromVertex);
+
+        /**
+         * From 위치를 To로 옮기는 비용, Seam이나 경계를 벗어나서 옮길 수 없다면 음수
+         * @param OutMappings From의 Vertex마다 옮겨갈 To의 Vertex
+         */
+        double EvaluateCollapse(uint32 From, uint32 To, TArray<FWedgeMapping>& OutMappings) const;
+
+        /** 접은 뒤 Non-Manifold가 되거나 Triangle이 뒤집히지 않는지 확인합니다. To 주변까지 보므로 Queue에서 꺼낼 때 호출합니다. */
+        bool IsCollapseValid(uint32 From, uint32 To);
+
+        /** 이웃마다 Collapse 후보를 Queue에 넣고, 이전에 넣은 후보는 Stamp로 무효화합니다. */
+        void UpdateCollapses(uint32 Position);
+
+        void ApplyCollapse(uint32 From, uint32 To, const TArray<FWedgeMapping>& Mappings);
+
+    private:
+        const OBJ::FStaticMeshRenderData& Mesh;
+        const FStaticMeshLODSettings& Settings;
+
+        TArray<uint32> PositionOfVertex;
+        TArray<FPoint> Positions;
+        TArray<EPositionKind> PositionKinds;
+        TArray<uint8> PositionAlive;
+        TArray<uint32> PositionStamps;
+        TArray<FQuadric> Quadrics;
+
+        /** 위치를 쓰는 Triangle, 죽은 Triangle이 남아있을 수 있습니다. */
+        TArray<TArray<uint32>> PositionTriangles;
+
+        TArray<uint32> Corners;
+
+        /** Corners의 위치, Collapse마다 Vertex를 거쳐 찾지 않도록 같이 갱신합니다. */
+        TArray<uint32> CornerPositions;
+
+        TArray<uint32> TriangleSubsets;
+        TArray<uint8> TriangleAlive;
+        int32 NumAliveTriangles = 0;
+
+        std::priority_queue<FCollapse, std::vector<FCollapse>, std::greater<FCollapse>> Queue;
+        double MaxCollapseCost = 0.0;
+
+        TArray<uint32> NeighborScratch;
+        TArray<uint32> OtherNeighborScratch;
+        TArray<uint32> UpdateScratch;
+        TArray<FWedgeMapping> MappingScratch;
+    };
+
+    bool FSimplifyContext::Initialize()
+    {
+        if (Mesh.Vertices.Num() == 0 || Mesh.Indices.Num() < 3)
+        {
+            return false;
+        }
+
+        BuildPositions();
+        BuildTriangles();
+        ClassifyPositions();
+        BuildQuadrics();
+
+        for (int32 Position = 0; Position < Positions.Num(); ++Position)
+        {
+            UpdateCollapses(Position);
+        }
+        return NumAliveTriangles > 0;
+    }
+
+    void FSimplifyContext::BuildPositions()
+    {
+        const TArray<FStaticMeshVertex>& Vertices = Mesh.Vertices;
+        const int32 NumVertices = Vertices.Num();
+
+        // 위치가 완전히 같은 Vertex를 한 위치로 묶습니다. 정렬하면 같은 위치끼리 붙습니다.
+        TArray<uint32> Order;
+        Order.SetNum(NumVertices);
+        for (int32 Index = 0; Index < NumVertices; ++Index)
+        {
+            Order[Index] = Index;
+        }
+        Order.Sort([&Vertices](uint32 A, uint32 B)
+        {
+            const FStaticMeshVertex& VA = Vertices[A];
+            const FStaticMeshVertex& VB = Vertices[B];
+            if (VA.X != VB.X) return VA.X < VB.X;
+            if (VA.Y != VB.Y) return VA.Y < VB.Y;
+            if (VA.Z != VB.Z) return VA.Z < VB.Z;
+            return A < B;
+        });
+
+        const FVector Center = (Mesh.BoundingBoxMin + Mesh.BoundingBoxMax) * 0.5f;
+        const FVector HalfExtent = (Mesh.BoundingBoxMax - Mesh.BoundingBoxMin) * 0.5f;
+        const double Radius = std::sqrt(static_cast<double>(HalfExtent.X) * HalfExtent.X + static_cast<double>(HalfExtent.Y) * HalfExtent.Y + static_cast<double>(HalfExtent.Z) * HalfExtent.Z);
+        const double InvRadius = Radius > 0.0 ? 1.0 / Radius : 1.0;
+
+        PositionOfVertex.SetNum(NumVertices);
+        for (int32 SortedIndex = 0; SortedIndex < NumVertices; ++SortedIndex)
+        {
+            const FStaticMeshVertex& Vertex = Vertices[Order[SortedIndex]];
+            if (SortedIndex == 0 || Vertex.X != Vertices[Order[SortedIndex - 1]].X || Vertex.Y != Vertices[Order[SortedIndex - 1]].Y || Vertex.Z != Vertices[Order[SortedIndex - 1]].Z)
+            {
+                Positions.Add({ (Vertex.X - Center.X) * InvRadius, (Vertex.Y - Center.Y) * InvRadius, (Vertex.Z - Center.Z) * InvRadius });
+            }
+            PositionOfVertex[Order[SortedIndex]] = Positions.Num() - 1;
+        }
+
+        const int32 NumPositions = Positions.Num();
+        PositionKinds.SetNum(NumPositions);
+        PositionAlive.SetNum(NumPositions);
+        PositionStamps.SetNum(NumPositions);
+        Quadrics.SetNum(NumPositions);
+        PositionTriangles.SetNum(NumPositions);
+        for (int32 Position = 0; Position < NumPositions; ++Position)
+        {
+            PositionKinds[Position] = EPositionKind::Interior;
+            PositionAlive[Position] = 1;
+            PositionStamps[Position] = 0;
+        }
+    }
+
+    void FSimplifyContext::BuildTriangles()
+    {
+        const int32 NumTriangles = Mesh.Indices.Num() / 3;
+        Corners.SetNum(NumTriangles * 3);
+        CornerPositions.SetNum(NumTriangles * 3);
+        TriangleSubsets.SetNum(NumTriangles);
+        TriangleAlive.SetNum(NumTriangles);
+
+        // Subset이 덮지 않는 Triangle은 LOD 0에서도 그려지지 않으므로 Subset 수를 Index로 두어 결과에서 뺍니다.
+        const TArray<FMaterialSubset>& Subsets = Mesh.MaterialSubsets;
+        for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+        {
+            TriangleSubsets[Triangle] = Subsets.Num();
+        }
+        for (int32 SubsetIndex = 0; SubsetIndex < Subsets.Num(); ++SubsetIndex)
+        {
+            const uint32 First = Subsets[SubsetIndex].IndexStart / 3;
+            const uint32 Last = std::min<uint32>((Subsets[SubsetIndex].IndexStart + Subsets[SubsetIndex].IndexCount) / 3, NumTriangles);
+            for (uint32 Triangle = First; Triangle < Last; ++Triangle)
+            {
+                TriangleSubsets[Triangle] = SubsetIndex;
+            }
+        }
+
+        for (int32 Triangle = 0; Triangle < NumTriangles; ++Triangle)
+        {
+            bool bValidIndices = true;
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const uint32 Vertex = Mesh.Indices[Triangle * 3 + Corner];
+                bValidIndices &= Vertex < static_cast<uint32>(PositionOfVertex.Num());
+                Corners[Triangle * 3 + Corner] = bValidIndices ? Vertex : 0;
+                CornerPositions[Triangle * 3 + Corner] = PositionOfVertex[Corners[Triangle * 3 + Corner]];
+            }
+
+            // 넓이가 없거나 범위를 벗어난 Triangle은 처음부터 뺍니다.
+            const uint32 P0 = GetPosition(Triangle, 0), P1 = GetPosition(Triangle, 1), P2 = GetPosition(Triangle, 2);
+            const bool bDegenerate = !bValidIndices || P0 == P1 || P1 == P2 || P2 == P0;
+            TriangleAlive[Triangle] = bDegenerate ? 0 : 1;
+            if (bDegenerate)
+            {
+                continue;
+            }
+
+            ++NumAliveTriangles;
+            PositionTriangles[P0].Add(Triangle);
+            PositionTriangles[P1].Add(Triangle);
+            PositionTriangles[P2].Add(Triangle);
+        }
+    }
+
+    void FSimplifyContext::ClassifyPositions()
+    {
+        for (int32 Position = 0; Position < Positions.Num(); ++Position)
+        {
+            const TArray<uint32>& Triangles = PositionTriangles[Position];
+            if (Triangles.Num() == 0)
+            {
+                PositionKinds[Position] = EPositionKind::Locked;
+                continue;
+            }
+
+            // 여러 재질이 만나는 위치를 옮기면 Subset 사이에 틈이 생깁니다.
+            bool bLocked = false;
+            for (const uint32 Triangle : Triangles)
+            {
+                bLocked |= TriangleSubsets[Triangle] != TriangleSubsets[Triangles[0]];
+            }
+
+            // 이웃 위치마다 공유하는 Triangle 수를 세서 경계(1)와 Non-Manifold(3 이상) Edge를 찾습니다.
+            NeighborScratch.Empty();
+            for (const uint32 Triangle : Triangles)
+            {
+                for (int32 Corner = 0; Corner < 3; ++Corner)
+                {
+                    const uint32 Neighbor = GetPosition(Triangle, Corner);
+                    if (Neighbor != static_cast<uint32>(Position))
+                    {
+                        NeighborScratch.Add(Neighbor);
+                    }
+                }
+            }
+            NeighborScratch.Sort();
+
+            int32 NumBorderEdges = 0;
+            for (int32 Start = 0; Start < NeighborScratch.Num();)
+            {
+                int32 End = Start;
+                while (End < NeighborScratch.Num() && NeighborScratch[End] == NeighborScratch[Start])
+                {
+                    ++End;
+                }
+                const int32 NumEdgeTriangles = End - Start;
+                NumBorderEdges += NumEdgeTriangles == 1;
+                bLocked |= NumEdgeTriangles > 2;
+                Start = End;
+            }
+
+            // 경계가 두 번 이상 지나가는 위치(Bowtie)도 옮기지 않습니다.
+            bLocked |= NumBorderEdges > 2;
+
+            PositionKinds[Position] = bLocked ? EPositionKind::Locked : (NumBorderEdges > 0 ? EPositionKind::Border : EPositionKind::Interior);
+        }
+    }
+
+    void FSimplifyContext::BuildQuadrics()
+    {
+        for (int32 Triangle = 0; Triangle < TriangleAlive.Num(); ++Triangle)
+        {
+            if (!TriangleAlive[Triangle])
+            {
+                continue;
+            }
+
+            const uint32 TrianglePositions[3] = { GetPosition(Triangle, 0), GetPosition(Triangle, 1), GetPosition(Triangle, 2) };
+            const FPoint& P0 = Positions[TrianglePositions[0]];
+            const FPoint Normal = Cross(Sub(Positions[TrianglePositions[1]], P0), Sub(Positions[TrianglePositions[2]], P0));
+            const double Length = std::sqrt(Dot(Normal, Normal));
+            if (Length <= 0.0)
+            {
+                continue;
+            }
+
+            // 넓이로 가중해서 작은 Triangle의 평면이 큰 Triangle을 끌고가지 않도록 합니다.
+            const FPoint UnitNormal = { Normal.X / Length, Normal.Y / Length, Normal.Z / Length };
+            const double Area = Length * 0.5;
+            FQuadric Plane;
+            Plane.AddPlane(UnitNormal, -Dot(UnitNormal, P0), Area);
+            for (const uint32 Position : TrianglePositions)
+            {
+                Quadrics[Position].Add(Plane);
+            }
+
+            // 경계 Edge는 Triangle에 수직인 평면을 더해서 외곽선이 안쪽으로 말려들지 않게 합니다.
+            for (int32 Edge = 0; Edge < 3; ++Edge)
+            {
+                const uint32 A = TrianglePositions[Edge];
+                const uint32 B = TrianglePositions[(Edge + 1) % 3];
+                if (PositionKinds[A] == EPositionKind::Interior || PositionKinds[B] == EPositionKind::Interior)
+                {
+                    continue;
+                }
+
+                int32 NumEdgeTriangles = 0;
+                for (const uint32 Other : PositionTriangles[A])
+                {
+                    NumEdgeTriangles += TriangleHasPosition(Other, B);
+                }
+                if (NumEdgeTriangles != 1)
+                {
+                    continue;
+                }
+
+                const FPoint EdgeVector = Sub(Positions[B], Positions[A]);
+                const double EdgeLengthSquared = Dot(EdgeVector, EdgeVector);
+                const FPoint BorderNormal = Cross(EdgeVector, UnitNormal);
+                const double BorderLength = std::sqrt(Dot(BorderNormal, BorderNormal));
+                if (BorderLength <= 0.0)
+                {
+                    continue;
+                }
+
+                const FPoint UnitBorderNormal = { BorderNormal.X / BorderLength, BorderNormal.Y / BorderLength, BorderNormal.Z / BorderLength };
+                FQuadric BorderPlane;
+                BorderPlane.AddPlane(UnitBorderNormal, -Dot(UnitBorderNormal, Positions[A]), EdgeLengthSquared * Settings.BorderWeight);
+                Quadrics[A].Add(BorderPlane);
+                Quadrics[B].Add(BorderPlane);
+            }
+        }
+    }
+
+    bool FSimplifyContext::TriangleHasPosition(uint32 TriangleIndex, uint32 Position) const
+    {
+        return GetPosition(TriangleIndex, 0) == Position || GetPosition(TriangleIndex, 1) == Position || GetPosition(TriangleIndex, 2) == Position;
+    }
+
+    int32 FSimplifyContext::FindCorner(uint32 TriangleIndex, uint32 Position) const
+    {
+        return GetPosition(TriangleIndex, 0) == Position ? 0 : (GetPosition(TriangleIndex, 1) == Position ? 1 : 2);
+    }
+
+    const FWedgeMapping* FSimplifyContext::FindMapping(const TArray<FWedgeMapping>& Mappings, uint32 FromVertex)
+    {
+        for (const FWedgeMapping& Mapping : Mappings)
+        {
+            if (Mapping.From == FromVertex)
+            {
+                return &Mapping;
+            }
+        }
+        return nullptr;
+    }
+
+    void FSimplifyContext::CompactTriangles(uint32 Position)
+    {
+        TArray<uint32>& Triangles = PositionTriangles[Position];
+        int32 NumKept = 0;
+        for (int32 Index = 0; Index < Triangles.Num(); ++Index)
+        {
+            if (TriangleAlive[Triangles[Index]])
+            {
+                Triangles[NumKept++] = Triangles[Index];
+            }
+        }
+        Triangles.SetNum(NumKept);
+    }
+
+    void FSimplifyContext::GatherNeighbors(uint32 Position, TArray<uint32>& OutNeighbors) const
+    {
+        OutNeighbors.Empty();
+        for (const uint32 Triangle : PositionTriangles[Position])
+        {
+            if (!TriangleAlive[Triangle])
+            {
+                continue;
+            }
+
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const uint32 Neighbor = GetPosition(Triangle, Corner);
+                if (Neighbor != Position && std::find(OutNeighbors.begin(), OutNeighbors.end(), Neighbor) == OutNeighbors.end())
+                {
+                    OutNeighbors.Add(Neighbor);
+                }
+            }
+        }
+    }
+
+    double FSimplifyContext::EvaluateCollapse(uint32 From, uint32 To, TArray<FWedgeMapping>& OutMappings) const
+    {
+        OutMappings.Empty();
+
+        // Edge를 공유하는 Triangle에서 From의 Vertex가 To의 어느 Vertex로 옮겨갈지 정합니다.
+        // Seam 위라면 양쪽 Triangle이 각자 자기 쪽 Vertex를 알려주고, 한 Vertex가 두 곳으로 가야 한다면 Seam을 가로지르는 Collapse입니다.
+        int32 NumEdgeTriangles = 0;
+        for (const uint32 Triangle : PositionTriangles[From])
+        {
+            if (!TriangleAlive[Triangle] || !TriangleHasPosition(Triangle, To))
+            {
+                continue;
+            }
+
+            ++NumEdgeTriangles;
+            uint32 FromVertex = 0;
+            uint32 ToVertex = 0;
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const uint32 Position = GetPosition(Triangle, Corner);
+                if (Position == From)
+                {
+                    FromVertex = Corners[Triangle * 3 + Corner];
+                }
+                else if (Position == To)
+                {
+                    ToVertex = Corners[Triangle * 3 + Corner];
+                }
+            }
+
+            if (const FWedgeMapping* Mapping = FindMapping(OutMappings, FromVertex))
+            {
+                if (Mapping->To != ToVertex)
+                {
+                    return -1.0;
+                }
+                continue;
+            }
+            OutMappings.Add({ FromVertex, ToVertex });
+        }
+
+        // 경계 위치는 경계를 따라서만, 안쪽 위치는 양쪽에 Triangle이 있는 Edge로만 옮깁니다.
+        if (NumEdgeTriangles != (PositionKinds[From] == EPositionKind::Border ? 1 : 2))
+        {
+            return -1.0;
+        }
+
+        // Edge 밖의 Triangle도 From의 Vertex가 옮겨갈 곳이 정해져 있어야 합니다. 없다면 Seam을 벗어나는 Collapse입니다.
+        for (const uint32 Triangle : PositionTriangles[From])
+        {
+            if (TriangleAlive[Triangle] && FindMapping(OutMappings, Corners[Triangle * 3 + FindCorner(Triangle, From)]) == nullptr)
+            {
+                return -1.0;
+            }
+        }
+
+        // From의 Vertex가 To의 Vertex 속성을 쓰게 되므로, 바뀌는 Normal과 UV 차이를 위치 오차처럼 더합니다.
+        double AttributeCost = 0.0;
+        for (const FWedgeMapping& Mapping : OutMappings)
+        {
+            const FStaticMeshVertex& A = Mesh.Vertices[Mapping.From];
+            const FStaticMeshVertex& B = Mesh.Vertices[Mapping.To];
+            const double NormalDelta = (A.NormalX - B.NormalX) * (A.NormalX - B.NormalX) + (A.NormalY - B.NormalY) * (A.NormalY - B.NormalY) + (A.NormalZ - B.NormalZ) * (A.NormalZ - B.NormalZ);
+            const double UVDelta = (A.U - B.U) * (A.U - B.U) + (A.V - B.V) * (A.V - B.V);
+            AttributeCost = std::max(AttributeCost, Settings.NormalWeight * Settings.NormalWeight * NormalDelta + Settings.UVWeight * Settings.UVWeight * UVDelta);
+        }
+
+        return Quadrics[From].Evaluate(Positions[To]) + AttributeCost;
+    }
+
+    bool FSimplifyContext::IsCollapseValid(uint32 From, uint32 To)
+    {
+        // 두 위치가 Edge의 Triangle 밖에서도 이웃을 공유하면 접은 뒤 Edge가 겹쳐서 Non-Manifold가 됩니다.
+        GatherNeighbors(From, NeighborScratch);
+        GatherNeighbors(To, OtherNeighborScratch);
+        int32 NumSharedNeighbors = 0;
+        for (const uint32 Neighbor : NeighborScratch)
+        {
+            NumSharedNeighbors += std::find(OtherNeighborScratch.begin(), OtherNeighborScratch.end(), Neighbor) != OtherNeighborScratch.end();
+        }
+        if (NumSharedNeighbors != (PositionKinds[From] == EPositionKind::Border ? 1 : 2))
+        {
+            return false;
+        }
+
+        // 옮긴 뒤 Triangle이 뒤집히거나 넓이가 없어지면 거절합니다.
+        const FPoint& FromPosition = Positions[From];
+        const FPoint& ToPosition = Positions[To];
+        for (const uint32 Triangle : PositionTriangles[From])
+        {
+            if (!TriangleAlive[Triangle] || TriangleHasPosition(Triangle, To))
+            {
+                continue;
+            }
+
+            const int32 FromCorner = FindCorner(Triangle, From);
+            const FPoint& P1 = Positions[GetPosition(Triangle, (FromCorner + 1) % 3)];
+            const FPoint& P2 = Positions[GetPosition(Triangle, (FromCorner + 2) % 3)];
+            const FPoint OldNormal = Cross(Sub(P1, FromPosition), Sub(P2, FromPosition));
+            const FPoint NewNormal = Cross(Sub(P1, ToPosition), Sub(P2, ToPosition));
+            if (Dot(OldNormal, NewNormal) <= 1e-3 * std::sqrt(Dot(OldNormal, OldNormal) * Dot(NewNormal, NewNormal)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void FSimplifyContext::UpdateCollapses(uint32 Position)
+    {
+        ++PositionStamps[Position];
+        if (!PositionAlive[Position] || PositionKinds[Position] == EPositionKind::Locked)
+        {
+            return;
+        }
+
+        CompactTriangles(Position);
+        GatherNeighbors(Position, NeighborScratch);
+
+        // 위상과 뒤집힘 검사는 꺼낼 때 하고, 여기서는 비용만 구해서 이웃마다 넣습니다.
+        for (const uint32 Neighbor : NeighborScratch)
+        {
+            const double Cost = EvaluateCollapse(Position, Neighbor, MappingScratch);
+            if (Cost >= 0.0)
+            {
+                Queue.push({ static_cast<float>(Cost), Position, Neighbor, PositionStamps[Position] });
+            }
+        }
+    }
+
+    void FSimplifyContext::ApplyCollapse(uint32 From, uint32 To, const TArray<FWedgeMapping>& Mappings)
+    {
+        for (const uint32 Triangle : PositionTriangles[From])
+        {
+            if (!TriangleAlive[Triangle])
+            {
+                continue;
+            }
+
+            if (TriangleHasPosition(Triangle, To))
+            {
+                TriangleAlive[Triangle] = 0;
+                --NumAliveTriangles;
+                continue;
+            }
+
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                if (CornerPositions[Triangle * 3 + Corner] != From)
+                {
+                    continue;
+                }
+
+                uint32& Vertex = Corners[Triangle * 3 + Corner];
+                for (const FWedgeMapping& Mapping : Mappings)
+                {
+                    if (Mapping.From == Vertex)
+                    {
+                        Vertex = Mapping.To;
+                        break;
+                    }
+                }
+                CornerPositions[Triangle * 3 + Corner] = To;
+            }
+            PositionTriangles[To].Add(Triangle);
+        }
+
+        PositionTriangles[From].Empty();
+        PositionAlive[From] = 0;
+        Quadrics[To].Add(Quadrics[From]);
+        ++Stats.NumCollapses;
+
+        // To와 이웃의 후보가 바뀌었으므로 다시 구합니다.
+        GatherNeighbors(To, UpdateScratch);
+        UpdateCollapses(To);
+        for (const uint32 Neighbor : UpdateScratch)
+        {
+            UpdateCollapses(Neighbor);
+        }
+    }
+
+    void FSimplifyContext::SimplifyTo(int32 TargetTriangles)
+    {
+        const double MaxCost = static_cast<double>(Settings.MaxError) * Settings.MaxError;
+        TArray<FWedgeMapping> Mappings;
+
+        while (NumAliveTriangles > TargetTriangles && !Queue.empty())
+        {
+            const FCollapse Collapse = Queue.top();
+            if (Collapse.Cost > MaxCost)
+            {
+                break;
+            }
+            Queue.pop();
+
+            // From 주변의 Triangle이 바뀌면 From의 후보를 다시 넣으므로, Stamp가 같다면 비용도 그대로입니다.
+            if (!PositionAlive[Collapse.From] || !PositionAlive[Collapse.To] || Collapse.Stamp != PositionStamps[Collapse.From])
+            {
+                continue;
+            }
+
+            // To 쪽 이웃은 바뀌었을 수 있으므로 꺼낼 때 확인합니다. 거절해도 From의 다른 후보가 Queue에 남아있습니다.
+            if (!IsCollapseValid(Collapse.From, Collapse.To))
+            {
+                ++Stats.NumRejected;
+                continue;
+            }
+
+            const double Cost = EvaluateCollapse(Collapse.From, Collapse.To, Mappings);
+            MaxCollapseCost = std::max(MaxCollapseCost, Cost);
+            ApplyCollapse(Collapse.From, Collapse.To, Mappings);
+        }
+    }
+
+    void FSimplifyContext::MakeLOD(OBJ::FStaticMeshLODData& OutLOD) const
+    {
+        const TArray<FMaterialSubset>& Subsets = Mesh.MaterialSubsets;
+        const int32 NumGroups = std::max(Subsets.Num(), 1);
+
+        // Subset마다 남은 Triangle을 원래 순서대로 모읍니다.
+        TArray<uint32> GroupStarts;
+        GroupStarts.SetNum(NumGroups + 1);
+        for (int32 Group = 0; Group <= NumGroups; ++Group)
+        {
+            GroupStarts[Group] = 0;
+        }
+        for (int32 Triangle = 0; Triangle < TriangleAlive.Num(); ++Triangle)
+        {
+            if (TriangleAlive[Triangle] && TriangleSubsets[Triangle] < static_cast<uint32>(NumGroups))
+            {
+                ++GroupStarts[TriangleSubsets[Triangle] + 1];
+            }
+        }
+        for (int32 Group = 0; Group < NumGroups; ++Group)
+        {
+            GroupStarts[Group + 1] += GroupStarts[Group];
+        }
+
+        OutLOD.Indices.SetNum(GroupStarts[NumGroups] * 3);
+        TArray<uint32> Cursors = GroupStarts;
+        for (int32 Triangle = 0; Triangle < TriangleAlive.Num(); ++Triangle)
+        {
+            if (!TriangleAlive[Triangle] || TriangleSubsets[Triangle] >= static_cast<uint32>(NumGroups))
+            {
+                continue;
+            }
+
+            const uint32 Destination = Cursors[TriangleSubsets[Triangle]]++ * 3;
+            OutLOD.Indices[Destination] = Corners[Triangle * 3];
+            OutLOD.Indices[Destination + 1] = Corners[Triangle * 3 + 1];
+            OutLOD.Indices[Destination + 2] = Corners[Triangle * 3 + 2];
+        }
+
+        OutLOD.MaterialSubsets = Subsets;
+        for (int32 SubsetIndex = 0; SubsetIndex < Subsets.Num(); ++SubsetIndex)
+        {
+            OutLOD.MaterialSubsets[SubsetIndex].IndexStart = GroupStarts[SubsetIndex] * 3;
+            OutLOD.MaterialSubsets[SubsetIndex].IndexCount = (GroupStarts[SubsetIndex + 1] - GroupStarts[SubsetIndex]) * 3;
+        }
+
+        OutLOD.Error = GetError();
+        OutLOD.IndexBuffer = nullptr;
+    }
+}
+
+int32 FStaticMeshSimplifier::BuildLODs(OBJ::FStaticMeshRenderData& Mesh, const FStaticMeshLODSettings& Settings, FStaticMeshSimplifyStats* OutStats)
+{
+    Mesh.LODs.Empty();
+
+    if (Mesh.Indices.Num() / 3 < Settings.MinTriangles * 2 || Settings.MaxLODs <= 0)
+    {
+        return 0;
+    }
+
+    FSimplifyContext Context(Mesh, Settings);
+    if (!Context.Initialize())
+    {
+        return 0;
+    }
+
+    int32 PreviousTriangles = Context.GetNumTriangles();
+    while (Mesh.LODs.Num() < Settings.MaxLODs)
+    {
+        const int32 TargetTriangles = static_cast<int32>(PreviousTriangles * Settings.TriangleRatio);
+        if (TargetTriangles < Settings.MinTriangles)
+        {
+            break;
+        }
+
+        Context.SimplifyTo(TargetTriangles);
+
+        // MaxError 안에서 목표에 닿지 못했다면, 충분히 줄어든 경우만 마지막 LOD로 남깁니다.
+        const bool bReachedTarget = Context.GetNumTriangles() <= TargetTriangles;
+        if (bReachedTarget || Context.GetNumTriangles() <= PreviousTriangles * Settings.MinReduction)
+        {
+            OBJ::FStaticMeshLODData& LOD = Mesh.LODs[Mesh.LODs.Add(OBJ::FStaticMeshLODData())];
+            Context.MakeLOD(LOD);
+            LOD.ScreenSize = ComputeScreenSize(LOD.Error, Settings);
+            PreviousTriangles = Context.GetNumTriangles();
+        }
+
+        if (!bReachedTarget)
+        {
+            break;
+        }
+    }
+
+    if (OutStats)
+    {
+        *OutStats = Context.Stats;
+    }
+    return Mesh.LODs.Num();
+}
+
+float FStaticMeshSimplifier::ComputeScreenSize(float Error, const FStaticMeshLODSettings& Settings)
+{
+    // Screen Size가 S일 때 반지름은 화면 높이의 S / 2를 차지하므로, 오차는 Error * S / 2 * 화면 높이 Pixel입니다.
+    if (Error <= 0.0f)
+    {
+        return MaxLODScreenSize;
+    }
+    return std::min(2.0f * Settings.PixelError / (Error * Settings.ReferenceScreenHeight), MaxLODScreenSize);
+}
@@ -0,0 +1,72 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+namespace OBJ
+{
+    struct FStaticMeshRenderData;
+}
+
+/** Cook할 때 만드는 LOD Chain의 설정 */
+struct FStaticMeshLODSettings
+{
+    /** LOD 0을 제외하고 만들 최대 LOD 수 */
+    int32 MaxLODs = 4;
+
+    /** LOD마다 앞 LOD에 대해 남길 Triangle 비율 */
+    float TriangleRatio = 0.5f;
+
+    /** 이보다 적은 Triangle로는 줄이지 않습니다. 이보다 작은 Mesh는 LOD를 만들지 않습니다. */
+    int32 MinTriangles = 64;
+
+    /** Bounds 반지름에 대한 최대 오차, 이보다 큰 오차를 내는 Collapse는 하지 않습니다. */
+    float MaxError = 0.05f;
+
+    /** 목표 Triangle 수에 닿지 못했더라도 앞 LOD보다 이 비율 이하로 줄었다면 마지막 LOD로 남깁니다. */
+    float MinReduction = 0.75f;
+
+    /** Normal, UV 차이를 위치 오차로 바꾸는 가중치, 클수록 Shading과 Texture 경계를 지킵니다. */
+    float NormalWeight = 0.25f;
+    float UVWeight = 0.5f;
+
+    /** 열린 경계에 더하는 수직 평면 Quadric의 가중치, 클수록 외곽선이 덜 움직입니다. */
+    float BorderWeight = 10.0f;
+
+    /** ScreenSize를 정하는 기준, 이 화면 높이에서 LOD 오차가 PixelError를 넘지 않는 크기부터 LOD를 씁니다. */
+    float PixelError = 1.0f;
+    float ReferenceScreenHeight = 1080.0f;
+};
+
+/** FStaticMeshSimplifier::BuildLODs 결과 통계 */
+struct FStaticMeshSimplifyStats
+{
+    int32 NumCollapses = 0;
+
+    /** 위상이나 Normal 뒤집힘 검사로 거절한 Collapse 후보 수 */
+    int32 NumRejected = 0;
+};
+
+/**
+ * Quadric Error Metric으로 Edge를 하나씩 접어서 Static Mesh의 LOD Chain을 만듭니다.
+ *
+ * Vertex를 다른 끝점으로 옮기는 Half-Edge Collapse만 사용하므로 새 Vertex가 생기지 않고,
+ * 모든 LOD가 LOD 0의 Vertex Buffer를 그대로 쓰면서 Index Buffer만 따로 가집니다.
+ * 위치가 같고 Normal이나 UV가 다른 Vertex(Seam)는 같은 위치로 묶어서 함께 옮기고, Collapse 비용에
+ * 바뀌는 Normal, UV 차이를 더해서 Shading과 Texture 경계가 늦게 무너지도록 합니다.
+ *
+ * 한 번 줄여가면서 Triangle 수가 LOD마다 목표에 닿을 때 결과를 복사하므로 LOD 수만큼 다시 계산하지 않습니다.
+ * 재질 Subset 경계의 Vertex는 움직이지 않으므로 Subset 사이에 틈이 생기지 않고, LOD의 Subset은 LOD 0과 수와 순서가 같습니다.
+ * D3D와 UObject를 사용하지 않으므로 Cook하는 Worker 스레드에서 호출할 수 있습니다.
+ */
+class FStaticMeshSimplifier
+{
+public:
+    /**
+     * Mesh의 LODs를 새로 채웁니다. 만들 수 없는 Mesh라면 LODs는 비어있습니다.
+     * @return 만든 LOD 수
+     */
+    static int32 BuildLODs(OBJ::FStaticMeshRenderData& Mesh, const FStaticMeshLODSettings& Settings = FStaticMeshLODSettings(), FStaticMeshSimplifyStats* OutStats = nullptr);
+
+    /** Bounds 반지름에 대한 오차가 Error인 LOD를 쓰기 시작하는 Screen Size */
+    static float ComputeScreenSize(float Error, const FStaticMeshLODSettings& Settings);
+};
@@ -0,0 +1,539 @@
+#include "Misc/AutomationTest.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "WindowsPlatformTime.h"
+#include "Engine/FLoaderOBJ.h"
+
+namespace
+{
+    /** 이전 std::istringstream 기반 FLoaderOBJ::ParseOBJ, 새 Parser의 결과를 비교하는 기준으로만 사용합니다. */
+    bool ReferenceParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+    {
+        std::ifstream OBJ(ObjFilePath.ToWideString());
+        if (!OBJ)
+        {
+            return false;
+        }
+
+        OutObjInfo.FilePath = ObjFilePath.ToWideString().substr(0, ObjFilePath.ToWideString().find_last_of(L"\\/") + 1);
+        OutObjInfo.ObjectName = ObjFilePath.ToWideString();
+        // ObjectName은 wstring 타입이므로, 이를 string으로 변환 (간단한 ASCII 변환의 경우)
+        std::wstring wideName = OutObjInfo.ObjectName.substr(ObjFilePath.ToWideString().find_last_of(L"\\/") + 1);;
+        std::string fileName(wideName.begin(), wideName.end());
+
+        // 마지막 '.'을 찾아 확장자를 제거
+        size_t dotPos = fileName.find_last_of('.');
+        if (dotPos != std::string::npos)
+        {
+            OutObjInfo.DisplayName = fileName.substr(0, dotPos);
+        }
+        else
+        {
+            OutObjInfo.DisplayName = fileName;
+        }
+
+        /**
+         * 블렌더 Export 설정
+         *   - General
+         *       Forward Axis:  Y
+         *       Up Axis:       Z
+         *   - Geometry
+         *       ✅ Triangulated Mesh
+         */
+
+        std::string Line;
+
+        while (std::getline(OBJ, Line))
+        {
+            if (Line.empty() || Line[0] == '#')
+                continue;
+
+            std::istringstream LineStream(Line);
+            std::string Token;
+            LineStream >> Token;
+
+            if (Token == "mtllib")
+            {
+                LineStream >> Line;
+                OutObjInfo.MatName = Line;
+                continue;
+            }
+
+            if (Token == "usemtl")
+            {
+                LineStream >> Line;
+                FString MatName(Line);
+
+                if (!OutObjInfo.MaterialSubsets.IsEmpty())
+                {
+                    FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+                    LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+                }
+
+                FMaterialSubset MaterialSubset;
+                MaterialSubset.MaterialName = MatName;
+                MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
+                MaterialSubset.IndexCount = 0;
+                OutObjInfo.MaterialSubsets.Add(MaterialSubset);
+            }
+
+            if (Token == "g" || Token == "o")
+            {
+                LineStream >> Line;
+                OutObjInfo.GroupName.Add(Line);
+                OutObjInfo.NumOfGroup++;
+            }
+
+            if (Token == "v") // Vertex
+            {
+                float X, Y, Z;
+                LineStream >> X >> Y >> Z;
+                OutObjInfo.Vertices.Add(FVector(X, Y * -1.f, Z));
+                continue;
+            }
+
+            if (Token == "vn") // Normal
+            {
+                float NormalX, NormalY, NormalZ;
+                LineStream >> NormalX >> NormalY >> NormalZ;
+                OutObjInfo.Normals.Add(FVector(NormalX, NormalY * -1.f, NormalZ));
+                continue;
+            }
+
+            if (Token == "vt") // Texture
+            {
+                float U, V;
+                LineStream >> U >> V;
+                OutObjInfo.UVs.Add(FVector2D(U, 1.f - V));
+                continue;
+            }
+
+            if (Token == "f")
+            {
+                TArray<uint32> FaceVertexIndices;  // 이번 페이스의 정점 인덱스
+                TArray<uint32> FaceNormalIndices;  // 이번 페이스의 법선 인덱스
+                TArray<uint32> FaceUVIndices; // 이번 페이스의 텍스처 인덱스
+
+                while (LineStream >> Token)
+                {
+                    std::istringstream TokenStream(Token);
+                    std::string Part;
+                    TArray<std::string> FacePieces;
+
+                    uint32 vertexIndex = 0;
+                    uint32 textureIndex = UINT32_MAX;
+                    uint32 normalIndex = UINT32_MAX;
+
+                    // v
+                    if (std::getline(TokenStream, Part, '/'))
+                    {
+                        if (!Part.empty())
+                        {
+                            vertexIndex = std::stoi(Part) - 1;
+                        }
+                    }
+
+                    // vt
+                    if (std::getline(TokenStream, Part, '/'))
+                    {
+                        if (!Part.empty())
+                        {
+                            textureIndex = std::stoi(Part) - 1;
+                        }
+                    }
+
+                    // vn
+                    if (std::getline(TokenStream, Part, '/'))
+                    {
+                        if (!Part.empty())
+                        {
+                            normalIndex = std::stoi(Part) - 1;
+                        }
+                    }
+
+                    FaceVertexIndices.Add(vertexIndex);
+                    FaceUVIndices.Add(textureIndex);
+                    FaceNormalIndices.Add(normalIndex);
+                }
+
+                if (FaceVertexIndices.Num() == 3) // 삼각형
+                {
+                    // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환: 0-2-1
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
+
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
+
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
+                }
+                else if (FaceVertexIndices.Num() == 4) // 쿼드
+                {
+                    // 첫 번째 삼각형: 0-2-1
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[1]);
+
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
+
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
+
+                    // 두 번째 삼각형: 0-3-2
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[3]);
+                    OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
+
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[3]);
+                    OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
+
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[3]);
+                    OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+                }
+            }
+        }
+
+        if (!OutObjInfo.MaterialSubsets.IsEmpty())
+        {
+            FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+            LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+        }
+
+        return true;
+    }
+
+    /**
+     * 이전 FLoaderOBJ::ConvertToStaticMesh와 같이 "v/vt/vn" 문자열로 중복 정점을 찾습니다.
+     * Tangent는 두 경우 모두 같은 함수로 계산하므로 만들지 않고 비교하지도 않습니다.
+     */
+    void ReferenceConvertToStaticMesh(const FObjInfo& RawData, const TArray<FMaterialSubset>& Subsets, TArray<FStaticMeshVertex>& OutVertices, TArray<uint32>& OutIndices)
+    {
+        TMap<std::string, uint32> IndexMap;
+
+        for (int32 i = 0; i < RawData.VertexIndices.Num(); i++)
+        {
+            const uint32 VertexIndex = RawData.VertexIndices[i];
+            const uint32 UVIndex = RawData.UVIndices[i];
+            const uint32 NormalIndex = RawData.NormalIndices[i];
+
+            uint32 MaterialIndex = 0;
+            for (int32 j = 0; j < Subsets.Num(); j++)
+            {
+                const FMaterialSubset& Subset = Subsets[j];
+                if (Subset.IndexStart <= static_cast<uint32>(i) && static_cast<uint32>(i) < Subset.IndexStart + Subset.IndexCount)
+                {
+                    MaterialIndex = Subset.MaterialIndex;
+                    break;
+                }
+            }
+
+            const std::string Key = std::to_string(VertexIndex) + "/" + std::to_string(UVIndex) + "/" + std::to_string(NormalIndex);
+
+            uint32 FinalIndex;
+            if (IndexMap.Contains(Key))
+            {
+                FinalIndex = IndexMap[Key];
+            }
+            else
+            {
+                FStaticMeshVertex StaticMeshVertex = {};
+                StaticMeshVertex.MaterialIndex = MaterialIndex;
+                StaticMeshVertex.X = RawData.Vertices[VertexIndex].X;
+                StaticMeshVertex.Y = RawData.Vertices[VertexIndex].Y;
+                StaticMeshVertex.Z = RawData.Vertices[VertexIndex].Z;
+
+                StaticMeshVertex.R = 0.7f; StaticMeshVertex.G = 0.7f; StaticMeshVertex.B = 0.7f; StaticMeshVertex.A = 1.0f;
+
+                if (UVIndex != UINT32_MAX && UVIndex < static_cast<uint32>(RawData.UVs.Num()))
+                {
+                    StaticMeshVertex.U = RawData.UVs[UVIndex].X;
+                    StaticMeshVertex.V = RawData.UVs[UVIndex].Y;
+                }
+
+                if (NormalIndex != UINT32_MAX && NormalIndex < static_cast<uint32>(RawData.Normals.Num()))
+                {
+                    StaticMeshVertex.NormalX = RawData.Normals[NormalIndex].X;
+                    StaticMeshVertex.NormalY = RawData.Normals[NormalIndex].Y;
+                    StaticMeshVertex.NormalZ = RawData.Normals[NormalIndex].Z;
+                }
+
+                FinalIndex = OutVertices.Num();
+                IndexMap[Key] = FinalIndex;
+                OutVertices.Add(StaticMeshVertex);
+            }
+
+            OutIndices.Add(FinalIndex);
+        }
+    }
+
+    /** Subset마다 다른 Material Index를 주어서 Convert가 정점의 Material을 제대로 나누는지도 비교합니다. */
+    TArray<FMaterialSubset> MakeTestSubsets(const FObjInfo& RawData)
+    {
+        TArray<FMaterialSubset> Subsets = RawData.MaterialSubsets;
+        for (int32 Index = 0; Index < Subsets.Num(); ++Index)
+        {
+            Subsets[Index].MaterialIndex = static_cast<uint32>(Index);
+        }
+        return Subsets;
+    }
+
+    template <typename ElementType>
+    bool BitwiseEqual(const TArray<ElementType>& A, const TArray<ElementType>& B)
+    {
+        return A.Num() == B.Num() && (A.Num() == 0 || std::memcmp(A.GetData(), B.GetData(), sizeof(ElementType) * A.Num()) == 0);
+    }
+
+    bool BitwiseEqual(float A, float B)
+    {
+        return std::memcmp(&A, &B, sizeof(float)) == 0;
+    }
+
+    /** 다른 항목의 이름을 반환하고, 모두 같다면 nullptr */
+    const ANSICHAR* FindObjInfoMismatch(const FObjInfo& Expected, const FObjInfo& Actual)
+    {
+        if (Expected.ObjectName != Actual.ObjectName || Expected.FilePath != Actual.FilePath || Expected.DisplayName != Actual.DisplayName)
+        {
+            return "name";
+        }
+        if (Expected.MatName != Actual.MatName)
+        {
+            return "mtllib";
+        }
+        if (Expected.NumOfGroup != Actual.NumOfGroup || Expected.GroupName.Num() != Actual.GroupName.Num())
+        {
+            return "groups";
+        }
+        for (int32 Index = 0; Index < Expected.GroupName.Num(); ++Index)
+        {
+            if (Expected.GroupName[Index] != Actual.GroupName[Index])
+            {
+                return "groups";
+            }
+        }
+        if (!BitwiseEqual(Expected.Vertices, Actual.Vertices))
+        {
+            return "positions";
+        }
+        if (!BitwiseEqual(Expected.Normals, Actual.Normals))
+        {
+            return "normals";
+        }
+        if (!BitwiseEqual(Expected.UVs, Actual.UVs))
+        {
+            return "uvs";
+        }
+        if (!BitwiseEqual(Expected.VertexIndices, Actual.VertexIndices) || !BitwiseEqual(Expected.UVIndices, Actual.UVIndices) || !BitwiseEqual(Expected.NormalIndices, Actual.NormalIndices))
+        {
+            return "indices";
+        }
+        if (Expected.MaterialSubsets.Num() != Actual.MaterialSubsets.Num())
+        {
+            return "subsets";
+        }
+        for (int32 Index = 0; Index < Expected.MaterialSubsets.Num(); ++Index)
+        {
+            const FMaterialSubset& A = Expected.MaterialSubsets[Index];
+            const FMaterialSubset& B = Actual.MaterialSubsets[Index];
+            if (A.MaterialName != B.MaterialName || A.IndexStart != B.IndexStart || A.IndexCount != B.IndexCount)
+            {
+                return "subsets";
+            }
+        }
+        return nullptr;
+    }
+
+    const ANSICHAR* FindConvertedMismatch(const TArray<FStaticMeshVertex>& ExpectedVertices, const TArray<uint32>& ExpectedIndices, const OBJ::FStaticMeshRenderData& Actual)
+    {
+        if (ExpectedVertices.Num() != Actual.Vertices.Num())
+        {
+            return "vertex count";
+        }
+        for (int32 Index = 0; Index < ExpectedVertices.Num(); ++Index)
+        {
+            const FStaticMeshVertex& A = ExpectedVertices[Index];
+            const FStaticMeshVertex& B = Actual.Vertices[Index];
+            const bool bSame = BitwiseEqual(A.X, B.X) && BitwiseEqual(A.Y, B.Y) && BitwiseEqual(A.Z, B.Z)
+                && BitwiseEqual(A.R, B.R) && BitwiseEqual(A.G, B.G) && BitwiseEqual(A.B, B.B) && BitwiseEqual(A.A, B.A)
+                && BitwiseEqual(A.NormalX, B.NormalX) && BitwiseEqual(A.NormalY, B.NormalY) && BitwiseEqual(A.NormalZ, B.NormalZ)
+                && BitwiseEqual(A.U, B.U) && BitwiseEqual(A.V, B.V)
+                && A.MaterialIndex == B.MaterialIndex;
+            if (!bSame)
+            {
+                return "converted vertices";
+            }
+        }
+        if (ExpectedIndices.Num() != Actual.Indices.Num()
+            || (ExpectedIndices.Num() > 0 && std::memcmp(ExpectedIndices.GetData(), Actual.Indices.GetData(), sizeof(uint32) * ExpectedIndices.Num()) != 0))
+        {
+            return "converted indices";
+        }
+
+        FVector ExpectedMin;
+        FVector ExpectedMax;
+        FLoaderOBJ::ComputeBoundingBox(ExpectedVertices, ExpectedMin, ExpectedMax);
+        if (ExpectedVertices.Num() > 0 && (ExpectedMin != Actual.BoundingBoxMin || ExpectedMax != Actual.BoundingBoxMax))
+        {
+            return "bounds";
+        }
+        return nullptr;
+    }
+
+    /** 에셋에는 없는 표기를 다루는 작은 OBJ 파일들 */
+    struct FSyntheticObj
+    {
+        const ANSICHAR* FileName;
+        const ANSICHAR* Content;
+    };
+
+    constexpr FSyntheticObj SyntheticObjs[] =
+    {
+        { "Exponents.obj",
+            "v 1e-3 -2.5E+2 3.0e0\nv +1.5 .5 -0.\nv 123456789 0.000001 1e-38\nv 3.4028234e38 -7.006e-6 0.1\n"
+            "vt 0.25 1e-1\nvt 0.333333343 0.666666687\nvn 0 1 0\nvn 0.577350259 -0.577350259 0.577350259\n"
+            "f 1/1/1 2/2/2 3/1/1\nf 2/2/2 3/1/1 4/2/2\n" },
+        { "TabsAndCRLF.obj",
+            "# comment\r\n\r\nv\t1\t2\t3\r\nv  4 5  6\r\nv 7 8 9 \r\nvn 0 0 1\r\nf 1//1\t2//1 3//1\r\n" },
+        { "QuadsAndGroups.obj",
+            "mtllib Golden.mtl\no Box\nv 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0 0 1\n"
+            "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n"
+            "g Side\nusemtl Red\nf 1/1 2/2 3/3 4/4\nusemtl Green\nf 1 2 3\n"
+            "g Top\nusemtl Blue\nf 1/1 2/2 3/3 4/4 5/1\nf 4/4 3/3 2/2\n" },
+        { "PositionsOnly.obj",
+            "v 0 0 0\nv 1 0 0\nv 0 1 0\nv 1 1 0\nf 1 2 3\nf 2 4 3\nf 1 2 3\n" },
+        { "Empty.obj", "" },
+    };
+
+    /** Contents와 Assets의 OBJ 파일, 테스트는 작업 디렉터리가 프로젝트 폴더라고 가정합니다. */
+    void CollectAssetObjFiles(TArray<FString>& OutPaths)
+    {
+        for (const ANSICHAR* Directory : { "Contents", "Assets" })
+        {
+            std::error_code ec;
+            for (std::filesystem::recursive_directory_iterator It(Directory, ec), End; !ec && It != End; It.increment(ec))
+            {
+                if (It->is_regular_file() && It->path().extension() == ".obj")
+                {
+                    OutPaths.Add(FString(It->path().generic_string()));
+                }
+            }
+        }
+    }
+
+    /** 임시 폴더에 합성 OBJ 파일을 씁니다. */
+    void WriteSyntheticObjFiles(TArray<FString>& OutPaths)
+    {
+        const std::filesystem::path Directory = std::filesystem::temp_directory_path() / "SharkryLoaderOBJTest";
+        std::filesystem::create_directories(Directory);
+        for (const FSyntheticObj& Obj : SyntheticObjs)
+        {
+            const std::filesystem::path Path = Directory / Obj.FileName;
+            std::ofstream File(Path, std::ios::binary);
+            File << Obj.Content;
+            OutPaths.Add(FString(Path.generic_string()));
+        }
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FLoaderOBJGoldenTest, "Engine.LoaderOBJ.MatchesReferenceParser", EAutomationTestType::Unit)
+{
+    TArray<FString> AssetPaths;
+    CollectAssetObjFiles(AssetPaths);
+    TestTrue("OBJ files found in Contents and Assets", AssetPaths.Num() > 0);
+
+    TArray<FString> Paths = AssetPaths;
+    WriteSyntheticObjFiles(Paths);
+
+    int32 NumParsed = 0;
+    int32 NumMismatches = 0;
+    for (const FString& Path : Paths)
+    {
+        FObjInfo Expected;
+        FObjInfo Actual;
+        const bool bExpectedParsed = ReferenceParseOBJ(Path, Expected);
+        const bool bActualParsed = FLoaderOBJ::ParseOBJ(Path, Actual);
+
+        const ANSICHAR* Mismatch = bExpectedParsed != bActualParsed ? "parse result" : FindObjInfoMismatch(Expected, Actual);
+        NumParsed += bActualParsed ? 1 : 0;
+        if (!Mismatch && bExpectedParsed)
+        {
+            TArray<FStaticMeshVertex> ExpectedVertices;
+            TArray<uint32> ExpectedIndices;
+            ReferenceConvertToStaticMesh(Expected, MakeTestSubsets(Expected), ExpectedVertices, ExpectedIndices);
+
+            OBJ::FStaticMeshRenderData Converted = {};
+            Converted.MaterialSubsets = MakeTestSubsets(Actual);
+            FLoaderOBJ::ConvertToStaticMesh(Actual, Converted);
+            Mismatch = FindConvertedMismatch(ExpectedVertices, ExpectedIndices, Converted);
+        }
+
+        if (Mismatch)
+        {
+            AddError(FString::Printf(TEXT("%s: %s differ from the reference parser"), *Path, Mismatch));
+            ++NumMismatches;
+        }
+    }
+
+    AddInfo(FString::Printf(TEXT("%d files compared (%d from Contents and Assets)"), Paths.Num(), AssetPaths.Num()));
+    TestEqual("Files parsed", NumParsed, Paths.Num());
+    TestEqual("Files that differ from the reference parser", NumMismatches, 0);
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FLoaderOBJBenchmark, "Engine.LoaderOBJ.ParseSpeed", EAutomationTestType::Benchmark)
+{
+    TArray<FString> Paths;
+    CollectAssetObjFiles(Paths);
+
+    // 파일은 OS Cache에 올라간 상태에서 Parse와 Convert만 잽니다.
+    for (const FString& Path : Paths)
+    {
+        FObjInfo Warmup;
+        FLoaderOBJ::ParseOBJ(Path, Warmup);
+    }
+
+    double ReferenceMs = 0.0;
+    double CurrentMs = 0.0;
+    uint64 NumIndices = 0;
+    for (const FString& Path : Paths)
+    {
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        {
+            FObjInfo RawData;
+            TArray<FStaticMeshVertex> Vertices;
+            TArray<uint32> Indices;
+            ReferenceParseOBJ(Path, RawData);
+            ReferenceConvertToStaticMesh(RawData, RawData.MaterialSubsets, Vertices, Indices);
+        }
+        ReferenceMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        StartCycles = FPlatformTime::Cycles64();
+        {
+            FObjInfo RawData;
+            OBJ::FStaticMeshRenderData Converted = {};
+            FLoaderOBJ::ParseOBJ(Path, RawData);
+            Converted.MaterialSubsets = RawData.MaterialSubsets;
+            FLoaderOBJ::ConvertToStaticMesh(RawData, Converted);
+            NumIndices += Converted.Indices.Num();
+        }
+        CurrentMs += FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    }
+
+    AddInfo(FString::Printf(TEXT("%d files, %llu indices"), Paths.Num(), NumIndices));
+    AddInfo(FString::Printf(TEXT("Reference parse + convert (no tangents): %.3f ms"), ReferenceMs));
+    AddInfo(FString::Printf(TEXT("FLoaderOBJ parse + convert:              %.3f ms"), CurrentMs));
+    return true;
+}
@@ -0,0 +1,483 @@
+#include "Misc/AutomationTest.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include "WindowsPlatformTime.h"
+#include "Engine/FLoaderOBJ.h"
+#include "Serialization/Serializer.h"
+
+namespace
+{
+    /** 실행마다 같은 Mesh가 나오도록 하는 간단한 난수 */
+    struct FTestRandom
+    {
+        uint32 State = 12345u;
+
+        uint32 Next()
+        {
+            State = State * 1664525u + 1013904223u;
+            return State >> 8;
+        }
+
+        float Range(float Min, float Max)
+        {
+            return Min + (Max - Min) * static_cast<float>(Next() & 0xFFFF) / 65535.f;
+        }
+    };
+
+    /** user-020 이전의 std::ofstream 기반 SaveStaticMeshToBinary, 읽기 시간을 비교하는 기준으로만 사용합니다. */
+    bool ReferenceSaveStaticMesh(const FWString& FilePath, const OBJ::FStaticMeshRenderData& StaticMesh)
+    {
+        std::ofstream File(std::filesystem::path(FilePath), std::ios::binary);
+        if (!File.is_open())
+        {
+            return false;
+        }
+
+        Serializer::WriteFWString(File, StaticMesh.ObjectName);
+        Serializer::WriteFString(File, StaticMesh.DisplayName);
+
+        uint32 VertexCount = StaticMesh.Vertices.Num();
+        File.write(reinterpret_cast<const char*>(&VertexCount), sizeof(VertexCount));
+        File.write(reinterpret_cast<const char*>(StaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
+
+        uint32 IndexCount = StaticMesh.Indices.Num();
+        File.write(reinterpret_cast<const char*>(&IndexCount), sizeof(IndexCount));
+        File.write(reinterpret_cast<const char*>(StaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
+
+        uint32 MaterialCount = StaticMesh.Materials.Num();
+        File.write(reinterpret_cast<const char*>(&MaterialCount), sizeof(MaterialCount));
+        for (const FObjMaterialInfo& Material : StaticMesh.Materials)
+        {
+            Serializer::WriteFString(File, Material.MaterialName);
+            File.write(reinterpret_cast<const char*>(&Material.TextureFlag), sizeof(Material.TextureFlag));
+            File.write(reinterpret_cast<const char*>(&Material.bTransparent), sizeof(Material.bTransparent));
+            File.write(reinterpret_cast<const char*>(&Material.Diffuse), sizeof(Material.Diffuse));
+            File.write(reinterpret_cast<const char*>(&Material.Specular), sizeof(Material.Specular));
+            File.write(reinterpret_cast<const char*>(&Material.Ambient), sizeof(Material.Ambient));
+            File.write(reinterpret_cast<const char*>(&Material.Emissive), sizeof(Material.Emissive));
+            File.write(reinterpret_cast<const char*>(&Material.SpecularScalar), sizeof(Material.SpecularScalar));
+            File.write(reinterpret_cast<const char*>(&Material.DensityScalar), sizeof(Material.DensityScalar));
+            File.write(reinterpret_cast<const char*>(&Material.TransparencyScalar), sizeof(Material.TransparencyScalar));
+            File.write(reinterpret_cast<const char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
+            Serializer::WriteFString(File, Material.DiffuseTextureName);
+            Serializer::WriteFWString(File, Material.DiffuseTexturePath);
+            Serializer::WriteFString(File, Material.AmbientTextureName);
+            Serializer::WriteFWString(File, Material.AmbientTexturePath);
+            Serializer::WriteFString(File, Material.SpecularTextureName);
+            Serializer::WriteFWString(File, Material.SpecularTexturePath);
+            Serializer::WriteFString(File, Material.BumpTextureName);
+            Serializer::WriteFWString(File, Material.BumpTexturePath);
+            Serializer::WriteFString(File, Material.AlphaTextureName);
+            Serializer::WriteFWString(File, Material.AlphaTexturePath);
+        }
+
+        uint32 SubsetCount = StaticMesh.MaterialSubsets.Num();
+        File.write(reinterpret_cast<const char*>(&SubsetCount), sizeof(SubsetCount));
+        for (const FMaterialSubset& Subset : StaticMesh.MaterialSubsets)
+        {
+            Serializer::WriteFString(File, Subset.MaterialName);
+            File.write(reinterpret_cast<const char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
+            File.write(reinterpret_cast<const char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
+            File.write(reinterpret_cast<const char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
+        }
+
+        File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMin), sizeof(FVector));
+        File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMax), sizeof(FVector));
+        return File.good();
+    }
+
+    /** user-020 이전의 std::ifstream 기반 LoadStaticMeshFromBinary */
+    bool ReferenceLoadStaticMesh(const FWString& FilePath, OBJ::FStaticMeshRenderData& OutStaticMesh)
+    {
+        std::ifstream File(std::filesystem::path(FilePath), std::ios::binary);
+        if (!File.is_open())
+        {
+            return false;
+        }
+
+        Serializer::ReadFWString(File, OutStaticMesh.ObjectName);
+        Serializer::ReadFString(File, OutStaticMesh.DisplayName);
+
+        uint32 VertexCount = 0;
+        File.read(reinterpret_cast<char*>(&VertexCount), sizeof(VertexCount));
+        OutStaticMesh.Vertices.SetNum(VertexCount);
+        File.read(reinterpret_cast<char*>(OutStaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
+
+        uint32 IndexCount = 0;
+        File.read(reinterpret_cast<char*>(&IndexCount), sizeof(IndexCount));
+        OutStaticMesh.Indices.SetNum(IndexCount);
+        File.read(reinterpret_cast<char*>(OutStaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
+
+        uint32 MaterialCount = 0;
+        File.read(reinterpret_cast<char*>(&MaterialCount), sizeof(MaterialCount));
+        OutStaticMesh.Materials.SetNum(MaterialCount);
+        for (FObjMaterialInfo& Material : OutStaticMesh.Materials)
+        {
+            Serializer::ReadFString(File, Material.MaterialName);
+            File.read(reinterpret_cast<char*>(&Material.TextureFlag), sizeof(Material.TextureFlag));
+            File.read(reinterpret_cast<char*>(&Material.bTransparent), sizeof(Material.bTransparent));
+            File.read(reinterpret_cast<char*>(&Material.Diffuse), sizeof(Material.Diffuse));
+            File.read(reinterpret_cast<char*>(&Material.Specular), sizeof(Material.Specular));
+            File.read(reinterpret_cast<char*>(&Material.Ambient), sizeof(Material.Ambient));
+            File.read(reinterpret_cast<char*>(&Material.Emissive), sizeof(Material.Emissive));
+            File.read(reinterpret_cast<char*>(&Material.SpecularScalar), sizeof(Material.SpecularScalar));
+            File.read(reinterpret_cast<char*>(&Material.DensityScalar), sizeof(Material.DensityScalar));
+            File.read(reinterpret_cast<char*>(&Material.TransparencyScalar), sizeof(Material.TransparencyScalar));
+            File.read(reinterpret_cast<char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
+            Serializer::ReadFString(File, Material.DiffuseTextureName);
+            Serializer::ReadFWString(File, Material.DiffuseTexturePath);
+            Serializer::ReadFString(File, Material.AmbientTextureName);
+            Serializer::ReadFWString(File, Material.AmbientTexturePath);
+            Serializer::ReadFString(File, Material.SpecularTextureName);
+            Serializer::ReadFWString(File, Material.SpecularTexturePath);
+            Serializer::ReadFString(File, Material.BumpTextureName);
+            Serializer::ReadFWString(File, Material.BumpTexturePath);
+            Serializer::ReadFString(File, Material.AlphaTextureName);
+            Serializer::ReadFWString(File, Material.AlphaTexturePath);
+        }
+
+        uint32 SubsetCount = 0;
+        File.read(reinterpret_cast<char*>(&SubsetCount), sizeof(SubsetCount));
+        OutStaticMesh.MaterialSubsets.SetNum(SubsetCount);
+        for (FMaterialSubset& Subset : OutStaticMesh.MaterialSubsets)
+        {
+            Serializer::ReadFString(File, Subset.MaterialName);
+            File.read(reinterpret_cast<char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
+            File.read(reinterpret_cast<char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
+            File.read(reinterpret_cast<char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
+        }
+
+        File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMin), sizeof(FVector));
+        File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMax), sizeof(FVector));
+        return File.good();
+    }
+
+    /** Material마다 Index를 같은 수로 나눈 Subset과, 절반만 남긴 LOD 하나를 가진 Mesh를 만듭니다. */
+    OBJ::FStaticMeshRenderData MakeTestMesh(int32 NumVertices, int32 NumTriangles, int32 NumMaterials, FTestRandom& Random)
+    {
+        OBJ::FStaticMeshRenderData Mesh = {};
+        Mesh.ObjectName = L"Contents/TestMesh.obj";
+        Mesh.DisplayName = FString("TestMesh");
+
+        for (int32 Index = 0; Index < NumVertices; ++Index)
+        {
+            FStaticMeshVertex Vertex = {};
+            Vertex.X = Random.Range(-10.f, 10.f);
+            Vertex.Y = Random.Range(-10.f, 10.f);
+            Vertex.Z = Random.Range(-10.f, 10.f);
+            Vertex.R = Random.Range(0.f, 1.f);
+            Vertex.G = Random.Range(0.f, 1.f);
+            Vertex.B = Random.Range(0.f, 1.f);
+            Vertex.A = 1.f;
+            Vertex.NormalX = Random.Range(-1.f, 1.f);
+            Vertex.NormalY = Random.Range(-1.f, 1.f);
+            Vertex.NormalZ = Random.Range(-1.f, 1.f);
+            Vertex.TangentX = Random.Range(-1.f, 1.f);
+            Vertex.TangentY = Random.Range(-1.f, 1.f);
+            Vertex.TangentZ = Random.Range(-1.f, 1.f);
+            Vertex.U = Random.Range(0.f, 1.f);
+            Vertex.V = Random.Range(0.f, 1.f);
+            Vertex.MaterialIndex = NumMaterials > 0 ? Random.Next() % NumMaterials : 0;
+            Mesh.Vertices.Add(Vertex);
+        }
+
+        for (int32 Index = 0; Index < NumTriangles * 3; ++Index)
+        {
+            Mesh.Indices.Add(NumVertices > 0 ? Random.Next() % NumVertices : 0);
+        }
+
+        OBJ::FStaticMeshLODData LOD;
+        LOD.Error = 0.01f;
+        LOD.ScreenSize = 0.25f;
+
+        const uint32 NumIndicesPerMaterial = NumMaterials > 0 ? static_cast<uint32>(NumTriangles / NumMaterials) * 3 : 0;
+        for (int32 MaterialIndex = 0; MaterialIndex < NumMaterials; ++MaterialIndex)
+        {
+            FObjMaterialInfo Material;
+            Material.MaterialName = FString::Printf(TEXT("Material%d"), MaterialIndex);
+            Material.TextureFlag = MaterialIndex;
+            Material.bTransparent = MaterialIndex % 2 == 1;
+            Material.Diffuse = FVector(Random.Range(0.f, 1.f), Random.Range(0.f, 1.f), Random.Range(0.f, 1.f));
+            Material.DensityScalar = 1.f;
+            Material.TransparencyScalar = Random.Range(0.f, 1.f);
+            Material.BumpMultiplier = 1.f;
+            Material.IlluminanceModel = 2;
+            Material.DiffuseTextureName = FString::Printf(TEXT("Diffuse%d.png"), MaterialIndex);
+            Material.DiffuseTexturePath = L"Contents/Textures/Diffuse" + std::to_wstring(MaterialIndex) + L".png";
+            Mesh.Materials.Add(Material);
+
+            FMaterialSubset Subset;
+            Subset.MaterialName = Material.MaterialName;
+            Subset.IndexStart = MaterialIndex * NumIndicesPerMaterial;
+            Subset.IndexCount = NumIndicesPerMaterial;
+            Subset.MaterialIndex = MaterialIndex;
+            Mesh.MaterialSubsets.Add(Subset);
+
+            FMaterialSubset LODSubset = Subset;
+            LODSubset.IndexStart = LOD.Indices.Num();
+            LODSubset.IndexCount = NumIndicesPerMaterial / 6 * 3;
+            for (uint32 Index = 0; Index < LODSubset.IndexCount; ++Index)
+            {
+                LOD.Indices.Add(Mesh.Indices[Subset.IndexStart + Index]);
+            }
+            LOD.MaterialSubsets.Add(LODSubset);
+        }
+        if (NumMaterials > 0)
+        {
+            Mesh.LODs.Add(LOD);
+        }
+
+        Mesh.BoundingBoxMin = FVector(-10.f, -10.f, -10.f);
+        Mesh.BoundingBoxMax = FVector(10.f, 10.f, 10.f);
+        return Mesh;
+    }
+
+    template <typename ElementType>
+    bool BitwiseEqual(const TArray<ElementType>& A, const TArray<ElementType>& B)
+    {
+        return A.Num() == B.Num() && (A.Num() == 0 || std::memcmp(A.GetData(), B.GetData(), sizeof(ElementType) * A.Num()) == 0);
+    }
+
+    bool IsSameSubsets(const TArray<FMaterialSubset>& A, const TArray<FMaterialSubset>& B)
+    {
+        if (A.Num() != B.Num())
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < A.Num(); ++Index)
+        {
+            if (A[Index].MaterialName != B[Index].MaterialName || A[Index].IndexStart != B[Index].IndexStart
+                || A[Index].IndexCount != B[Index].IndexCount || A[Index].MaterialIndex != B[Index].MaterialIndex)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool IsSameMesh(const OBJ::FStaticMeshRenderData& A, const OBJ::FStaticMeshRenderData& B)
+    {
+        if (A.ObjectName != B.ObjectName || A.DisplayName != B.DisplayName
+            || !BitwiseEqual(A.Vertices, B.Vertices) || !BitwiseEqual(A.Indices, B.Indices)
+            || !IsSameSubsets(A.MaterialSubsets, B.MaterialSubsets)
+            || A.BoundingBoxMin != B.BoundingBoxMin || A.BoundingBoxMax != B.BoundingBoxMax
+            || A.Materials.Num() != B.Materials.Num() || A.LODs.Num() != B.LODs.Num())
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < A.Materials.Num(); ++Index)
+        {
+            const FObjMaterialInfo& MaterialA = A.Materials[Index];
+            const FObjMaterialInfo& MaterialB = B.Materials[Index];
+            if (MaterialA.MaterialName != MaterialB.MaterialName || MaterialA.TextureFlag != MaterialB.TextureFlag
+                || MaterialA.bTransparent != MaterialB.bTransparent || MaterialA.Diffuse != MaterialB.Diffuse
+                || MaterialA.TransparencyScalar != MaterialB.TransparencyScalar || MaterialA.IlluminanceModel != MaterialB.IlluminanceModel
+                || MaterialA.DiffuseTextureName != MaterialB.DiffuseTextureName || MaterialA.DiffuseTexturePath != MaterialB.DiffuseTexturePath)
+            {
+                return false;
+            }
+        }
+        for (int32 Index = 0; Index < A.LODs.Num(); ++Index)
+        {
+            const OBJ::FStaticMeshLODData& LODA = A.LODs[Index];
+            const OBJ::FStaticMeshLODData& LODB = B.LODs[Index];
+            if (!BitwiseEqual(LODA.Indices, LODB.Indices) || !IsSameSubsets(LODA.MaterialSubsets, LODB.MaterialSubsets)
+                || LODA.Error != LODB.Error || LODA.ScreenSize != LODB.ScreenSize)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** 파일의 한 Byte를 뒤집습니다. 같은 Offset으로 한 번 더 호출하면 원래대로 돌아옵니다. */
+    void FlipByte(const std::filesystem::path& Path, uint64 Offset)
+    {
+        std::fstream File(Path, std::ios::in | std::ios::out | std::ios::binary);
+        File.seekg(static_cast<std::streamoff>(Offset));
+        char Byte = 0;
+        File.read(&Byte, 1);
+        Byte ^= 0x10;
+        File.seekp(static_cast<std::streamoff>(Offset));
+        File.write(&Byte, 1);
+    }
+
+    /**
+     * 파일을 OS File Cache에서 내립니다.
+     * 다른 Handle이 없을 때 FILE_FLAG_NO_BUFFERING으로 열면 Cache Manager가 그 파일의 Cache를 비웁니다.
+     */
+    void EvictFromFileCache(const FWString& FilePath)
+    {
+        HANDLE File = CreateFileW(FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_NO_BUFFERING, nullptr);
+        if (File != INVALID_HANDLE_VALUE)
+        {
+            CloseHandle(File);
+        }
+    }
+
+    std::filesystem::path GetTestDirectory()
+    {
+        const std::filesystem::path Directory = std::filesystem::temp_directory_path() / "SharkryStaticMeshBinaryTest";
+        std::filesystem::create_directories(Directory);
+        return Directory;
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FStaticMeshBinaryRoundTripTest, "Engine.StaticMeshBinary.RoundTrip", EAutomationTestType::Unit)
+{
+    const std::filesystem::path Directory = GetTestDirectory();
+    const FWString FilePath = (Directory / "RoundTrip.bin").wstring();
+    FTestRandom Random;
+
+    // Material이 없거나 정점이 없는 Mesh도 그대로 돌아와야 합니다.
+    int32 NumMismatches = 0;
+    for (int32 Case = 0; Case < 16; ++Case)
+    {
+        const OBJ::FStaticMeshRenderData Mesh = MakeTestMesh(Case * 37, Case * 50, Case % 4, Random);
+        OBJ::FStaticMeshRenderData Loaded = {};
+        if (!FManagerOBJ::SaveStaticMeshToBinary(FilePath, Mesh) || !FManagerOBJ::LoadStaticMeshFromBinary(FilePath, Loaded) || !IsSameMesh(Mesh, Loaded))
+        {
+            AddError(FString::Printf(TEXT("Case %d did not round trip"), Case));
+            ++NumMismatches;
+        }
+    }
+    TestEqual("Meshes that did not round trip", NumMismatches, 0);
+
+    // Header, Section Table, Vertex, Index 중 어디가 바뀌어도 Cache를 버리고 다시 만들어야 합니다.
+    // Vertex가 파일의 대부분이고 Index가 그 뒤에 이어지므로, 파일의 1/3, 1/2은 Vertex, 7/8은 Index 안쪽입니다.
+    const OBJ::FStaticMeshRenderData Mesh = MakeTestMesh(1000, 1000, 3, Random);
+    FManagerOBJ::SaveStaticMeshToBinary(FilePath, Mesh);
+    const uint64 FileSize = std::filesystem::file_size(Directory / "RoundTrip.bin");
+
+    int32 NumAccepted = 0;
+    for (const uint64 Offset : { uint64(0), uint64(4), uint64(8), uint64(40), uint64(80), uint64(120), FileSize / 3, FileSize / 2, FileSize / 8 * 7 })
+    {
+        FlipByte(Directory / "RoundTrip.bin", Offset);
+        OBJ::FStaticMeshRenderData Loaded = {};
+        if (FManagerOBJ::LoadStaticMeshFromBinary(FilePath, Loaded))
+        {
+            AddError(FString::Printf(TEXT("A flipped byte at offset %llu was accepted"), Offset));
+            ++NumAccepted;
+        }
+        FlipByte(Directory / "RoundTrip.bin", Offset);
+    }
+    TestEqual("Corrupted caches accepted", NumAccepted, 0);
+
+    OBJ::FStaticMeshRenderData Restored = {};
+    TestTrue("Restored cache loads", FManagerOBJ::LoadStaticMeshFromBinary(FilePath, Restored) && IsSameMesh(Mesh, Restored));
+
+    std::filesystem::resize_file(Directory / "RoundTrip.bin", FileSize - 16);
+    OBJ::FStaticMeshRenderData Truncated = {};
+    TestFalse("Truncated cache accepted", FManagerOBJ::LoadStaticMeshFromBinary(FilePath, Truncated));
+
+    // 이전 형식으로 쓰인 Cache도 오래된 Cache로 보고 버려야 합니다.
+    ReferenceSaveStaticMesh(FilePath, Mesh);
+    OBJ::FStaticMeshRenderData Stale = {};
+    TestFalse("Cache in the previous format accepted", FManagerOBJ::LoadStaticMeshFromBinary(FilePath, Stale));
+
+    std::filesystem::remove(Directory / "RoundTrip.bin");
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FStaticMeshBinaryLoadBenchmark, "Engine.StaticMeshBinary.LoadTime", EAutomationTestType::Benchmark)
+{
+    constexpr int32 NumRuns = 5;
+
+    const std::filesystem::path Directory = GetTestDirectory();
+
+    // Contents의 Mesh 전체와, 큰 Mesh 하나를 따로 잽니다.
+    TArray<OBJ::FStaticMeshRenderData> ContentMeshes;
+    std::error_code ec;
+    for (std::filesystem::recursive_directory_iterator It("Contents", ec), End; !ec && It != End; It.increment(ec))
+    {
+        if (It->is_regular_file() && It->path().extension() == ".obj")
+        {
+            FObjInfo RawData;
+            if (FLoaderOBJ::ParseOBJ(FString(It->path().generic_string()), RawData))
+            {
+                OBJ::FStaticMeshRenderData& Mesh = ContentMeshes[ContentMeshes.Add(OBJ::FStaticMeshRenderData())];
+                Mesh.MaterialSubsets = RawData.MaterialSubsets;
+                FLoaderOBJ::ConvertToStaticMesh(RawData, Mesh);
+            }
+        }
+    }
+
+    FTestRandom Random;
+    TArray<OBJ::FStaticMeshRenderData> LargeMeshes;
+    LargeMeshes.Add(MakeTestMesh(400000, 400000, 8, Random));
+
+    const auto RunCase = [this, &Directory](const ANSICHAR* CaseName, const TArray<OBJ::FStaticMeshRenderData>& Meshes)
+    {
+        TArray<FWString> ReferencePaths;
+        TArray<FWString> CookedPaths;
+        uint64 ReferenceBytes = 0;
+        uint64 CookedBytes = 0;
+        for (int32 Index = 0; Index < Meshes.Num(); ++Index)
+        {
+            const std::filesystem::path ReferencePath = Directory / ("Reference" + std::to_string(Index) + ".bin");
+            const std::filesystem::path CookedPath = Directory / ("Cooked" + std::to_string(Index) + ".bin");
+            ReferenceSaveStaticMesh(ReferencePath.wstring(), Meshes[Index]);
+            FManagerOBJ::SaveStaticMeshToBinary(CookedPath.wstring(), Meshes[Index]);
+            ReferencePaths.Add(ReferencePath.wstring());
+            CookedPaths.Add(CookedPath.wstring());
+            ReferenceBytes += std::filesystem::file_size(ReferencePath);
+            CookedBytes += std::filesystem::file_size(CookedPath);
+        }
+
+        int32 NumFailed = 0;
+        const auto Measure = [&NumFailed](const TArray<FWString>& Paths, bool bCold, auto&& Load)
+        {
+            double BestMs = 0.0;
+            for (int32 Run = 0; Run < NumRuns; ++Run)
+            {
+                if (bCold)
+                {
+                    for (const FWString& Path : Paths)
+                    {
+                        EvictFromFileCache(Path);
+                    }
+                }
+
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                for (const FWString& Path : Paths)
+                {
+                    OBJ::FStaticMeshRenderData Loaded = {};
+                    NumFailed += Load(Path, Loaded) ? 0 : 1;
+                }
+                const double Ms = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+                BestMs = Run == 0 ? Ms : std::min(BestMs, Ms);
+            }
+            return BestMs;
+        };
+
+        const double ReferenceWarmMs = Measure(ReferencePaths, false, ReferenceLoadStaticMesh);
+        const double CookedWarmMs = Measure(CookedPaths, false, FManagerOBJ::LoadStaticMeshFromBinary);
+        const double ReferenceColdMs = Measure(ReferencePaths, true, ReferenceLoadStaticMesh);
+        const double CookedColdMs = Measure(CookedPaths, true, FManagerOBJ::LoadStaticMeshFromBinary);
+
+        int32 NumMismatches = 0;
+        for (int32 Index = 0; Index < Meshes.Num(); ++Index)
+        {
+            OBJ::FStaticMeshRenderData Loaded = {};
+            FManagerOBJ::LoadStaticMeshFromBinary(CookedPaths[Index], Loaded);
+            NumMismatches += IsSameMesh(Meshes[Index], Loaded) ? 0 : 1;
+            std::filesystem::remove(ReferencePaths[Index]);
+            std::filesystem::remove(CookedPaths[Index]);
+        }
+        TestEqual("Failed loads", NumFailed, 0);
+        TestEqual("Cooked meshes that differ from the source", NumMismatches, 0);
+
+        AddInfo(FString::Printf(TEXT("%s: %d meshes, %llu KB before, %llu KB cooked"), CaseName, Meshes.Num(), ReferenceBytes / 1024, CookedBytes / 1024));
+        AddInfo(FString::Printf(TEXT("%s: warm %.3f ms before, %.3f ms cooked"), CaseName, ReferenceWarmMs, CookedWarmMs));
+        AddInfo(FString::Printf(TEXT("%s: cold %.3f ms before, %.3f ms cooked"), CaseName, ReferenceColdMs, CookedColdMs));
+    };
+
+    TestTrue("OBJ files found in Contents", ContentMeshes.Num() > 0);
+    RunCase("Contents", ContentMeshes);
+    RunCase("400k vertices", LargeMeshes);
+    return true;
+}
@@ -0,0 +1,431 @@
+#include "Misc/AutomationTest.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include "WindowsPlatformTime.h"
+#include "Define.h"
+#include "Engine/FLoaderOBJ.h"
+#include "Engine/StaticMeshSimplifier.h"
+
+namespace
+{
+    /** 점에서 Triangle ABC까지 가장 가까운 거리의 제곱, Triangle의 영역(Vertex, Edge, 면)을 나눠서 구합니다. */
+    float PointTriangleDistanceSquared(const FVector& P, const FVector& A, const FVector& B, const FVector& C)
+    {
+        const FVector AB = B - A;
+        const FVector AC = C - A;
+        const FVector AP = P - A;
+        const float D1 = AB.Dot(AP);
+        const float D2 = AC.Dot(AP);
+        if (D1 <= 0.f && D2 <= 0.f)
+        {
+            return AP.SizeSquared();
+        }
+
+        const FVector BP = P - B;
+        const float D3 = AB.Dot(BP);
+        const float D4 = AC.Dot(BP);
+        if (D3 >= 0.f && D4 <= D3)
+        {
+            return BP.SizeSquared();
+        }
+
+        const float VC = D1 * D4 - D3 * D2;
+        if (VC <= 0.f && D1 >= 0.f && D3 <= 0.f)
+        {
+            return (AP - AB * (D1 / (D1 - D3))).SizeSquared();
+        }
+
+        const FVector CP = P - C;
+        const float D5 = AB.Dot(CP);
+        const float D6 = AC.Dot(CP);
+        if (D6 >= 0.f && D5 <= D6)
+        {
+            return CP.SizeSquared();
+        }
+
+        const float VB = D5 * D2 - D1 * D6;
+        if (VB <= 0.f && D2 >= 0.f && D6 <= 0.f)
+        {
+            return (AP - AC * (D2 / (D2 - D6))).SizeSquared();
+        }
+
+        const float VA = D3 * D6 - D5 * D4;
+        if (VA <= 0.f && D4 - D3 >= 0.f && D5 - D6 >= 0.f)
+        {
+            return (BP - (C - B) * ((D4 - D3) / ((D4 - D3) + (D5 - D6)))).SizeSquared();
+        }
+
+        const float Denominator = 1.f / (VA + VB + VC);
+        return (AP - AB * (VB * Denominator) - AC * (VC * Denominator)).SizeSquared();
+    }
+
+    FVector GetPosition(const OBJ::FStaticMeshRenderData& Mesh, uint32 VertexIndex)
+    {
+        const FStaticMeshVertex& Vertex = Mesh.Vertices[VertexIndex];
+        return FVector(Vertex.X, Vertex.Y, Vertex.Z);
+    }
+
+    float DistanceToSurface(const OBJ::FStaticMeshRenderData& Mesh, const TArray<UINT>& Indices, const FVector& Point)
+    {
+        float MinDistanceSquared = FLT_MAX;
+        for (int32 Index = 0; Index + 2 < Indices.Num(); Index += 3)
+        {
+            MinDistanceSquared = std::min(MinDistanceSquared,
+                PointTriangleDistanceSquared(Point, GetPosition(Mesh, Indices[Index]), GetPosition(Mesh, Indices[Index + 1]), GetPosition(Mesh, Indices[Index + 2])));
+        }
+        return std::sqrt(MinDistanceSquared);
+    }
+
+    /** FStaticMeshSimplifier와 같이 Bounds 반지름을 오차의 단위로 씁니다. */
+    float GetBoundsRadius(const OBJ::FStaticMeshRenderData& Mesh)
+    {
+        return ((Mesh.BoundingBoxMax - Mesh.BoundingBoxMin) * 0.5f).Length();
+    }
+
+    /**
+     * LOD 0과 LOD 표면 사이의 거리를 양방향으로 재서, Bounds 반지름에 대한 비율로 반환합니다.
+     * LOD 0의 Vertex에서 LOD까지, LOD Triangle의 중심에서 LOD 0까지 거리를 재고, MaxSamples개보다 많다면 고르게 건너뜁니다.
+     */
+    void MeasureLODError(const OBJ::FStaticMeshRenderData& Mesh, const OBJ::FStaticMeshLODData& LOD, int32 MaxSamples, float& OutMaxError, float& OutMeanError)
+    {
+        TArray<uint8> bUsed;
+        bUsed.SetNum(Mesh.Vertices.Num());
+        std::fill(bUsed.GetData(), bUsed.GetData() + bUsed.Num(), static_cast<uint8>(0));
+        for (const UINT Index : Mesh.Indices)
+        {
+            bUsed[Index] = 1;
+        }
+
+        float MaxDistance = 0.f;
+        double SumDistance = 0.0;
+        int32 NumSamples = 0;
+
+        const int32 VertexStep = std::max(1, Mesh.Vertices.Num() / MaxSamples);
+        for (int32 VertexIndex = 0; VertexIndex < Mesh.Vertices.Num(); VertexIndex += VertexStep)
+        {
+            if (bUsed[VertexIndex])
+            {
+                const float Distance = DistanceToSurface(Mesh, LOD.Indices, GetPosition(Mesh, VertexIndex));
+                MaxDistance = std::max(MaxDistance, Distance);
+                SumDistance += Distance;
+                ++NumSamples;
+            }
+        }
+
+        const int32 NumTriangles = LOD.Indices.Num() / 3;
+        const int32 TriangleStep = std::max(1, NumTriangles / MaxSamples);
+        for (int32 Triangle = 0; Triangle < NumTriangles; Triangle += TriangleStep)
+        {
+            const FVector Centroid = (GetPosition(Mesh, LOD.Indices[Triangle * 3]) + GetPosition(Mesh, LOD.Indices[Triangle * 3 + 1]) + GetPosition(Mesh, LOD.Indices[Triangle * 3 + 2])) / 3.f;
+            const float Distance = DistanceToSurface(Mesh, Mesh.Indices, Centroid);
+            MaxDistance = std::max(MaxDistance, Distance);
+            SumDistance += Distance;
+            ++NumSamples;
+        }
+
+        const float Radius = GetBoundsRadius(Mesh);
+        OutMaxError = MaxDistance / Radius;
+        OutMeanError = NumSamples > 0 ? static_cast<float>(SumDistance / NumSamples) / Radius : 0.f;
+    }
+
+    /**
+     * LOD Chain이 FStaticMeshSimplifier가 약속하는 형태인지 확인합니다.
+     * @return 찾은 문제, 없다면 빈 문자열
+     */
+    FString FindLODChainProblem(const OBJ::FStaticMeshRenderData& Mesh)
+    {
+        int32 PreviousNumIndices = Mesh.Indices.Num();
+        float PreviousScreenSize = FLT_MAX;
+        float PreviousError = 0.f;
+        for (int32 LODIndex = 0; LODIndex < Mesh.LODs.Num(); ++LODIndex)
+        {
+            const OBJ::FStaticMeshLODData& LOD = Mesh.LODs[LODIndex];
+            if (LOD.Indices.Num() == 0 || LOD.Indices.Num() % 3 != 0 || LOD.Indices.Num() >= PreviousNumIndices)
+            {
+                return FString::Printf(TEXT("LOD %d has %d indices after %d"), LODIndex + 1, LOD.Indices.Num(), PreviousNumIndices);
+            }
+            if (LOD.ScreenSize >= PreviousScreenSize || LOD.Error < PreviousError)
+            {
+                return FString::Printf(TEXT("LOD %d screen size %f and error %f do not follow the previous LOD"), LODIndex + 1, LOD.ScreenSize, LOD.Error);
+            }
+            PreviousNumIndices = LOD.Indices.Num();
+            PreviousScreenSize = LOD.ScreenSize;
+            PreviousError = LOD.Error;
+
+            for (int32 Index = 0; Index < LOD.Indices.Num(); Index += 3)
+            {
+                const UINT A = LOD.Indices[Index];
+                const UINT B = LOD.Indices[Index + 1];
+                const UINT C = LOD.Indices[Index + 2];
+                if (A >= static_cast<UINT>(Mesh.Vertices.Num()) || B >= static_cast<UINT>(Mesh.Vertices.Num()) || C >= static_cast<UINT>(Mesh.Vertices.Num()))
+                {
+                    return FString::Printf(TEXT("LOD %d index out of range at %d"), LODIndex + 1, Index);
+                }
+                if (A == B || B == C || A == C)
+                {
+                    return FString::Printf(TEXT("LOD %d has a degenerate triangle at %d"), LODIndex + 1, Index);
+                }
+            }
+
+            // Subset은 LOD 0과 수, 순서, 재질이 같고 LOD의 Index를 빈틈없이 이어서 덮어야 합니다.
+            if (LOD.MaterialSubsets.Num() != Mesh.MaterialSubsets.Num())
+            {
+                return FString::Printf(TEXT("LOD %d has %d subsets, LOD 0 has %d"), LODIndex + 1, LOD.MaterialSubsets.Num(), Mesh.MaterialSubsets.Num());
+            }
+            uint32 NextIndexStart = 0;
+            for (int32 SubsetIndex = 0; SubsetIndex < LOD.MaterialSubsets.Num(); ++SubsetIndex)
+            {
+                const FMaterialSubset& Subset = LOD.MaterialSubsets[SubsetIndex];
+                if (Subset.IndexStart != NextIndexStart || Subset.MaterialIndex != Mesh.MaterialSubsets[SubsetIndex].MaterialIndex)
+                {
+                    return FString::Printf(TEXT("LOD %d subset %d does not continue the previous subset"), LODIndex + 1, SubsetIndex);
+                }
+                NextIndexStart += Subset.IndexCount;
+            }
+            if (LOD.MaterialSubsets.Num() > 0 && NextIndexStart != static_cast<uint32>(LOD.Indices.Num()))
+            {
+                return FString::Printf(TEXT("LOD %d subsets cover %u of %d indices"), LODIndex + 1, NextIndexStart, LOD.Indices.Num());
+            }
+        }
+        return FString();
+    }
+
+    void AddTestVertex(OBJ::FStaticMeshRenderData& Mesh, const FVector& Position, const FVector& Normal, float U, float V)
+    {
+        FStaticMeshVertex Vertex = {};
+        Vertex.X = Position.X;
+        Vertex.Y = Position.Y;
+        Vertex.Z = Position.Z;
+        Vertex.NormalX = Normal.X;
+        Vertex.NormalY = Normal.Y;
+        Vertex.NormalZ = Normal.Z;
+        Vertex.U = U;
+        Vertex.V = V;
+        Mesh.Vertices.Add(Vertex);
+    }
+
+    void AddTestQuad(OBJ::FStaticMeshRenderData& Mesh, UINT A, UINT B, UINT C, UINT D)
+    {
+        for (const UINT Index : { A, B, C, A, C, D })
+        {
+            Mesh.Indices.Add(Index);
+        }
+    }
+
+    void UpdateTestBounds(OBJ::FStaticMeshRenderData& Mesh)
+    {
+        FLoaderOBJ::ComputeBoundingBox(Mesh.Vertices, Mesh.BoundingBoxMin, Mesh.BoundingBoxMax);
+    }
+
+    /** 위도, 경도로 나눈 구, U가 0과 1인 경도에 Seam이 있고 위, 아래 반구가 서로 다른 Subset입니다. */
+    void MakeTestSphere(OBJ::FStaticMeshRenderData& OutMesh, int32 NumRings, int32 NumSegments)
+    {
+        for (int32 Ring = 0; Ring <= NumRings; ++Ring)
+        {
+            const float Theta = PI * Ring / NumRings;
+            for (int32 Segment = 0; Segment <= NumSegments; ++Segment)
+            {
+                const float Phi = 2.f * PI * Segment / NumSegments;
+                const FVector Normal(std::sin(Theta) * std::cos(Phi), std::sin(Theta) * std::sin(Phi), std::cos(Theta));
+                AddTestVertex(OutMesh, Normal * 2.f, Normal, static_cast<float>(Segment) / NumSegments, static_cast<float>(Ring) / NumRings);
+            }
+        }
+
+        for (int32 Half = 0; Half < 2; ++Half)
+        {
+            FMaterialSubset Subset;
+            Subset.IndexStart = OutMesh.Indices.Num();
+            Subset.MaterialIndex = Half;
+            for (int32 Ring = Half * NumRings / 2; Ring < (Half + 1) * NumRings / 2; ++Ring)
+            {
+                for (int32 Segment = 0; Segment < NumSegments; ++Segment)
+                {
+                    const UINT First = Ring * (NumSegments + 1) + Segment;
+                    const UINT Below = First + NumSegments + 1;
+                    if (Ring > 0)
+                    {
+                        for (const UINT Index : { First, Below, First + 1 })
+                        {
+                            OutMesh.Indices.Add(Index);
+                        }
+                    }
+                    if (Ring < NumRings - 1)
+                    {
+                        for (const UINT Index : { First + 1, Below, Below + 1 })
+                        {
+                            OutMesh.Indices.Add(Index);
+                        }
+                    }
+                }
+            }
+            Subset.IndexCount = OutMesh.Indices.Num() - Subset.IndexStart;
+            OutMesh.MaterialSubsets.Add(Subset);
+        }
+        UpdateTestBounds(OutMesh);
+    }
+
+    /** 완만한 높이의 격자, 열린 경계가 있고 Subset이 없습니다. */
+    void MakeTestTerrain(OBJ::FStaticMeshRenderData& OutMesh, int32 NumQuads)
+    {
+        for (int32 Y = 0; Y <= NumQuads; ++Y)
+        {
+            for (int32 X = 0; X <= NumQuads; ++X)
+            {
+                const float PositionX = static_cast<float>(X) / NumQuads * 10.f;
+                const float PositionY = static_cast<float>(Y) / NumQuads * 10.f;
+                const float Height = 0.5f * std::sin(PositionX * 0.6f) * std::cos(PositionY * 0.4f);
+                AddTestVertex(OutMesh, FVector(PositionX, PositionY, Height), FVector(0.f, 0.f, 1.f), static_cast<float>(X) / NumQuads, static_cast<float>(Y) / NumQuads);
+            }
+        }
+        for (int32 Y = 0; Y < NumQuads; ++Y)
+        {
+            for (int32 X = 0; X < NumQuads; ++X)
+            {
+                const UINT First = Y * (NumQuads + 1) + X;
+                AddTestQuad(OutMesh, First, First + 1, First + NumQuads + 2, First + NumQuads + 1);
+            }
+        }
+        UpdateTestBounds(OutMesh);
+    }
+
+    /** Contents의 OBJ 파일, 테스트는 작업 디렉터리가 프로젝트 폴더라고 가정합니다. */
+    void CollectContentObjFiles(TArray<FString>& OutPaths)
+    {
+        std::error_code ec;
+        for (std::filesystem::recursive_directory_iterator It("Contents", ec), End; !ec && It != End; It.increment(ec))
+        {
+            if (It->is_regular_file() && It->path().extension() == ".obj")
+            {
+                OutPaths.Add(FString(It->path().generic_string()));
+            }
+        }
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FStaticMeshSimplifierQualityTest, "Engine.StaticMeshSimplifier.Quality", EAutomationTestType::Unit)
+{
+    constexpr int32 MaxSamples = 4096;
+
+    const FStaticMeshLODSettings Settings;
+
+    struct FTestMesh
+    {
+        const TCHAR* Name;
+        OBJ::FStaticMeshRenderData Mesh = {};
+    };
+    FTestMesh TestMeshes[2] = { { TEXT("Sphere") }, { TEXT("Terrain") } };
+    MakeTestSphere(TestMeshes[0].Mesh, 32, 64);
+    MakeTestTerrain(TestMeshes[1].Mesh, 48);
+
+    for (FTestMesh& TestMesh : TestMeshes)
+    {
+        OBJ::FStaticMeshRenderData& Mesh = TestMesh.Mesh;
+        const int32 NumLODs = FStaticMeshSimplifier::BuildLODs(Mesh, Settings);
+        if (!TestTrue("Builds at least one LOD", NumLODs > 0) || !TestEqual("Returned LOD count", NumLODs, Mesh.LODs.Num()))
+        {
+            AddError(TestMesh.Name);
+            continue;
+        }
+
+        const FString Problem = FindLODChainProblem(Mesh);
+        if (!Problem.IsEmpty())
+        {
+            AddError(FString(TestMesh.Name) + TEXT(": ") + Problem);
+        }
+
+        // 실제로 잰 거리가 설정한 최대 오차를 넘지 않아야 합니다.
+        for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+        {
+            float MaxError = 0.f;
+            float MeanError = 0.f;
+            MeasureLODError(Mesh, Mesh.LODs[LODIndex], MaxSamples, MaxError, MeanError);
+            if (MaxError > Settings.MaxError)
+            {
+                AddError(FString::Printf(TEXT("%s LOD %d: measured error %f is larger than %f"), TestMesh.Name, LODIndex + 1, MaxError, Settings.MaxError));
+            }
+            AddInfo(FString::Printf(TEXT("%s LOD %d: %d of %d triangles, measured max %.4f mean %.5f"),
+                TestMesh.Name, LODIndex + 1, Mesh.LODs[LODIndex].Indices.Num() / 3, Mesh.Indices.Num() / 3, MaxError, MeanError));
+        }
+
+        // 같은 입력으로 다시 만들면 같은 LOD가 나와야 Cook 결과가 실행마다 같습니다.
+        OBJ::FStaticMeshRenderData Rebuilt = Mesh;
+        FStaticMeshSimplifier::BuildLODs(Rebuilt, Settings);
+        bool bSameLODs = Rebuilt.LODs.Num() == Mesh.LODs.Num();
+        for (int32 LODIndex = 0; LODIndex < Mesh.LODs.Num() && bSameLODs; ++LODIndex)
+        {
+            const TArray<UINT>& Expected = Mesh.LODs[LODIndex].Indices;
+            const TArray<UINT>& Actual = Rebuilt.LODs[LODIndex].Indices;
+            bSameLODs = Expected.Num() == Actual.Num() && std::equal(Expected.GetData(), Expected.GetData() + Expected.Num(), Actual.GetData());
+        }
+        if (!TestTrue("Rebuilding gives the same LODs", bSameLODs))
+        {
+            AddError(TestMesh.Name);
+        }
+    }
+
+    // MinTriangles보다 작은 Mesh는 LOD를 만들지 않습니다.
+    OBJ::FStaticMeshRenderData SmallMesh = {};
+    MakeTestTerrain(SmallMesh, 4);
+    TestEqual("LODs of a mesh smaller than MinTriangles", FStaticMeshSimplifier::BuildLODs(SmallMesh, Settings), 0);
+    TestEqual("LOD array of a mesh smaller than MinTriangles", SmallMesh.LODs.Num(), 0);
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FStaticMeshSimplifierBenchmark, "Engine.StaticMeshSimplifier.ContentMeshes", EAutomationTestType::Benchmark)
+{
+    constexpr int32 MaxSamples = 1000;
+
+    TArray<FString> Paths;
+    CollectContentObjFiles(Paths);
+    if (!TestTrue("Contents OBJ files found", Paths.Num() > 0))
+    {
+        return true;
+    }
+
+    double TotalMs = 0.0;
+    for (const FString& Path : Paths)
+    {
+        // BuildStaticMeshRenderData처럼 Subset을 먼저 넣고 변환합니다. 재질과 Texture는 읽지 않습니다.
+        FObjInfo ObjInfo;
+        OBJ::FStaticMeshRenderData Mesh = {};
+        if (!FLoaderOBJ::ParseOBJ(Path, ObjInfo))
+        {
+            AddError(TEXT("Failed to parse ") + Path);
+            continue;
+        }
+        Mesh.MaterialSubsets = ObjInfo.MaterialSubsets;
+        FLoaderOBJ::ConvertToStaticMesh(ObjInfo, Mesh);
+
+        FStaticMeshSimplifyStats Stats;
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        const int32 NumLODs = FStaticMeshSimplifier::BuildLODs(Mesh, FStaticMeshLODSettings(), &Stats);
+        const double BuildMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+        TotalMs += BuildMs;
+
+        AddInfo(FString::Printf(TEXT("%s: %d vertices, %d triangles, %d LODs in %.1f ms (%d collapses, %d rejected)"),
+            *Path, Mesh.Vertices.Num(), Mesh.Indices.Num() / 3, NumLODs, BuildMs, Stats.NumCollapses, Stats.NumRejected));
+
+        const FString Problem = FindLODChainProblem(Mesh);
+        if (!Problem.IsEmpty())
+        {
+            AddError(Path + TEXT(": ") + Problem);
+        }
+
+        // 오차는 Sample로 재므로 실제 최대 오차보다 작을 수 있습니다.
+        for (int32 LODIndex = 0; LODIndex < NumLODs; ++LODIndex)
+        {
+            const OBJ::FStaticMeshLODData& LOD = Mesh.LODs[LODIndex];
+            float MaxError = 0.f;
+            float MeanError = 0.f;
+            MeasureLODError(Mesh, LOD, MaxSamples, MaxError, MeanError);
+            AddInfo(FString::Printf(TEXT("    LOD %d: %d triangles (%.1f%%), estimated error %.4f, measured max %.4f mean %.5f, screen size < %.3f"),
+                LODIndex + 1, LOD.Indices.Num() / 3, 100.f * LOD.Indices.Num() / Mesh.Indices.Num(), LOD.Error, MaxError, MeanError, LOD.ScreenSize));
+        }
+    }
+
+    AddInfo(FString::Printf(TEXT("%d meshes: %.1f ms to build all LODs"), Paths.Num(), TotalMs));
+    return true;
+}
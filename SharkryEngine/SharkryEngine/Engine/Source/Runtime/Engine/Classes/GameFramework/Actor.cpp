@@ -6,6 +6,7 @@
 #include "Components/InputComponent.h"
 #include "Components/LuaScriptComponent.h"
 #include "Engine/Lua/LuaScriptManager.h"
+#include "UObject/UObjectArray.h"
 
 #include "Engine/Lua/LuaUtils/LuaTypeMacros.h"
 
@@ -20,6 +21,7 @@ UObject* AActor::Duplicate(UObject* InOuter)
 
     NewActor->Owner = Owner;
     NewActor->bTickInEditor = bTickInEditor;
+    NewActor->PrimaryActorTick = PrimaryActorTick;
     // 기본적으로 있던 컴포넌트 제거
     TSet CopiedComponents = NewActor->OwnedComponents;
 
@@ -135,14 +137,6 @@ void AActor::BeginPlay()
 
 void AActor::Tick(float DeltaTime)
 {
-    // TODO: 임시로 Actor에서 Tick 돌리기
-    // TODO: 나중에 삭제를 Pending으로 하던가 해서 복사비용 줄이기
-    const auto CopyComponents = OwnedComponents;
-
-    for (UActorComponent* Comp : CopyComponents)
-    {
-        Comp->TickComponent(DeltaTime);
-    }
 }
 
 void AActor::Destroyed()
@@ -193,6 +187,13 @@ bool AActor::Destroy()
     {
         if (UWorld* World = GetWorld())
         {
+            if (World->IsActorPoolEnabled(GetClass()))
+            {
+                World->ReleaseActor(this);
+                bActorIsBeingDestroyed = true;
+                return true;
+            }
+
             UE_LOG(LogLevel::Display, "Delete Component - %s", *GetName());
 
             World->DestroyActor(this);
@@ -203,6 +204,36 @@ bool AActor::Destroy()
     return IsActorBeingDestroyed();
 }
 
+void AActor::OnReleasedToPool()
+{
+    UninitializeComponents();
+
+    for (UActorComponent* Component : OwnedComponents)
+    {
+        Component->Deactivate();
+
+        // 이전 용도로 만든 Weak Pointer(FOverlapInfo 등)가 재사용된 Component를 가리키지 않도록 합니다.
+        GUObjectArray.ReissueSerialNumber(Component);
+    }
+    GUObjectArray.ReissueSerialNumber(this);
+
+    // Pool에 있는 동안은 제거중인 Actor와 동일하게 취급합니다.
+    bActorIsBeingDestroyed = true;
+}
+
+void AActor::OnAcquiredFromPool()
+{
+    bActorIsBeingDestroyed = false;
+
+    for (UActorComponent* Component : OwnedComponents)
+    {
+        Component->ResetForReuse();
+    }
+
+    // bAutoActive인 Component는 여기서 다시 활성화됩니다.
+    InitializeComponents();
+}
+
 UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRootComponent)
 {
 
@@ -224,6 +255,16 @@ UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRo
         
         OwnedComponents.Add(Component);
         Component->OwnerPrivate = this;
+        MarkTickListsDirty();
+
+        // Level에 있는 Actor라면 바로 Render Scene에 등록하고, 아니라면 Actor가 Spawn될 때 함께 등록됩니다.
+        if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+        {
+            if (UWorld* World = GetWorld())
+            {
+                World->GetRenderScene().AddComponent(SceneComponent);
+            }
+        }
 
         // 만약 SceneComponent를 상속 받았다면
 
@@ -256,6 +297,15 @@ UActorComponent* AActor::AddComponent(UClass* InClass, FName InName, bool bTryRo
 void AActor::RemoveOwnedComponent(UActorComponent* Component)
 {
     OwnedComponents.Remove(Component);
+    MarkTickListsDirty();
+
+    if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+    {
+        if (UWorld* World = GetWorld())
+        {
+            World->GetRenderScene().RemoveComponent(SceneComponent);
+        }
+    }
 }
 
 void AActor::InitializeComponents()
@@ -404,6 +454,24 @@ void AActor::UpdateOverlaps() const
 void AActor::SetActorTickInEditor(bool InbInTickInEditor)
 {
     bTickInEditor = InbInTickInEditor;
+    MarkTickListsDirty();
+}
+
+void AActor::SetActorTickEnabled(bool bEnabled)
+{
+    if (PrimaryActorTick.bTickEnabled != bEnabled)
+    {
+        PrimaryActorTick.bTickEnabled = bEnabled;
+        MarkTickListsDirty();
+    }
+}
+
+void AActor::MarkTickListsDirty() const
+{
+    if (UWorld* World = GetWorld())
+    {
+        World->GetTickTaskManager().MarkTickListsDirty();
+    }
 }
 
 void AActor::InitLuaScriptComponent()
@@ -433,10 +501,29 @@ void AActor::RegisterLuaType(sol::state& Lua)
         "ActorLocation", sol::property(&ThisClass::GetActorLocation, &ThisClass::SetActorLocation),
         "ActorRotation", sol::property(&ThisClass::GetActorRotation, &ThisClass::SetActorRotation),
         "ActorScale", sol::property(&ThisClass::GetActorScale, &ThisClass::SetActorScale),
-        "Destroy", &ThisClass::Destroy
+        "Destroy", &ThisClass::Destroy,
+        "EnableActorPoolLua", &ThisClass::EnableActorPoolLua
     )
 }
 
+void AActor::EnableActorPoolLua(const std::string& ClassName, int32 PrewarmCount)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    UClass* PoolClass = UClass::FindClass(FString(ClassName.c_str()));
+    if (!PoolClass)
+    {
+        UE_LOG(LogLevel::Error, TEXT("EnableActorPoolLua: Cannot find class '%s'"), ClassName.c_str());
+        return;
+    }
+
+    World->EnableActorPool(PoolClass, PrewarmCount);
+}
+
 bool AActor::BindSelfLuaProperties()
 {
     if (!LuaScriptComponent)
@@ -48,7 +48,10 @@ public:
     /** Actor가 게임에 배치되거나 스폰될 때 호출됩니다. */
     virtual void BeginPlay();
 
-    /** 매 Tick마다 호출됩니다. */
+    /**
+     * 매 Tick마다 PrimaryActorTick.TickGroup에서 Game Thread로 호출됩니다.
+     * Component의 TickComponent는 World의 FTickTaskManager가 따로 호출하므로, 여기서 호출하지 않습니다.
+     */
     virtual void Tick(float DeltaTime);
 
     /** Actor가 제거될 때 호출됩니다. */
@@ -63,9 +66,22 @@ public:
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason);
 
 public:
-    /** 이 Actor를 제거합니다. */
+    /**
+     * 이 Actor를 제거합니다.
+     * World에서 이 Actor의 Class가 Pool을 사용한다면 제거하지 않고 Pool로 반환합니다.
+     */
     virtual bool Destroy();
 
+    /**
+     * Pool로 반환될 때 호출됩니다.
+     * Component를 초기화 해제하고 비활성화해서 렌더링과 충돌 검사에서 제외합니다.
+     * Actor와 Component의 Serial Number를 새로 발급하므로, 반환 전에 만든 Weak Pointer는 nullptr가 됩니다.
+     */
+    virtual void OnReleasedToPool();
+
+    /** Pool에서 다시 꺼내질 때 BeginPlay 이전에 호출됩니다. Component마다 ResetForReuse를 호출합니다. */
+    virtual void OnAcquiredFromPool();
+
     /** 현재 Actor가 제거중인지 여부를 반환합니다. */
     bool IsActorBeingDestroyed() const
     {
@@ -184,7 +200,17 @@ public:
     bool IsActorTickInEditor() const { return bTickInEditor; }
     void SetActorTickInEditor(bool InbInTickInEditor);
 
+    /** Actor의 Tick을 켜거나 끕니다. Component의 Tick에는 영향을 주지 않습니다. */
+    void SetActorTickEnabled(bool bEnabled);
+    bool IsActorTickEnabled() const { return PrimaryActorTick.IsTickFunctionEnabled(); }
+
+    /** Tick의 실행 Group 설정 */
+    FTickFunction PrimaryActorTick;
+
 private:
+    /** Actor나 Component의 Tick 대상이 바뀌었음을 World에 알립니다. */
+    void MarkTickListsDirty() const;
+
     bool bTickInEditor = false;
 
 
@@ -195,6 +221,9 @@ public: // Lua Script.
 	virtual void RegisterLuaType(sol::state& Lua); // Lua에 클래스 등록해주는 함수.
     virtual bool BindSelfLuaProperties(); // LuaEnv에서 사용할 멤버 변수 등록 함수.
 
+    /** Lua에서 Class 이름으로 World의 Actor Pool을 켭니다. 모든 Actor의 Lua Type에서 사용할 수 있습니다. */
+    void EnableActorPoolLua(const std::string& ClassName, int32 PrewarmCount);
+
 	bool bUseScript = true;
 protected:
 	ULuaScriptComponent* LuaScriptComponent = nullptr;
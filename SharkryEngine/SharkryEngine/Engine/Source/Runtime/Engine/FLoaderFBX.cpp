@@ -803,7 +803,7 @@ namespace  FBX {
     {
         if (OutSkeleton->BoneTree.IsEmpty()) return;
 
-        OutSkeleton->CurrentPose.Resize(OutSkeleton->BoneTree.Num());
+        OutSkeleton->RefPose.Resize(OutSkeleton->BoneTree.Num());
 
         TArray<int32> ProcessingOrder; ProcessingOrder.Reserve(OutSkeleton->BoneTree.Num());
         TArray<uint8> Processed;
@@ -855,30 +855,30 @@ namespace  FBX {
             int32 ParentIdx = CurrentBone.ParentIndex;
 
             // 1. 현재 포즈의 로컬 변환을 로컬 바인드 포즈로 초기화 (모든 본에 대해 수행)
-            OutSkeleton->CurrentPose.LocalTransforms[BoneIndex] = LocalBindPose;
+            OutSkeleton->RefPose.LocalTransforms[BoneIndex] = LocalBindPose;
 
             // 2. 현재 포즈의 글로벌 변환 계산
             if (ParentIdx != INDEX_NONE) // 자식 본인 경우
             {
-                if (OutSkeleton->CurrentPose.GlobalTransforms.IsValidIndex(ParentIdx))
+                if (OutSkeleton->RefPose.GlobalTransforms.IsValidIndex(ParentIdx))
                 {
-                    const FMatrix& ParentGlobalTransform = OutSkeleton->CurrentPose.GlobalTransforms[ParentIdx];
-                    OutSkeleton->CurrentPose.GlobalTransforms[BoneIndex] = LocalBindPose * ParentGlobalTransform;
+                    const FMatrix& ParentGlobalTransform = OutSkeleton->RefPose.GlobalTransforms[ParentIdx];
+                    OutSkeleton->RefPose.GlobalTransforms[BoneIndex] = LocalBindPose * ParentGlobalTransform;
                 }
                 else
                 {
-                    OutSkeleton->CurrentPose.GlobalTransforms[BoneIndex] = LocalBindPose; // 오류상황 : 임시 처리
+                    OutSkeleton->RefPose.GlobalTransforms[BoneIndex] = LocalBindPose; // 오류상황 : 임시 처리
                 }
             }
             else // 루트 본인 경우
             {
                 // 루트 글로벌 = 루트 로컬
-                OutSkeleton->CurrentPose.GlobalTransforms[BoneIndex] = LocalBindPose;
+                OutSkeleton->RefPose.GlobalTransforms[BoneIndex] = LocalBindPose;
             }
 
             // 3. 현재 포즈의 스키닝 행렬 계산 (모든 본에 대해 루프 끝에서 한 번만)
-            OutSkeleton->CurrentPose.SkinningMatrices[BoneIndex] =
-                OutSkeleton->CalculateSkinningMatrix(BoneIndex, OutSkeleton->CurrentPose.GlobalTransforms[BoneIndex]);
+            OutSkeleton->RefPose.SkinningMatrices[BoneIndex] =
+                OutSkeleton->CalculateSkinningMatrix(BoneIndex, OutSkeleton->RefPose.GlobalTransforms[BoneIndex]);
         }
     }
 
@@ -123,8 +123,7 @@ namespace FBX
         TArray<FFbxMaterialInfo> Materials;           // 이 메시에 사용된 재질 정보 배열
         TArray<FMeshSubset> Subsets;                  // 재질별 인덱스 범위 정보
 
-        // DirectX 버퍼 포인터 (생성 후 채워짐)
-        ID3D11Buffer* DynamicVertexBuffer = nullptr;
+        // DirectX 버퍼 포인터 (생성 후 채워짐), 스키닝된 정점 버퍼는 포즈가 다른 컴포넌트마다 따로 가짐
         ID3D11Buffer* IndexBuffer = nullptr;
 
         FBoundingBox Bounds;                          // 메시의 AABB
@@ -142,11 +141,9 @@ namespace FBX
             Indices(std::move(Other.Indices)),
             Materials(std::move(Other.Materials)),
             Subsets(std::move(Other.Subsets)), // Subsets 이동 추가
-            DynamicVertexBuffer(Other.DynamicVertexBuffer),
             IndexBuffer(Other.IndexBuffer),
             Bounds(Other.Bounds)
         {
-            Other.DynamicVertexBuffer = nullptr;
             Other.IndexBuffer = nullptr;
         }
 
@@ -161,10 +158,8 @@ namespace FBX
                 Indices = std::move(Other.Indices);
                 Materials = std::move(Other.Materials);
                 Subsets = std::move(Other.Subsets); // Subsets 이동 추가
-                DynamicVertexBuffer = Other.DynamicVertexBuffer;
                 IndexBuffer = Other.IndexBuffer;
                 Bounds = Other.Bounds;
-                Other.DynamicVertexBuffer = nullptr;
                 Other.IndexBuffer = nullptr;
             }
             return *this;
@@ -172,7 +167,6 @@ namespace FBX
 
         void ReleaseBuffers()
         {
-            if (DynamicVertexBuffer) { DynamicVertexBuffer->Release(); DynamicVertexBuffer = nullptr; }
             if (IndexBuffer) { IndexBuffer->Release(); IndexBuffer = nullptr; }
         }
 
@@ -10,7 +10,7 @@ void FSkeletalMeshDebugger::DrawSkeleton(const USkeletalMeshComponent* SkelMeshC
     }
 
     const USkeleton* Skeleton = SkelMeshComp->GetSkeletalMesh()->Skeleton;
-    const FAnimationPoseData& Pose = Skeleton->CurrentPose;
+    const FAnimationPoseData& Pose = SkelMeshComp->GetPose();
     const TArray<FBoneNode>& BoneTree = Skeleton->BoneTree;
     const int32 NumBones = Pose.GlobalTransforms.Num();
 
@@ -55,7 +55,7 @@ void FSkeletalMeshDebugger::DrawSkeletonAABBs(const USkeletalMeshComponent* Skel
     }
 
     const USkeleton* Skeleton = SkelMeshComp->GetSkeletalMesh()->Skeleton;
-    const FAnimationPoseData& Pose = Skeleton->CurrentPose;
+    const FAnimationPoseData& Pose = SkelMeshComp->GetPose();
     const int32 NumBones = Pose.GlobalTransforms.Num();
 
     if (NumBones == 0)
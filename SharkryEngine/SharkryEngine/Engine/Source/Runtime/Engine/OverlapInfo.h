@@ -1,12 +1,20 @@
+#pragma once
+#include "UObject/WeakObjectPtr.h"
+
 class UPrimitiveComponent;
 class AActor;
 
+/**
+ * 이번 프레임에 겹친 상대
+ *
+ * 상대가 같은 프레임에 제거되어도 다음 프레임의 비교에서 접근하지 않도록 Weak Pointer로 저장합니다.
+ */
 struct FOverlapInfo
 {
-    UPrimitiveComponent* OtherComponent;
-    AActor* OtherActor;
+    TWeakObjectPtr<UPrimitiveComponent> OtherComponent;
+    TWeakObjectPtr<AActor> OtherActor;
 
-    FOverlapInfo(UPrimitiveComponent* InComponent, AActor* InActor)
+    FOverlapInfo(const TWeakObjectPtr<UPrimitiveComponent>& InComponent, const TWeakObjectPtr<AActor>& InActor)
         : OtherComponent(InComponent), OtherActor(InActor) {
     }
 };
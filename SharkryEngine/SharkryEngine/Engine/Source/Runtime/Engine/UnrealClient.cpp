@@ -5,6 +5,10 @@
 
 FViewportResource::FViewportResource()
 {
+    // Get 함수가 돌려준 포인터를 들고 있는 동안 다른 타입이 처음 생성되어도 Rehash로 주소가 바뀌지 않도록 모든 타입만큼 공간을 확보합니다.
+    DepthStencils.Reserve(static_cast<uint32>(EResourceType::ERT_MAX));
+    RenderTargets.Reserve(static_cast<uint32>(EResourceType::ERT_MAX));
+
     ClearColors.Add(EResourceType::ERT_Compositing, { 0.f, 0.f, 0.f, 1.f });
     ClearColors.Add(EResourceType::ERT_Scene,  { 0.025f, 0.025f, 0.025f, 1.0f });
     ClearColors.Add(EResourceType::ERT_PP_Fog, { 0.f, 0.f, 0.f, 0.f });
@@ -100,6 +100,7 @@ public:
     HRESULT CreateDepthStencil(EResourceType Type);
     
     // 해당 타입의 리소스를 리턴. 없는 경우에는 생성해서 리턴.
+    // 생성자에서 모든 타입만큼 Reserve하므로 리턴한 포인터는 다른 타입을 생성해도 유효함.
     FDepthStencilRHI* GetDepthStencil(EResourceType Type);
 
     bool HasDepthStencil(EResourceType Type) const;
@@ -117,6 +118,7 @@ public:
     HRESULT CreateRenderTarget(EResourceType Type);
     
     // 해당 타입의 리소스를 리턴. 없는 경우에는 생성해서 리턴.
+    // 생성자에서 모든 타입만큼 Reserve하므로 리턴한 포인터는 다른 타입을 생성해도 유효함.
     FRenderTargetRHI* GetRenderTarget(EResourceType Type);
 
     bool HasRenderTarget(EResourceType Type) const;
@@ -1,19 +1,20 @@
 #include "Console.h"
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include "UnrealEd/EditorViewportClient.h"
 #include "Engine/Engine.h"
+#include "World/World.h"
+#include "EngineLoop.h"
 #include "Renderer/UpdateLightBufferPass.h"
+#include "Renderer/StaticMeshRenderPass.h"
+#include "Renderer/ShadowRenderPass.h"
 #include "UObject/Casts.h"
-#include "UObject/UObjectIterator.h"
-#include "Components/Light/LightComponent.h"
-#include "Components/Light/PointLightComponent.h"
-#include "Components/Light/SpotLightComponent.h"
-#include "Components/Light/DirectionalLightComponent.h"
-#include "Components/Light/AmbientLightComponent.h"
 #include "ImGUI/imgui.h"
 #include "Stats/ProfilerStatsManager.h"
 #include "Stats/GPUTimingManager.h"
+#include "UnrealEd/SceneManager.h"
+#include "Misc/AutomationTest.h"
 
 void StatOverlay::ToggleStat(const std::string& Command)
 {
@@ -32,11 +33,47 @@ void StatOverlay::ToggleStat(const std::string& Command)
         ShowLight = true;
         ShowRender = true;
     }
+    else if (Command == "stat collision")
+    {
+        ShowCollision = true;
+        ShowRender = true;
+    }
+    else if (Command == "stat pool")
+    {
+        ShowPool = true;
+        ShowRender = true;
+    }
+    else if (Command == "stat culling")
+    {
+        ShowCulling = true;
+        ShowRender = true;
+    }
+    else if (Command == "stat tick")
+    {
+        ShowTick = true;
+        ShowRender = true;
+    }
+    else if (Command == "stat scene")
+    {
+        ShowScene = true;
+        ShowRender = true;
+    }
+    else if (Command == "stat draw")
+    {
+        ShowDraw = true;
+        ShowRender = true;
+    }
     else if (Command == "stat none")
     {
         ShowFPS = false;
         ShowMemory = false;
         ShowLight = false;
+        ShowCollision = false;
+        ShowPool = false;
+        ShowCulling = false;
+        ShowTick = false;
+        ShowScene = false;
+        ShowDraw = false;
         ShowRender = false;
     }
 }
@@ -89,40 +126,120 @@ void StatOverlay::Render(ID3D11DeviceContext* Context, UINT Width, UINT Height)
         ImGui::Text("Allocated Object Memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Object>());
         ImGui::Text("Allocated Container Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Container>());
         ImGui::Text("Allocated Container memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Container>());
-    }
+        ImGui::Text("Object Slab Count: %llu", FPlatformMemory::GetAllocationCount<EAT_ObjectSlab>());
+        ImGui::Text("Object Slab Memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_ObjectSlab>());
 
-    if (ShowLight)
-    {
-        // @todo Find Better Way to Get Light Count
-        int NumPointLights = 0;
-        int NumSpotLights = 0;
-        for (const auto iter : TObjectRange<ULightComponentBase>())
+        // Slab을 가장 많이 사용하는 클래스 순으로 표시
+        TArray<const UClass*> SlabClasses;
+        for (const auto& [ClassName, Class] : UClass::GetClassMap())
         {
-            if (iter->GetWorld() == GEngine->ActiveWorld)
+            if (Class->GetObjectAllocatorStats().NumElements > 0)
             {
-                if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(iter))
-                {
-                    NumPointLights++;
-                }
-                else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(iter))
-                {
-                    NumSpotLights++;
-                }
-                /*
-                else if (UDirectionalLightComponent* DirectionalLight = Cast<UDirectionalLightComponent>(iter))
-                {
-                    DirectionalLights.Add(DirectionalLight);
-                }
-                else if (UAmbientLightComponent* AmbientLight = Cast<UAmbientLightComponent>(iter))
-                {
-                    AmbientLights.Add(AmbientLight);
-                }
-                */
+                SlabClasses.Add(Class);
             }
         }
+        SlabClasses.Sort([](const UClass* A, const UClass* B)
+        {
+            return A->GetObjectAllocatorStats().GetSlabBytes() > B->GetObjectAllocatorStats().GetSlabBytes();
+        });
+
+        constexpr int32 MaxSlabClasses = 8;
+        for (int32 Index = 0; Index < SlabClasses.Num() && Index < MaxSlabClasses; ++Index)
+        {
+            const FSlabAllocatorStats& SlabStats = SlabClasses[Index]->GetObjectAllocatorStats();
+            ImGui::Text("  %s: %u objects, %u slabs (%u per slab)",
+                *SlabClasses[Index]->GetName(), SlabStats.NumElements, SlabStats.NumSlabs, SlabStats.ElementsPerSlab);
+        }
+    }
+
+    if (ShowLight && GEngine->ActiveWorld)
+    {
+        const FRenderScene& RenderScene = GEngine->ActiveWorld->GetRenderScene();
         ImGui::Text("[ Light Counters ]\n");
-        ImGui::Text("Point Light: %d", NumPointLights);
-        ImGui::Text("Spot Light: %d", NumSpotLights);
+        ImGui::Text("Point Light: %d", RenderScene.GetPointLights().Num());
+        ImGui::Text("Spot Light: %d", RenderScene.GetSpotLights().Num());
+        ImGui::Text("\n");
+    }
+
+    if (ShowCollision && GEngine->ActiveWorld)
+    {
+        const FCollisionBroadphase& Broadphase = GEngine->ActiveWorld->GetCollisionBroadphase();
+        ImGui::Text("[ Collision Broadphase ]\n");
+        ImGui::Text("Proxies: %d", Broadphase.GetProxyCount());
+        ImGui::Text("Tree Height: %d", Broadphase.GetHeight());
+        ImGui::Text("Reinserted: %u", Broadphase.NumReinserted);
+        ImGui::Text("Queries: %u", Broadphase.NumQueries);
+        ImGui::Text("Candidate Pairs: %u", Broadphase.NumCandidates);
+        ImGui::Text("\n");
+    }
+
+    if (ShowPool && GEngine->ActiveWorld)
+    {
+        const FActorPool& ActorPool = GEngine->ActiveWorld->GetActorPool();
+        const FActorPoolStats& PoolStats = ActorPool.GetStats();
+        ImGui::Text("[ Actor Pool ]\n");
+        ImGui::Text("Pooled Actors: %d", ActorPool.GetNumPooled());
+        ImGui::Text("Acquired: %u", PoolStats.NumAcquired);
+        ImGui::Text("Hits: %u (%.1f%%)", PoolStats.NumHits, PoolStats.GetHitRate() * 100.0f);
+        ImGui::Text("Released: %u", PoolStats.NumReleased);
+        ImGui::Text("\n");
+    }
+
+    if (ShowCulling)
+    {
+        // 모든 Viewport에 대한 누적값
+        const FVisibilityCullStats& MeshCullStats = FEngineLoop::Renderer.StaticMeshRenderPass->GetCullStats();
+        const FVisibilityCullStats& ShadowCullStats = FEngineLoop::Renderer.ShadowRenderPass->GetCullStats();
+        ImGui::Text("[ Visibility Culling ]\n");
+        ImGui::Text("Static Mesh: %u / %u culled", MeshCullStats.NumCulled, MeshCullStats.NumTested);
+        ImGui::Text("Shadow Caster: %u / %u culled", ShadowCullStats.NumCulled, ShadowCullStats.NumTested);
+        ImGui::Text("\n");
+    }
+
+    if (ShowTick && GEngine->ActiveWorld)
+    {
+        const FTickTaskStats& TickStats = GEngine->ActiveWorld->GetTickTaskManager().GetStats();
+        const uint32 NumComponentTicks = TickStats.NumGameThreadComponentTicks + TickStats.NumParallelComponentTicks;
+        ImGui::Text("[ Tick ]\n");
+        ImGui::Text("Actors: %u ticked / %u registered", TickStats.NumActorTicks, TickStats.NumRegisteredActors);
+        ImGui::Text("Components: %u ticked / %u registered", NumComponentTicks, TickStats.NumRegisteredComponents);
+        ImGui::Text("Parallel: %u, Idle: %u", TickStats.NumParallelComponentTicks, TickStats.NumIdleComponents);
+        ImGui::Text("List Rebuilds: %u", TickStats.NumRebuilds);
+        ImGui::Text("\n");
+    }
+
+    if (ShowScene && GEngine->ActiveWorld)
+    {
+        const FRenderScene& RenderScene = GEngine->ActiveWorld->GetRenderScene();
+        const FRenderSceneStats& SceneStats = RenderScene.GetStats();
+        ImGui::Text("[ Render Scene ]\n");
+        ImGui::Text("Registered Components: %d", RenderScene.GetNumRegisteredComponents());
+        ImGui::Text("Static Mesh Proxies: %d", RenderScene.GetStaticMeshProxies().Num());
+        ImGui::Text("Skeletal Mesh Proxies: %d", RenderScene.GetSkeletalMeshProxies().Num());
+        ImGui::Text("Transform Updates: %u", SceneStats.NumTransformUpdates);
+        ImGui::Text("Render State Updates: %u", SceneStats.NumRenderStateUpdates);
+        ImGui::Text("\n");
+    }
+
+    if (ShowDraw)
+    {
+        // 모든 Viewport에 대한 누적값, 정렬 없이 그렸을 때 -> 정렬 후 바뀐 상태만 Bind했을 때
+        const FMeshDrawStats& DrawStats = FEngineLoop::Renderer.StaticMeshRenderPass->GetDrawStats();
+        ImGui::Text("[ Static Mesh Draw ]\n");
+        const FMeshInstanceStats& InstanceStats = FEngineLoop::Renderer.StaticMeshRenderPass->GetInstanceStats();
+        ImGui::Text("Draw Commands: %u", DrawStats.NumCommands);
+        ImGui::Text("Draw Calls: %u -> %u", DrawStats.Unfiltered.NumDrawCalls, DrawStats.Filtered.NumDrawCalls);
+        ImGui::Text("Instancing: %u / %u objects in %u batches", InstanceStats.NumInstancedObjects, InstanceStats.NumObjects, InstanceStats.NumBatches);
+        const FStaticMeshLODStats& LODStats = FEngineLoop::Renderer.StaticMeshRenderPass->GetLODStats();
+        ImGui::Text("LOD Objects: %u / %u / %u / %u / %u", LODStats.NumObjects[0], LODStats.NumObjects[1], LODStats.NumObjects[2], LODStats.NumObjects[3], LODStats.NumObjects[4]);
+        ImGui::Text("LOD Triangles: %llu -> %llu", LODStats.NumLOD0Triangles, LODStats.NumTriangles);
+        ImGui::Text("Shader: %u", DrawStats.Filtered.NumShaderBinds);
+        ImGui::Text("Vertex Buffer: %u -> %u", DrawStats.Unfiltered.NumVertexBufferBinds, DrawStats.Filtered.NumVertexBufferBinds);
+        ImGui::Text("Index Buffer: %u -> %u", DrawStats.Unfiltered.NumIndexBufferBinds, DrawStats.Filtered.NumIndexBufferBinds);
+        ImGui::Text("Object: %u -> %u", DrawStats.Unfiltered.NumObjectBinds, DrawStats.Filtered.NumObjectBinds);
+        ImGui::Text("Material: %u -> %u", DrawStats.Unfiltered.NumMaterialBinds, DrawStats.Filtered.NumMaterialBinds);
+        ImGui::Text("Texture: %u -> %u", DrawStats.Unfiltered.NumTextureBinds, DrawStats.Filtered.NumTextureBinds);
+        ImGui::Text("SubMesh: %u -> %u", DrawStats.Unfiltered.NumSubMeshUpdates, DrawStats.Filtered.NumSubMeshUpdates);
         ImGui::Text("\n");
     }
 
@@ -373,6 +490,50 @@ void Console::ExecuteCommand(const std::string& Command)
         AddLog(LogLevel::Display, " - stat fps: Toggle FPS display");
         AddLog(LogLevel::Display, " - stat memory: Toggle Memory display");
         AddLog(LogLevel::Display, " - stat none: Hide all stat overlays");
+        AddLog(LogLevel::Display, " - cook: Cook the current level into a binary level");
+        AddLog(LogLevel::Display, " - automation list: List automation tests");
+        AddLog(LogLevel::Display, " - automation run [filter]: Run unit tests whose name contains filter");
+        AddLog(LogLevel::Display, " - automation bench [filter]: Run benchmarks whose name contains filter");
+    }
+    else if (Command == "cook")
+    {
+        const FString LevelPath = GEngine->ActiveWorld->GetActiveLevel()->GetLevelPath();
+        if (SceneManager::CookScene(GetData(LevelPath)))
+        {
+            AddLog(LogLevel::Display, "Cooked %s", *LevelPath);
+        }
+        else
+        {
+            AddLog(LogLevel::Error, "Failed to cook %s", *LevelPath);
+        }
+    }
+    else if (Command == "automation list")
+    {
+        for (const FAutomationTestBase* Test : FAutomationTestFramework::Get().GetTests())
+        {
+            const bool bBenchmark = Test->GetTestType() == EAutomationTestType::Benchmark;
+            AddLog(LogLevel::Display, "%s%s", *Test->GetTestName(), bBenchmark ? " (benchmark)" : "");
+        }
+    }
+    else if (Command.starts_with("automation run") || Command.starts_with("automation bench"))
+    {
+        const EAutomationTestType TestType = Command.starts_with("automation bench") ? EAutomationTestType::Benchmark : EAutomationTestType::Unit;
+        const size_t FilterStart = Command.find(' ', std::strlen("automation "));
+        const FString Filter = FilterStart != std::string::npos ? FString(Command.substr(FilterStart + 1)) : FString();
+
+        TArray<FAutomationTestResult> Results;
+        const int32 NumFailed = FAutomationTestFramework::Get().RunTests(Filter, TestType, Results);
+
+        TArray<FString> Lines;
+        FAutomationTestFramework::FormatResults(Results, Lines);
+        for (const FString& Line : Lines)
+        {
+            AddLog(LogLevel::Display, "%s", *Line);
+        }
+        if (NumFailed > 0)
+        {
+            AddLog(LogLevel::Error, "%d automation tests failed", NumFailed);
+        }
     }
     else if (Command.starts_with("stat "))
     {
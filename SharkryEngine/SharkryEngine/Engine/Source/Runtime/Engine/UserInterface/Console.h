@@ -20,6 +20,12 @@ public:
     bool ShowFPS = false;
     bool ShowMemory = false;
     bool ShowLight = false;
+    bool ShowCollision = false;
+    bool ShowPool = false;
+    bool ShowCulling = false;
+    bool ShowTick = false;
+    bool ShowScene = false;
+    bool ShowDraw = false;
     bool ShowRender = false;
 
     void ToggleStat(const std::string& Command);
@@ -3,6 +3,7 @@
 #include <d3d11.h>
 
 #include "EngineBaseTypes.h"
+#include "Container/Map.h"
 #include "HAL/PlatformType.h"
 #include "Math/Matrix.h"
 
@@ -12,6 +13,7 @@
 class FViewportResource;
 class FViewport;
 class UWorld;
+class UStaticMeshComponent;
 
 struct FViewportCamera
 {
@@ -159,6 +161,14 @@ protected:
     FMatrix View;
     FMatrix Projection;
 
+    // Renderer가 View마다 유지하는 상태
+public:
+    /** 이 View에서 Component마다 마지막으로 그린 LOD, Viewport마다 화면 크기가 다르므로 View가 따로 가지고 다음 LOD를 고를 때 Hysteresis의 기준으로 씁니다. */
+    TMap<const UStaticMeshComponent*, int32>& GetStaticMeshLODs() { return StaticMeshLODs; }
+
+protected:
+    TMap<const UStaticMeshComponent*, int32> StaticMeshLODs;
+
 public:
     static FVector GetOrthoPivot() { return OrthoPivot; }
     static void SetOrthoPivot(FVector InOrthoPivot) { OrthoPivot = InOrthoPivot; }
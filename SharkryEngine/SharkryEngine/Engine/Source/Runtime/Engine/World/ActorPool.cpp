@@ -0,0 +1,55 @@
+#include "ActorPool.h"
+#include "GameFramework/Actor.h"
+
+void FActorPool::Enable(UClass* InClass)
+{
+    FreeActors.FindOrAdd(InClass);
+}
+
+bool FActorPool::IsEnabled(const UClass* InClass) const
+{
+    return FreeActors.Contains(const_cast<UClass*>(InClass));
+}
+
+AActor* FActorPool::Pop(UClass* InClass)
+{
+    TArray<AActor*>* Actors = FreeActors.Find(InClass);
+    if (!Actors || Actors->IsEmpty())
+    {
+        return nullptr;
+    }
+
+    const int32 LastIndex = Actors->Num() - 1;
+    AActor* Actor = (*Actors)[LastIndex];
+    Actors->RemoveAt(LastIndex);
+    --NumPooled;
+
+    return Actor;
+}
+
+void FActorPool::Push(AActor* InActor)
+{
+    FreeActors.FindOrAdd(InActor->GetClass()).Add(InActor);
+    ++NumPooled;
+}
+
+int32 FActorPool::GetNumPooled(UClass* InClass) const
+{
+    const TArray<AActor*>* Actors = FreeActors.Find(InClass);
+    return Actors ? Actors->Num() : 0;
+}
+
+void FActorPool::Empty(TArray<AActor*>& OutPooledActors)
+{
+    for (auto& [Class, Actors] : FreeActors)
+    {
+        for (AActor* Actor : Actors)
+        {
+            OutPooledActors.Add(Actor);
+        }
+    }
+
+    FreeActors.Empty();
+    NumPooled = 0;
+    Stats = FActorPoolStats();
+}
@@ -0,0 +1,68 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+#include "Container/Map.h"
+
+class AActor;
+class UClass;
+
+/** Actor Pool 누적 통계 */
+struct FActorPoolStats
+{
+    /** Pool이 활성화된 Class에 대한 Acquire 요청 수 */
+    uint32 NumAcquired = 0;
+
+    /** Pool에서 꺼내 재사용한 횟수 */
+    uint32 NumHits = 0;
+
+    /** Pool로 반환된 횟수 */
+    uint32 NumReleased = 0;
+
+    float GetHitRate() const
+    {
+        return NumAcquired > 0 ? static_cast<float>(NumHits) / static_cast<float>(NumAcquired) : 0.0f;
+    }
+};
+
+/**
+ * Class별로 비활성 Actor를 보관하는 Pool
+ *
+ * 활성화된 Class만 Pool을 사용하며, 보관중인 Actor는 Level에서 빠져있는 상태입니다.
+ * Level 등록과 BeginPlay/EndPlay 처리는 UWorld가 담당합니다.
+ */
+class FActorPool
+{
+public:
+    FActorPool() = default;
+
+    /** InClass에 대해 Pool을 사용하도록 설정합니다. */
+    void Enable(UClass* InClass);
+
+    /** InClass가 Pool을 사용하는지 여부를 반환합니다. */
+    bool IsEnabled(const UClass* InClass) const;
+
+    /**
+     * 보관중인 Actor를 하나 꺼냅니다.
+     * @return 보관중인 Actor가 없다면 nullptr
+     */
+    AActor* Pop(UClass* InClass);
+
+    /** 비활성화된 Actor를 Pool에 보관합니다. */
+    void Push(AActor* InActor);
+
+    /** 보관중인 Actor 수 */
+    int32 GetNumPooled() const { return NumPooled; }
+    int32 GetNumPooled(UClass* InClass) const;
+
+    /** 모든 Class의 Pool을 비우고, 보관중이던 Actor들을 반환합니다. */
+    void Empty(TArray<AActor*>& OutPooledActors);
+
+    FActorPoolStats& GetStats() { return Stats; }
+    const FActorPoolStats& GetStats() const { return Stats; }
+
+private:
+    TMap<UClass*, TArray<AActor*>> FreeActors;
+    int32 NumPooled = 0;
+
+    FActorPoolStats Stats;
+};
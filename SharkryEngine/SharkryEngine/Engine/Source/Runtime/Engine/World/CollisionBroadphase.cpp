@@ -0,0 +1,334 @@
+#include "CollisionBroadphase.h"
+
+namespace
+{
+    FBoundingBox Union(const FBoundingBox& A, const FBoundingBox& B)
+    {
+        return FBoundingBox(A.min.ComponentMin(B.min), A.max.ComponentMax(B.max));
+    }
+
+    /** Tree 비용 계산에 사용하는 표면적 */
+    float SurfaceArea(const FBoundingBox& Box)
+    {
+        const FVector Size = Box.max - Box.min;
+        return 2.0f * (Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X);
+    }
+
+    bool Contains(const FBoundingBox& Outer, const FBoundingBox& Inner)
+    {
+        return Outer.min.X <= Inner.min.X && Outer.min.Y <= Inner.min.Y && Outer.min.Z <= Inner.min.Z
+            && Inner.max.X <= Outer.max.X && Inner.max.Y <= Outer.max.Y && Inner.max.Z <= Outer.max.Z;
+    }
+}
+
+int32 FCollisionBroadphase::CreateProxy(const FBoundingBox& InBounds, void* InUserData)
+{
+    const int32 ProxyId = AllocateNode();
+
+    const FVector Margin(FatMargin);
+    FNode& Node = Nodes[ProxyId];
+    Node.Bounds = FBoundingBox(InBounds.min - Margin, InBounds.max + Margin);
+    Node.UserData = InUserData;
+    Node.Height = 0;
+
+    InsertLeaf(ProxyId);
+    ++ProxyCount;
+
+    return ProxyId;
+}
+
+void FCollisionBroadphase::DestroyProxy(int32 ProxyId)
+{
+    assert(0 <= ProxyId && ProxyId < Nodes.Num());
+    assert(Nodes[ProxyId].IsLeaf());
+
+    RemoveLeaf(ProxyId);
+    FreeNode(ProxyId);
+    --ProxyCount;
+}
+
+bool FCollisionBroadphase::MoveProxy(int32 ProxyId, const FBoundingBox& InBounds)
+{
+    assert(0 <= ProxyId && ProxyId < Nodes.Num());
+    assert(Nodes[ProxyId].IsLeaf());
+
+    if (Contains(Nodes[ProxyId].Bounds, InBounds))
+    {
+        return false;
+    }
+
+    RemoveLeaf(ProxyId);
+
+    const FVector Margin(FatMargin);
+    Nodes[ProxyId].Bounds = FBoundingBox(InBounds.min - Margin, InBounds.max + Margin);
+
+    InsertLeaf(ProxyId);
+    ++NumReinserted;
+
+    return true;
+}
+
+void FCollisionBroadphase::Empty()
+{
+    Nodes.Empty();
+    RootIndex = INDEX_NONE;
+    FreeListIndex = INDEX_NONE;
+    ProxyCount = 0;
+}
+
+int32 FCollisionBroadphase::AllocateNode()
+{
+    if (FreeListIndex == INDEX_NONE)
+    {
+        return Nodes.Emplace();
+    }
+
+    const int32 NodeIndex = FreeListIndex;
+    FreeListIndex = Nodes[NodeIndex].ParentOrNext;
+    Nodes[NodeIndex] = FNode();
+    return NodeIndex;
+}
+
+void FCollisionBroadphase::FreeNode(int32 NodeIndex)
+{
+    FNode& Node = Nodes[NodeIndex];
+    Node.UserData = nullptr;
+    Node.Child1 = INDEX_NONE;
+    Node.Child2 = INDEX_NONE;
+    Node.Height = -1;
+    Node.ParentOrNext = FreeListIndex;
+    FreeListIndex = NodeIndex;
+}
+
+void FCollisionBroadphase::InsertLeaf(int32 LeafIndex)
+{
+    if (RootIndex == INDEX_NONE)
+    {
+        RootIndex = LeafIndex;
+        Nodes[RootIndex].ParentOrNext = INDEX_NONE;
+        return;
+    }
+
+    // 표면적 증가량이 가장 적은 형제 Node를 찾습니다. (SAH)
+    const FBoundingBox LeafBounds = Nodes[LeafIndex].Bounds;
+    int32 Index = RootIndex;
+    while (!Nodes[Index].IsLeaf())
+    {
+        const FNode& Node = Nodes[Index];
+        const float Area = SurfaceArea(Node.Bounds);
+        const float CombinedArea = SurfaceArea(Union(Node.Bounds, LeafBounds));
+
+        // 이 Node와 Leaf를 묶어 새 부모를 만드는 비용
+        const float Cost = 2.0f * CombinedArea;
+
+        // Leaf를 더 아래로 내려보낼 때 조상들에게 더해지는 비용
+        const float InheritanceCost = 2.0f * (CombinedArea - Area);
+
+        auto DescendCost = [&](int32 ChildIndex)
+        {
+            const FNode& Child = Nodes[ChildIndex];
+            const float NewArea = SurfaceArea(Union(Child.Bounds, LeafBounds));
+            if (Child.IsLeaf())
+            {
+                return NewArea + InheritanceCost;
+            }
+            return NewArea - SurfaceArea(Child.Bounds) + InheritanceCost;
+        };
+
+        const float Cost1 = DescendCost(Node.Child1);
+        const float Cost2 = DescendCost(Node.Child2);
+
+        if (Cost < Cost1 && Cost < Cost2)
+        {
+            break;
+        }
+
+        Index = Cost1 < Cost2 ? Node.Child1 : Node.Child2;
+    }
+
+    const int32 SiblingIndex = Index;
+
+    // 형제와 Leaf를 묶는 새 부모 Node 생성
+    const int32 OldParentIndex = Nodes[SiblingIndex].ParentOrNext;
+    const int32 NewParentIndex = AllocateNode();
+    {
+        FNode& NewParent = Nodes[NewParentIndex];
+        NewParent.ParentOrNext = OldParentIndex;
+        NewParent.Bounds = Union(LeafBounds, Nodes[SiblingIndex].Bounds);
+        NewParent.Height = Nodes[SiblingIndex].Height + 1;
+        NewParent.Child1 = SiblingIndex;
+        NewParent.Child2 = LeafIndex;
+    }
+
+    if (OldParentIndex != INDEX_NONE)
+    {
+        FNode& OldParent = Nodes[OldParentIndex];
+        if (OldParent.Child1 == SiblingIndex)
+        {
+            OldParent.Child1 = NewParentIndex;
+        }
+        else
+        {
+            OldParent.Child2 = NewParentIndex;
+        }
+    }
+    else
+    {
+        RootIndex = NewParentIndex;
+    }
+
+    Nodes[SiblingIndex].ParentOrNext = NewParentIndex;
+    Nodes[LeafIndex].ParentOrNext = NewParentIndex;
+
+    // 조상들의 Bounds와 Height를 갱신하면서 회전으로 균형을 맞춥니다.
+    Index = NewParentIndex;
+    while (Index != INDEX_NONE)
+    {
+        Index = Balance(Index);
+
+        FNode& Node = Nodes[Index];
+        Node.Height = 1 + std::max(Nodes[Node.Child1].Height, Nodes[Node.Child2].Height);
+        Node.Bounds = Union(Nodes[Node.Child1].Bounds, Nodes[Node.Child2].Bounds);
+
+        Index = Node.ParentOrNext;
+    }
+}
+
+void FCollisionBroadphase::RemoveLeaf(int32 LeafIndex)
+{
+    if (LeafIndex == RootIndex)
+    {
+        RootIndex = INDEX_NONE;
+        return;
+    }
+
+    const int32 ParentIndex = Nodes[LeafIndex].ParentOrNext;
+    const int32 GrandParentIndex = Nodes[ParentIndex].ParentOrNext;
+    const int32 SiblingIndex = Nodes[ParentIndex].Child1 == LeafIndex ? Nodes[ParentIndex].Child2 : Nodes[ParentIndex].Child1;
+
+    if (GrandParentIndex == INDEX_NONE)
+    {
+        RootIndex = SiblingIndex;
+        Nodes[SiblingIndex].ParentOrNext = INDEX_NONE;
+        FreeNode(ParentIndex);
+        return;
+    }
+
+    // 부모를 제거하고 형제를 조부모에 직접 연결
+    FNode& GrandParent = Nodes[GrandParentIndex];
+    if (GrandParent.Child1 == ParentIndex)
+    {
+        GrandParent.Child1 = SiblingIndex;
+    }
+    else
+    {
+        GrandParent.Child2 = SiblingIndex;
+    }
+    Nodes[SiblingIndex].ParentOrNext = GrandParentIndex;
+    FreeNode(ParentIndex);
+
+    int32 Index = GrandParentIndex;
+    while (Index != INDEX_NONE)
+    {
+        Index = Balance(Index);
+
+        FNode& Node = Nodes[Index];
+        Node.Bounds = Union(Nodes[Node.Child1].Bounds, Nodes[Node.Child2].Bounds);
+        Node.Height = 1 + std::max(Nodes[Node.Child1].Height, Nodes[Node.Child2].Height);
+
+        Index = Node.ParentOrNext;
+    }
+}
+
+int32 FCollisionBroadphase::Balance(int32 IndexA)
+{
+    //       A
+    //     /   \
+    //    B     C
+    //   / \   / \
+    //  D   E F   G
+    FNode& A = Nodes[IndexA];
+    if (A.IsLeaf() || A.Height < 2)
+    {
+        return IndexA;
+    }
+
+    const int32 IndexB = A.Child1;
+    const int32 IndexC = A.Child2;
+    FNode& B = Nodes[IndexB];
+    FNode& C = Nodes[IndexC];
+
+    const int32 HeightDiff = C.Height - B.Height;
+
+    // 한쪽이 2 이상 깊다면 깊은쪽 자식을 위로 올립니다.
+    auto Rotate = [this, IndexA](int32 IndexUp, int32 IndexOther, bool bUpIsChild2) -> int32
+    {
+        FNode& NodeA = Nodes[IndexA];
+        FNode& Up = Nodes[IndexUp];
+        FNode& Other = Nodes[IndexOther];
+
+        const int32 IndexF = Up.Child1;
+        const int32 IndexG = Up.Child2;
+        FNode& F = Nodes[IndexF];
+        FNode& G = Nodes[IndexG];
+
+        // Up을 A의 자리로 올리기
+        Up.Child1 = IndexA;
+        Up.ParentOrNext = NodeA.ParentOrNext;
+        NodeA.ParentOrNext = IndexUp;
+
+        if (Up.ParentOrNext != INDEX_NONE)
+        {
+            FNode& OldParent = Nodes[Up.ParentOrNext];
+            if (OldParent.Child1 == IndexA)
+            {
+                OldParent.Child1 = IndexUp;
+            }
+            else
+            {
+                OldParent.Child2 = IndexUp;
+            }
+        }
+        else
+        {
+            RootIndex = IndexUp;
+        }
+
+        // 더 높은 손자는 Up에 남기고, 낮은 손자를 A로 내립니다.
+        const bool bKeepF = F.Height > G.Height;
+        const int32 IndexKeep = bKeepF ? IndexF : IndexG;
+        const int32 IndexMove = bKeepF ? IndexG : IndexF;
+        FNode& Move = Nodes[IndexMove];
+
+        Up.Child2 = IndexKeep;
+        if (bUpIsChild2)
+        {
+            NodeA.Child2 = IndexMove;
+        }
+        else
+        {
+            NodeA.Child1 = IndexMove;
+        }
+        Move.ParentOrNext = IndexA;
+
+        NodeA.Bounds = Union(Other.Bounds, Move.Bounds);
+        NodeA.Height = 1 + std::max(Other.Height, Move.Height);
+
+        const FNode& Keep = Nodes[IndexKeep];
+        Up.Bounds = Union(NodeA.Bounds, Keep.Bounds);
+        Up.Height = 1 + std::max(NodeA.Height, Keep.Height);
+
+        return IndexUp;
+    };
+
+    if (HeightDiff > 1)
+    {
+        return Rotate(IndexC, IndexB, true);
+    }
+    if (HeightDiff < -1)
+    {
+        return Rotate(IndexB, IndexC, false);
+    }
+
+    return IndexA;
+}
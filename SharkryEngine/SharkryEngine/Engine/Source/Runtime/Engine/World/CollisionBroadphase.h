@@ -0,0 +1,139 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+
+/**
+ * Overlap 후보쌍을 빠르게 찾기 위한 Dynamic AABB Tree
+ *
+ * Leaf마다 실제 Bounds보다 FatMargin만큼 큰 AABB를 저장하고,
+ * 실제 Bounds가 Fat AABB를 벗어날 때만 Leaf를 재삽입하므로 조금씩 움직이는 Shape는 트리를 건드리지 않습니다.
+ */
+class FCollisionBroadphase
+{
+public:
+    FCollisionBroadphase() = default;
+
+    /** Proxy를 새로 등록하고 Proxy Id를 반환합니다. */
+    int32 CreateProxy(const FBoundingBox& InBounds, void* InUserData);
+
+    /** 등록된 Proxy를 제거합니다. */
+    void DestroyProxy(int32 ProxyId);
+
+    /**
+     * Proxy의 Bounds를 갱신합니다.
+     * @return Fat AABB를 벗어나서 트리에 재삽입 되었다면 true
+     */
+    bool MoveProxy(int32 ProxyId, const FBoundingBox& InBounds);
+
+    /** 모든 Proxy를 제거합니다. */
+    void Empty();
+
+    void* GetUserData(int32 ProxyId) const { return Nodes[ProxyId].UserData; }
+    const FBoundingBox& GetFatBounds(int32 ProxyId) const { return Nodes[ProxyId].Bounds; }
+
+    int32 GetProxyCount() const { return ProxyCount; }
+    int32 GetHeight() const { return RootIndex == INDEX_NONE ? 0 : Nodes[RootIndex].Height; }
+
+    /**
+     * InBounds와 겹치는 모든 Proxy에 대해 Callback을 호출합니다.
+     * @param Callback bool(void* UserData), false를 반환하면 탐색을 중단합니다.
+     */
+    template <typename FuncType>
+    void Query(const FBoundingBox& InBounds, FuncType&& Callback) const;
+
+public:
+    /** Fat AABB에 더해지는 여유 공간 */
+    float FatMargin = 0.1f;
+
+    //~ 프레임 통계, ResetStats()로 초기화
+    mutable uint32 NumQueries = 0;
+    mutable uint32 NumCandidates = 0;
+    uint32 NumReinserted = 0;
+
+    void ResetStats()
+    {
+        NumQueries = 0;
+        NumCandidates = 0;
+        NumReinserted = 0;
+    }
+
+private:
+    struct FNode
+    {
+        FBoundingBox Bounds;
+        void* UserData = nullptr;
+
+        /** 사용중인 Node는 부모, Free Node는 다음 Free Node의 Index */
+        int32 ParentOrNext = INDEX_NONE;
+        int32 Child1 = INDEX_NONE;
+        int32 Child2 = INDEX_NONE;
+
+        /** Leaf는 0, Free Node는 -1 */
+        int32 Height = -1;
+
+        bool IsLeaf() const { return Child1 == INDEX_NONE; }
+    };
+
+    int32 AllocateNode();
+    void FreeNode(int32 NodeIndex);
+
+    void InsertLeaf(int32 LeafIndex);
+    void RemoveLeaf(int32 LeafIndex);
+    int32 Balance(int32 NodeIndex);
+
+    static bool Overlaps(const FBoundingBox& A, const FBoundingBox& B)
+    {
+        return A.min.X <= B.max.X && A.max.X >= B.min.X
+            && A.min.Y <= B.max.Y && A.max.Y >= B.min.Y
+            && A.min.Z <= B.max.Z && A.max.Z >= B.min.Z;
+    }
+
+private:
+    TArray<FNode> Nodes;
+    int32 RootIndex = INDEX_NONE;
+    int32 FreeListIndex = INDEX_NONE;
+    int32 ProxyCount = 0;
+
+    /** Query에서 재사용하는 탐색 스택 */
+    mutable TArray<int32> QueryStack;
+};
+
+template <typename FuncType>
+void FCollisionBroadphase::Query(const FBoundingBox& InBounds, FuncType&& Callback) const
+{
+    if (RootIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    ++NumQueries;
+
+    QueryStack.Empty();
+    QueryStack.Add(RootIndex);
+
+    while (!QueryStack.IsEmpty())
+    {
+        const int32 NodeIndex = QueryStack[QueryStack.Num() - 1];
+        QueryStack.SetNum(QueryStack.Num() - 1);
+
+        const FNode& Node = Nodes[NodeIndex];
+        if (!Overlaps(Node.Bounds, InBounds))
+        {
+            continue;
+        }
+
+        if (Node.IsLeaf())
+        {
+            ++NumCandidates;
+            if (!Callback(Node.UserData))
+            {
+                return;
+            }
+        }
+        else
+        {
+            QueryStack.Add(Node.Child1);
+            QueryStack.Add(Node.Child2);
+        }
+    }
+}
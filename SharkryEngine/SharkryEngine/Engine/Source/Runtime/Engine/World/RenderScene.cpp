@@ -0,0 +1,455 @@
+#include "RenderScene.h"
+
+#include <cassert>
+
+#include "BaseGizmos/GizmoBaseComponent.h"
+#include "Components/BillboardComponent.h"
+#include "Components/HeightFogComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/Light/AmbientLightComponent.h"
+#include "Components/Light/DirectionalLightComponent.h"
+#include "Components/Light/PointLightComponent.h"
+#include "Components/Light/SpotLightComponent.h"
+#include "Components/Shapes/ShapeComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Casts.h"
+
+namespace
+{
+    USceneComponent* GetListComponent(USceneComponent* Component) { return Component; }
+    USceneComponent* GetListComponent(const FStaticMeshSceneProxy& Proxy) { return Proxy.Component; }
+    USceneComponent* GetListComponent(const FSkeletalMeshSceneProxy& Proxy) { return Proxy.Component; }
+}
+
+template <typename ElementType>
+void FRenderScene::AddToList(TArray<ElementType*>& List, ElementType* Component)
+{
+    Component->RenderSceneHandle.ProxyIndex = List.Add(Component);
+}
+
+template <typename ElementType>
+void FRenderScene::RemoveAtSwap(TArray<ElementType>& List, int32 Index)
+{
+    const int32 LastIndex = List.Num() - 1;
+    if (Index != LastIndex)
+    {
+        List[Index] = std::move(List[LastIndex]);
+        GetListComponent(List[Index])->RenderSceneHandle.ProxyIndex = Index;
+    }
+    List.RemoveAt(LastIndex);
+}
+
+void FRenderScene::AddActor(AActor* Actor)
+{
+    if (!Actor || RegisteredActors.Contains(Actor))
+    {
+        return;
+    }
+
+    RegisteredActors.Add(Actor);
+    for (UActorComponent* Component : Actor->GetComponents())
+    {
+        if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+        {
+            AddComponent(SceneComponent);
+        }
+    }
+}
+
+void FRenderScene::RemoveActor(AActor* Actor)
+{
+    if (!Actor || RegisteredActors.Remove(Actor) == 0)
+    {
+        return;
+    }
+
+    for (UActorComponent* Component : Actor->GetComponents())
+    {
+        if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+        {
+            RemoveComponent(SceneComponent);
+        }
+    }
+}
+
+void FRenderScene::AddComponent(USceneComponent* Component)
+{
+    if (!Component || Component->RenderSceneHandle.Scene || !RegisteredActors.Contains(Component->GetOwner()))
+    {
+        return;
+    }
+
+    const ERenderProxyType ProxyType = GetProxyType(Component);
+    if (ProxyType == ERenderProxyType::None)
+    {
+        return;
+    }
+
+    FRenderSceneHandle& Handle = Component->RenderSceneHandle;
+    Handle.Scene = this;
+    Handle.ProxyType = static_cast<uint8>(ProxyType);
+    Handle.ProxyIndex = INDEX_NONE;
+    Handle.PendingUpdateIndex = INDEX_NONE;
+
+    ++NumRegisteredComponents;
+    ++MaxPendingUpdates;
+    ReservePendingUpdates();
+
+    // Proxy는 UpdateDirtyProxies에서 만들어서, 등록 직후에 바뀐 Mesh나 활성 상태까지 한 번에 읽습니다.
+    MarkProxyDirty(Component, true);
+}
+
+void FRenderScene::RemoveComponent(USceneComponent* Component)
+{
+    if (!Component || Component->RenderSceneHandle.Scene != this)
+    {
+        return;
+    }
+
+    FRenderSceneHandle& Handle = Component->RenderSceneHandle;
+    if (Handle.PendingUpdateIndex != INDEX_NONE)
+    {
+        PendingUpdates[Handle.PendingUpdateIndex] = nullptr;
+    }
+    if (Handle.ProxyIndex != INDEX_NONE)
+    {
+        RemoveProxy(Component);
+    }
+
+    Handle = FRenderSceneHandle();
+    --NumRegisteredComponents;
+}
+
+void FRenderScene::MarkProxyDirty(USceneComponent* Component, bool bRenderStateDirty)
+{
+    FRenderSceneHandle& Handle = Component->RenderSceneHandle;
+    assert(Handle.Scene == this);
+
+    // Light, Billboard 등은 Transform을 Pass가 직접 읽으므로 움직여도 갱신할 것이 없습니다.
+    const ERenderProxyType ProxyType = static_cast<ERenderProxyType>(Handle.ProxyType);
+    const bool bHasTransformProxy = ProxyType == ERenderProxyType::StaticMesh || ProxyType == ERenderProxyType::SkeletalMesh;
+    if (!bRenderStateDirty && !bHasTransformProxy)
+    {
+        return;
+    }
+
+    if (bRenderStateDirty)
+    {
+        Handle.bRenderStateDirty.store(true, std::memory_order_relaxed);
+    }
+
+    // 여러 Worker가 같은 Component를 동시에 표시해도 exchange로 차지한 한 스레드만 자리를 받습니다.
+    if (Handle.bPendingUpdate.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    // Component마다 한 번만 들어오므로 MaxPendingUpdates를 넘지 않습니다.
+    const int32 Slot = NumPendingUpdates.fetch_add(1, std::memory_order_relaxed);
+    assert(Slot < PendingUpdates.Num());
+    PendingUpdates[Slot] = Component;
+    Handle.PendingUpdateIndex = Slot;
+}
+
+void FRenderScene::UpdateDirtyProxies()
+{
+    const int32 NumPending = NumPendingUpdates.load(std::memory_order_acquire);
+    for (int32 Index = 0; Index < NumPending; ++Index)
+    {
+        USceneComponent* Component = PendingUpdates[Index];
+        if (!Component)
+        {
+            continue;
+        }
+
+        FRenderSceneHandle& Handle = Component->RenderSceneHandle;
+        const bool bRenderStateDirty = Handle.bRenderStateDirty.exchange(false, std::memory_order_relaxed);
+        Handle.PendingUpdateIndex = INDEX_NONE;
+        Handle.bPendingUpdate.store(false, std::memory_order_release);
+
+        UpdateProxy(Component, bRenderStateDirty);
+    }
+
+    NumPendingUpdates.store(0, std::memory_order_relaxed);
+    MaxPendingUpdates = NumRegisteredComponents;
+}
+
+void FRenderScene::Release()
+{
+    // 아직 살아있는 Component의 Handle을 지워서, 이후 Transform이 바뀌어도 해제된 Scene에 접근하지 않도록 합니다.
+    const TArray<AActor*> Actors = RegisteredActors.Array();
+    for (AActor* Actor : Actors)
+    {
+        RemoveActor(Actor);
+    }
+
+    RegisteredActors.Empty();
+    StaticMeshProxies.Empty();
+    StaticMeshBounds.Empty();
+    SkeletalMeshProxies.Empty();
+    Billboards.Empty();
+    PointLights.Empty();
+    SpotLights.Empty();
+    DirectionalLights.Empty();
+    AmbientLights.Empty();
+    HeightFogs.Empty();
+    Shapes.Empty();
+    NumPendingUpdates.store(0, std::memory_order_relaxed);
+    MaxPendingUpdates = 0;
+    NumRegisteredComponents = 0;
+}
+
+void FRenderScene::ForEachLight(const std::function<void(ULightComponentBase*)>& Func) const
+{
+    for (UPointLightComponent* Light : PointLights)
+    {
+        Func(Light);
+    }
+    for (USpotLightComponent* Light : SpotLights)
+    {
+        Func(Light);
+    }
+    for (UDirectionalLightComponent* Light : DirectionalLights)
+    {
+        Func(Light);
+    }
+    for (UAmbientLightComponent* Light : AmbientLights)
+    {
+        Func(Light);
+    }
+}
+
+ERenderProxyType FRenderScene::GetProxyType(const USceneComponent* Component)
+{
+    // Gizmo는 GizmoRenderPass가 따로 그립니다.
+    if (Component->IsA<UGizmoBaseComponent>())
+    {
+        return ERenderProxyType::None;
+    }
+    if (Component->IsA<UStaticMeshComponent>())
+    {
+        return ERenderProxyType::StaticMesh;
+    }
+    if (Component->IsA<USkeletalMeshComponent>())
+    {
+        return ERenderProxyType::SkeletalMesh;
+    }
+    if (Component->IsA<UBillboardComponent>())
+    {
+        return ERenderProxyType::Billboard;
+    }
+    if (Component->IsA<UPointLightComponent>())
+    {
+        return ERenderProxyType::PointLight;
+    }
+    if (Component->IsA<USpotLightComponent>())
+    {
+        return ERenderProxyType::SpotLight;
+    }
+    if (Component->IsA<UDirectionalLightComponent>())
+    {
+        return ERenderProxyType::DirectionalLight;
+    }
+    if (Component->IsA<UAmbientLightComponent>())
+    {
+        return ERenderProxyType::AmbientLight;
+    }
+    if (Component->IsA<UHeightFogComponent>())
+    {
+        return ERenderProxyType::HeightFog;
+    }
+    if (Component->IsA<UShapeComponent>())
+    {
+        return ERenderProxyType::Shape;
+    }
+    return ERenderProxyType::None;
+}
+
+void FRenderScene::UpdateProxy(USceneComponent* Component, bool bRenderStateDirty)
+{
+    if (bRenderStateDirty)
+    {
+        ++Stats.NumRenderStateUpdates;
+    }
+
+    FRenderSceneHandle& Handle = Component->RenderSceneHandle;
+    switch (static_cast<ERenderProxyType>(Handle.ProxyType))
+    {
+    case ERenderProxyType::StaticMesh:
+        UpdateStaticMeshProxy(static_cast<UStaticMeshComponent*>(Component), bRenderStateDirty);
+        return;
+    case ERenderProxyType::SkeletalMesh:
+        UpdateSkeletalMeshProxy(static_cast<USkeletalMeshComponent*>(Component), bRenderStateDirty);
+        return;
+    default:
+        break;
+    }
+
+    // 목록에만 등록하는 종류는 처음 한 번만 넣습니다.
+    if (Handle.ProxyIndex != INDEX_NONE)
+    {
+        return;
+    }
+
+    switch (static_cast<ERenderProxyType>(Handle.ProxyType))
+    {
+    case ERenderProxyType::Billboard:
+        AddToList(Billboards, static_cast<UBillboardComponent*>(Component));
+        break;
+    case ERenderProxyType::PointLight:
+        AddToList(PointLights, static_cast<UPointLightComponent*>(Component));
+        break;
+    case ERenderProxyType::SpotLight:
+        AddToList(SpotLights, static_cast<USpotLightComponent*>(Component));
+        break;
+    case ERenderProxyType::DirectionalLight:
+        AddToList(DirectionalLights, static_cast<UDirectionalLightComponent*>(Component));
+        break;
+    case ERenderProxyType::AmbientLight:
+        AddToList(AmbientLights, static_cast<UAmbientLightComponent*>(Component));
+        break;
+    case ERenderProxyType::HeightFog:
+        AddToList(HeightFogs, static_cast<UHeightFogComponent*>(Component));
+        break;
+    case ERenderProxyType::Shape:
+        AddToList(Shapes, static_cast<UShapeComponent*>(Component));
+        break;
+    default:
+        break;
+    }
+}
+
+void FRenderScene::UpdateStaticMeshProxy(UStaticMeshComponent* Component, bool bRenderStateDirty)
+{
+    FRenderSceneHandle& Handle = Component->RenderSceneHandle;
+
+    if (bRenderStateDirty)
+    {
+        // 비활성이거나 Mesh가 없는 Component는 Proxy 없이 등록만 유지합니다.
+        const bool bShouldHaveProxy = Component->IsActive() && Component->GetStaticMesh() != nullptr;
+        if (!bShouldHaveProxy)
+        {
+            if (Handle.ProxyIndex != INDEX_NONE)
+            {
+                RemoveProxy(Component);
+            }
+            return;
+        }
+
+        if (Handle.ProxyIndex == INDEX_NONE)
+        {
+            Handle.ProxyIndex = StaticMeshProxies.Add(FStaticMeshSceneProxy());
+            StaticMeshBounds.AddBounds(FBoundingBox(), FMatrix::Identity);
+        }
+
+        FStaticMeshSceneProxy& Proxy = StaticMeshProxies[Handle.ProxyIndex];
+        Proxy.Component = Component;
+        Proxy.StaticMesh = Component->GetStaticMesh();
+        Proxy.LocalBounds = Component->GetBoundingBox();
+        Proxy.UUIDColor = Component->EncodeUUID() / 255.0f;
+        Proxy.OverrideMaterials = Component->GetOverrideMaterials();
+    }
+    else if (Handle.ProxyIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    ++Stats.NumTransformUpdates;
+
+    FStaticMeshSceneProxy& Proxy = StaticMeshProxies[Handle.ProxyIndex];
+    Proxy.WorldMatrix = Component->GetWorldMatrix();
+    Proxy.WorldInverseTransposeMatrix = Component->GetWorldInverseTransposeMatrix();
+    StaticMeshBounds.SetBounds(Handle.ProxyIndex, Proxy.LocalBounds, Proxy.WorldMatrix);
+}
+
+void FRenderScene::UpdateSkeletalMeshProxy(USkeletalMeshComponent* Component, bool bRenderStateDirty)
+{
+    FRenderSceneHandle& Handle = Component->RenderSceneHandle;
+
+    if (bRenderStateDirty)
+    {
+        const bool bShouldHaveProxy = Component->IsActive() && Component->GetSkeletalMesh() != nullptr;
+        if (!bShouldHaveProxy)
+        {
+            if (Handle.ProxyIndex != INDEX_NONE)
+            {
+                RemoveProxy(Component);
+            }
+            return;
+        }
+
+        if (Handle.ProxyIndex == INDEX_NONE)
+        {
+            Handle.ProxyIndex = SkeletalMeshProxies.Add(FSkeletalMeshSceneProxy());
+        }
+
+        FSkeletalMeshSceneProxy& Proxy = SkeletalMeshProxies[Handle.ProxyIndex];
+        Proxy.Component = Component;
+        Proxy.SkeletalMesh = Component->GetSkeletalMesh();
+        Proxy.LocalBounds = Component->GetBoundingBox();
+        Proxy.UUIDColor = Component->EncodeUUID() / 255.0f;
+        Proxy.OverrideMaterials = Component->GetOverrideMaterials();
+    }
+    else if (Handle.ProxyIndex == INDEX_NONE)
+    {
+        return;
+    }
+
+    ++Stats.NumTransformUpdates;
+
+    FSkeletalMeshSceneProxy& Proxy = SkeletalMeshProxies[Handle.ProxyIndex];
+    Proxy.WorldMatrix = Component->GetWorldMatrix();
+    Proxy.WorldInverseTransposeMatrix = Component->GetWorldInverseTransposeMatrix();
+}
+
+void FRenderScene::RemoveProxy(USceneComponent* Component)
+{
+    FRenderSceneHandle& Handle = Component->RenderSceneHandle;
+    const int32 Index = Handle.ProxyIndex;
+    Handle.ProxyIndex = INDEX_NONE;
+
+    switch (static_cast<ERenderProxyType>(Handle.ProxyType))
+    {
+    case ERenderProxyType::StaticMesh:
+        // Bounds도 Proxy와 같은 방식으로 옮겨서 Index를 맞춥니다.
+        RemoveAtSwap(StaticMeshProxies, Index);
+        StaticMeshBounds.RemoveAtSwap(Index);
+        break;
+    case ERenderProxyType::SkeletalMesh:
+        RemoveAtSwap(SkeletalMeshProxies, Index);
+        break;
+    case ERenderProxyType::Billboard:
+        RemoveAtSwap(Billboards, Index);
+        break;
+    case ERenderProxyType::PointLight:
+        RemoveAtSwap(PointLights, Index);
+        break;
+    case ERenderProxyType::SpotLight:
+        RemoveAtSwap(SpotLights, Index);
+        break;
+    case ERenderProxyType::DirectionalLight:
+        RemoveAtSwap(DirectionalLights, Index);
+        break;
+    case ERenderProxyType::AmbientLight:
+        RemoveAtSwap(AmbientLights, Index);
+        break;
+    case ERenderProxyType::HeightFog:
+        RemoveAtSwap(HeightFogs, Index);
+        break;
+    case ERenderProxyType::Shape:
+        RemoveAtSwap(Shapes, Index);
+        break;
+    default:
+        break;
+    }
+}
+
+void FRenderScene::ReservePendingUpdates()
+{
+    if (PendingUpdates.Num() < MaxPendingUpdates)
+    {
+        // 한 번에 많이 등록되는 경우를 위해 두 배씩 늘립니다.
+        PendingUpdates.SetNum(FMath::Max(MaxPendingUpdates, PendingUpdates.Num() * 2));
+    }
+}
@@ -0,0 +1,191 @@
+#pragma once
+#include <atomic>
+#include <functional>
+
+#include "Define.h"
+#include "Container/Array.h"
+#include "Container/Set.h"
+#include "Renderer/VisibilityCuller.h"
+
+class AActor;
+class UMaterial;
+class USceneComponent;
+class UStaticMesh;
+class UStaticMeshComponent;
+class USkeletalMesh;
+class USkeletalMeshComponent;
+class UBillboardComponent;
+class ULightComponentBase;
+class UPointLightComponent;
+class USpotLightComponent;
+class UDirectionalLightComponent;
+class UAmbientLightComponent;
+class UHeightFogComponent;
+class UShapeComponent;
+
+/** Render Scene이 Component를 나누는 종류, Component마다 하나로 정해집니다. */
+enum class ERenderProxyType : uint8
+{
+    None,
+    StaticMesh,
+    SkeletalMesh,
+    Billboard,
+    PointLight,
+    SpotLight,
+    DirectionalLight,
+    AmbientLight,
+    HeightFog,
+    Shape,
+};
+
+/** Static Mesh를 그릴 때 필요한 값, Transform이나 Mesh, Material이 바뀐 경우에만 다시 읽습니다. */
+struct FStaticMeshSceneProxy
+{
+    UStaticMeshComponent* Component = nullptr;
+    UStaticMesh* StaticMesh = nullptr;
+
+    FMatrix WorldMatrix;
+    FMatrix WorldInverseTransposeMatrix;
+    FBoundingBox LocalBounds;
+    FVector4 UUIDColor;
+    TArray<UMaterial*> OverrideMaterials;
+};
+
+/** Skeletal Mesh를 그릴 때 필요한 값, 정점 Skinning 결과는 매 프레임 바뀌므로 Component에서 직접 읽습니다. */
+struct FSkeletalMeshSceneProxy
+{
+    USkeletalMeshComponent* Component = nullptr;
+    USkeletalMesh* SkeletalMesh = nullptr;
+
+    FMatrix WorldMatrix;
+    FMatrix WorldInverseTransposeMatrix;
+    FBoundingBox LocalBounds;
+    FVector4 UUIDColor;
+    TArray<UMaterial*> OverrideMaterials;
+};
+
+/** Render Scene 통계, ResetStats()로 초기화 */
+struct FRenderSceneStats
+{
+    /** Transform만 다시 읽은 Proxy 수 */
+    uint32 NumTransformUpdates = 0;
+
+    /** Mesh, Material, 활성 상태까지 다시 읽은 Component 수 */
+    uint32 NumRenderStateUpdates = 0;
+};
+
+/**
+ * World에서 그려지는 Component를 종류별로 모아둔 목록
+ *
+ * 모든 Render Pass가 프레임마다 TObjectRange로 전체 Object를 순회하며 각자 목록을 만드는 대신,
+ * Level에 등록된 Actor의 Component를 여기에 한 번 등록해두고 Pass는 읽기만 합니다.
+ * Mesh Component는 World 행렬, Bounds, Mesh, Material을 Proxy에 복사해두고, Static Mesh의 월드 AABB는
+ * Proxy와 같은 Index로 FVisibilityCuller에 유지해서 Pass가 다시 계산하지 않습니다.
+ *
+ * Component가 움직이거나(MarkWorldTransformDirty) Mesh, Material, 활성 상태가 바뀌면(MarkRenderStateDirty)
+ * 갱신 대기 목록에 한 번만 들어가고, 렌더링 직전 UpdateDirtyProxies에서 바뀐 Component만 다시 읽습니다.
+ * 따라서 프레임마다 드는 비용은 전체 Component 수가 아닌 바뀐 Component 수에 비례합니다.
+ *
+ * 대기 목록은 등록된 Component 수만큼 미리 잡아두고 Atomic Index로 자리를 받으므로,
+ * 병렬 Component Tick에서 Transform을 바꿔도 Lock 없이 안전하게 쌓입니다.
+ * 등록, 제거, UpdateDirtyProxies는 Game Thread에서만 호출합니다.
+ *
+ * Light, Billboard, Fog, Shape는 Pass가 속성을 직접 읽으므로 종류별 목록에 Component만 등록합니다.
+ */
+class FRenderScene
+{
+public:
+    FRenderScene() = default;
+
+    FRenderScene(const FRenderScene&) = delete;
+    FRenderScene& operator=(const FRenderScene&) = delete;
+
+    /** Actor와 Actor의 Component를 등록합니다. 이후 Actor에 추가되는 Component도 등록됩니다. */
+    void AddActor(AActor* Actor);
+
+    /** Actor와 Actor의 Component를 모두 제거합니다. */
+    void RemoveActor(AActor* Actor);
+
+    /** 그려지는 종류의 Component라면 등록합니다. Owner가 등록되지 않았다면 무시합니다. */
+    void AddComponent(USceneComponent* Component);
+
+    /** 등록된 Component라면 Proxy와 함께 제거합니다. */
+    void RemoveComponent(USceneComponent* Component);
+
+    /**
+     * Component의 Proxy를 다음 UpdateDirtyProxies에서 다시 읽도록 표시합니다. 병렬 Tick에서도 호출할 수 있습니다.
+     * @param bRenderStateDirty false라면 Transform만 다시 읽습니다.
+     */
+    void MarkProxyDirty(USceneComponent* Component, bool bRenderStateDirty);
+
+    /** 표시된 Component의 Proxy를 갱신합니다. Pass가 목록을 읽기 전에 Game Thread에서 호출합니다. */
+    void UpdateDirtyProxies();
+
+    /** 모든 Component와 Actor를 제거합니다. World가 해제될 때 호출합니다. */
+    void Release();
+
+    const TArray<FStaticMeshSceneProxy>& GetStaticMeshProxies() const { return StaticMeshProxies; }
+
+    /** StaticMeshProxies와 같은 Index로 등록된 월드 AABB */
+    const FVisibilityCuller& GetStaticMeshBounds() const { return StaticMeshBounds; }
+
+    const TArray<FSkeletalMeshSceneProxy>& GetSkeletalMeshProxies() const { return SkeletalMeshProxies; }
+    const TArray<UBillboardComponent*>& GetBillboards() const { return Billboards; }
+    const TArray<UPointLightComponent*>& GetPointLights() const { return PointLights; }
+    const TArray<USpotLightComponent*>& GetSpotLights() const { return SpotLights; }
+    const TArray<UDirectionalLightComponent*>& GetDirectionalLights() const { return DirectionalLights; }
+    const TArray<UAmbientLightComponent*>& GetAmbientLights() const { return AmbientLights; }
+    const TArray<UHeightFogComponent*>& GetHeightFogs() const { return HeightFogs; }
+    const TArray<UShapeComponent*>& GetShapes() const { return Shapes; }
+
+    /** 모든 종류의 Light에 대해 Func를 호출합니다. */
+    void ForEachLight(const std::function<void(ULightComponentBase*)>& Func) const;
+
+    int32 GetNumRegisteredComponents() const { return NumRegisteredComponents; }
+
+    const FRenderSceneStats& GetStats() const { return Stats; }
+    void ResetStats() { Stats = FRenderSceneStats(); }
+
+private:
+    static ERenderProxyType GetProxyType(const USceneComponent* Component);
+
+    void UpdateProxy(USceneComponent* Component, bool bRenderStateDirty);
+    void UpdateStaticMeshProxy(UStaticMeshComponent* Component, bool bRenderStateDirty);
+    void UpdateSkeletalMeshProxy(USkeletalMeshComponent* Component, bool bRenderStateDirty);
+    void RemoveProxy(USceneComponent* Component);
+
+    /** 등록된 Component가 모두 한 번씩 대기 목록에 들어가도 넘치지 않도록 늘립니다. */
+    void ReservePendingUpdates();
+
+    template <typename ElementType>
+    static void AddToList(TArray<ElementType*>& List, ElementType* Component);
+
+    /** 마지막 원소를 Index 자리로 옮겨서 제거하고, 옮겨진 Component의 ProxyIndex를 고칩니다. */
+    template <typename ElementType>
+    static void RemoveAtSwap(TArray<ElementType>& List, int32 Index);
+
+private:
+    TSet<AActor*> RegisteredActors;
+    int32 NumRegisteredComponents = 0;
+
+    TArray<FStaticMeshSceneProxy> StaticMeshProxies;
+    FVisibilityCuller StaticMeshBounds;
+    TArray<FSkeletalMeshSceneProxy> SkeletalMeshProxies;
+
+    TArray<UBillboardComponent*> Billboards;
+    TArray<UPointLightComponent*> PointLights;
+    TArray<USpotLightComponent*> SpotLights;
+    TArray<UDirectionalLightComponent*> DirectionalLights;
+    TArray<UAmbientLightComponent*> AmbientLights;
+    TArray<UHeightFogComponent*> HeightFogs;
+    TArray<UShapeComponent*> Shapes;
+
+    /** 갱신 대기중인 Component, [0, NumPendingUpdates) 구간만 유효하고 제거된 Component의 자리는 nullptr입니다. */
+    TArray<USceneComponent*> PendingUpdates;
+    std::atomic<int32> NumPendingUpdates = 0;
+
+    /** 다음 UpdateDirtyProxies 전까지 대기 목록에 들어올 수 있는 최대 수, 제거된 Component의 자리도 포함합니다. */
+    int32 MaxPendingUpdates = 0;
+
+    FRenderSceneStats Stats;
+};
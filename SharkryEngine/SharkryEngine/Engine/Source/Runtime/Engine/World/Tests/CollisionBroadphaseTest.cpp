@@ -0,0 +1,219 @@
+#include "Misc/AutomationTest.h"
+#include <cmath>
+#include "WindowsPlatformTime.h"
+#include "World/CollisionBroadphase.h"
+
+namespace
+{
+    /** 실행마다 같은 배치가 나오도록 하는 간단한 난수 */
+    struct FTestRandom
+    {
+        uint32 State = 12345u;
+
+        uint32 Next()
+        {
+            State = State * 1664525u + 1013904223u;
+            return State >> 8;
+        }
+
+        float Range(float Min, float Max)
+        {
+            return Min + (Max - Min) * static_cast<float>(Next() & 0xFFFF) / 65535.f;
+        }
+    };
+
+    /** 밀도가 Proxy 수와 상관없이 비슷하도록, Proxy 수에 맞춰 커지는 공간에 흩어놓은 Shape 하나 */
+    struct FTestShape
+    {
+        FVector Center;
+        FVector Extent;
+        int32 ProxyId = INDEX_NONE;
+
+        FBoundingBox GetBounds() const { return FBoundingBox(Center - Extent, Center + Extent); }
+    };
+
+    bool Overlaps(const FBoundingBox& A, const FBoundingBox& B)
+    {
+        return A.min.X <= B.max.X && A.max.X >= B.min.X
+            && A.min.Y <= B.max.Y && A.max.Y >= B.min.Y
+            && A.min.Z <= B.max.Z && A.max.Z >= B.min.Z;
+    }
+
+    void MakeShapes(int32 NumShapes, FTestRandom& Random, TArray<FTestShape>& OutShapes)
+    {
+        const float WorldExtent = 2.f * std::cbrt(static_cast<float>(NumShapes));
+        for (int32 Index = 0; Index < NumShapes; ++Index)
+        {
+            FTestShape& Shape = OutShapes[OutShapes.Add(FTestShape())];
+            Shape.Center = FVector(Random.Range(-WorldExtent, WorldExtent), Random.Range(-WorldExtent, WorldExtent), Random.Range(-WorldExtent, WorldExtent));
+            Shape.Extent = FVector(Random.Range(0.2f, 1.f), Random.Range(0.2f, 1.f), Random.Range(0.2f, 1.f));
+        }
+    }
+
+    /** 프레임마다 Shape를 조금씩 움직입니다. 대부분은 Fat AABB 안에 머무릅니다. */
+    void JitterShapes(TArray<FTestShape>& Shapes, FTestRandom& Random, float MaxStep)
+    {
+        for (FTestShape& Shape : Shapes)
+        {
+            Shape.Center += FVector(Random.Range(-MaxStep, MaxStep), Random.Range(-MaxStep, MaxStep), Random.Range(-MaxStep, MaxStep));
+        }
+    }
+
+    /** 이전 방식처럼 모든 Shape 쌍을 비교해서 겹치는 쌍의 수를 셉니다. */
+    int32 CountOverlappingPairsBruteForce(const TArray<FTestShape>& Shapes)
+    {
+        int32 NumPairs = 0;
+        for (int32 A = 0; A < Shapes.Num(); ++A)
+        {
+            const FBoundingBox BoundsA = Shapes[A].GetBounds();
+            for (int32 B = A + 1; B < Shapes.Num(); ++B)
+            {
+                NumPairs += Overlaps(BoundsA, Shapes[B].GetBounds()) ? 1 : 0;
+            }
+        }
+        return NumPairs;
+    }
+
+    /** Shape마다 Broadphase Query로 후보를 받고, 실제 Bounds가 겹치는 쌍의 수를 셉니다. */
+    int32 CountOverlappingPairsBroadphase(const FCollisionBroadphase& Broadphase, const TArray<FTestShape>& Shapes)
+    {
+        int32 NumPairs = 0;
+        for (const FTestShape& Shape : Shapes)
+        {
+            const FBoundingBox Bounds = Shape.GetBounds();
+            Broadphase.Query(Bounds, [&Shape, &Bounds, &NumPairs](void* UserData)
+            {
+                const FTestShape* Other = static_cast<const FTestShape*>(UserData);
+                if (Other > &Shape && Overlaps(Bounds, Other->GetBounds()))
+                {
+                    ++NumPairs;
+                }
+                return true;
+            });
+        }
+        return NumPairs;
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FCollisionBroadphaseBruteForceTest, "Engine.World.CollisionBroadphase.MatchesBruteForce", EAutomationTestType::Unit)
+{
+    constexpr int32 NumShapes = 1000;
+    constexpr int32 NumFrames = 8;
+
+    FTestRandom Random;
+    TArray<FTestShape> Shapes;
+    Shapes.Reserve(NumShapes);
+    MakeShapes(NumShapes, Random, Shapes);
+
+    FCollisionBroadphase Broadphase;
+    for (FTestShape& Shape : Shapes)
+    {
+        Shape.ProxyId = Broadphase.CreateProxy(Shape.GetBounds(), &Shape);
+    }
+    TestEqual("Proxy count after creation", Broadphase.GetProxyCount(), NumShapes);
+
+    // 작은 이동(Fat AABB 안)과 큰 이동(재삽입)을 섞어서, 매 프레임 전수 비교와 같은 쌍을 찾는지 확인합니다.
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        JitterShapes(Shapes, Random, Frame % 2 == 0 ? 0.05f : 1.f);
+        for (const FTestShape& Shape : Shapes)
+        {
+            Broadphase.MoveProxy(Shape.ProxyId, Shape.GetBounds());
+        }
+
+        const int32 ExpectedPairs = CountOverlappingPairsBruteForce(Shapes);
+        const int32 FoundPairs = CountOverlappingPairsBroadphase(Broadphase, Shapes);
+        if (!TestEqual("Overlapping pairs found by the broadphase", FoundPairs, ExpectedPairs))
+        {
+            AddError(FString::Printf(TEXT("Frame %d"), Frame));
+            break;
+        }
+    }
+
+    // 절반을 제거해도 남은 Proxy끼리는 그대로 찾아야 하고, 제거한 Proxy는 후보로 나오지 않아야 합니다.
+    for (int32 Index = 0; Index < NumShapes; ++Index)
+    {
+        if (Index % 2 == 1)
+        {
+            Broadphase.DestroyProxy(Shapes[Index].ProxyId);
+        }
+    }
+    TestEqual("Proxy count after destroying half", Broadphase.GetProxyCount(), NumShapes / 2);
+
+    int32 NumDestroyedCandidates = 0;
+    for (int32 Index = 0; Index < NumShapes; Index += 2)
+    {
+        Broadphase.Query(Shapes[Index].GetBounds(), [&Shapes, &NumDestroyedCandidates](void* UserData)
+        {
+            const int32 OtherIndex = static_cast<int32>(static_cast<const FTestShape*>(UserData) - Shapes.GetData());
+            NumDestroyedCandidates += OtherIndex % 2 == 1 ? 1 : 0;
+            return true;
+        });
+    }
+    TestEqual("Destroyed proxies returned as candidates", NumDestroyedCandidates, 0);
+
+    Broadphase.Empty();
+    TestEqual("Proxy count after Empty", Broadphase.GetProxyCount(), 0);
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FCollisionBroadphaseBenchmark, "Engine.World.CollisionBroadphase.Scaling", EAutomationTestType::Benchmark)
+{
+    constexpr int32 ShapeCounts[] = { 1000, 5000, 20000 };
+    constexpr int32 NumFrames = 10;
+
+    for (const int32 NumShapes : ShapeCounts)
+    {
+        FTestRandom Random;
+        TArray<FTestShape> Shapes;
+        Shapes.Reserve(NumShapes);
+        MakeShapes(NumShapes, Random, Shapes);
+
+        FCollisionBroadphase Broadphase;
+        uint64 StartCycles = FPlatformTime::Cycles64();
+        for (FTestShape& Shape : Shapes)
+        {
+            Shape.ProxyId = Broadphase.CreateProxy(Shape.GetBounds(), &Shape);
+        }
+        const double BuildMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        // UWorld::UpdateCollisionBroadphase와 UpdateOverlaps처럼, 매 프레임 모든 Proxy를 갱신하고 모든 Shape로 Query합니다.
+        double UpdateMs = 0.0;
+        double QueryMs = 0.0;
+        uint32 NumReinserted = 0;
+        uint32 NumCandidates = 0;
+        int32 BroadphasePairs = 0;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            JitterShapes(Shapes, Random, 0.02f);
+            Broadphase.ResetStats();
+
+            StartCycles = FPlatformTime::Cycles64();
+            for (const FTestShape& Shape : Shapes)
+            {
+                Broadphase.MoveProxy(Shape.ProxyId, Shape.GetBounds());
+            }
+            const uint64 MidCycles = FPlatformTime::Cycles64();
+            BroadphasePairs = CountOverlappingPairsBroadphase(Broadphase, Shapes);
+            const uint64 EndCycles = FPlatformTime::Cycles64();
+
+            UpdateMs += FPlatformTime::ToMilliseconds(MidCycles - StartCycles);
+            QueryMs += FPlatformTime::ToMilliseconds(EndCycles - MidCycles);
+            NumReinserted += Broadphase.NumReinserted;
+            NumCandidates += Broadphase.NumCandidates;
+        }
+
+        // 전수 비교는 Shape 수의 제곱에 비례하므로 마지막 배치에 대해 한 번만 잽니다.
+        StartCycles = FPlatformTime::Cycles64();
+        const int32 BruteForcePairs = CountOverlappingPairsBruteForce(Shapes);
+        const double BruteForceMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+        TestEqual("Overlapping pairs found by the broadphase", BroadphasePairs, BruteForcePairs);
+        AddInfo(FString::Printf(TEXT("%d shapes: build %.3f ms, update %.3f ms/frame (%u reinserted), query %.3f ms/frame (%u candidates, %d pairs), height %d"),
+            NumShapes, BuildMs, UpdateMs / NumFrames, NumReinserted / NumFrames, QueryMs / NumFrames, NumCandidates / NumFrames, BroadphasePairs, Broadphase.GetHeight()));
+        AddInfo(FString::Printf(TEXT("%d shapes: brute force %.3f ms/frame"), NumShapes, BruteForceMs));
+    }
+    return true;
+}
@@ -0,0 +1,194 @@
+#include "Misc/AutomationTest.h"
+#include <cmath>
+#include "Async/JobSystem.h"
+#include "Components/StaticMeshComponent.h"
+#include "Components/Light/PointLightComponent.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/UObjectArray.h"
+#include "World/World.h"
+
+namespace
+{
+    /**
+     * Render Scene 테스트에 쓰는 World와 Mesh
+     * Render Data에 정점이 없으면 UStaticMesh::SetData가 Buffer를 만들지 않으므로, D3D Device 없이 Proxy를 만들 수 있습니다.
+     */
+    struct FRenderSceneTestWorld
+    {
+        OBJ::FStaticMeshRenderData RenderData;
+        UStaticMesh* Mesh = nullptr;
+        UWorld* World = nullptr;
+
+        FRenderSceneTestWorld()
+        {
+            RenderData.VertexBuffer = nullptr;
+            RenderData.IndexBuffer = nullptr;
+            RenderData.BoundingBoxMin = FVector(-1.f, -1.f, -1.f);
+            RenderData.BoundingBoxMax = FVector(1.f, 1.f, 1.f);
+
+            Mesh = FObjectFactory::ConstructObject<UStaticMesh>(nullptr);
+            Mesh->SetData(&RenderData);
+
+            World = UWorld::CreateWorld(GEngine, EWorldType::Editor, FString("AutomationTestWorld"));
+        }
+
+        ~FRenderSceneTestWorld()
+        {
+            World->Release();
+            GUObjectArray.MarkRemoveObject(World);
+            GUObjectArray.MarkRemoveObject(Mesh);
+            GUObjectArray.ProcessPendingDestroyObjects();
+        }
+
+        UStaticMeshComponent* SpawnMeshActor(const FVector& Location)
+        {
+            AActor* Actor = World->SpawnActor<AActor>();
+            UStaticMeshComponent* Component = Actor->AddComponent<UStaticMeshComponent>();
+            Component->SetStaticMesh(Mesh);
+            Component->SetRelativeLocation(Location);
+            return Component;
+        }
+
+        FRenderScene& GetScene() const { return World->GetRenderScene(); }
+    };
+
+    /**
+     * 모든 Proxy의 World 행렬과 같은 Index의 Culling Bounds가 Proxy의 Component와 일치하는지 셉니다.
+     * RemoveAtSwap이 Proxy와 Bounds를 다르게 옮기거나 Dirty 표시가 빠지면 어긋납니다.
+     */
+    int32 CountStaleProxies(const FRenderScene& Scene)
+    {
+        constexpr float Tolerance = 1.e-4f;
+
+        int32 NumStale = 0;
+        const TArray<FStaticMeshSceneProxy>& Proxies = Scene.GetStaticMeshProxies();
+        for (int32 Index = 0; Index < Proxies.Num(); ++Index)
+        {
+            const FVector Location = Proxies[Index].Component->GetWorldLocation();
+            const FVector ProxyLocation = Proxies[Index].WorldMatrix.GetTranslationVector();
+            const FVector BoundsCenter = Scene.GetStaticMeshBounds().GetCenter(Index);
+            if ((Location - ProxyLocation).Length() > Tolerance || (Location - BoundsCenter).Length() > Tolerance)
+            {
+                ++NumStale;
+            }
+        }
+        return NumStale;
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FRenderSceneProxyTest, "Engine.World.RenderScene.Proxies", EAutomationTestType::Unit)
+{
+    constexpr int32 NumActors = 64;
+
+    FRenderSceneTestWorld TestWorld;
+    FRenderScene& Scene = TestWorld.GetScene();
+
+    TArray<UStaticMeshComponent*> Components;
+    for (int32 Index = 0; Index < NumActors; ++Index)
+    {
+        Components.Add(TestWorld.SpawnMeshActor(FVector(Index * 10.f, 0.f, 0.f)));
+    }
+    Components[0]->GetOwner()->AddComponent<UPointLightComponent>();
+
+    // 등록: 첫 UpdateDirtyProxies에서 Proxy가 만들어집니다.
+    TestEqual("Static mesh proxies before the first update", Scene.GetStaticMeshProxies().Num(), 0);
+    Scene.UpdateDirtyProxies();
+    TestEqual("Static mesh proxies", Scene.GetStaticMeshProxies().Num(), NumActors);
+    TestEqual("Static mesh bounds", Scene.GetStaticMeshBounds().Num(), NumActors);
+    TestEqual("Point lights", Scene.GetPointLights().Num(), 1);
+    TestEqual("Stale proxies after registration", CountStaleProxies(Scene), 0);
+
+    // 바뀐 것이 없으면 아무것도 다시 읽지 않습니다.
+    Scene.ResetStats();
+    Scene.UpdateDirtyProxies();
+    TestEqual("Transform updates with nothing dirty", static_cast<int32>(Scene.GetStats().NumTransformUpdates), 0);
+
+    // Transform: 절반만 움직이고, 한 Component를 여러 번 움직여도 한 번만 다시 읽습니다.
+    for (int32 Index = 0; Index < NumActors; Index += 2)
+    {
+        Components[Index]->SetRelativeLocation(FVector(Index * 10.f, 5.f, 0.f));
+        Components[Index]->SetRelativeLocation(FVector(Index * 10.f, 7.f, 0.f));
+    }
+    Scene.ResetStats();
+    Scene.UpdateDirtyProxies();
+    TestEqual("Transform updates after moving half", static_cast<int32>(Scene.GetStats().NumTransformUpdates), NumActors / 2);
+    TestEqual("Render state updates after moving half", static_cast<int32>(Scene.GetStats().NumRenderStateUpdates), 0);
+    TestEqual("Stale proxies after moving half", CountStaleProxies(Scene), 0);
+
+    // Render State: 비활성화하면 Proxy가 빠지고, 다시 활성화하면 돌아옵니다.
+    Components[1]->Deactivate();
+    Components[2]->SetStaticMesh(nullptr);
+    Scene.UpdateDirtyProxies();
+    TestEqual("Static mesh proxies after deactivating", Scene.GetStaticMeshProxies().Num(), NumActors - 2);
+    TestEqual("Stale proxies after deactivating", CountStaleProxies(Scene), 0);
+
+    Components[1]->Activate();
+    Components[2]->SetStaticMesh(TestWorld.Mesh);
+    Scene.UpdateDirtyProxies();
+    TestEqual("Static mesh proxies after reactivating", Scene.GetStaticMeshProxies().Num(), NumActors);
+    TestEqual("Stale proxies after reactivating", CountStaleProxies(Scene), 0);
+
+    // 제거: 대기 목록에 들어간 Component를 Update 전에 제거해도 해제된 Component를 읽지 않아야 합니다.
+    const int32 NumRegistered = Scene.GetNumRegisteredComponents();
+    for (int32 Index = 0; Index < NumActors; Index += 4)
+    {
+        Components[Index]->SetRelativeLocation(FVector(Index * 10.f, -5.f, 0.f));
+        Components[Index]->GetOwner()->Destroy();
+    }
+    TestEqual("Proxies removed from the scene by Destroy", Scene.GetStaticMeshProxies().Num(), NumActors - NumActors / 4);
+    TestEqual("Registered components after Destroy", Scene.GetNumRegisteredComponents(), NumRegistered - NumActors / 4 - 1);
+
+    TestWorld.World->Tick(0.f);
+    GUObjectArray.ProcessPendingDestroyObjects();
+
+    Scene.ResetStats();
+    Scene.UpdateDirtyProxies();
+    TestEqual("Transform updates for destroyed components", static_cast<int32>(Scene.GetStats().NumTransformUpdates), 0);
+    TestEqual("Point lights after destroying the owner", Scene.GetPointLights().Num(), 0);
+    TestEqual("Stale proxies after destroying", CountStaleProxies(Scene), 0);
+
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FRenderScenePendingUpdateTest, "Engine.World.RenderScene.ParallelMarkDirty", EAutomationTestType::Unit)
+{
+    constexpr int32 NumActors = 4096;
+    constexpr int32 MarksPerComponent = 8;
+    constexpr int32 NumRounds = 16;
+
+    FRenderSceneTestWorld TestWorld;
+    FRenderScene& Scene = TestWorld.GetScene();
+
+    TArray<USceneComponent*> Components;
+    for (int32 Index = 0; Index < NumActors; ++Index)
+    {
+        Components.Add(TestWorld.SpawnMeshActor(FVector(Index * 10.f, 0.f, 0.f)));
+    }
+    Scene.UpdateDirtyProxies();
+
+    // 병렬 Tick처럼 여러 스레드가 같은 Component를 동시에 표시해도, 대기 목록에는 Component마다 한 번만 들어가야 합니다.
+    int32 NumWrongRounds = 0;
+    for (int32 Round = 0; Round < NumRounds; ++Round)
+    {
+        GJobSystem.ParallelFor(NumActors * MarksPerComponent, 64, [&Scene, &Components](int32 BeginIndex, int32 EndIndex)
+        {
+            for (int32 Index = BeginIndex; Index < EndIndex; ++Index)
+            {
+                // 같은 Component가 NumActors 간격으로 다시 나오므로, 서로 다른 Batch가 같은 Component를 표시합니다.
+                Scene.MarkProxyDirty(Components[Index % Components.Num()], false);
+            }
+        });
+
+        Scene.ResetStats();
+        Scene.UpdateDirtyProxies();
+        NumWrongRounds += static_cast<int32>(Scene.GetStats().NumTransformUpdates) != NumActors ? 1 : 0;
+    }
+    TestEqual("Rounds where a component was updated more or less than once", NumWrongRounds, 0);
+    TestEqual("Stale proxies after parallel marking", CountStaleProxies(Scene), 0);
+
+    return true;
+}
@@ -0,0 +1,111 @@
+#include "Misc/AutomationTest.h"
+#include "WindowsPlatformTime.h"
+#include "Components/ProjectileMovementComponent.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Casts.h"
+#include "UObject/UObjectArray.h"
+#include "World/World.h"
+
+namespace
+{
+    /** 에디터 World에서도 Tick하도록 설정한 Projectile Actor를 만듭니다. Projectile이 Root가 됩니다. */
+    AActor* SpawnProjectileActor(UWorld* World, int32 NumProjectiles = 1)
+    {
+        AActor* Actor = World->SpawnActor<AActor>();
+        Actor->SetActorTickInEditor(true);
+        for (int32 Index = 0; Index < NumProjectiles; ++Index)
+        {
+            Actor->AddComponent<UProjectileMovementComponent>();
+        }
+        return Actor;
+    }
+
+    void DestroyTestWorld(UWorld* World)
+    {
+        World->Release();
+        GUObjectArray.MarkRemoveObject(World);
+        GUObjectArray.ProcessPendingDestroyObjects();
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FTickTaskManagerParallelEligibilityTest, "Engine.World.Tick.ParallelEligibility", EAutomationTestType::Unit)
+{
+    UWorld* World = UWorld::CreateWorld(GEngine, EWorldType::Editor, FString("AutomationTestWorld"));
+
+    // A, B: B의 Root가 A의 Root에 붙어 있으므로 둘 다 Game Thread
+    // C: 병렬 Component가 둘이므로 첫 번째만 Worker
+    // D: 혼자 있으므로 Worker
+    AActor* ActorA = SpawnProjectileActor(World);
+    AActor* ActorB = SpawnProjectileActor(World);
+    SpawnProjectileActor(World, 2);
+    SpawnProjectileActor(World);
+    ActorB->GetRootComponent()->AttachToComponent(ActorA->GetRootComponent());
+
+    World->Tick(0.016f);
+    const FTickTaskStats& Stats = World->GetTickTaskManager().GetStats();
+    TestEqual("Parallel ticks with cross-actor attachment", static_cast<int32>(Stats.NumParallelComponentTicks), 2);
+    TestEqual("Game thread ticks with cross-actor attachment", static_cast<int32>(Stats.NumGameThreadComponentTicks), 3);
+
+    // 떼어내면 Tick 목록을 다시 모아서 A, B도 Worker에서 실행됩니다.
+    ActorB->GetRootComponent()->AttachToComponent(nullptr);
+
+    World->Tick(0.016f);
+    TestEqual("Parallel ticks after detaching", static_cast<int32>(Stats.NumParallelComponentTicks), 4);
+    TestEqual("Game thread ticks after detaching", static_cast<int32>(Stats.NumGameThreadComponentTicks), 1);
+
+    DestroyTestWorld(World);
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FTickTaskManagerHeadlessBenchmark, "Engine.World.Tick.Headless", EAutomationTestType::Benchmark)
+{
+    constexpr int32 ActorCounts[] = { 10000, 50000, 100000 };
+    constexpr int32 NumFrames = 10;
+    constexpr float DeltaTime = 0.016f;
+
+    for (const int32 NumActors : ActorCounts)
+    {
+        UWorld* World = UWorld::CreateWorld(GEngine, EWorldType::Editor, FString("AutomationTestWorld"));
+
+        TArray<UProjectileMovementComponent*> Projectiles;
+        for (int32 Index = 0; Index < NumActors; ++Index)
+        {
+            AActor* Actor = SpawnProjectileActor(World);
+            Projectiles.Add(Cast<UProjectileMovementComponent>(Actor->GetRootComponent()));
+        }
+
+        // 첫 Tick은 목록을 모으는 비용이 들어가므로 재지 않습니다.
+        World->Tick(DeltaTime);
+
+        auto MeasureFrames = [World, NumFrames, DeltaTime]()
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                World->Tick(DeltaTime);
+            }
+            return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) / NumFrames;
+        };
+
+        const double ParallelMs = MeasureFrames();
+        const uint32 NumParallelTicks = World->GetTickTaskManager().GetStats().NumParallelComponentTicks;
+
+        for (UProjectileMovementComponent* Projectile : Projectiles)
+        {
+            Projectile->PrimaryComponentTick.bRunOnAnyThread = false;
+        }
+        World->GetTickTaskManager().MarkTickListsDirty();
+        World->Tick(DeltaTime);
+
+        const double GameThreadMs = MeasureFrames();
+
+        TestEqual("Projectiles ticked on workers", static_cast<int32>(NumParallelTicks), NumActors);
+        AddInfo(FString::Printf(TEXT("%d actors: %.3f ms/frame on workers, %.3f ms/frame on the game thread"), NumActors, ParallelMs, GameThreadMs));
+
+        DestroyTestWorld(World);
+    }
+    return true;
+}
@@ -0,0 +1,148 @@
+#include "Misc/AutomationTest.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/WeakObjectPtr.h"
+#include "World/World.h"
+
+namespace
+{
+    /** 에디터 World와 같은 방식으로 Tick하는 테스트용 World, 테스트가 끝나면 함께 제거합니다. */
+    UWorld* CreateTestWorld()
+    {
+        return UWorld::CreateWorld(GEngine, EWorldType::Editor, FString("AutomationTestWorld"));
+    }
+
+    void DestroyTestWorld(UWorld* World)
+    {
+        World->Release();
+        GUObjectArray.MarkRemoveObject(World);
+        GUObjectArray.ProcessPendingDestroyObjects();
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FWorldDestructionWeakPointerTest, "Engine.World.Destruction.WeakPointers", EAutomationTestType::Unit)
+{
+    constexpr int32 NumActors = 2000;
+
+    UWorld* World = CreateTestWorld();
+
+    TArray<AActor*> Actors;
+    TArray<TWeakObjectPtr<AActor>> WeakActors;
+    TArray<TWeakObjectPtr<USceneComponent>> WeakComponents;
+    for (int32 Index = 0; Index < NumActors; ++Index)
+    {
+        AActor* Actor = World->SpawnActor<AActor>();
+        USceneComponent* Component = Actor->AddComponent<USceneComponent>();
+        Actors.Add(Actor);
+        WeakActors.Add(Actor);
+        WeakComponents.Add(Component);
+    }
+
+    // 홀수 번째만 제거하고, Tick 마지막의 일괄 처리와 실제 소멸까지 진행합니다.
+    for (int32 Index = 1; Index < NumActors; Index += 2)
+    {
+        Actors[Index]->Destroy();
+    }
+    World->Tick(0.f);
+    GUObjectArray.ProcessPendingDestroyObjects();
+
+    int32 NumWrongDestroyed = 0;
+    int32 NumWrongAlive = 0;
+    for (int32 Index = 0; Index < NumActors; ++Index)
+    {
+        if (Index % 2 == 1)
+        {
+            NumWrongDestroyed += (WeakActors[Index].Get() != nullptr || WeakComponents[Index].Get() != nullptr) ? 1 : 0;
+        }
+        else
+        {
+            NumWrongAlive += (WeakActors[Index].Get() != Actors[Index]) ? 1 : 0;
+        }
+    }
+    TestEqual("Destroyed actors still resolved by weak pointers", NumWrongDestroyed, 0);
+    TestEqual("Alive actors not resolved by weak pointers", NumWrongAlive, 0);
+
+    // 새로 만든 Object가 제거된 자리를 재사용해도, 이전 Weak Pointer는 새 Object를 가리키지 않아야 합니다.
+    TArray<AActor*> NewActors;
+    for (int32 Index = 0; Index < NumActors / 2; ++Index)
+    {
+        NewActors.Add(World->SpawnActor<AActor>());
+    }
+
+    int32 NumResolvedToNewObject = 0;
+    for (int32 Index = 1; Index < NumActors; Index += 2)
+    {
+        NumResolvedToNewObject += (WeakActors[Index].Get() != nullptr || WeakComponents[Index].Get() != nullptr) ? 1 : 0;
+    }
+    TestEqual("Old weak pointers resolved to objects in reused slots", NumResolvedToNewObject, 0);
+
+    const TWeakObjectPtr<AActor> NewWeakActor = NewActors[0];
+    TestTrue("Weak pointer to a new actor", NewWeakActor.Get() == NewActors[0]);
+
+    DestroyTestWorld(World);
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FWorldActorPoolWeakPointerTest, "Engine.World.ActorPool.WeakPointers", EAutomationTestType::Unit)
+{
+    constexpr int32 NumActors = 500;
+    constexpr int32 NumCycles = 20;
+
+    UWorld* World = CreateTestWorld();
+    World->EnableActorPool(AActor::StaticClass());
+
+    TArray<AActor*> Actors;
+    for (int32 Index = 0; Index < NumActors; ++Index)
+    {
+        AActor* Actor = World->AcquireActor<AActor>();
+        Actor->AddComponent<USceneComponent>();
+        Actors.Add(Actor);
+    }
+
+    int32 NumMissedPool = 0;
+    int32 NumStaleActors = 0;
+    int32 NumStaleComponents = 0;
+    int32 NumInvalidNewPointers = 0;
+    for (int32 Cycle = 0; Cycle < NumCycles; ++Cycle)
+    {
+        TArray<TWeakObjectPtr<AActor>> WeakActors;
+        TArray<TWeakObjectPtr<USceneComponent>> WeakComponents;
+        for (AActor* Actor : Actors)
+        {
+            WeakActors.Add(Actor);
+            WeakComponents.Add(Actor->GetRootComponent());
+            Actor->Destroy();
+        }
+        World->Tick(0.f);
+
+        // Pool에서 같은 Actor가 나오더라도, 반환 전에 만든 Weak Pointer는 재사용된 Actor를 가리키지 않아야 합니다.
+        TArray<AActor*> ReusedActors;
+        for (int32 Index = 0; Index < NumActors; ++Index)
+        {
+            ReusedActors.Add(World->AcquireActor<AActor>());
+        }
+
+        for (int32 Index = 0; Index < NumActors; ++Index)
+        {
+            NumStaleActors += WeakActors[Index].Get() != nullptr ? 1 : 0;
+            NumStaleComponents += WeakComponents[Index].Get() != nullptr ? 1 : 0;
+
+            const TWeakObjectPtr<AActor> NewWeakActor = ReusedActors[Index];
+            NumInvalidNewPointers += NewWeakActor.Get() != ReusedActors[Index] ? 1 : 0;
+            NumMissedPool += Actors.Contains(ReusedActors[Index]) ? 0 : 1;
+        }
+        Actors = ReusedActors;
+    }
+
+    TestEqual("Acquired actors that did not come from the pool", NumMissedPool, 0);
+    TestEqual("Weak pointers to pooled actors still valid after AcquireActor", NumStaleActors, 0);
+    TestEqual("Weak pointers to pooled components still valid after AcquireActor", NumStaleComponents, 0);
+    TestEqual("Weak pointers to acquired actors not valid", NumInvalidNewPointers, 0);
+
+    DestroyTestWorld(World);
+    return true;
+}
@@ -0,0 +1,264 @@
+#include "TickTaskManager.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "Async/JobSystem.h"
+#include "Level.h"
+#include "Components/ActorComponent.h"
+#include "Components/SceneComponent.h"
+#include "UObject/Casts.h"
+#include "GameFramework/Actor.h"
+
+void FTickTaskManager::StartFrame(const ULevel* Level, bool bEditorTickOnly)
+{
+    if (bTickListsDirty || Level != TickListLevel || bEditorTickOnly != bTickListsEditorOnly)
+    {
+        RebuildTickLists(Level, bEditorTickOnly);
+    }
+
+    Stats.NumActorTicks = 0;
+    Stats.NumGameThreadComponentTicks = 0;
+    Stats.NumParallelComponentTicks = 0;
+}
+
+void FTickTaskManager::RunTickGroup(ETickingGroup Group, float DeltaTime)
+{
+    FTickGroupList& List = TickGroups[Group];
+
+    // Tick 중에 Spawn, Destroy가 일어나도 목록은 다음 프레임에 다시 만들어지므로, 이번 프레임은 Index로 끝까지 순회합니다.
+    // 제거된 Actor, Component는 ProcessPendingDestroyObjects 전까지 메모리가 남아있으므로 플래그로 걸러냅니다.
+    for (int32 Index = 0; Index < List.Actors.Num(); ++Index)
+    {
+        AActor* Actor = List.Actors[Index];
+        float ActorDeltaTime;
+        if (!Actor->IsActorBeingDestroyed() && ConsumeTickInterval(Actor->PrimaryActorTick, DeltaTime, ActorDeltaTime))
+        {
+            Actor->Tick(ActorDeltaTime);
+            ++Stats.NumActorTicks;
+        }
+    }
+
+    for (int32 Index = 0; Index < List.GameThreadComponents.Num(); ++Index)
+    {
+        UActorComponent* Component = List.GameThreadComponents[Index];
+        float ComponentDeltaTime;
+        if (CanTickComponent(Component) && ConsumeTickInterval(Component->PrimaryComponentTick, DeltaTime, ComponentDeltaTime))
+        {
+            Component->TickComponent(ComponentDeltaTime);
+            ++Stats.NumGameThreadComponentTicks;
+        }
+    }
+
+    // Batch마다 센 뒤 한번만 더해서, Worker끼리 Counter를 두고 경합하지 않도록 합니다.
+    std::atomic<uint32> NumParallelTicks = 0;
+    const TArray<UActorComponent*>& ParallelComponents = List.ParallelComponents;
+    GJobSystem.ParallelFor(ParallelComponents.Num(), MinParallelTicksPerBatch, [&ParallelComponents, &NumParallelTicks, DeltaTime](int32 BeginIndex, int32 EndIndex)
+    {
+        uint32 NumTicks = 0;
+        for (int32 Index = BeginIndex; Index < EndIndex; ++Index)
+        {
+            UActorComponent* Component = ParallelComponents[Index];
+            float ComponentDeltaTime;
+            if (CanTickComponent(Component) && ConsumeTickInterval(Component->PrimaryComponentTick, DeltaTime, ComponentDeltaTime))
+            {
+                Component->TickComponent(ComponentDeltaTime);
+                ++NumTicks;
+            }
+        }
+        NumParallelTicks.fetch_add(NumTicks, std::memory_order_relaxed);
+    });
+    Stats.NumParallelComponentTicks += NumParallelTicks.load(std::memory_order_relaxed);
+
+    FlushGameThreadTasks();
+}
+
+void FTickTaskManager::QueueGameThreadTask(std::function<void()> Task)
+{
+    std::lock_guard Lock(GameThreadTaskMutex);
+    GameThreadTasks.Add(std::move(Task));
+}
+
+void FTickTaskManager::RebuildTickLists(const ULevel* Level, bool bEditorTickOnly)
+{
+    // Empty는 Capacity를 유지하므로, 목록이 자주 바뀌어도 다시 할당하지 않습니다.
+    for (FTickGroupList& List : TickGroups)
+    {
+        List.Actors.Empty();
+        List.GameThreadComponents.Empty();
+        List.ParallelComponents.Empty();
+    }
+
+    TickListLevel = Level;
+    bTickListsEditorOnly = bEditorTickOnly;
+    bTickListsDirty = false;
+    ++Stats.NumRebuilds;
+    Stats.NumRegisteredActors = 0;
+    Stats.NumRegisteredComponents = 0;
+    Stats.NumIdleComponents = 0;
+
+    if (!Level)
+    {
+        return;
+    }
+
+    ClassOrder.Empty();
+
+    for (AActor* Actor : Level->Actors)
+    {
+        if (!Actor || (bEditorTickOnly && !Actor->IsActorTickInEditor()))
+        {
+            continue;
+        }
+
+        if (Actor->PrimaryActorTick.IsTickFunctionEnabled())
+        {
+            TickGroups[Actor->PrimaryActorTick.TickGroup].Actors.Add(Actor);
+            ++Stats.NumRegisteredActors;
+        }
+
+        // 병렬 Tick이 가능한지는 병렬 Component가 있는 Actor에서만 처음 한 번 확인합니다.
+        bool bHasParallelComponent[TG_MAX] = {};
+        int32 AttachmentCheck = INDEX_NONE;
+
+        for (UActorComponent* Component : Actor->GetComponents())
+        {
+            const FTickFunction& TickFunction = Component->PrimaryComponentTick;
+            if (!TickFunction.IsTickFunctionEnabled())
+            {
+                ++Stats.NumIdleComponents;
+                continue;
+            }
+            ++Stats.NumRegisteredComponents;
+
+            if (!ClassOrder.Contains(Component->GetClass()))
+            {
+                ClassOrder.Add(Component->GetClass(), ClassOrder.Num());
+            }
+
+            FTickGroupList& List = TickGroups[TickFunction.TickGroup];
+            bool bCanRunOnWorker = TickFunction.bRunOnAnyThread && !bHasParallelComponent[TickFunction.TickGroup];
+            if (bCanRunOnWorker)
+            {
+                if (AttachmentCheck == INDEX_NONE)
+                {
+                    AttachmentCheck = IsAttachmentSelfContained(Actor) ? 1 : 0;
+                }
+                bCanRunOnWorker = AttachmentCheck == 1;
+            }
+
+            if (bCanRunOnWorker)
+            {
+                List.ParallelComponents.Add(Component);
+                bHasParallelComponent[TickFunction.TickGroup] = true;
+            }
+            else
+            {
+                List.GameThreadComponents.Add(Component);
+            }
+        }
+    }
+
+    // 같은 Class끼리 모읍니다.
+    for (FTickGroupList& List : TickGroups)
+    {
+        SortByClassOrder(List.GameThreadComponents);
+        SortByClassOrder(List.ParallelComponents);
+    }
+}
+
+void FTickTaskManager::SortByClassOrder(TArray<UActorComponent*>& Components)
+{
+    // 정렬 중에 Map을 찾지 않도록 Class 순서를 먼저 붙여두고, stable_sort로 Class 안에서는 Actor 순서를 유지합니다.
+    SortScratch.Empty();
+    for (UActorComponent* Component : Components)
+    {
+        SortScratch.Add({ ClassOrder[Component->GetClass()], Component });
+    }
+
+    std::ranges::stable_sort(SortScratch.GetContainerPrivate(), {}, &std::pair<int32, UActorComponent*>::first);
+
+    for (int32 Index = 0; Index < SortScratch.Num(); ++Index)
+    {
+        Components[Index] = SortScratch[Index].second;
+    }
+}
+
+void FTickTaskManager::FlushGameThreadTasks()
+{
+    // 작업 중에 다시 작업을 넣을 수 있으므로 목록을 떼어낸 뒤 실행합니다.
+    while (true)
+    {
+        TArray<std::function<void()>> Tasks;
+        {
+            std::lock_guard Lock(GameThreadTaskMutex);
+            if (GameThreadTasks.IsEmpty())
+            {
+                return;
+            }
+            Tasks = std::move(GameThreadTasks);
+            GameThreadTasks.Empty();
+        }
+
+        for (std::function<void()>& Task : Tasks)
+        {
+            Task();
+        }
+    }
+}
+
+bool FTickTaskManager::ConsumeTickInterval(FTickFunction& TickFunction, float DeltaTime, float& OutDeltaTime)
+{
+    if (TickFunction.TickInterval <= 0.0f)
+    {
+        OutDeltaTime = DeltaTime;
+        return true;
+    }
+
+    TickFunction.AccumulatedDeltaTime += DeltaTime;
+    if (TickFunction.AccumulatedDeltaTime < TickFunction.TickInterval)
+    {
+        return false;
+    }
+
+    OutDeltaTime = TickFunction.AccumulatedDeltaTime;
+    TickFunction.AccumulatedDeltaTime = 0.0f;
+    return true;
+}
+
+bool FTickTaskManager::IsAttachmentSelfContained(const AActor* Actor)
+{
+    for (const UActorComponent* Component : Actor->GetComponents())
+    {
+        const USceneComponent* SceneComponent = Cast<USceneComponent>(Component);
+        if (!SceneComponent)
+        {
+            continue;
+        }
+
+        const USceneComponent* Parent = SceneComponent->GetAttachParent();
+        if (Parent && Parent->GetOwner() != Actor)
+        {
+            return false;
+        }
+        for (const USceneComponent* Child : SceneComponent->GetAttachChildren())
+        {
+            if (Child && Child->GetOwner() != Actor)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool FTickTaskManager::CanTickComponent(const UActorComponent* Component)
+{
+    if (Component->IsBeingDestroyed())
+    {
+        return false;
+    }
+
+    const AActor* Owner = Component->GetOwner();
+    return !Owner || !Owner->IsActorBeingDestroyed();
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include <functional>
+#include <mutex>
+
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Engine/EngineTypes.h"
+
+class AActor;
+class UActorComponent;
+class UClass;
+class ULevel;
+
+/** 마지막 프레임의 Tick 수 */
+struct FTickTaskStats
+{
+    uint32 NumActorTicks = 0;
+    uint32 NumGameThreadComponentTicks = 0;
+    uint32 NumParallelComponentTicks = 0;
+
+    /** Tick 목록에 들어간 수, 목록을 다시 모을 때 갱신됩니다. TickInterval이 지나지 않은 프레임에는 등록되어 있어도 Tick하지 않습니다. */
+    uint32 NumRegisteredActors = 0;
+    uint32 NumRegisteredComponents = 0;
+
+    /** Level에 있지만 Tick이 꺼져 있거나 bCanEverTick이 false라서 목록에서 빠진 Component 수 */
+    uint32 NumIdleComponents = 0;
+
+    /** Tick 목록을 Level에서 다시 모은 횟수 */
+    uint32 NumRebuilds = 0;
+};
+
+/**
+ * World의 Actor, Component Tick을 Tick Group 순서대로 실행합니다.
+ *
+ * Tick 목록은 Group마다 Actor, Game Thread Component, 병렬 Component로 나눠서 유지하고,
+ * Level의 Actor나 Actor의 Component가 바뀌어 MarkTickListsDirty가 호출된 경우에만 다음 프레임 시작 시 다시 모읍니다.
+ * Tick이 꺼진 Component는 목록에 넣지 않으므로, 매 프레임 순회하는 것은 실제로 Tick하는 Component뿐입니다.
+ * Component 목록은 Class별로 모아두어서, 같은 TickComponent가 연달아 호출되고 같은 Slab의 Object를 이어서 읽습니다.
+ *
+ * 한 Group 안에서는 Actor Tick -> Game Thread Component Tick -> 병렬 Component Tick 순서로 실행하므로,
+ * Component는 같은 Group에 있는 Owner Actor의 Tick 결과를 볼 수 있습니다.
+ * 병렬 Component Tick은 GJobSystem의 Worker에서 실행되고, 모두 끝난 뒤 Game Thread로 넘긴 작업을 처리하고 다음 Group으로 넘어갑니다.
+ *
+ * Tick 사이의 순서는 Tick Group 순서와 위의 Group 안 순서뿐이고, Tick마다 선행 Tick을 지정하는 기능은 없습니다.
+ * 같은 단계 안의 Tick끼리는 순서를 가정할 수 없습니다.
+ *
+ * 병렬 Tick은 자기 Actor의 Transform을 바꾸고 World 변환 캐시를 채우므로, Attach 계층을 다른 Actor와 공유하면 경합합니다.
+ * 그래서 bRunOnAnyThread인 Component라도 다음 경우에는 Game Thread Component로 실행합니다.
+ * - Owner의 Scene Component가 다른 Actor의 Component에 붙어 있거나, 다른 Actor의 Component가 붙어 있는 경우
+ * - 같은 Group에서 같은 Owner의 병렬 Component가 이미 있는 경우 (첫 번째만 Worker에서 실행)
+ */
+class FTickTaskManager
+{
+public:
+    /** 병렬 Component Tick을 Batch 하나에 묶는 최소 개수 */
+    static constexpr int32 MinParallelTicksPerBatch = 64;
+
+    FTickTaskManager() = default;
+
+    FTickTaskManager(const FTickTaskManager&) = delete;
+    FTickTaskManager& operator=(const FTickTaskManager&) = delete;
+
+    /** 다음 프레임 시작 시 Tick 목록을 Level에서 다시 모으도록 표시합니다. */
+    void MarkTickListsDirty() { bTickListsDirty = true; }
+
+    /**
+     * 프레임의 Tick을 시작합니다. 목록이 바뀌었다면 Level의 Actor와 Component로 다시 만듭니다.
+     * @param bEditorTickOnly true라면 IsActorTickInEditor인 Actor와 그 Component만 Tick합니다.
+     */
+    void StartFrame(const ULevel* Level, bool bEditorTickOnly);
+
+    /** Group에 속한 Tick을 모두 실행하고, Tick 중에 Game Thread로 넘긴 작업까지 처리한 뒤 반환합니다. */
+    void RunTickGroup(ETickingGroup Group, float DeltaTime);
+
+    /**
+     * 병렬 Tick에서 Spawn, Destroy처럼 Game Thread에서만 할 수 있는 작업을 넘깁니다.
+     * 현재 Tick Group의 Tick이 모두 끝난 직후 Game Thread에서 넣은 순서대로 실행합니다.
+     */
+    void QueueGameThreadTask(std::function<void()> Task);
+
+    const FTickTaskStats& GetStats() const { return Stats; }
+
+private:
+    struct FTickGroupList
+    {
+        TArray<AActor*> Actors;
+        TArray<UActorComponent*> GameThreadComponents;
+        TArray<UActorComponent*> ParallelComponents;
+    };
+
+    void RebuildTickLists(const ULevel* Level, bool bEditorTickOnly);
+
+    /** Components를 Class가 Level에서 처음 나온 순서로 모읍니다. 같은 Class 안에서는 원래 순서를 유지합니다. */
+    void SortByClassOrder(TArray<UActorComponent*>& Components);
+
+    void FlushGameThreadTasks();
+
+    static bool CanTickComponent(const UActorComponent* Component);
+
+    /** Actor의 Scene Component들이 다른 Actor의 Component와 Attach로 이어져 있지 않은지 확인합니다. */
+    static bool IsAttachmentSelfContained(const AActor* Actor);
+
+    /** TickInterval이 지났다면 그동안 쌓인 DeltaTime을 OutDeltaTime에 넣고 true를 반환합니다. */
+    static bool ConsumeTickInterval(FTickFunction& TickFunction, float DeltaTime, float& OutDeltaTime);
+
+private:
+    FTickGroupList TickGroups[TG_MAX];
+
+    /** Tick 목록을 만든 조건, 바뀌면 다시 모읍니다. */
+    const ULevel* TickListLevel = nullptr;
+    bool bTickListsEditorOnly = false;
+    bool bTickListsDirty = true;
+
+    /** RebuildTickLists에서 Class마다 처음 나온 순서, 포인터 값과 달리 실행마다 같은 Tick 순서를 만듭니다. */
+    TMap<const UClass*, int32> ClassOrder;
+    TArray<std::pair<int32, UActorComponent*>> SortScratch;
+
+    std::mutex GameThreadTaskMutex;
+    TArray<std::function<void()>> GameThreadTasks;
+
+    FTickTaskStats Stats;
+};
@@ -6,9 +6,11 @@
 #include "Engine/Engine.h"
 #include "UnrealEd/SceneManager.h"
 #include "Components/PrimitiveComponent.h"
+#include "Components/Shapes/ShapeComponent.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/PlayerController.h"
 #include "Camera/PlayerCameraManager.h"
+#include "Stats/Stats.h"
 
 UWorld* UWorld::CreateWorld(UObject* InOuter, const EWorldType InWorldType, const FString& InWorldName)
 {
@@ -31,6 +33,10 @@ UObject* UWorld::Duplicate(UObject* InOuter)
     UWorld* NewWorld = Cast<UWorld>(Super::Duplicate(InOuter));
     NewWorld->ActiveLevel = Cast<ULevel>(ActiveLevel->Duplicate(NewWorld));
     NewWorld->ActiveLevel->InitLevel(NewWorld);
+    for (AActor* Actor : NewWorld->ActiveLevel->Actors)
+    {
+        NewWorld->RenderScene.AddActor(Actor);
+    }
     return NewWorld;
 }
 
@@ -63,43 +69,63 @@ void UWorld::Tick(float DeltaTime)
 
     if (WorldType != EWorldType::Editor)
     {
-        TArray<AActor*> PendingActors = PendingBeginPlayActors;
+        // BeginPlay 중에 Spawn된 Actor는 새 목록에 쌓여 다음 Tick에 BeginPlay가 호출됩니다.
+        TArray<AActor*> PendingActors = std::move(PendingBeginPlayActors);
+        PendingBeginPlayActors.Empty();
         for (AActor* Actor : PendingActors)
         {
             Actor->BeginPlay();
-            if (PendingBeginPlayActors.Contains(Actor))
-                PendingBeginPlayActors.Remove(Actor);
         }
         GetFirstPlayerController()->UpdateCameraManager(DeltaTime);
     }
-    TArray<AActor*> ActorsCopy = GetActiveLevel()->Actors;
 
-    for (AActor* Actor : ActorsCopy)
+    // 에디터에서는 IsActorTickInEditor인 Actor만 Tick합니다.
+    const bool bEditorTickOnly = WorldType == EWorldType::Editor || WorldType == EWorldType::Viewer;
+    TickTaskManager.StartFrame(ActiveLevel, bEditorTickOnly);
+
+    // 이번 Tick에서 바뀐 Proxy는 렌더링 직전에 갱신되므로, 통계는 그때까지 쌓인 값을 보여줍니다.
+    RenderScene.ResetStats();
     {
-        if (!Actor || Actor->IsActorBeingDestroyed())
-            continue;
+        QUICK_SCOPE_CYCLE_COUNTER(TickPrePhysics_CPU)
+        TickTaskManager.RunTickGroup(TG_PrePhysics, DeltaTime);
+        TickTaskManager.RunTickGroup(TG_DuringPhysics, DeltaTime);
+    }
+
+    UpdateComponentTransforms();
+    UpdateCollisionBroadphase();
 
-        Actor->UpdateOverlaps();
+    // Level의 Actor 목록은 FlushPendingActorRemovals에서만 줄어들고, Overlap 이벤트에서 Spawn된 Actor는 뒤에 붙으므로
+    // 시작할 때의 개수까지만 Index로 순회합니다.
+    const TArray<AActor*>& Actors = ActiveLevel->Actors;
+    const int32 NumActors = Actors.Num();
+    {
+        QUICK_SCOPE_CYCLE_COUNTER(UpdateOverlaps_CPU)
+        for (int32 Index = 0; Index < NumActors; ++Index)
+        {
+            AActor* Actor = Actors[Index];
+            if (!Actor || Actor->IsActorBeingDestroyed())
+                continue;
+
+            Actor->UpdateOverlaps();
+        }
     }
 
-    for (AActor* Actor : ActorsCopy)
+    for (int32 Index = 0; Index < NumActors; ++Index)
     {
+        AActor* Actor = Actors[Index];
         if (!Actor || Actor->IsActorBeingDestroyed())
             continue;
 
         Actor->ProcessOverlaps();
     }
 
-    if (!PendingDestroyActors.IsEmpty())
     {
-        for (AActor* Actor : PendingDestroyActors)
-        {
-            ActiveLevel->Actors.Remove(Actor);
-            GUObjectArray.MarkRemoveObject(Actor);
-        }
-        PendingDestroyActors.Empty();
+        QUICK_SCOPE_CYCLE_COUNTER(TickPostPhysics_CPU)
+        TickTaskManager.RunTickGroup(TG_PostPhysics, DeltaTime);
     }
 
+    FlushPendingActorRemovals();
+
     for (APlayerController* PlayerController : PlayerControllers)
     {
         if (PlayerController)
@@ -112,6 +138,25 @@ void UWorld::Tick(float DeltaTime)
 
 void UWorld::Release()
 {
+    // Level의 Actor들이 Pool로 반환되지 않고 실제로 제거되도록 Pool을 먼저 비웁니다.
+    TArray<AActor*> PooledActors = PendingReleaseActors;
+    PendingReleaseActors.Empty();
+    ActorPool.Empty(PooledActors);
+
+    TSet<AActor*> PooledActorSet;
+    PooledActorSet.Reserve(PooledActors.Num());
+    for (AActor* Actor : PooledActors)
+    {
+        PooledActorSet.Add(Actor);
+    }
+    RemoveActorsFromLevel(PooledActorSet);
+
+    for (AActor* Actor : PooledActors)
+    {
+        Actor->Destroyed();
+        GUObjectArray.MarkRemoveObject(Actor);
+    }
+
     if (ActiveLevel)
     {
         ActiveLevel->Release();
@@ -119,6 +164,16 @@ void UWorld::Release()
         ActiveLevel = nullptr;
     }
 
+    // Level의 Actor들은 Release 중에 Destroy되어 대기 목록에 쌓이므로, Level이 없어도 여기서 함께 제거합니다.
+    for (AActor* Actor : PendingDestroyActors)
+    {
+        GUObjectArray.MarkRemoveObject(Actor);
+    }
+    PendingDestroyActors.Empty();
+
+    // Level에서 빠지지 않고 제거되는 Actor가 남아있으므로, Object가 해제되기 전에 비웁니다.
+    RenderScene.Release();
+
     GUObjectArray.ProcessPendingDestroyObjects();
 }
 
@@ -135,8 +190,12 @@ AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
         AActor* NewActor = Cast<AActor>(FObjectFactory::ConstructObject(InClass, this, InActorName));
         ActiveLevel->Actors.Add(NewActor);
         PendingBeginPlayActors.Add(NewActor);
+        TickTaskManager.MarkTickListsDirty();
 
         NewActor->PostSpawnInitialize();
+
+        // 생성자와 PostSpawnInitialize에서 추가된 Component를 함께 등록합니다.
+        RenderScene.AddActor(NewActor);
         return NewActor;
     }
 
@@ -144,6 +203,53 @@ AActor* UWorld::SpawnActor(UClass* InClass, FName InActorName)
     return nullptr;
 }
 
+void UWorld::EnableActorPool(UClass* InClass, int32 PrewarmCount)
+{
+    if (!InClass || !InClass->IsChildOf<AActor>())
+    {
+        UE_LOG(LogLevel::Error, TEXT("EnableActorPool failed: Class is not derived from AActor."));
+        return;
+    }
+
+    ActorPool.Enable(InClass);
+
+    for (int32 Index = 0; Index < PrewarmCount; ++Index)
+    {
+        AActor* NewActor = Cast<AActor>(FObjectFactory::ConstructObject(InClass, this));
+        NewActor->PostSpawnInitialize();
+        NewActor->OnReleasedToPool();
+        ActorPool.Push(NewActor);
+    }
+}
+
+AActor* UWorld::AcquireActor(UClass* InClass)
+{
+    if (!InClass || !ActorPool.IsEnabled(InClass))
+    {
+        return SpawnActor(InClass);
+    }
+
+    FActorPoolStats& PoolStats = ActorPool.GetStats();
+    ++PoolStats.NumAcquired;
+
+    AActor* PooledActor = ActorPool.Pop(InClass);
+    if (!PooledActor)
+    {
+        return SpawnActor(InClass);
+    }
+
+    ++PoolStats.NumHits;
+
+    // 객체 생성과 GUObjectArray 등록 없이 Level에 다시 배치만 합니다.
+    PooledActor->OnAcquiredFromPool();
+    ActiveLevel->Actors.Add(PooledActor);
+    PendingBeginPlayActors.Add(PooledActor);
+    TickTaskManager.MarkTickListsDirty();
+    RenderScene.AddActor(PooledActor);
+
+    return PooledActor;
+}
+
 void UWorld::AddPlayerController(APlayerController* InPlayerController)
 {
     PlayerControllers.Add(InPlayerController);
@@ -170,6 +276,49 @@ bool UWorld::DestroyActor(AActor* ThisActor)
         return true;
     }
 
+    ClearEditorSelection(ThisActor);
+
+    ThisActor->Destroyed();
+    if (ThisActor->GetOwner())
+    {
+        ThisActor->SetOwner(nullptr);
+    }
+
+    // 실제 Remove는 나중에
+    PendingDestroyActors.Add(ThisActor);
+    return true;
+}
+
+bool UWorld::ReleaseActor(AActor* ThisActor)
+{
+    if (ThisActor->GetWorld() == nullptr)
+    {
+        return false;
+    }
+
+    if (ThisActor->IsActorBeingDestroyed())
+    {
+        return true;
+    }
+
+    ClearEditorSelection(ThisActor);
+
+    // 아직 BeginPlay 전에 반환된 경우
+    PendingBeginPlayActors.Remove(ThisActor);
+
+    ThisActor->EndPlay(EEndPlayReason::Destroyed);
+    if (ThisActor->GetOwner())
+    {
+        ThisActor->SetOwner(nullptr);
+    }
+
+    // Level에서 빼는건 Destroy와 마찬가지로 나중에
+    PendingReleaseActors.Add(ThisActor);
+    return true;
+}
+
+void UWorld::ClearEditorSelection(AActor* ThisActor) const
+{
     UEditorEngine* EditorEngine = Cast<UEditorEngine>(GEngine);
 
     if (EditorEngine->GetSelectedActor() == ThisActor)
@@ -180,16 +329,103 @@ bool UWorld::DestroyActor(AActor* ThisActor)
     {
         EditorEngine->DeselectComponent(EditorEngine->GetSelectedComponent());
     }
+}
 
-    ThisActor->Destroyed();
-    if (ThisActor->GetOwner())
+void UWorld::UpdateComponentTransforms()
+{
+    QUICK_SCOPE_CYCLE_COUNTER(UpdateComponentTransforms_CPU)
+
+    for (AActor* Actor : ActiveLevel->Actors)
     {
-        ThisActor->SetOwner(nullptr);
+        if (!Actor || Actor->IsActorBeingDestroyed())
+        {
+            continue;
+        }
+
+        if (USceneComponent* RootComponent = Actor->GetRootComponent())
+        {
+            RootComponent->UpdateWorldTransformTree();
+        }
     }
+}
 
-    // 실제 Remove는 나중에
-    PendingDestroyActors.Add(ThisActor);
-    return true;
+void UWorld::UpdateCollisionBroadphase()
+{
+    QUICK_SCOPE_CYCLE_COUNTER(CollisionBroadphase_CPU)
+
+    CollisionBroadphase.ResetStats();
+
+    for (AActor* Actor : ActiveLevel->Actors)
+    {
+        if (!Actor || Actor->IsActorBeingDestroyed())
+        {
+            continue;
+        }
+
+        for (UActorComponent* Component : Actor->GetComponents())
+        {
+            if (UShapeComponent* Shape = Cast<UShapeComponent>(Component))
+            {
+                Shape->UpdateBroadphaseProxy(CollisionBroadphase);
+            }
+        }
+    }
+}
+
+void UWorld::FlushPendingActorRemovals()
+{
+    if (PendingDestroyActors.IsEmpty() && PendingReleaseActors.IsEmpty())
+    {
+        return;
+    }
+
+    QUICK_SCOPE_CYCLE_COUNTER(FlushPendingActorRemovals_CPU)
+
+    // Actor마다 Level 목록을 검색해서 빼면 한 프레임에 많은 Actor가 제거될 때 O(N * M)이 되므로, 대상을 모아서 한 번에 뺍니다.
+    TSet<AActor*> RemovedActors;
+    RemovedActors.Reserve(PendingDestroyActors.Num() + PendingReleaseActors.Num());
+    for (AActor* Actor : PendingDestroyActors)
+    {
+        RemovedActors.Add(Actor);
+    }
+    for (AActor* Actor : PendingReleaseActors)
+    {
+        RemovedActors.Add(Actor);
+    }
+    RemoveActorsFromLevel(RemovedActors);
+
+    for (AActor* Actor : PendingDestroyActors)
+    {
+        GUObjectArray.MarkRemoveObject(Actor);
+    }
+    PendingDestroyActors.Empty();
+
+    for (AActor* Actor : PendingReleaseActors)
+    {
+        Actor->OnReleasedToPool();
+        ActorPool.Push(Actor);
+        ++ActorPool.GetStats().NumReleased;
+    }
+    PendingReleaseActors.Empty();
+}
+
+void UWorld::RemoveActorsFromLevel(const TSet<AActor*>& InActors)
+{
+    if (!ActiveLevel || InActors.IsEmpty())
+    {
+        return;
+    }
+
+    ActiveLevel->Actors.RemoveAll([&InActors](AActor* Actor)
+    {
+        return InActors.Contains(Actor);
+    });
+    TickTaskManager.MarkTickListsDirty();
+
+    for (AActor* Actor : InActors)
+    {
+        RenderScene.RemoveActor(Actor);
+    }
 }
 
 UWorld* UWorld::GetWorld() const
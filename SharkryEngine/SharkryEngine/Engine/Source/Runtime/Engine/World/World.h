@@ -5,6 +5,10 @@
 #include "UObject/ObjectMacros.h"
 #include "WorldType.h"
 #include "Level.h"
+#include "CollisionBroadphase.h"
+#include "ActorPool.h"
+#include "RenderScene.h"
+#include "TickTaskManager.h"
 
 class FObjectFactory;
 class AActor;
@@ -60,9 +64,63 @@ public:
 
     APlayerController* GetFirstPlayerController();
 
+    FCollisionBroadphase& GetCollisionBroadphase() { return CollisionBroadphase; }
+    const FCollisionBroadphase& GetCollisionBroadphase() const { return CollisionBroadphase; }
+
+    FTickTaskManager& GetTickTaskManager() { return TickTaskManager; }
+    const FTickTaskManager& GetTickTaskManager() const { return TickTaskManager; }
+
+    FRenderScene& GetRenderScene() { return RenderScene; }
+    const FRenderScene& GetRenderScene() const { return RenderScene; }
+
+public:
+    /**
+     * InClass의 Actor를 Pool로 재사용하도록 설정합니다.
+     * 설정 이후 해당 Class의 Actor는 Destroy 대신 Pool로 반환됩니다.
+     * @param PrewarmCount 미리 생성해 둘 Actor 수
+     */
+    void EnableActorPool(UClass* InClass, int32 PrewarmCount = 0);
+
+    bool IsActorPoolEnabled(const UClass* InClass) const { return ActorPool.IsEnabled(InClass); }
+
+    /**
+     * Pool에서 Actor를 꺼내 World에 다시 배치합니다.
+     * Pool이 비어있거나 사용하지 않는 Class라면 SpawnActor로 새로 생성합니다.
+     * 꺼낸 Actor는 다음 Tick에 BeginPlay가 다시 호출됩니다.
+     */
+    AActor* AcquireActor(UClass* InClass);
+
+    template <typename T>
+        requires std::derived_from<T, AActor>
+    T* AcquireActor();
+
+    const FActorPool& GetActorPool() const { return ActorPool; }
+
+private:
+    /** Level에 있는 Actor들의 Dirty인 World 변환 캐시를 부모 우선으로 한 번에 갱신합니다. */
+    void UpdateComponentTransforms();
+
+    /** Level에 있는 모든 Shape의 World Bounds를 Broadphase에 반영합니다. */
+    void UpdateCollisionBroadphase();
+
+    /**
+     * Tick 마지막에 Destroy, Release 대기중인 Actor를 한 번에 처리합니다.
+     * Level에서는 한 번의 압축으로 빼고, Destroy 대상은 GUObjectArray의 제거 대기 목록으로 넘깁니다.
+     */
+    void FlushPendingActorRemovals();
+
+    /** InActors를 Level의 Actor 목록에서 순서를 유지한 채 한 번에 뺍니다. */
+    void RemoveActorsFromLevel(const TSet<AActor*>& InActors);
+
 private:
     /** World에 존재하는 Actor를 제거합니다. */
     bool DestroyActor(AActor* ThisActor);
+
+    /** Actor의 EndPlay를 호출하고, Tick 마지막에 Level에서 빼서 Pool로 반환합니다. */
+    bool ReleaseActor(AActor* ThisActor);
+
+    /** 에디터에서 ThisActor 또는 그 Component가 선택되어 있다면 선택을 해제합니다. */
+    void ClearEditorSelection(AActor* ThisActor) const;
     
 private:
     FString WorldName = "DefaultWorld";
@@ -74,8 +132,23 @@ private:
 
     TArray<AActor*> PendingDestroyActors;
 
+    /** EndPlay가 호출되었고, Tick 마지막에 Pool로 반환될 Actor들 */
+    TArray<AActor*> PendingReleaseActors;
+
     TArray<APlayerController*> PlayerControllers;
 
+    /** Overlap 후보쌍 검색용 Broadphase */
+    FCollisionBroadphase CollisionBroadphase;
+
+    /** Class별 비활성 Actor Pool */
+    FActorPool ActorPool;
+
+    /** Tick Group별 Actor, Component Tick 목록 */
+    FTickTaskManager TickTaskManager;
+
+    /** Render Pass가 읽는 Level의 Primitive, Light 목록 */
+    FRenderScene RenderScene;
+
 public:
 
     float TimeSeconds;
@@ -89,6 +162,13 @@ T* UWorld::SpawnActor()
     return Cast<T>(SpawnActor(T::StaticClass()));
 }
 
+template <typename T>
+    requires std::derived_from<T, AActor>
+T* UWorld::AcquireActor()
+{
+    return Cast<T>(AcquireActor(T::StaticClass()));
+}
+
 template <typename T>
     requires std::derived_from<T, AActor>
 T* UWorld::DuplicateActor(T* InActor)
@@ -98,6 +178,8 @@ T* UWorld::DuplicateActor(T* InActor)
         T* NewActor = static_cast<T*>(InActor->Duplicate(this));
         ActiveLevel->Actors.Add(NewActor);
         PendingBeginPlayActors.Add(NewActor);
+        TickTaskManager.MarkTickListsDirty();
+        RenderScene.AddActor(NewActor);
         return NewActor;
     }
     return nullptr;
@@ -6,6 +6,12 @@
 #include "UnrealEd/EditorViewportClient.h"
 #include "World/World.h"
 
+UGizmoBaseComponent::UGizmoBaseComponent()
+{
+    // 카메라 거리에 맞춰 Gizmo 크기를 매 프레임 갱신합니다.
+    PrimaryComponentTick.bCanEverTick = true;
+}
+
 void UGizmoBaseComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
@@ -28,12 +34,12 @@ void UGizmoBaseComponent::TickComponent(float DeltaTime)
             float Scaler = (ViewportClient->GetPerspectiveCamera().GetLocation() - TransformGizmo->GetActorLocation()).Length();
             
             Scaler *= GizmoScale;
-            RelativeScale3D = FVector(Scaler);
+            SetRelativeScale3D(FVector(Scaler));
         }
         else
         {
             float Scaler = FEditorViewportClient::GetOrthoSize() * GizmoScale;
-            RelativeScale3D = FVector(Scaler);
+            SetRelativeScale3D(FVector(Scaler));
         }
     }
 }
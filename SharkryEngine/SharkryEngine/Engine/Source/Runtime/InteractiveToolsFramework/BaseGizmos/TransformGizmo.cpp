@@ -131,9 +131,9 @@ void ATransformGizmo::Tick(float DeltaTime)
 		return;
 	}
 	// [TEMP] Viewermode gizmo setting
-	FRotator GizmoRotation = Skeleton->CurrentPose.LocalTransforms[Skeleton->BoneNameToIndex[SelectedBone->Name]].ToQuat().Rotator();
+	FRotator GizmoRotation = SkeletalComp->GetPose().LocalTransforms[Skeleton->BoneNameToIndex[SelectedBone->Name]].ToQuat().Rotator();
 
-	FVector GizmoPosition = Skeleton->CurrentPose.GlobalTransforms[Skeleton->BoneNameToIndex[SelectedBone->Name]].GetTranslationVector();
+	FVector GizmoPosition = SkeletalComp->GetPose().GlobalTransforms[Skeleton->BoneNameToIndex[SelectedBone->Name]].GetTranslationVector();
 	SetActorLocation(GizmoPosition);
 	SetActorRotation(GizmoRotation);
 #else
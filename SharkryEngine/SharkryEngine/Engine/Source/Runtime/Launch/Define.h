@@ -24,6 +24,7 @@
 #define GOURAUD "LIGHTING_MODEL_GOURAUD"
 #define LAMBERT "LIGHTING_MODEL_LAMBERT"
 #define PHONG "LIGHTING_MODEL_BLINN_PHONG"
+#define INSTANCING "STATIC_MESH_INSTANCING"
 
 #ifndef MAX_BONE_INFLUENCES
 #define MAX_BONE_INFLUENCES 4
@@ -123,6 +124,23 @@ struct FObjMaterialInfo
 // Cooked Data
 namespace OBJ
 {
+    /** LOD 0의 Vertex Buffer를 그대로 쓰고 Index만 줄인 LOD, LOD 0은 FStaticMeshRenderData의 Indices와 MaterialSubsets입니다. */
+    struct FStaticMeshLODData
+    {
+        TArray<UINT> Indices;
+
+        /** LOD 0과 수와 순서가 같습니다. 모두 지워진 Subset은 IndexCount가 0입니다. */
+        TArray<FMaterialSubset> MaterialSubsets;
+
+        /** Bounds 반지름에 대한 최대 거리 오차 */
+        float Error = 0.0f;
+
+        /** Bounds가 화면 높이에서 차지하는 비율이 이 값보다 작으면 이 LOD를 씁니다. */
+        float ScreenSize = 0.0f;
+
+        ID3D11Buffer* IndexBuffer = nullptr;
+    };
+
     struct FStaticMeshRenderData
     {
         FWString ObjectName;
@@ -139,6 +157,9 @@ namespace OBJ
 
         FVector BoundingBoxMin;
         FVector BoundingBoxMax;
+
+        /** LOD 1부터, ScreenSize가 줄어드는 순서입니다. */
+        TArray<FStaticMeshLODData> LODs;
     };
 }
 struct FVertexTexture
@@ -2,6 +2,7 @@
 #include "ImGuiManager.h"
 #include "UnrealClient.h"
 #include "WindowsPlatformTime.h"
+#include "Async/JobSystem.h"
 #include "Audio/AudioManager.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "Engine/EditorEngine.h"
@@ -49,6 +50,9 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
 {
     FPlatformTime::InitTiming();
 
+    // Tick, Skinning 등에서 사용하는 Worker 스레드 생성
+    GJobSystem.Initialize();
+
     /* must be initialized before window. */
     WindowInit(hInstance);
 
@@ -88,6 +92,10 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
     EngineProfiler.RegisterStatScope(TEXT("|- GizmoPass"), FName(TEXT("GizmoPass_CPU")), FName(TEXT("GizmoPass_GPU")));
     EngineProfiler.RegisterStatScope(TEXT("|- CompositingPass"), FName(TEXT("CompositingPass_CPU")), FName(TEXT("CompositingPass_GPU")));
     EngineProfiler.RegisterStatScope(TEXT("SlatePass"), FName(TEXT("SlatePass_CPU")), FName(TEXT("SlatePass_GPU")));
+    EngineProfiler.RegisterStatScope(TEXT("UpdateComponentTransforms"), FName(TEXT("UpdateComponentTransforms_CPU")), FName(TEXT("UpdateComponentTransforms_GPU")));
+    EngineProfiler.RegisterStatScope(TEXT("CollisionBroadphase"), FName(TEXT("CollisionBroadphase_CPU")), FName(TEXT("CollisionBroadphase_GPU")));
+    EngineProfiler.RegisterStatScope(TEXT("UpdateOverlaps"), FName(TEXT("UpdateOverlaps_CPU")), FName(TEXT("UpdateOverlaps_GPU")));
+    EngineProfiler.RegisterStatScope(TEXT("CPUSkinning"), FName(TEXT("CPUSkinning_CPU")), FName(TEXT("CPUSkinning_GPU")));
 
     BufferManager->Initialize(GraphicDevice.Device, GraphicDevice.DeviceContext);
     Renderer.Initialize(&GraphicDevice, BufferManager, &GPUTimingManager);
@@ -111,6 +119,7 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
 void FEngineLoop::Render() const
 {
     GraphicDevice.Prepare();
+    BufferManager->BeginUploadFrame();
 
     std::shared_ptr<FEditorViewportClient> ActiveViewportCache = GetLevelEditor()->GetActiveViewportClient();
     if (LevelEditor->IsMultiViewport())
@@ -245,6 +254,7 @@ void FEngineLoop::Exit()
 
 
     GEngine->Release();
+    GJobSystem.Shutdown();
 
     delete UnrealEditor;
     delete BufferManager;
@@ -1,5 +1,9 @@
 #include "Core/HAL/PlatformType.h"
 #include "EngineLoop.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Parse.h"
+#include <cstring>
+#include <fstream>
 #include <windows.h>
 #include <shellapi.h>
 #include <shlwapi.h> // PathRemoveFileSpecW
@@ -11,6 +15,49 @@ FEngineLoop GEngineLoop;
 FWString GViewerFilePath;
 #endif
 
+/**
+ * -automation[=Filter] 또는 -benchmark[=Filter] 인자가 있으면 엔진 초기화 뒤 해당 테스트만 실행합니다.
+ * 결과는 AutomationReport.txt에 쓰고, 실패한 테스트 수를 OutExitCode로 반환합니다.
+ * @return 테스트를 실행했다면 true
+ */
+static bool RunAutomationFromCommandLine(int32& OutExitCode)
+{
+    const TCHAR* CommandLine = GetCommandLineA();
+
+    EAutomationTestType TestType;
+    const TCHAR* Match;
+    if (std::strstr(CommandLine, TEXT("-automation")))
+    {
+        TestType = EAutomationTestType::Unit;
+        Match = TEXT("-automation=");
+    }
+    else if (std::strstr(CommandLine, TEXT("-benchmark")))
+    {
+        TestType = EAutomationTestType::Benchmark;
+        Match = TEXT("-benchmark=");
+    }
+    else
+    {
+        return false;
+    }
+
+    TCHAR FilterBuffer[256] = {};
+    FParse::Value(CommandLine, Match, FilterBuffer, 256);
+
+    TArray<FAutomationTestResult> Results;
+    OutExitCode = FAutomationTestFramework::Get().RunTests(FString(FilterBuffer), TestType, Results);
+
+    TArray<FString> Lines;
+    FAutomationTestFramework::FormatResults(Results, Lines);
+
+    std::ofstream Report("AutomationReport.txt");
+    for (const FString& Line : Lines)
+    {
+        Report << *Line << '\n';
+    }
+    return true;
+}
+
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nShowCmd)
 {
     UNREFERENCED_PARAMETER(hPrevInstance);
@@ -34,6 +81,14 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 #endif
 
     GEngineLoop.Init(hInstance);
+
+    int32 AutomationExitCode = 0;
+    if (RunAutomationFromCommandLine(AutomationExitCode))
+    {
+        GEngineLoop.Exit();
+        return AutomationExitCode;
+    }
+
     GEngineLoop.Tick();
     GEngineLoop.Exit();
 
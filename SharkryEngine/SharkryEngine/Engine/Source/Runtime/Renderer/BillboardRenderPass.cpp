@@ -44,14 +44,7 @@ void FBillboardRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGraph
 
 void FBillboardRenderPass::PrepareRenderArr()
 {
-    BillboardComps.Empty();
-    for (const auto iter : TObjectRange<UBillboardComponent>())
-    {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            BillboardComps.Add(iter);
-        }
-    }
+    BillboardComps = GEngine->ActiveWorld->GetRenderScene().GetBillboards();
 }
 
 void FBillboardRenderPass::PrepareTextureShader() const
@@ -81,7 +74,7 @@ void FBillboardRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, cons
 {
     FObjectConstantBuffer ObjectData = {};
     ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::InverseAffine(WorldMatrix));
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
     
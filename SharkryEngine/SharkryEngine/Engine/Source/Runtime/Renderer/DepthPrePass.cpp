@@ -59,6 +59,8 @@ void FDepthPrePass::PrepareRenderState(const std::shared_ptr<FViewportClient>& V
     
     VertexShader = ShaderManager->GetVertexShaderByKey(L"StaticMeshVertexShader");
     InputLayout = ShaderManager->GetInputLayoutByKey(L"StaticMeshVertexShader");
+    InstancedVertexShader = ShaderManager->GetVertexShaderByKey(L"INSTANCED_StaticMeshVertexShader");
+    InstancedInputLayout = ShaderManager->GetInputLayoutByKey(L"INSTANCED_StaticMeshVertexShader");
     
     Graphics->DeviceContext->VSSetShader(VertexShader, nullptr, 0);
     Graphics->DeviceContext->IASetInputLayout(InputLayout);
@@ -3,7 +3,7 @@
 
 #include "UnrealClient.h"
 #include "Engine/Engine.h"
-#include "UObject/UObjectIterator.h"
+#include "World/World.h"
 #include "Components/BillboardComponent.h"
 
 FEditorBillboardRenderPass::FEditorBillboardRenderPass()
@@ -14,9 +14,9 @@ FEditorBillboardRenderPass::FEditorBillboardRenderPass()
 void FEditorBillboardRenderPass::PrepareRenderArr()
 {
     BillboardComps.Empty();
-    for (const auto Component : TObjectRange<UBillboardComponent>())
+    for (UBillboardComponent* Component : GEngine->ActiveWorld->GetRenderScene().GetBillboards())
     {
-        if (Component->GetWorld() == GEngine->ActiveWorld && Component->bIsEditorBillboard)
+        if (Component->bIsEditorBillboard)
         {
             BillboardComps.Add(Component);
         }
@@ -10,8 +10,6 @@
 #include "UnrealClient.h"
 #include "Engine/Source/Runtime/Engine/World/World.h"
 #include "UnrealEd/EditorViewportClient.h"
-#include "UObject/UObjectIterator.h"
-#include "BaseGizmos/GizmoBaseComponent.h"
 #include "Components/Shapes/BoxComponent.h"
 #include "Components/Shapes/CapsuleComponent.h"
 #include "Components/Shapes/SphereComponent.h"
@@ -395,51 +393,37 @@ void FEditorRenderPass::PrepareRenderArr()
         return;
     }
     
-    // gizmo 제외하고 넣기
-    for (const auto* Actor : TObjectRange<AActor>())
-    {
-        if (!Actor->IsActorBeingDestroyed() && Actor->GetWorld() != GEngine->ActiveWorld)
-        {
-            continue;
-        }
-        
-        for (const auto* Component : Actor->GetComponents())
-        {
-            // AABB용 static mesh component
-            if (UStaticMeshComponent* StaticMesh = Cast<UStaticMeshComponent>(Component))
-            {
-                if (!StaticMesh->IsA<UGizmoBaseComponent>())
-                {
-                    Resources.Components.StaticMeshComponent.Add(StaticMesh);
-                }
-            }
+    // Render Scene은 Gizmo를 등록하지 않습니다.
+    const FRenderScene& RenderScene = GEngine->ActiveWorld->GetRenderScene();
 
-            // light
-            if (ULightComponentBase* light = Cast<ULightComponentBase>(Component))
-            {
-                Resources.Components.Light.Add(light);
-            }
+    // AABB용 static mesh component
+    for (const FStaticMeshSceneProxy& Proxy : RenderScene.GetStaticMeshProxies())
+    {
+        Resources.Components.StaticMeshComponent.Add(Proxy.Component);
+    }
 
-            // fog
-            if (UHeightFogComponent* fog = Cast<UHeightFogComponent>(Component))
-            {
-                Resources.Components.Fog.Add(fog);
-            }
+    // light
+    RenderScene.ForEachLight([this](ULightComponentBase* Light)
+    {
+        Resources.Components.Light.Add(Light);
+    });
 
-            if (USphereComponent* SphereComponent = Cast<USphereComponent>(Component))
-            {
-                Resources.Components.SphereComponents.Add(SphereComponent);
-            }
+    // fog
+    Resources.Components.Fog = RenderScene.GetHeightFogs();
 
-            if (UBoxComponent* BoxComponent = Cast<UBoxComponent>(Component))
-            {
-                Resources.Components.BoxComponents.Add(BoxComponent);
-            }
-            
-            if (UCapsuleComponent* CapsuleComponent = Cast<UCapsuleComponent>(Component))
-            {
-                Resources.Components.CapsuleComponents.Add(CapsuleComponent);
-            }
+    for (UShapeComponent* Shape : RenderScene.GetShapes())
+    {
+        if (USphereComponent* SphereComponent = Cast<USphereComponent>(Shape))
+        {
+            Resources.Components.SphereComponents.Add(SphereComponent);
+        }
+        else if (UBoxComponent* BoxComponent = Cast<UBoxComponent>(Shape))
+        {
+            Resources.Components.BoxComponents.Add(BoxComponent);
+        }
+        else if (UCapsuleComponent* CapsuleComponent = Cast<UCapsuleComponent>(Shape))
+        {
+            Resources.Components.CapsuleComponents.Add(CapsuleComponent);
         }
     }
 }
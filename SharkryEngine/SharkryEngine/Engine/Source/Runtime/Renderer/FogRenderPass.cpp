@@ -6,7 +6,7 @@
 #include "Define.h"
 #include "Engine/Classes/GameFramework/Actor.h"
 #include <wchar.h>
-#include <UObject/UObjectIterator.h>
+#include "World/World.h"
 #include <Engine/Engine.h>
 
 #include "RendererHelpers.h"
@@ -64,13 +64,7 @@ void FFogRenderPass::ReleaseShader()
 
 void FFogRenderPass::PrepareRenderArr()
 {
-    for (const auto iter : TObjectRange<UHeightFogComponent>())
-    {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            FogComponents.Add(iter);
-        }
-    }
+    FogComponents = GEngine->ActiveWorld->GetRenderScene().GetHeightFogs();
 }
 
 void FFogRenderPass::ClearRenderArr()
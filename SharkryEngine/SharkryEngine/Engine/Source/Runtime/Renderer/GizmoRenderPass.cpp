@@ -183,7 +183,7 @@ void FGizmoRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FV
 {
     FObjectConstantBuffer ObjectData = {};
     ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::InverseAffine(WorldMatrix));
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
     
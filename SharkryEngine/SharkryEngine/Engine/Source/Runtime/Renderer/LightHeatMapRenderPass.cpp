@@ -6,7 +6,7 @@
 #include "UnrealEd/EditorViewportClient.h"
 #include "Define.h"
 #include "Engine/Classes/GameFramework/Actor.h"
-#include <UObject/UObjectIterator.h>
+#include "World/World.h"
 #include <Engine/Engine.h>
 
 FLightHeatMapRenderPass::FLightHeatMapRenderPass()
@@ -70,14 +70,7 @@ void FLightHeatMapRenderPass::CreateShader()
 
 void FLightHeatMapRenderPass::PrepareRender()
 {
-    for (const auto iter : TObjectRange<UHeightFogComponent>())
-    {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            FogComponents.Add(iter);
-        }
-    }
-
+    FogComponents = GEngine->ActiveWorld->GetRenderScene().GetHeightFogs();
 }
 
 void FLightHeatMapRenderPass::ClearRenderArr()
@@ -0,0 +1,213 @@
+#include "MeshDrawCommandList.h"
+
+void FMeshDrawBindCounts::Add(const FMeshDrawBinds& Binds)
+{
+    ++NumDrawCalls;
+    NumShaderBinds += Binds.bShader;
+    NumVertexBufferBinds += Binds.bVertexBuffer;
+    NumIndexBufferBinds += Binds.bIndexBuffer;
+    NumObjectBinds += Binds.bObject;
+    NumMaterialBinds += Binds.bMaterial;
+    NumTextureBinds += Binds.bTextures;
+    NumSubMeshUpdates += Binds.bSubMesh;
+}
+
+uint64 FMeshDrawCommandList::MakeSortKey(uint32 Pass, uint32 ShaderId, int32 MaterialId, uint32 MeshId, float Depth01)
+{
+    constexpr uint64 PassMask = (1ull << PassBits) - 1;
+    constexpr uint64 ShaderMask = (1ull << ShaderBits) - 1;
+    constexpr uint64 MaterialMask = (1ull << MaterialBits) - 1;
+    constexpr uint64 MeshMask = (1ull << MeshBits) - 1;
+    constexpr uint64 DepthMask = (1ull << DepthBits) - 1;
+
+    // 재질이 없는 명령은 가장 큰 값으로 두고, 재질 Id는 그보다 작게 자릅니다.
+    const uint64 MaterialKey = MaterialId == INDEX_NONE ? MaterialMask : std::min<uint64>(static_cast<uint64>(MaterialId), MaterialMask - 1);
+
+    // NaN도 0으로 보내도록 비교를 뒤집어 둡니다.
+    const float ClampedDepth = !(Depth01 > 0.0f) ? 0.0f : (Depth01 < 1.0f ? Depth01 : 1.0f);
+    const uint64 DepthKey = static_cast<uint64>(ClampedDepth * static_cast<float>(DepthMask));
+
+    uint64 Key = Pass & PassMask;
+    Key = Key << ShaderBits | (ShaderId & ShaderMask);
+    Key = Key << MaterialBits | MaterialKey;
+    Key = Key << MeshBits | (MeshId & MeshMask);
+    Key = Key << DepthBits | DepthKey;
+    return Key;
+}
+
+void FMeshDrawCommandList::Reset()
+{
+    Commands.Empty();
+    SortedOrder.Empty();
+    Materials.Empty();
+    MaterialIds.Empty();
+    MeshIds.Empty();
+    LastAddedObjectIndex = ~0u;
+    LastAddedFirstInstance = ~0u;
+}
+
+int32 FMeshDrawCommandList::FindMaterial(const FObjMaterialInfo* MaterialInfo) const
+{
+    const int32* MaterialId = MaterialIds.Find(MaterialInfo);
+    return MaterialId ? *MaterialId : INDEX_NONE;
+}
+
+int32 FMeshDrawCommandList::AddMaterial(const FMeshDrawMaterial& Material)
+{
+    const int32 MaterialId = Materials.Add(Material);
+    MaterialIds.Add(Material.MaterialInfo, MaterialId);
+    return MaterialId;
+}
+
+uint32 FMeshDrawCommandList::FindOrAddMesh(const ID3D11Buffer* MeshBuffer)
+{
+    if (const uint32* MeshId = MeshIds.Find(MeshBuffer))
+    {
+        return *MeshId;
+    }
+
+    const uint32 MeshId = static_cast<uint32>(MeshIds.Num());
+    MeshIds.Add(MeshBuffer, MeshId);
+    return MeshId;
+}
+
+void FMeshDrawCommandList::AddCommand(const FMeshDrawCommand& Command)
+{
+    const uint32 CommandIndex = static_cast<uint32>(Commands.Add(Command));
+    SortedOrder.Add({ Command.SortKey, CommandIndex });
+
+    // 정렬하지 않고 그리던 방식은 Object마다 Buffer와 Object 상수를, Subset마다 재질과 Texture, SubMesh 상수를 Bind합니다.
+    const uint32 NumInstances = Command.NumInstances;
+    ++Stats.NumCommands;
+    Stats.Unfiltered.NumDrawCalls += NumInstances;
+    if (Command.ObjectIndex != LastAddedObjectIndex || Command.FirstInstance != LastAddedFirstInstance)
+    {
+        LastAddedObjectIndex = Command.ObjectIndex;
+        LastAddedFirstInstance = Command.FirstInstance;
+        Stats.Unfiltered.NumVertexBufferBinds += NumInstances;
+        Stats.Unfiltered.NumIndexBufferBinds += Command.IndexBuffer ? NumInstances : 0;
+        Stats.Unfiltered.NumObjectBinds += NumInstances;
+    }
+    if (Command.MaterialId != INDEX_NONE)
+    {
+        Stats.Unfiltered.NumMaterialBinds += NumInstances;
+        Stats.Unfiltered.NumTextureBinds += NumInstances;
+        Stats.Unfiltered.NumSubMeshUpdates += NumInstances;
+    }
+}
+
+void FMeshDrawCommandList::Sort()
+{
+    const int32 NumEntries = SortedOrder.Num();
+    if (NumEntries < 2)
+    {
+        return;
+    }
+
+    // 8bit 자리마다 한 번씩 안정 정렬하는 LSD Radix Sort, 자리별 개수는 한 번 훑어서 모두 셉니다.
+    constexpr int32 NumDigits = 8;
+    constexpr int32 NumBuckets = 256;
+    uint32 Counts[NumDigits][NumBuckets] = {};
+    for (const FSortEntry& Entry : SortedOrder)
+    {
+        for (int32 Digit = 0; Digit < NumDigits; ++Digit)
+        {
+            ++Counts[Digit][(Entry.SortKey >> (Digit * 8)) & 0xFF];
+        }
+    }
+
+    SortScratch.SetNum(NumEntries);
+    FSortEntry* Source = SortedOrder.GetData();
+    FSortEntry* Dest = SortScratch.GetData();
+
+    for (int32 Digit = 0; Digit < NumDigits; ++Digit)
+    {
+        uint32* DigitCounts = Counts[Digit];
+
+        // 모든 Key가 이 자리에서 같다면 순서가 바뀌지 않으므로 건너뜁니다. Mesh 수가 적으면 대부분의 상위 자리가 여기에 해당합니다.
+        const uint32 FirstBucketCount = DigitCounts[(Source[0].SortKey >> (Digit * 8)) & 0xFF];
+        if (FirstBucketCount == static_cast<uint32>(NumEntries))
+        {
+            continue;
+        }
+
+        uint32 Offset = 0;
+        for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+        {
+            const uint32 Count = DigitCounts[Bucket];
+            DigitCounts[Bucket] = Offset;
+            Offset += Count;
+        }
+
+        for (int32 Index = 0; Index < NumEntries; ++Index)
+        {
+            const FSortEntry& Entry = Source[Index];
+            Dest[DigitCounts[(Entry.SortKey >> (Digit * 8)) & 0xFF]++] = Entry;
+        }
+
+        std::swap(Source, Dest);
+    }
+
+    if (Source != SortedOrder.GetData())
+    {
+        std::swap(SortedOrder, SortScratch);
+    }
+}
+
+FMeshDrawBinds FMeshDrawCommandList::FStateCache::Apply(const FMeshDrawCommand& Command, const FMeshDrawMaterial* Material)
+{
+    FMeshDrawBinds Binds;
+
+    if (Command.ShaderId != ShaderId)
+    {
+        ShaderId = Command.ShaderId;
+        Binds.bShader = true;
+    }
+
+    if (Command.VertexBuffer != VertexBuffer)
+    {
+        VertexBuffer = Command.VertexBuffer;
+        Binds.bVertexBuffer = true;
+    }
+
+    if (Command.IndexBuffer && Command.IndexBuffer != IndexBuffer)
+    {
+        IndexBuffer = Command.IndexBuffer;
+        Binds.bIndexBuffer = true;
+    }
+
+    if (Command.ObjectIndex != ObjectIndex)
+    {
+        ObjectIndex = Command.ObjectIndex;
+        Binds.bObject = true;
+    }
+
+    // 재질이 없는 명령은 이전 재질과 SubMesh 상수를 그대로 사용합니다.
+    if (Material == nullptr)
+    {
+        return Binds;
+    }
+
+    if (Command.MaterialId != MaterialId)
+    {
+        MaterialId = Command.MaterialId;
+        Binds.bMaterial = true;
+    }
+
+    if (!bTexturesBound || Material->DiffuseTexture != DiffuseTexture || Material->BumpTexture != BumpTexture)
+    {
+        DiffuseTexture = Material->DiffuseTexture;
+        BumpTexture = Material->BumpTexture;
+        bTexturesBound = true;
+        Binds.bTextures = true;
+    }
+
+    const int32 SelectedState = Command.bSelectedSubMesh ? 1 : 0;
+    if (SelectedState != SelectedSubMesh)
+    {
+        SelectedSubMesh = SelectedState;
+        Binds.bSubMesh = true;
+    }
+
+    return Binds;
+}
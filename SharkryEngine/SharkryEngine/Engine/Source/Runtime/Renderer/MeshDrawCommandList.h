@@ -0,0 +1,198 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "HAL/PlatformType.h"
+
+struct ID3D11Buffer;
+struct FObjMaterialInfo;
+struct FTexture;
+
+/** Draw Command가 쓰는 재질, Texture는 등록할 때 한 번 찾아둡니다. */
+struct FMeshDrawMaterial
+{
+    const FObjMaterialInfo* MaterialInfo = nullptr;
+
+    /** 없다면 nullptr, 같은 Texture를 쓰는 재질끼리는 Texture를 다시 Bind하지 않습니다. */
+    const FTexture* DiffuseTexture = nullptr;
+    const FTexture* BumpTexture = nullptr;
+};
+
+/** Subset 하나를 그리는 명령 */
+struct FMeshDrawCommand
+{
+    uint64 SortKey = 0;
+
+    /** Pass가 정하는 Shader 구성, 바뀔 때만 Shader를 Bind합니다. */
+    uint32 ShaderId = 0;
+
+    ID3D11Buffer* VertexBuffer = nullptr;
+    ID3D11Buffer* IndexBuffer = nullptr;
+
+    /** FMeshDrawCommandList::AddMaterial의 반환값, 재질 없이 그린다면 INDEX_NONE */
+    int32 MaterialId = INDEX_NONE;
+
+    /** Object 상수의 Index, 같은 Object의 Subset끼리는 같은 값입니다. */
+    uint32 ObjectIndex = 0;
+
+    uint32 IndexStart = 0;
+    uint32 IndexCount = 0;
+
+    /** Instanced Draw라면 Instance Buffer의 구간, 아니라면 0과 1 */
+    uint32 FirstInstance = 0;
+    uint32 NumInstances = 1;
+
+    bool bSelectedSubMesh = false;
+};
+
+/** Submit에서 명령마다 다시 Bind해야 하는 상태 */
+struct FMeshDrawBinds
+{
+    bool bShader = false;
+    bool bVertexBuffer = false;
+    bool bIndexBuffer = false;
+    bool bObject = false;
+    bool bMaterial = false;
+    bool bTextures = false;
+    bool bSubMesh = false;
+};
+
+/** 종류별 Bind 횟수 */
+struct FMeshDrawBindCounts
+{
+    uint32 NumDrawCalls = 0;
+    uint32 NumShaderBinds = 0;
+    uint32 NumVertexBufferBinds = 0;
+    uint32 NumIndexBufferBinds = 0;
+    uint32 NumObjectBinds = 0;
+    uint32 NumMaterialBinds = 0;
+    uint32 NumTextureBinds = 0;
+    uint32 NumSubMeshUpdates = 0;
+
+    void Add(const FMeshDrawBinds& Binds);
+};
+
+/** Draw Command 통계, Reset()에서 초기화하지 않으므로 여러 Viewport의 값이 쌓입니다. ResetStats()로 초기화 */
+struct FMeshDrawStats
+{
+    uint32 NumCommands = 0;
+
+    /**
+     * 정렬, 상태 Filtering, Instancing 없이 Object마다 Buffer를, Subset마다 재질과 Texture를 Bind했을 때의 횟수
+     * Instanced 명령은 Instance마다 따로 그렸을 때로 셉니다.
+     */
+    FMeshDrawBindCounts Unfiltered;
+
+    /** 정렬한 뒤 바뀐 상태만 Bind한 횟수 */
+    FMeshDrawBindCounts Filtered;
+};
+
+/**
+ * Mesh Pass가 한 프레임에 그릴 Subset을 모아 정렬한 뒤, 바뀐 상태만 Bind하면서 제출하는 목록
+ *
+ * 명령마다 64bit Sort Key를 만들고 Radix Sort로 정렬합니다. 상위 bit부터 Pass, Shader, 재질, Mesh, 깊이 순서이므로
+ * 같은 재질과 Mesh를 쓰는 명령이 붙어서 재질 상수, Texture, Vertex/Index Buffer Bind가 줄어들고,
+ * 같은 Mesh 안에서는 가까운 것부터 그려서 Early-Z가 잘 동작합니다.
+ * D3D 리소스는 포인터로만 비교하므로 D3D 없이도 정렬과 Bind 판정을 확인할 수 있습니다.
+ */
+class FMeshDrawCommandList
+{
+public:
+    static constexpr uint32 PassBits = 4;
+    static constexpr uint32 ShaderBits = 8;
+    static constexpr uint32 MaterialBits = 16;
+    static constexpr uint32 MeshBits = 20;
+    static constexpr uint32 DepthBits = 16;
+    static_assert(PassBits + ShaderBits + MaterialBits + MeshBits + DepthBits == 64);
+
+    /**
+     * 정렬 Key를 만듭니다. 범위를 넘는 Id는 잘리므로 정렬만 덜 될 뿐 결과는 같습니다.
+     * @param MaterialId 재질이 없다면 INDEX_NONE, 재질이 있는 명령 뒤에 그립니다.
+     * @param Depth01 0(Near) ~ 1(Far)로 정규화한 View 깊이
+     */
+    static uint64 MakeSortKey(uint32 Pass, uint32 ShaderId, int32 MaterialId, uint32 MeshId, float Depth01);
+
+    /** 명령과 재질, Mesh Id를 모두 비웁니다. 할당된 메모리는 유지합니다. */
+    void Reset();
+
+    /** 이번 프레임에 등록된 재질이라면 Id, 아니라면 INDEX_NONE */
+    int32 FindMaterial(const FObjMaterialInfo* MaterialInfo) const;
+
+    /** 재질을 등록하고 Id를 반환합니다. FindMaterial로 먼저 찾아서 Texture를 한 번만 찾도록 합니다. */
+    int32 AddMaterial(const FMeshDrawMaterial& Material);
+
+    /** 같은 Buffer에 같은 Id를 돌려줍니다. LOD는 Vertex Buffer를 같이 쓰므로 Index Buffer로 구분합니다. */
+    uint32 FindOrAddMesh(const ID3D11Buffer* MeshBuffer);
+
+    void AddCommand(const FMeshDrawCommand& Command);
+
+    /** Sort Key 순서로 정렬합니다. Key가 같다면 추가한 순서를 유지합니다. */
+    void Sort();
+
+    int32 Num() const { return Commands.Num(); }
+    const FMeshDrawCommand& GetCommand(int32 SortedIndex) const { return Commands[SortedOrder[SortedIndex].CommandIndex]; }
+    const FMeshDrawMaterial& GetMaterial(int32 MaterialId) const { return Materials[MaterialId]; }
+
+    /**
+     * 정렬된 순서로 Func(const FMeshDrawCommand&, const FMeshDrawMaterial*, const FMeshDrawBinds&)를 호출합니다.
+     * 이전 명령과 같은 상태는 Binds에서 false이므로 Func는 true인 상태만 Bind합니다.
+     * 재질이 없는 명령의 FMeshDrawMaterial은 nullptr이고, 이전 재질과 Texture를 그대로 둡니다.
+     */
+    template <typename FuncType>
+    void Submit(FuncType&& Func);
+
+    const FMeshDrawStats& GetStats() const { return Stats; }
+    void ResetStats() { Stats = FMeshDrawStats(); }
+
+private:
+    /** Submit 중 마지막으로 Bind한 상태, 명령마다 다시 Bind해야 하는지 판정합니다. */
+    struct FStateCache
+    {
+        uint32 ShaderId = ~0u;
+        const ID3D11Buffer* VertexBuffer = nullptr;
+        const ID3D11Buffer* IndexBuffer = nullptr;
+        uint32 ObjectIndex = ~0u;
+        int32 MaterialId = INDEX_NONE;
+        const FTexture* DiffuseTexture = nullptr;
+        const FTexture* BumpTexture = nullptr;
+        bool bTexturesBound = false;
+        int32 SelectedSubMesh = INDEX_NONE;
+
+        FMeshDrawBinds Apply(const FMeshDrawCommand& Command, const FMeshDrawMaterial* Material);
+    };
+
+    struct FSortEntry
+    {
+        uint64 SortKey;
+        uint32 CommandIndex;
+    };
+
+    TArray<FMeshDrawCommand> Commands;
+    TArray<FSortEntry> SortedOrder;
+    TArray<FSortEntry> SortScratch;
+
+    TArray<FMeshDrawMaterial> Materials;
+    TMap<const FObjMaterialInfo*, int32> MaterialIds;
+    TMap<const ID3D11Buffer*, uint32> MeshIds;
+
+    /** AddCommand에서 Unfiltered 횟수를 세기 위한 직전 Object, Instanced 명령은 Instance 구간으로 구분합니다. */
+    uint32 LastAddedObjectIndex = ~0u;
+    uint32 LastAddedFirstInstance = ~0u;
+
+    FMeshDrawStats Stats;
+};
+
+template <typename FuncType>
+void FMeshDrawCommandList::Submit(FuncType&& Func)
+{
+    FStateCache StateCache;
+    for (const FSortEntry& Entry : SortedOrder)
+    {
+        const FMeshDrawCommand& Command = Commands[Entry.CommandIndex];
+        const FMeshDrawMaterial* Material = Command.MaterialId != INDEX_NONE ? &Materials[Command.MaterialId] : nullptr;
+
+        const FMeshDrawBinds Binds = StateCache.Apply(Command, Material);
+        Stats.Filtered.Add(Binds);
+
+        Func(Command, Material, Binds);
+    }
+}
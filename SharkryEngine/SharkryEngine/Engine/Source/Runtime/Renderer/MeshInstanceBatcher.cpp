@@ -0,0 +1,140 @@
+#include "MeshInstanceBatcher.h"
+
+namespace
+{
+    uint64 HashPointer(uint64 Hash, const void* Pointer)
+    {
+        Hash ^= reinterpret_cast<uintptr_t>(Pointer) + 0x9E3779B97F4A7C15ull + (Hash << 6) + (Hash >> 2);
+        return Hash;
+    }
+}
+
+FStaticMeshInstanceData FStaticMeshInstanceData::Make(const FMatrix& WorldMatrix, const FMatrix& InverseTransposedWorld)
+{
+    FStaticMeshInstanceData Data;
+    Data.WorldMatrix = WorldMatrix;
+    for (int32 Row = 0; Row < 3; ++Row)
+    {
+        Data.InverseTransposedWorld[Row] = FVector4(InverseTransposedWorld.M[Row][0], InverseTransposedWorld.M[Row][1], InverseTransposedWorld.M[Row][2], InverseTransposedWorld.M[Row][3]);
+    }
+    return Data;
+}
+
+void FMeshInstanceBatcher::Reset()
+{
+    Groups.Empty();
+    FirstGroupByHash.Empty();
+    MaterialKeys.Empty();
+    PendingObjects.Empty();
+    Batches.Empty();
+    InstanceObjects.Empty();
+    SingleObjects.Empty();
+}
+
+void FMeshInstanceBatcher::AddObject(uint32 ObjectIndex, const void* Mesh, const void* const* Materials, int32 NumMaterials, int32 SelectedSubMesh)
+{
+    const int32 GroupIndex = FindOrAddGroup(Mesh, Materials, NumMaterials, SelectedSubMesh);
+    ++Groups[GroupIndex].NumObjects;
+    PendingObjects.Add({ ObjectIndex, GroupIndex });
+}
+
+int32 FMeshInstanceBatcher::FindOrAddGroup(const void* Mesh, const void* const* Materials, int32 NumMaterials, int32 SelectedSubMesh)
+{
+    uint64 Hash = HashPointer(static_cast<uint64>(SelectedSubMesh), Mesh);
+    for (int32 Slot = 0; Slot < NumMaterials; ++Slot)
+    {
+        Hash = HashPointer(Hash, Materials[Slot]);
+    }
+
+    int32* FirstGroup = FirstGroupByHash.Find(Hash);
+    if (FirstGroup)
+    {
+        for (int32 GroupIndex = *FirstGroup; GroupIndex != INDEX_NONE; GroupIndex = Groups[GroupIndex].NextWithSameHash)
+        {
+            const FGroup& Group = Groups[GroupIndex];
+            if (Group.Mesh != Mesh || Group.SelectedSubMesh != SelectedSubMesh || Group.NumMaterials != NumMaterials)
+            {
+                continue;
+            }
+
+            bool bSameMaterials = true;
+            for (int32 Slot = 0; Slot < NumMaterials && bSameMaterials; ++Slot)
+            {
+                bSameMaterials = MaterialKeys[Group.FirstMaterial + Slot] == Materials[Slot];
+            }
+            if (bSameMaterials)
+            {
+                return GroupIndex;
+            }
+        }
+    }
+
+    FGroup NewGroup;
+    NewGroup.Mesh = Mesh;
+    NewGroup.FirstMaterial = MaterialKeys.Num();
+    NewGroup.NumMaterials = NumMaterials;
+    NewGroup.SelectedSubMesh = SelectedSubMesh;
+    NewGroup.NextWithSameHash = FirstGroup ? *FirstGroup : INDEX_NONE;
+    for (int32 Slot = 0; Slot < NumMaterials; ++Slot)
+    {
+        MaterialKeys.Add(Materials[Slot]);
+    }
+
+    const int32 GroupIndex = Groups.Add(NewGroup);
+    if (FirstGroup)
+    {
+        *FirstGroup = GroupIndex;
+    }
+    else
+    {
+        FirstGroupByHash.Add(Hash, GroupIndex);
+    }
+    return GroupIndex;
+}
+
+void FMeshInstanceBatcher::Build(uint32 MinInstances)
+{
+    Batches.Empty();
+    InstanceObjects.Empty();
+    SingleObjects.Empty();
+
+    // 충분히 모인 묶음만 Instance 구간을 잡습니다.
+    uint32 NumInstances = 0;
+    for (FGroup& Group : Groups)
+    {
+        if (Group.NumObjects < MinInstances)
+        {
+            Group.BatchIndex = INDEX_NONE;
+            continue;
+        }
+
+        FMeshInstanceBatch Batch;
+        Batch.Mesh = Group.Mesh;
+        Batch.FirstMaterial = Group.FirstMaterial;
+        Batch.NumMaterials = Group.NumMaterials;
+        Batch.SelectedSubMesh = Group.SelectedSubMesh;
+        Batch.FirstInstance = NumInstances;
+        Group.BatchIndex = Batches.Add(Batch);
+        NumInstances += Group.NumObjects;
+    }
+
+    // 추가한 순서대로 각 묶음 구간을 채우므로 묶음 안의 순서가 유지됩니다.
+    InstanceObjects.SetNum(NumInstances);
+    for (const FPendingObject& Object : PendingObjects)
+    {
+        const int32 BatchIndex = Groups[Object.GroupIndex].BatchIndex;
+        if (BatchIndex == INDEX_NONE)
+        {
+            SingleObjects.Add(Object.ObjectIndex);
+            continue;
+        }
+
+        FMeshInstanceBatch& Batch = Batches[BatchIndex];
+        InstanceObjects[Batch.FirstInstance + Batch.NumInstances++] = Object.ObjectIndex;
+    }
+
+    Stats.NumObjects += PendingObjects.Num();
+    Stats.NumBatches += Batches.Num();
+    Stats.NumInstancedObjects += NumInstances;
+    Stats.NumSingleObjects += SingleObjects.Num();
+}
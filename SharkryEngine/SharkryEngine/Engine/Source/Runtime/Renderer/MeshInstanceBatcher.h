@@ -0,0 +1,125 @@
+#pragma once
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "HAL/PlatformType.h"
+#include "Math/Matrix.h"
+#include "Math/Vector4.h"
+
+/**
+ * Instance Buffer에 들어가는 Instance 하나, Instancing Vertex Shader의 INSTANCE_* 입력과 순서가 같습니다.
+ * 법선은 3x3만 사용하므로 Inverse Transposed World는 3행만 넣습니다.
+ * Static Mesh Pixel Shader는 UUID를 출력하지 않고 선택 강조는 Object 상수로 그리므로 UUID는 넣지 않습니다.
+ */
+struct FStaticMeshInstanceData
+{
+    FMatrix WorldMatrix;
+    FVector4 InverseTransposedWorld[3];
+
+    static FStaticMeshInstanceData Make(const FMatrix& WorldMatrix, const FMatrix& InverseTransposedWorld);
+};
+static_assert(sizeof(FStaticMeshInstanceData) == 112);
+
+/** 같은 Mesh와 재질 구성을 쓰는 Object의 묶음, 한 Subset을 한 번의 Instanced Draw로 그립니다. */
+struct FMeshInstanceBatch
+{
+    /** AddObject에 넘긴 Mesh */
+    const void* Mesh = nullptr;
+
+    /** 재질 Slot별 최종 재질, FMeshInstanceBatcher::GetMaterial(Batch, Slot)로 읽습니다. */
+    int32 FirstMaterial = 0;
+    int32 NumMaterials = 0;
+
+    /** 강조할 Subset, 없다면 INDEX_NONE */
+    int32 SelectedSubMesh = INDEX_NONE;
+
+    /** GetInstanceObjects()와 Instance Buffer에서 이 묶음이 차지하는 구간 */
+    uint32 FirstInstance = 0;
+    uint32 NumInstances = 0;
+};
+
+/** Instancing 통계, Reset()에서 초기화하지 않으므로 여러 Viewport의 값이 쌓입니다. ResetStats()로 초기화 */
+struct FMeshInstanceStats
+{
+    uint32 NumObjects = 0;
+    uint32 NumBatches = 0;
+    uint32 NumInstancedObjects = 0;
+    uint32 NumSingleObjects = 0;
+};
+
+/**
+ * 같은 Mesh를 같은 재질 구성으로 그리는 Object를 모아 Instanced Draw 묶음을 만듭니다.
+ *
+ * Mesh와 재질은 포인터로만 비교하므로 D3D나 UObject 없이 묶는 규칙을 확인할 수 있습니다.
+ * MinInstances보다 적게 모인 Object는 묶지 않고 GetSingleObjects()로 돌려주며, 기존처럼 Object마다 그립니다.
+ */
+class FMeshInstanceBatcher
+{
+public:
+    static constexpr uint32 DefaultMinInstances = 2;
+
+    /** Object와 묶음을 모두 비웁니다. 할당된 메모리는 유지합니다. */
+    void Reset();
+
+    /**
+     * @param ObjectIndex 호출한 쪽의 Object Index, 결과에서 그대로 돌려줍니다.
+     * @param Materials 재질 Slot별 최종 재질, Override가 있다면 Override를 넘깁니다.
+     * @param SelectedSubMesh 강조할 Subset, 다른 값을 쓰는 Object와는 묶지 않습니다.
+     */
+    void AddObject(uint32 ObjectIndex, const void* Mesh, const void* const* Materials, int32 NumMaterials, int32 SelectedSubMesh);
+
+    /** 추가한 Object를 묶음별로 모읍니다. 묶음 안에서는 추가한 순서를 유지합니다. */
+    void Build(uint32 MinInstances = DefaultMinInstances);
+
+    const TArray<FMeshInstanceBatch>& GetBatches() const { return Batches; }
+
+    /** Instance 순서의 Object Index, Instance Buffer를 이 순서로 채웁니다. */
+    const TArray<uint32>& GetInstanceObjects() const { return InstanceObjects; }
+
+    /** 묶이지 않은 Object Index, 추가한 순서 */
+    const TArray<uint32>& GetSingleObjects() const { return SingleObjects; }
+
+    const void* GetMaterial(const FMeshInstanceBatch& Batch, int32 MaterialSlot) const { return MaterialKeys[Batch.FirstMaterial + MaterialSlot]; }
+
+    const FMeshInstanceStats& GetStats() const { return Stats; }
+    void ResetStats() { Stats = FMeshInstanceStats(); }
+
+private:
+    /** 같은 Mesh, 재질, 강조 Subset을 쓰는 Object 묶음 후보 */
+    struct FGroup
+    {
+        const void* Mesh = nullptr;
+        int32 FirstMaterial = 0;
+        int32 NumMaterials = 0;
+        int32 SelectedSubMesh = INDEX_NONE;
+
+        /** Hash가 같은 다음 묶음, 없다면 INDEX_NONE */
+        int32 NextWithSameHash = INDEX_NONE;
+
+        uint32 NumObjects = 0;
+
+        /** Build에서 정하는 결과 묶음 Index, 묶이지 않는다면 INDEX_NONE */
+        int32 BatchIndex = INDEX_NONE;
+    };
+
+    struct FPendingObject
+    {
+        uint32 ObjectIndex;
+        int32 GroupIndex;
+    };
+
+    int32 FindOrAddGroup(const void* Mesh, const void* const* Materials, int32 NumMaterials, int32 SelectedSubMesh);
+
+    TArray<FGroup> Groups;
+    TMap<uint64, int32> FirstGroupByHash;
+
+    /** 묶음 후보별 재질을 이어붙인 배열 */
+    TArray<const void*> MaterialKeys;
+
+    TArray<FPendingObject> PendingObjects;
+
+    TArray<FMeshInstanceBatch> Batches;
+    TArray<uint32> InstanceObjects;
+    TArray<uint32> SingleObjects;
+
+    FMeshInstanceStats Stats;
+};
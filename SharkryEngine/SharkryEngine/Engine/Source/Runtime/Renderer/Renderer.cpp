@@ -226,6 +226,48 @@ void FRenderer::CreateCommonShader() const
         return;
     }
 #pragma endregion UberShader
+
+#pragma region Instancing
+    // 0번 Slot은 Mesh 정점, 1번 Slot은 FStaticMeshInstanceData
+    D3D11_INPUT_ELEMENT_DESC InstancedStaticMeshLayoutDesc[] = {
+        {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TANGENT", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"MATERIAL_INDEX", 0, DXGI_FORMAT_R32_UINT, 0, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"INSTANCE_WORLD", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_WORLD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_WORLD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_WORLD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_NORMAL", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, D3D11_APPEND_ALIGNED_ELEMENT, D3D11_INPUT_PER_INSTANCE_DATA, 1},
+    };
+
+    D3D_SHADER_MACRO DefinesInstancing[] =
+    {
+        { INSTANCING, "1" },
+        { nullptr, nullptr }
+    };
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"INSTANCED_StaticMeshVertexShader", L"Shaders/StaticMeshVertexShader.hlsl", "mainVS", InstancedStaticMeshLayoutDesc, ARRAYSIZE(InstancedStaticMeshLayoutDesc), DefinesInstancing);
+    if (FAILED(hr))
+    {
+        return;
+    }
+
+    D3D_SHADER_MACRO DefinesInstancingGouraud[] =
+    {
+        { INSTANCING, "1" },
+        { GOURAUD, "1" },
+        { nullptr, nullptr }
+    };
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"INSTANCED_GOURAUD_StaticMeshVertexShader", L"Shaders/StaticMeshVertexShader.hlsl", "mainVS", InstancedStaticMeshLayoutDesc, ARRAYSIZE(InstancedStaticMeshLayoutDesc), DefinesInstancingGouraud);
+    if (FAILED(hr))
+    {
+        return;
+    }
+#pragma endregion Instancing
 }
 
 void FRenderer::PrepareRender(FViewportResource* ViewportResource) const
@@ -241,6 +283,9 @@ void FRenderer::PrepareRender(FViewportResource* ViewportResource) const
 
 void FRenderer::PrepareRenderPass() const
 {
+    // Pass들이 읽기 전에, 지난 프레임 이후 바뀐 Component의 Proxy만 한 번 갱신합니다.
+    GEngine->ActiveWorld->GetRenderScene().UpdateDirtyProxies();
+
     StaticMeshRenderPass->PrepareRenderArr();
     SkeletalMeshRenderPass->PrepareRenderArr();
     ShadowRenderPass->PrepareRenderArr();
@@ -277,7 +322,7 @@ void FRenderer::UpdateCommonBuffer(const std::shared_ptr<FViewportClient>& Viewp
     if (GEngine->ActiveWorld->WorldType == EWorldType::Editor || GEngine->ActiveWorld->WorldType == EWorldType::Viewer)
     {
         CameraConstantBuffer.ViewMatrix = Viewport->GetViewMatrix();
-        CameraConstantBuffer.InvViewMatrix = FMatrix::Inverse(CameraConstantBuffer.ViewMatrix);
+        CameraConstantBuffer.InvViewMatrix = FMatrix::InverseOrthonormal(CameraConstantBuffer.ViewMatrix);
         CameraConstantBuffer.ProjectionMatrix = Viewport->GetProjectionMatrix();
         CameraConstantBuffer.InvProjectionMatrix = FMatrix::Inverse(CameraConstantBuffer.ProjectionMatrix);
         CameraConstantBuffer.ViewLocation = Viewport->GetCameraLocation();
@@ -292,7 +337,7 @@ void FRenderer::UpdateCommonBuffer(const std::shared_ptr<FViewportClient>& Viewp
                                         CameraPOV.Location  + CameraPOV.Rotation.GetForwardVector(),
                                             CameraPOV.Rotation.GetUpVector()
                                     );
-        CameraConstantBuffer.InvViewMatrix = FMatrix::Inverse(CameraConstantBuffer.ViewMatrix);
+        CameraConstantBuffer.InvViewMatrix = FMatrix::InverseOrthonormal(CameraConstantBuffer.ViewMatrix);
 
         if (CameraPOV.ProjectionMode == ECameraProjectionMode::Perspective)
         {
@@ -20,7 +20,8 @@ enum class EShaderSRVSlot : int8
 
 namespace MaterialUtils
 {
-    inline void UpdateMaterial(FDXDBufferManager* BufferManager, FGraphicsDevice* Graphics, const FObjMaterialInfo& MaterialInfo)
+    /** 재질 상수만 갱신합니다. Texture는 BindMaterialTextures로 따로 Bind합니다. */
+    inline void UpdateMaterialConstants(FDXDBufferManager* BufferManager, const TConstantBufferHandle<FMaterialConstants>& MaterialBuffer, const FObjMaterialInfo& MaterialInfo)
     {
         FMaterialConstants Data;
         Data.DiffuseColor = MaterialInfo.Diffuse;
@@ -35,34 +36,38 @@ namespace MaterialUtils
         Data.AmbientColor = MaterialInfo.Ambient;
         Data.TextureFlag = MaterialInfo.TextureFlag;
 
-        BufferManager->UpdateConstantBuffer(TEXT("FMaterialConstants"), Data);
-        
-        // Update Textures
-        if (MaterialInfo.TextureFlag & (1 << 1)) {
-            std::shared_ptr<FTexture> texture = FEngineLoop::ResourceManager.GetTexture(MaterialInfo.DiffuseTexturePath);
-            Graphics->DeviceContext->PSSetShaderResources(0, 1, &texture->TextureSRV);
-            Graphics->DeviceContext->PSSetSamplers(0, 1, &texture->SamplerState);
-        }
-        else
-        {
-            ID3D11ShaderResourceView* nullSRV[1] = { nullptr };
-            ID3D11SamplerState* nullSampler[1] = { nullptr };
-            Graphics->DeviceContext->PSSetShaderResources(0, 1, nullSRV);
-            Graphics->DeviceContext->PSSetSamplers(0, 1, nullSampler);
+        BufferManager->UpdateConstantBuffer(MaterialBuffer, Data);
+    }
 
-        }
-        
-        if (MaterialInfo.TextureFlag & (1 << 2))
-        {
-            std::shared_ptr<FTexture> texture = FEngineLoop::ResourceManager.GetTexture(MaterialInfo.BumpTexturePath);
-            Graphics->DeviceContext->PSSetShaderResources(1, 1, &texture->TextureSRV);
-            Graphics->DeviceContext->PSSetSamplers(1, 1, &texture->SamplerState);
-        }
-        else {
-            ID3D11ShaderResourceView* nullSRV[1] = { nullptr };
-            ID3D11SamplerState* nullSampler[1] = { nullptr };
-            Graphics->DeviceContext->PSSetShaderResources(1, 1, nullSRV);
-            Graphics->DeviceContext->PSSetSamplers(1, 1, nullSampler);
-        }
+    /** 재질의 Diffuse, Bump Texture, 사용하지 않는다면 nullptr */
+    inline const FTexture* FindDiffuseTexture(const FObjMaterialInfo& MaterialInfo)
+    {
+        return (MaterialInfo.TextureFlag & (1 << 1)) ? FEngineLoop::ResourceManager.GetTexture(MaterialInfo.DiffuseTexturePath).get() : nullptr;
+    }
+
+    inline const FTexture* FindBumpTexture(const FObjMaterialInfo& MaterialInfo)
+    {
+        return (MaterialInfo.TextureFlag & (1 << 2)) ? FEngineLoop::ResourceManager.GetTexture(MaterialInfo.BumpTexturePath).get() : nullptr;
+    }
+
+    /** Diffuse는 0번, Bump는 1번 Slot에 Bind합니다. nullptr이라면 Slot을 비웁니다. */
+    inline void BindMaterialTextures(FGraphicsDevice* Graphics, const FTexture* DiffuseTexture, const FTexture* BumpTexture)
+    {
+        ID3D11ShaderResourceView* SRVs[2] = { DiffuseTexture ? DiffuseTexture->TextureSRV : nullptr, BumpTexture ? BumpTexture->TextureSRV : nullptr };
+        ID3D11SamplerState* Samplers[2] = { DiffuseTexture ? DiffuseTexture->SamplerState : nullptr, BumpTexture ? BumpTexture->SamplerState : nullptr };
+        Graphics->DeviceContext->PSSetShaderResources(0, 2, SRVs);
+        Graphics->DeviceContext->PSSetSamplers(0, 2, Samplers);
+    }
+
+    /** Draw마다 호출하는 Pass는 초기화할 때 구해둔 FMaterialConstants Handle을 넘깁니다. */
+    inline void UpdateMaterial(FDXDBufferManager* BufferManager, FGraphicsDevice* Graphics, const TConstantBufferHandle<FMaterialConstants>& MaterialBuffer, const FObjMaterialInfo& MaterialInfo)
+    {
+        UpdateMaterialConstants(BufferManager, MaterialBuffer, MaterialInfo);
+        BindMaterialTextures(Graphics, FindDiffuseTexture(MaterialInfo), FindBumpTexture(MaterialInfo));
+    }
+
+    inline void UpdateMaterial(FDXDBufferManager* BufferManager, FGraphicsDevice* Graphics, const FObjMaterialInfo& MaterialInfo)
+    {
+        UpdateMaterial(BufferManager, Graphics, BufferManager->GetConstantBufferHandle<FMaterialConstants>(TEXT("FMaterialConstants")), MaterialInfo);
     }
 }
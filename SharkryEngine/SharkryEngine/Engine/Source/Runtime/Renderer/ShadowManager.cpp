@@ -594,7 +594,7 @@ void FShadowManager::UpdateCascadeMatrices(const std::shared_ptr<FViewportClient
 	float halfHFOV = FMath::DegreesToRadians(FOV) * 0.5f;
 	float tanHFOV = FMath::Tan(halfHFOV);
 	float tanVFOV = tanHFOV / AspectRatio;
-	FMatrix InvView = FMatrix::Inverse(CamView);
+	FMatrix InvView = FMatrix::InverseOrthonormal(CamView);
 
     //CascadeSplits.Empty();
     CascadeSplits.SetNum(NumCascades + 1);
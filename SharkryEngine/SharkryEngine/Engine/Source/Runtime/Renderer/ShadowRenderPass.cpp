@@ -2,7 +2,6 @@
 
 #include "ShadowManager.h"
 #include "ShowFlag.h"
-#include "BaseGizmos/GizmoBaseComponent.h"
 #include "Components/Light/LightComponent.h"
 #include "Components/Light/PointLightComponent.h"
 #include "D3D11RHI/DXDBufferManager.h"
@@ -10,11 +9,12 @@
 #include "D3D11RHI/DXDShaderManager.h"
 #include "Components/Light/DirectionalLightComponent.h"
 #include "Components/Light/SpotLightComponent.h"
+#include "Components/StaticMeshComponent.h"
 #include "Engine/EditorEngine.h"
 #include "Engine/Engine.h"
+#include "World/World.h"
 #include "UnrealEd/EditorViewportClient.h"
 #include "UObject/Casts.h"
-#include "UObject/UObjectIterator.h"
 
 class UEditorEngine;
 class UStaticMeshComponent;
@@ -86,13 +86,8 @@ void FShadowRenderPass::PrepareCSMRenderState()
 
 void FShadowRenderPass::PrepareRenderArr()
 {
-    for (const auto iter : TObjectRange<UStaticMeshComponent>())
-    {
-        if (!Cast<UGizmoBaseComponent>(iter) && iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            StaticMeshComponents.Add(iter);
-        }
-    }
+    RenderScene = &GEngine->ActiveWorld->GetRenderScene();
+    CullStats.Reset();
 }
 
 void FShadowRenderPass::UpdateIsShadowConstant(int32 isShadow) const
@@ -121,24 +116,26 @@ void FShadowRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewport)
     }
 
     
-    for (const auto DirectionalLight : TObjectRange<UDirectionalLightComponent>())
+    const FVisibilityCuller& Culler = RenderScene->GetStaticMeshBounds();
+    for (UDirectionalLightComponent* DirectionalLight : RenderScene->GetDirectionalLights())
     {
-        if (DirectionalLight->GetWorld() != GEngine->ActiveWorld)
-        {
-            continue;
-        }
-
         // Cascade Shadow Map을 위한 ViewProjection Matrix 설정
         ShadowManager->UpdateCascadeMatrices(Viewport, DirectionalLight);
 
         PrepareCSMRenderState();
         FCascadeConstantBuffer CascadeData = {};
+        FConvexVolume CascadeFrustums[MAX_CASCADE_NUM];
         uint32 NumCascades = ShadowManager->GetNumCasCades();
         for (uint32 i = 0; i < NumCascades; i++)
         {
             CascadeData.ViewProj[i] = ShadowManager->GetCascadeViewProjMatrix(i);
+            CascadeFrustums[i] = FConvexVolume::FromViewProjection(CascadeData.ViewProj[i], false);
         }
 
+        // GS가 모든 Cascade에 한 번에 그리므로, 어느 Cascade에라도 걸치는 Mesh만 남깁니다.
+        VisibleIndices.Empty();
+        Culler.Cull(CascadeFrustums, static_cast<int32>(NumCascades), VisibleIndices, CullStats);
+
         ShadowManager->BeginDirectionalShadowCascadePass(0);
         //RenderAllStaticMeshes(Viewport);
 
@@ -159,6 +156,9 @@ void FShadowRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewport)
 
         BufferManager->UpdateConstantBuffer(TEXT("FShadowConstantBuffer"), ShadowData);
 
+        VisibleIndices.Empty();
+        Culler.Cull(FConvexVolume::FromViewProjection(ShadowData.ShadowViewProj, false), VisibleIndices, CullStats);
+
         ShadowManager->BeginSpotShadowPass(i);
         RenderAllStaticMeshes();
            
@@ -170,6 +170,9 @@ void FShadowRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewport)
     for (int i = 0 ; i < PointLights.Num(); i++)
     {
         
+        VisibleIndices.Empty();
+        Culler.CullSphere(PointLights[i]->GetWorldLocation(), PointLights[i]->GetRadius(), VisibleIndices, CullStats);
+
         ShadowManager->BeginPointShadowPass(i);
         RenderAllStaticMeshesForPointLight(PointLights[i]);
            
@@ -182,7 +185,7 @@ void FShadowRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewport)
 
 void FShadowRenderPass::ClearRenderArr()
 {
-    StaticMeshComponents.Empty();
+    RenderScene = nullptr;
 }
 
 void FShadowRenderPass::SetLightData(const TArray<class UPointLightComponent*>& InPointLights, const TArray<class USpotLightComponent*>& InSpotLights)
@@ -191,7 +194,7 @@ void FShadowRenderPass::SetLightData(const TArray<class UPointLightComponent*>&
     SpotLights = InSpotLights;
 }
 
-void FShadowRenderPass::RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials,
+void FShadowRenderPass::RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials,
                                         int SelectedSubMeshIndex)
 {
     UINT Stride = sizeof(FStaticMeshVertex);
@@ -235,53 +238,43 @@ void FShadowRenderPass::RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData,
 
 void FShadowRenderPass::RenderAllStaticMeshes()
 {
-    for (UStaticMeshComponent* Comp : StaticMeshComponents)
-    {
-        if (!Comp || !Comp->GetStaticMesh())
-        {
-            continue;
-        }
+    UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+    const AActor* SelectedActor = Engine ? Engine->GetSelectedActor() : nullptr;
 
-        OBJ::FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
+    const TArray<FStaticMeshSceneProxy>& Proxies = RenderScene->GetStaticMeshProxies();
+    for (const int32 Index : VisibleIndices)
+    {
+        const FStaticMeshSceneProxy& Proxy = Proxies[Index];
+        OBJ::FStaticMeshRenderData* RenderData = Proxy.StaticMesh->GetRenderData();
         if (RenderData == nullptr)
         {
             continue;
         }
 
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
-
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-        FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
-        const bool bIsSelected = (Engine && Engine->GetSelectedActor() == Comp->GetOwner());
+        const bool bIsSelected = SelectedActor && SelectedActor == Proxy.Component->GetOwner();
 
-        UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected);
+        UpdateObjectConstant(Proxy.WorldMatrix, Proxy.WorldInverseTransposeMatrix, Proxy.UUIDColor, bIsSelected);
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
-        
+        RenderPrimitive(RenderData, Proxy.StaticMesh->GetMaterials(), Proxy.OverrideMaterials, Proxy.Component->GetselectedSubMeshIndex());
     }
 }
 
 void FShadowRenderPass::RenderAllStaticMeshesForCSM(FCascadeConstantBuffer FCasCadeData)
 {
-    for (UStaticMeshComponent* Comp : StaticMeshComponents)
+    const TArray<FStaticMeshSceneProxy>& Proxies = RenderScene->GetStaticMeshProxies();
+    for (const int32 Index : VisibleIndices)
     {
-        if (!Comp || !Comp->GetStaticMesh())
-        {
-            continue;
-        }
-
-        OBJ::FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
+        const FStaticMeshSceneProxy& Proxy = Proxies[Index];
+        OBJ::FStaticMeshRenderData* RenderData = Proxy.StaticMesh->GetRenderData();
         if (RenderData == nullptr)
         {
             continue;
         }
 
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-        FCasCadeData.World = WorldMatrix;
+        FCasCadeData.World = Proxy.WorldMatrix;
         BufferManager->UpdateConstantBuffer(TEXT("FCascadeConstantBuffer"), FCasCadeData);
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
-
+        RenderPrimitive(RenderData, Proxy.StaticMesh->GetMaterials(), Proxy.OverrideMaterials, Proxy.Component->GetselectedSubMeshIndex());
     }
 }
 
@@ -292,11 +285,11 @@ void FShadowRenderPass::BindResourcesForSampling()
     10);
 }
 
-void FShadowRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const
+void FShadowRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FMatrix& InverseTransposedWorld, const FVector4& UUIDColor, bool bIsSelected) const
 {
     FObjectConstantBuffer ObjectData = {};
     ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    ObjectData.InverseTransposedWorld = InverseTransposedWorld;
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
     
@@ -308,20 +301,16 @@ void FShadowRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const F
 
 void FShadowRenderPass::RenderAllStaticMeshesForPointLight(UPointLightComponent*& PointLight)
 {
-    for (UStaticMeshComponent* Comp : StaticMeshComponents)
+    const TArray<FStaticMeshSceneProxy>& Proxies = RenderScene->GetStaticMeshProxies();
+    for (const int32 Index : VisibleIndices)
     {
-        if (!Comp || !Comp->GetStaticMesh()) { continue; }
-
-        OBJ::FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
+        const FStaticMeshSceneProxy& Proxy = Proxies[Index];
+        OBJ::FStaticMeshRenderData* RenderData = Proxy.StaticMesh->GetRenderData();
         if (RenderData == nullptr) { continue; }
 
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
-
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-
-        UpdateCubeMapConstantBuffer(PointLight, WorldMatrix);
+        UpdateCubeMapConstantBuffer(PointLight, Proxy.WorldMatrix);
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        RenderPrimitive(RenderData, Proxy.StaticMesh->GetMaterials(), Proxy.OverrideMaterials, Proxy.Component->GetselectedSubMeshIndex());
     }
 }
 
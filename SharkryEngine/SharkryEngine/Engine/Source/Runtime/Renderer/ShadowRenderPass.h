@@ -1,6 +1,7 @@
 #pragma once
 #include "IRenderPass.h"
 #include "Define.h"
+#include "VisibilityCuller.h"
 #include <d3d11.h>
 
 #include "Components/Light/PointLightComponent.h"
@@ -14,6 +15,7 @@
 class FDXDBufferManager;
 class FDXDShaderManager;
 class FGraphicsDevice;
+class FRenderScene;
 class ULightComponentBase;
 
 class FShadowRenderPass : public IRenderPass
@@ -38,20 +40,26 @@ public:
     virtual void Render(const std::shared_ptr<FViewportClient>& Viewport) override;    
     virtual void ClearRenderArr() override;
 
-    void RenderPrimitive(OBJ::FStaticMeshRenderData* render_data, const TArray<FStaticMaterial*> array, TArray<UMaterial*> materials, int getselected_sub_mesh_index);
+    void RenderPrimitive(OBJ::FStaticMeshRenderData* render_data, const TArray<FStaticMaterial*>& array, const TArray<UMaterial*>& materials, int getselected_sub_mesh_index);
     virtual void RenderAllStaticMeshes();
     void RenderAllStaticMeshesForCSM(FCascadeConstantBuffer FCasCadeData);
     void BindResourcesForSampling();
 
-    void UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const;
+    void UpdateObjectConstant(const FMatrix& WorldMatrix, const FMatrix& InverseTransposedWorld, const FVector4& UUIDColor, bool bIsSelected) const;
 
     void RenderAllStaticMeshesForPointLight(UPointLightComponent*& PointLight);
 
+    const FVisibilityCullStats& GetCullStats() const { return CullStats; }
+
 
 private:
+    /** 이번 프레임에 그리는 World의 Render Scene, Shadow Caster와 Directional Light를 읽습니다. */
+    const FRenderScene* RenderScene = nullptr;
 
-    
-    TArray<class UStaticMeshComponent*> StaticMeshComponents;
+    FVisibilityCullStats CullStats;
+
+    /** 현재 Light의 영향 범위 안에 있는 Static Mesh Proxy의 Index */
+    TArray<int32> VisibleIndices;
     TArray<UPointLightComponent*> PointLights;
     TArray<USpotLightComponent*> SpotLights;
     
@@ -12,16 +12,15 @@
 #include "UnrealClient.h"
 #include "Math/JungleMath.h"
 
-#include "UObject/UObjectIterator.h"
 #include "UObject/Casts.h"
 
 #include "D3D11RHI/DXDBufferManager.h"
+#include "D3D11RHI/LinearUploadAllocator.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "D3D11RHI/DXDShaderManager.h"
 
 #include "Components/SkeletalMeshComponent.h"
 
-#include "BaseGizmos/GizmoBaseComponent.h"
 #include "Engine/EditorEngine.h"
 
 #include "UnrealEd/EditorViewportClient.h"
@@ -172,6 +171,13 @@ void FSkeletalMeshRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGr
     Graphics = InGraphics;
     ShaderManager = InShaderManager;
 
+    LightInfoBuffer = BufferManager->GetConstantBufferHandle<FLightInfoBuffer>(TEXT("FLightInfoBuffer"));
+    MaterialBuffer = BufferManager->GetConstantBufferHandle<FMaterialConstants>(TEXT("FMaterialConstants"));
+    LitUnlitBuffer = BufferManager->GetConstantBufferHandle<FLitUnlitConstants>(TEXT("FLitUnlitConstants"));
+    SubMeshBuffer = BufferManager->GetConstantBufferHandle<FSubMeshConstants>(TEXT("FSubMeshConstants"));
+    TextureBuffer = BufferManager->GetConstantBufferHandle<FTextureUVConstants>(TEXT("FTextureConstants"));
+    ObjectBuffer = BufferManager->GetConstantBufferHandle<FObjectConstantBuffer>(TEXT("FObjectConstantBuffer"));
+
     CreateShader();
 }
 
@@ -182,13 +188,7 @@ void FSkeletalMeshRenderPass::InitializeShadowManager(class FShadowManager* InSh
 
 void FSkeletalMeshRenderPass::PrepareRenderArr()
 {
-    for (const auto iter : TObjectRange<USkeletalMeshComponent>())
-    {
-        if (!Cast<UGizmoBaseComponent>(iter) && iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            SkeletalMeshComponents.Add(iter);
-        }
-    }
+    RenderScene = &GEngine->ActiveWorld->GetRenderScene();
 }
 
 void FSkeletalMeshRenderPass::PrepareRenderState(const std::shared_ptr<FViewportClient>& Viewport)
@@ -202,19 +202,10 @@ void FSkeletalMeshRenderPass::PrepareRenderState(const std::shared_ptr<FViewport
 
     Graphics->DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-    TArray<FString> PSBufferKeys = {
-        TEXT("FLightInfoBuffer"),
-        TEXT("FMaterialConstants"),
-        TEXT("FLitUnlitConstants"),
-        TEXT("FSubMeshConstants"),
-        TEXT("FTextureConstants")
-    };
+    BufferManager->BindConstantBuffers({ LightInfoBuffer, MaterialBuffer, LitUnlitBuffer, SubMeshBuffer, TextureBuffer }, 0, EShaderStage::Pixel);
 
-    BufferManager->BindConstantBuffers(PSBufferKeys, 0, EShaderStage::Pixel);
-
-    BufferManager->BindConstantBuffer(TEXT("FLightInfoBuffer"), 0, EShaderStage::Vertex);
-    BufferManager->BindConstantBuffer(TEXT("FMaterialConstants"), 1, EShaderStage::Vertex);
-    BufferManager->BindConstantBuffer(TEXT("FObjectConstantBuffer"), 12, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffers({ LightInfoBuffer, MaterialBuffer }, 0, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer(ObjectBuffer, 12, EShaderStage::Vertex);
 
 
     Graphics->DeviceContext->RSSetViewports(1, &Viewport->GetViewportResource()->GetD3DViewport());
@@ -252,33 +243,60 @@ void FSkeletalMeshRenderPass::PrepareRenderState(const std::shared_ptr<FViewport
     }
 }
 
-void FSkeletalMeshRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const
+void FSkeletalMeshRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FMatrix& InverseTransposedWorld, const FVector4& UUIDColor, bool bIsSelected) const
 {
     FObjectConstantBuffer ObjectData = {};
     ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    ObjectData.InverseTransposedWorld = InverseTransposedWorld;
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
 
-    BufferManager->UpdateConstantBuffer(TEXT("FObjectConstantBuffer"), ObjectData);
+    BufferManager->UpdateConstantBuffer(ObjectBuffer, ObjectData);
+}
+
+bool FSkeletalMeshRenderPass::UploadObjectConstants(const USceneComponent* SelectedComponent, FUploadAllocation& OutAllocation) const
+{
+    const TArray<FSkeletalMeshSceneProxy>& Proxies = RenderScene->GetSkeletalMeshProxies();
+
+    uint8* Data = BufferManager->MapUpload(sizeof(FObjectConstantBuffer), Proxies.Num(), OutAllocation);
+    if (!Data)
+    {
+        return false;
+    }
+
+    for (int32 ProxyIndex = 0; ProxyIndex < Proxies.Num(); ++ProxyIndex)
+    {
+        const FSkeletalMeshSceneProxy& Proxy = Proxies[ProxyIndex];
+
+        FObjectConstantBuffer ObjectData = {};
+        ObjectData.WorldMatrix = Proxy.WorldMatrix;
+        ObjectData.InverseTransposedWorld = Proxy.WorldInverseTransposeMatrix;
+        ObjectData.UUIDColor = Proxy.UUIDColor;
+        ObjectData.bIsSelected = SelectedComponent == Proxy.Component;
+
+        memcpy(Data + ProxyIndex * OutAllocation.Stride, &ObjectData, sizeof(FObjectConstantBuffer));
+    }
+
+    BufferManager->UnmapUpload();
+    return true;
 }
 
 void FSkeletalMeshRenderPass::UpdateLitUnlitConstant(int32 isLit) const
 {
     FLitUnlitConstants Data;
     Data.bIsLit = isLit;
-    BufferManager->UpdateConstantBuffer(TEXT("FLitUnlitConstants"), Data);
+    BufferManager->UpdateConstantBuffer(LitUnlitBuffer, Data);
 }
 
-void FSkeletalMeshRenderPass::RenderPrimitive(FBX::FSkeletalMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const
+void FSkeletalMeshRenderPass::RenderPrimitive(ID3D11Buffer* SkinnedVertexBuffer, FBX::FSkeletalMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int SelectedSubMeshIndex) const
 {
     // 정점 스트라이드 변경: FStaticMeshVertex -> FBX::FSkeletalMeshVertex
     UINT Stride = sizeof(FBX::FSkeletalMeshVertex);
     UINT Offset = 0;
 
-    // 버퍼 설정 (DynamicVertexBuffer 사용)
-    if (!RenderData || !RenderData->DynamicVertexBuffer) return; // 유효성 검사
-    Graphics->DeviceContext->IASetVertexBuffers(0, 1, &RenderData->DynamicVertexBuffer, &Stride, &Offset);
+    // 버퍼 설정 (컴포넌트마다 가진 스키닝 결과 Dynamic Vertex Buffer 사용)
+    if (!RenderData || !SkinnedVertexBuffer) return; // 유효성 검사
+    Graphics->DeviceContext->IASetVertexBuffers(0, 1, &SkinnedVertexBuffer, &Stride, &Offset);
 
     // 인덱스 버퍼 설정
     if (RenderData->IndexBuffer)
@@ -308,7 +326,7 @@ void FSkeletalMeshRenderPass::RenderPrimitive(FBX::FSkeletalMeshRenderData* Rend
             if (MaterialToUse)
             {
                 // UpdateMaterial은 FObjMaterialInfo를 받음
-                MaterialUtils::UpdateMaterial(BufferManager, Graphics, MaterialToUse->GetMaterialInfo());
+                MaterialUtils::UpdateMaterial(BufferManager, Graphics, MaterialBuffer, MaterialToUse->GetMaterialInfo());
             }
             else
             {
@@ -328,7 +346,7 @@ void FSkeletalMeshRenderPass::RenderPrimitive(FBX::FSkeletalMeshRenderData* Rend
 
         FSubMeshConstants SubMeshData;
         SubMeshData.bIsSelectedSubMesh = (SubMeshIndex == SelectedSubMeshIndex) ? 1.0f : 0.0f; // bool -> float 변환
-        BufferManager->UpdateConstantBuffer(TEXT("FSubMeshConstants"), SubMeshData);
+        BufferManager->UpdateConstantBuffer(SubMeshBuffer, SubMeshData);
 
         // 사용할 재질 결정 (Override 우선)
         UMaterial* MaterialToUse = nullptr;
@@ -345,7 +363,7 @@ void FSkeletalMeshRenderPass::RenderPrimitive(FBX::FSkeletalMeshRenderData* Rend
         // 재질 상수 버퍼 업데이트 및 텍스처 바인딩
         if (MaterialToUse)
         {
-            MaterialUtils::UpdateMaterial(BufferManager, Graphics, MaterialToUse->GetMaterialInfo());
+            MaterialUtils::UpdateMaterial(BufferManager, Graphics, MaterialBuffer, MaterialToUse->GetMaterialInfo());
         }
         else
         {
@@ -366,14 +384,31 @@ void FSkeletalMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FVie
 {
     const uint64 ShowFlag = Viewport->GetShowFlag();
 
-    for (USkeletalMeshComponent* Comp : SkeletalMeshComponents)
+    // 선택 상태는 Mesh마다 바뀌지 않으므로 한 번만 구합니다.
+    UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+    USceneComponent* TargetComponent = nullptr;
+    if (Engine)
     {
-        if (!Comp || !Comp->GetSkeletalMesh())
+        if (USceneComponent* SelectedComponent = Engine->GetSelectedComponent())
         {
-            continue;
+            TargetComponent = SelectedComponent;
         }
+        else if (AActor* SelectedActor = Engine->GetSelectedActor())
+        {
+            TargetComponent = SelectedActor->GetRootComponent();
+        }
+    }
 
-        FBX::FSkeletalMeshRenderData* RenderData = Comp->GetSkeletalMesh()->GetRenderData();
+    // 모든 Proxy의 Object 상수를 한 번에 올려두고, Draw마다 범위만 바꿔서 Bind합니다.
+    FUploadAllocation ObjectAllocation;
+    const bool bUploadedObjectConstants = UploadObjectConstants(TargetComponent, ObjectAllocation);
+
+    const TArray<FSkeletalMeshSceneProxy>& Proxies = RenderScene->GetSkeletalMeshProxies();
+    for (int32 ProxyIndex = 0; ProxyIndex < Proxies.Num(); ++ProxyIndex)
+    {
+        const FSkeletalMeshSceneProxy& Proxy = Proxies[ProxyIndex];
+        USkeletalMeshComponent* Comp = Proxy.Component;
+        FBX::FSkeletalMeshRenderData* RenderData = Proxy.SkeletalMesh->GetRenderData();
         if (RenderData == nullptr)
         {
             continue;
@@ -384,37 +419,31 @@ void FSkeletalMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FVie
             FSkeletalMeshDebugger::DrawSkeletonAABBs(Comp);
         }
 
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
-
-        USceneComponent* SelectedComponent = Engine->GetSelectedComponent();
-        AActor* SelectedActor = Engine->GetSelectedActor();
-
-        USceneComponent* TargetComponent = nullptr;
-
-        if (SelectedComponent != nullptr)
+        if (bUploadedObjectConstants)
         {
-            TargetComponent = SelectedComponent;
+            BufferManager->BindUploadConstantBuffer(ObjectAllocation, ProxyIndex, 12, EShaderStage::Vertex);
+            BufferManager->BindUploadConstantBuffer(ObjectAllocation, ProxyIndex, 12, EShaderStage::Pixel);
         }
-        else if (SelectedActor != nullptr)
+        else
         {
-            TargetComponent = SelectedActor->GetRootComponent();
+            const bool bIsSelected = TargetComponent == Comp;
+            UpdateObjectConstant(Proxy.WorldMatrix, Proxy.WorldInverseTransposeMatrix, Proxy.UUIDColor, bIsSelected);
         }
 
-        const bool bIsSelected = (Engine && TargetComponent == Comp);
-
-
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-        FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
-
-        UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected);
-
-        RenderPrimitive(RenderData, Comp->GetSkeletalMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        RenderPrimitive(Comp->GetSkinnedVertexBuffer(), RenderData, Proxy.SkeletalMesh->GetMaterials(), Proxy.OverrideMaterials, Comp->GetselectedSubMeshIndex());
 
         if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB))
         {
-            FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Comp->GetBoundingBox(), WorldMatrix);
+            FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Proxy.LocalBounds, Proxy.WorldMatrix);
         }
     }
+
+    // 다른 Pass는 12번 Slot에 FObjectConstantBuffer가 있다고 보고 갱신하므로 되돌려둡니다.
+    if (bUploadedObjectConstants)
+    {
+        BufferManager->BindConstantBuffer(ObjectBuffer, 12, EShaderStage::Vertex);
+        BufferManager->BindConstantBuffer(ObjectBuffer, 12, EShaderStage::Pixel);
+    }
 }
 
 void FSkeletalMeshRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewport)
@@ -454,25 +483,19 @@ void FSkeletalMeshRenderPass::Render(const std::shared_ptr<FViewportClient>& Vie
 
 void FSkeletalMeshRenderPass::ClearRenderArr()
 {
-    SkeletalMeshComponents.Empty();
+    RenderScene = nullptr;
 }
 
 
 void FSkeletalMeshRenderPass::RenderAllSkeletalMeshes(const std::shared_ptr<FViewportClient>&Viewport, UPointLightComponent * &PointLight)
 {
-    for (USkeletalMeshComponent* Comp : SkeletalMeshComponents)
+    for (const FSkeletalMeshSceneProxy& Proxy : RenderScene->GetSkeletalMeshProxies())
     {
-        if (!Comp || !Comp->GetSkeletalMesh()) { continue; }
-
-        FBX::FSkeletalMeshRenderData * RenderData = Comp->GetSkeletalMesh()->GetRenderData();
+        FBX::FSkeletalMeshRenderData * RenderData = Proxy.SkeletalMesh->GetRenderData();
         if (RenderData == nullptr) { continue; }
 
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
-
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-
-        //ShadowRenderPass->UpdateCubeMapConstantBuffer(PointLight, WorldMatrix);
+        //ShadowRenderPass->UpdateCubeMapConstantBuffer(PointLight, Proxy.WorldMatrix);
 
-        RenderPrimitive(RenderData, Comp->GetSkeletalMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        RenderPrimitive(Proxy.Component->GetSkinnedVertexBuffer(), RenderData, Proxy.SkeletalMesh->GetMaterials(), Proxy.OverrideMaterials, Proxy.Component->GetselectedSubMeshIndex());
     }
 }
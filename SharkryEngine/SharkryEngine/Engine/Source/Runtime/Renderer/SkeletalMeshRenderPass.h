@@ -4,14 +4,18 @@
 
 #include "Define.h"
 #include "Components/Light/PointLightComponent.h"
+#include "D3D11RHI/ConstantBufferRegistry.h"
 
 class FShadowManager;
 class FDXDShaderManager;
 class UWorld;
 class UMaterial;
 class USkeletalMeshComponent;
+class FRenderScene;
 struct FStaticMaterial;
 class FShadowRenderPass;
+class USceneComponent;
+struct FUploadAllocation;
 class FLoaderFBX;
 namespace FBX
 {
@@ -39,11 +43,17 @@ public:
 
     virtual void RenderAllSkeletalMeshes(const std::shared_ptr<FViewportClient>& Viewport);
     
-    void UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const;
+    void UpdateObjectConstant(const FMatrix& WorldMatrix, const FMatrix& InverseTransposedWorld, const FVector4& UUIDColor, bool bIsSelected) const;
+
+    /**
+     * Skeletal Mesh Proxy 순서대로 Object 상수를 Upload Buffer에 한 번에 올립니다.
+     * @return Upload Buffer를 사용할 수 없다면 false, 이 경우 Draw마다 UpdateObjectConstant로 갱신합니다.
+     */
+    bool UploadObjectConstants(const USceneComponent* SelectedComponent, FUploadAllocation& OutAllocation) const;
   
     void UpdateLitUnlitConstant(int32 isLit) const;
 
-    void RenderPrimitive(FBX::FSkeletalMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const;
+    void RenderPrimitive(ID3D11Buffer* SkinnedVertexBuffer, FBX::FSkeletalMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int SelectedSubMeshIndex) const;
     
     // Shader 관련 함수 (생성/해제 등)
     void CreateShader();
@@ -54,7 +64,8 @@ public:
 protected:
 
 
-    TArray<USkeletalMeshComponent*> SkeletalMeshComponents;
+    /** 이번 프레임에 그리는 World의 Render Scene, Skeletal Mesh Proxy를 읽습니다. */
+    const FRenderScene* RenderScene = nullptr;
 
     ID3D11VertexShader* VertexShader;
     ID3D11InputLayout* InputLayout;
@@ -66,6 +77,14 @@ protected:
     FDXDBufferManager* BufferManager;
     FGraphicsDevice* Graphics;
     FDXDShaderManager* ShaderManager;
+
+    /** Initialize에서 한 번 찾아둔 Constant Buffer */
+    TConstantBufferHandle<FLightInfoBuffer> LightInfoBuffer;
+    TConstantBufferHandle<FMaterialConstants> MaterialBuffer;
+    TConstantBufferHandle<FLitUnlitConstants> LitUnlitBuffer;
+    TConstantBufferHandle<FSubMeshConstants> SubMeshBuffer;
+    TConstantBufferHandle<FTextureUVConstants> TextureBuffer;
+    TConstantBufferHandle<FObjectConstantBuffer> ObjectBuffer;
     
     FShadowManager* ShadowManager;
     FLoaderFBX* FBXLoader;
@@ -0,0 +1,42 @@
+#include "StaticMeshLOD.h"
+
+#include <algorithm>
+
+namespace StaticMeshLOD
+{
+    float ComputeBoundsScreenSize(const FVector& Center, float Radius, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix, bool bOrthographic)
+    {
+        // Projection의 X, Y Scale 중 큰 쪽을 써서 화면이 가로로 넓어도 LOD가 거칠어지는 쪽으로 틀리지 않게 합니다.
+        const float ProjectionScale = std::max(ProjectionMatrix.M[0][0], ProjectionMatrix.M[1][1]);
+        if (bOrthographic)
+        {
+            return ProjectionScale * Radius;
+        }
+
+        // 카메라에서 Bounds 중심까지의 거리, View 공간으로 옮기면 카메라 위치를 따로 읽지 않아도 됩니다.
+        const float Distance = ViewMatrix.TransformPosition(Center).Length();
+        return ProjectionScale * Radius / std::max(Distance, 1.0f);
+    }
+
+    int32 SelectLOD(const OBJ::FStaticMeshRenderData& RenderData, float ScreenSize, int32 CurrentLOD, float Hysteresis)
+    {
+        const int32 NumLODs = RenderData.LODs.Num() + 1;
+        int32 LODIndex = std::clamp(CurrentLOD, 0, NumLODs - 1);
+
+        // LOD L은 ScreenSize가 LODs[L - 1].ScreenSize보다 작을 때 씁니다.
+        while (LODIndex + 1 < NumLODs && ScreenSize < RenderData.LODs[LODIndex].ScreenSize * (1.0f - Hysteresis))
+        {
+            ++LODIndex;
+        }
+        while (LODIndex > 0 && ScreenSize > RenderData.LODs[LODIndex - 1].ScreenSize * (1.0f + Hysteresis))
+        {
+            --LODIndex;
+        }
+        return LODIndex;
+    }
+
+    int32 GetNumIndices(const OBJ::FStaticMeshRenderData& RenderData, int32 LODIndex)
+    {
+        return LODIndex > 0 ? RenderData.LODs[LODIndex - 1].Indices.Num() : RenderData.Indices.Num();
+    }
+}
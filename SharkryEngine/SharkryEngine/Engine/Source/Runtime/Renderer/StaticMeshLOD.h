@@ -0,0 +1,54 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+#include "Math/Matrix.h"
+#include "Math/Vector.h"
+
+/** LOD별로 그린 Static Mesh 통계, 여러 Viewport의 값이 쌓입니다. */
+struct FStaticMeshLODStats
+{
+    /** 마지막 칸은 그 이상의 LOD를 함께 셉니다. */
+    static constexpr int32 MaxCountedLODs = 5;
+
+    uint32 NumObjects[MaxCountedLODs] = {};
+
+    /** 선택한 LOD로 그린 Triangle 수와, 모두 LOD 0으로 그렸다면 그렸을 Triangle 수 */
+    uint64 NumTriangles = 0;
+    uint64 NumLOD0Triangles = 0;
+
+    void Add(int32 LODIndex, int32 NumLODTriangles, int32 NumLOD0TrianglesOfMesh)
+    {
+        ++NumObjects[LODIndex < MaxCountedLODs ? LODIndex : MaxCountedLODs - 1];
+        NumTriangles += NumLODTriangles;
+        NumLOD0Triangles += NumLOD0TrianglesOfMesh;
+    }
+};
+
+/**
+ * 화면에 보이는 크기로 Static Mesh의 LOD를 고릅니다.
+ *
+ * Screen Size는 Bounds 구의 지름이 화면 높이에서 차지하는 비율이고, FStaticMeshSimplifier가 LOD마다 저장한
+ * ScreenSize보다 작아지면 그 LOD를 씁니다. D3D 리소스를 사용하지 않으므로 Pass와 상관없이 호출할 수 있습니다.
+ */
+namespace StaticMeshLOD
+{
+    /** 경계 근처에서 LOD가 프레임마다 바뀌지 않도록, 기준 Screen Size에서 이 비율만큼 더 멀어져야 LOD를 바꿉니다. */
+    constexpr float DefaultHysteresis = 0.1f;
+
+    /**
+     * 월드 Bounds 구가 화면에서 차지하는 크기
+     * @param bOrthographic true라면 거리와 상관없이 Projection의 Scale만 사용합니다.
+     */
+    float ComputeBoundsScreenSize(const FVector& Center, float Radius, const FMatrix& ViewMatrix, const FMatrix& ProjectionMatrix, bool bOrthographic);
+
+    /**
+     * ScreenSize에 맞는 LOD, 0은 원본 Mesh이고 1부터 RenderData.LODs[LOD - 1]입니다.
+     * 같은 ScreenSize와 결과 LOD로 다시 호출하면 같은 LOD가 나오므로 Depth Pre-Pass와 Base Pass가 같은 LOD를 그립니다.
+     * @param CurrentLOD 지난번에 고른 LOD, Hysteresis는 이 LOD에서 벗어날 때만 적용합니다.
+     */
+    int32 SelectLOD(const OBJ::FStaticMeshRenderData& RenderData, float ScreenSize, int32 CurrentLOD, float Hysteresis = DefaultHysteresis);
+
+    /** LOD의 Index 수, LOD가 없다면 원본 Mesh의 Index 수 */
+    int32 GetNumIndices(const OBJ::FStaticMeshRenderData& RenderData, int32 LODIndex);
+}
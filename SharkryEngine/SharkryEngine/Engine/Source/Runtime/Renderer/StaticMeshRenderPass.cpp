@@ -12,16 +12,15 @@
 #include "UnrealClient.h"
 #include "Math/JungleMath.h"
 
-#include "UObject/UObjectIterator.h"
 #include "UObject/Casts.h"
 
 #include "D3D11RHI/DXDBufferManager.h"
+#include "D3D11RHI/LinearUploadAllocator.h"
 #include "D3D11RHI/GraphicDevice.h"
 #include "D3D11RHI/DXDShaderManager.h"
 
 #include "Components/StaticMeshComponent.h"
 
-#include "BaseGizmos/GizmoBaseComponent.h"
 #include "Engine/EditorEngine.h"
 
 #include "UnrealEd/EditorViewportClient.h"
@@ -41,6 +40,7 @@ FStaticMeshRenderPass::FStaticMeshRenderPass()
 FStaticMeshRenderPass::~FStaticMeshRenderPass()
 {
     ReleaseShader();
+    ReleaseInstanceBuffer();
 }
 
 void FStaticMeshRenderPass::CreateShader()
@@ -149,6 +149,17 @@ void FStaticMeshRenderPass::ChangeViewMode(EViewModeIndex ViewModeIndex)
         UpdateLitUnlitConstant(1);
         break;
     }
+
+    if (ViewModeIndex == EViewModeIndex::VMI_Lit_Gouraud)
+    {
+        InstancedVertexShader = ShaderManager->GetVertexShaderByKey(L"INSTANCED_GOURAUD_StaticMeshVertexShader");
+        InstancedInputLayout = ShaderManager->GetInputLayoutByKey(L"INSTANCED_GOURAUD_StaticMeshVertexShader");
+    }
+    else
+    {
+        InstancedVertexShader = ShaderManager->GetVertexShaderByKey(L"INSTANCED_StaticMeshVertexShader");
+        InstancedInputLayout = ShaderManager->GetInputLayoutByKey(L"INSTANCED_StaticMeshVertexShader");
+    }
 }
 
 
@@ -158,6 +169,13 @@ void FStaticMeshRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGrap
     Graphics = InGraphics;
     ShaderManager = InShaderManager;
 
+    LightInfoBuffer = BufferManager->GetConstantBufferHandle<FLightInfoBuffer>(TEXT("FLightInfoBuffer"));
+    MaterialBuffer = BufferManager->GetConstantBufferHandle<FMaterialConstants>(TEXT("FMaterialConstants"));
+    LitUnlitBuffer = BufferManager->GetConstantBufferHandle<FLitUnlitConstants>(TEXT("FLitUnlitConstants"));
+    SubMeshBuffer = BufferManager->GetConstantBufferHandle<FSubMeshConstants>(TEXT("FSubMeshConstants"));
+    TextureBuffer = BufferManager->GetConstantBufferHandle<FTextureUVConstants>(TEXT("FTextureConstants"));
+    ObjectBuffer = BufferManager->GetConstantBufferHandle<FObjectConstantBuffer>(TEXT("FObjectConstantBuffer"));
+
     // ShadowRenderPass = new FShadowRenderPass();
     // ShadowRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     // ShadowRenderPass->InitializeShadowManager();
@@ -174,13 +192,12 @@ void FStaticMeshRenderPass::InitializeShadowManager(class FShadowManager* InShad
 
 void FStaticMeshRenderPass::PrepareRenderArr()
 {
-    for (const auto iter : TObjectRange<UStaticMeshComponent>())
-    {
-        if (!Cast<UGizmoBaseComponent>(iter) && iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            StaticMeshComponents.Add(iter);
-        }
-    }
+    // 활성화된 Static Mesh와 월드 AABB는 Render Scene이 유지하므로, 읽을 Scene만 잡아둡니다.
+    RenderScene = &GEngine->ActiveWorld->GetRenderScene();
+    CullStats.Reset();
+    DrawCommands.ResetStats();
+    InstanceBatcher.ResetStats();
+    LODStats = FStaticMeshLODStats();
 }
 
 void FStaticMeshRenderPass::PrepareRenderState(const std::shared_ptr<FViewportClient>& Viewport)
@@ -193,18 +210,9 @@ void FStaticMeshRenderPass::PrepareRenderState(const std::shared_ptr<FViewportCl
     Graphics->DeviceContext->IASetInputLayout(InputLayout);
     Graphics->DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 
-    TArray<FString> PSBufferKeys = {
-        TEXT("FLightInfoBuffer"),
-        TEXT("FMaterialConstants"),
-        TEXT("FLitUnlitConstants"),
-        TEXT("FSubMeshConstants"),
-        TEXT("FTextureConstants")
-    };
-
-    BufferManager->BindConstantBuffers(PSBufferKeys, 0, EShaderStage::Pixel);
-    BufferManager->BindConstantBuffer(TEXT("FLightInfoBuffer"), 0, EShaderStage::Vertex);
-    BufferManager->BindConstantBuffer(TEXT("FMaterialConstants"), 1, EShaderStage::Vertex);
-    BufferManager->BindConstantBuffer(TEXT("FObjectConstantBuffer"), 12, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffers({ LightInfoBuffer, MaterialBuffer, LitUnlitBuffer, SubMeshBuffer, TextureBuffer }, 0, EShaderStage::Pixel);
+    BufferManager->BindConstantBuffers({ LightInfoBuffer, MaterialBuffer }, 0, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer(ObjectBuffer, 12, EShaderStage::Vertex);
 
     Graphics->DeviceContext->RSSetViewports(1, &Viewport->GetViewportResource()->GetD3DViewport());
 
@@ -229,25 +237,51 @@ void FStaticMeshRenderPass::PrepareRenderState(const std::shared_ptr<FViewportCl
 }
 
 
-void FStaticMeshRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const
+void FStaticMeshRenderPass::UpdateObjectConstant(const FMatrix& WorldMatrix, const FMatrix& InverseTransposedWorld, const FVector4& UUIDColor, bool bIsSelected) const
 {
     FObjectConstantBuffer ObjectData = {};
     ObjectData.WorldMatrix = WorldMatrix;
-    ObjectData.InverseTransposedWorld = FMatrix::Transpose(FMatrix::Inverse(WorldMatrix));
+    ObjectData.InverseTransposedWorld = InverseTransposedWorld;
     ObjectData.UUIDColor = UUIDColor;
     ObjectData.bIsSelected = bIsSelected;
 
-    BufferManager->UpdateConstantBuffer(TEXT("FObjectConstantBuffer"), ObjectData);
+    BufferManager->UpdateConstantBuffer(ObjectBuffer, ObjectData);
+}
+
+bool FStaticMeshRenderPass::UploadObjectConstants(const USceneComponent* SelectedComponent, FUploadAllocation& OutAllocation) const
+{
+    uint8* Data = BufferManager->MapUpload(sizeof(FObjectConstantBuffer), SingleProxyIndices.Num(), OutAllocation);
+    if (!Data)
+    {
+        return false;
+    }
+
+    const TArray<FStaticMeshSceneProxy>& Proxies = RenderScene->GetStaticMeshProxies();
+    for (int32 ObjectIndex = 0; ObjectIndex < SingleProxyIndices.Num(); ++ObjectIndex)
+    {
+        const FStaticMeshSceneProxy& Proxy = Proxies[SingleProxyIndices[ObjectIndex]];
+
+        FObjectConstantBuffer ObjectData = {};
+        ObjectData.WorldMatrix = Proxy.WorldMatrix;
+        ObjectData.InverseTransposedWorld = Proxy.WorldInverseTransposeMatrix;
+        ObjectData.UUIDColor = Proxy.UUIDColor;
+        ObjectData.bIsSelected = SelectedComponent == Proxy.Component;
+
+        memcpy(Data + ObjectIndex * OutAllocation.Stride, &ObjectData, sizeof(FObjectConstantBuffer));
+    }
+
+    BufferManager->UnmapUpload();
+    return true;
 }
 
 void FStaticMeshRenderPass::UpdateLitUnlitConstant(int32 isLit) const
 {
     FLitUnlitConstants Data;
     Data.bIsLit = isLit;
-    BufferManager->UpdateConstantBuffer(TEXT("FLitUnlitConstants"), Data);
+    BufferManager->UpdateConstantBuffer(LitUnlitBuffer, Data);
 }
 
-void FStaticMeshRenderPass::RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const
+void FStaticMeshRenderPass::RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int SelectedSubMeshIndex) const
 {
     UINT Stride = sizeof(FStaticMeshVertex);
     UINT Offset = 0;
@@ -271,15 +305,15 @@ void FStaticMeshRenderPass::RenderPrimitive(OBJ::FStaticMeshRenderData* RenderDa
 
         FSubMeshConstants SubMeshData = (SubMeshIndex == SelectedSubMeshIndex) ? FSubMeshConstants(true) : FSubMeshConstants(false);
 
-        BufferManager->UpdateConstantBuffer(TEXT("FSubMeshConstants"), SubMeshData);
+        BufferManager->UpdateConstantBuffer(SubMeshBuffer, SubMeshData);
 
         if (OverrideMaterials[MaterialIndex] != nullptr)
         {
-            MaterialUtils::UpdateMaterial(BufferManager, Graphics, OverrideMaterials[MaterialIndex]->GetMaterialInfo());
+            MaterialUtils::UpdateMaterial(BufferManager, Graphics, MaterialBuffer, OverrideMaterials[MaterialIndex]->GetMaterialInfo());
         }
         else
         {
-            MaterialUtils::UpdateMaterial(BufferManager, Graphics, Materials[MaterialIndex]->Material->GetMaterialInfo());
+            MaterialUtils::UpdateMaterial(BufferManager, Graphics, MaterialBuffer, Materials[MaterialIndex]->Material->GetMaterialInfo());
         }
 
         uint32 StartIndex = RenderData->MaterialSubsets[SubMeshIndex].IndexStart;
@@ -305,51 +339,404 @@ void FStaticMeshRenderPass::RenderPrimitive(ID3D11Buffer* pVertexBuffer, UINT nu
     Graphics->DeviceContext->DrawIndexed(numIndices, 0, 0);
 }
 
-void FStaticMeshRenderPass::RenderAllStaticMeshes(const std::shared_ptr<FViewportClient>& Viewport)
+int32 FStaticMeshRenderPass::FindOrAddDrawMaterial(const FObjMaterialInfo& MaterialInfo)
 {
-    for (UStaticMeshComponent* Comp : StaticMeshComponents)
+    const int32 MaterialId = DrawCommands.FindMaterial(&MaterialInfo);
+    if (MaterialId != INDEX_NONE)
     {
-        if (!Comp || !Comp->GetStaticMesh())
+        return MaterialId;
+    }
+
+    FMeshDrawMaterial Material;
+    Material.MaterialInfo = &MaterialInfo;
+    Material.DiffuseTexture = MaterialUtils::FindDiffuseTexture(MaterialInfo);
+    Material.BumpTexture = MaterialUtils::FindBumpTexture(MaterialInfo);
+    return DrawCommands.AddMaterial(Material);
+}
+
+namespace
+{
+    /** 재질 Slot의 최종 재질, Override가 있다면 Override */
+    UMaterial* GetSlotMaterial(const FStaticMeshSceneProxy& Proxy, uint32 MaterialSlot)
+    {
+        if (MaterialSlot < static_cast<uint32>(Proxy.OverrideMaterials.Num()) && Proxy.OverrideMaterials[MaterialSlot])
         {
+            return Proxy.OverrideMaterials[MaterialSlot];
+        }
+        return Proxy.StaticMesh->GetMaterials()[MaterialSlot]->Material;
+    }
+}
+
+void FStaticMeshRenderPass::SelectLODs(const std::shared_ptr<FViewportClient>& Viewport)
+{
+    const TArray<FStaticMeshSceneProxy>& Proxies = RenderScene->GetStaticMeshProxies();
+    const FVisibilityCuller& Bounds = RenderScene->GetStaticMeshBounds();
+    const FMatrix& ViewMatrix = Viewport->GetViewMatrix();
+    const FMatrix& ProjectionMatrix = Viewport->GetProjectionMatrix();
+    const bool bOrthographic = Viewport->IsOrthographic();
+    TMap<const UStaticMeshComponent*, int32>& LastLODs = Viewport->GetStaticMeshLODs();
+
+    NextStaticMeshLODs.Empty();
+    ProxyLODs.SetNum(Proxies.Num());
+    for (const int32 ProxyIndex : VisibleIndices)
+    {
+        const FStaticMeshSceneProxy& Proxy = Proxies[ProxyIndex];
+        const OBJ::FStaticMeshRenderData* RenderData = Proxy.StaticMesh->GetRenderData();
+        if (RenderData == nullptr || RenderData->LODs.Num() == 0)
+        {
+            ProxyLODs[ProxyIndex] = 0;
             continue;
         }
 
-        OBJ::FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
+        const float ScreenSize = StaticMeshLOD::ComputeBoundsScreenSize(Bounds.GetCenter(ProxyIndex), Bounds.GetExtent(ProxyIndex).Length(), ViewMatrix, ProjectionMatrix, bOrthographic);
+        const int32* LastLOD = LastLODs.Find(Proxy.Component);
+        const int32 LODIndex = StaticMeshLOD::SelectLOD(*RenderData, ScreenSize, LastLOD ? *LastLOD : 0);
+        NextStaticMeshLODs.Add(Proxy.Component, LODIndex);
+        ProxyLODs[ProxyIndex] = LODIndex;
+
+        LODStats.Add(LODIndex, StaticMeshLOD::GetNumIndices(*RenderData, LODIndex) / 3, RenderData->Indices.Num() / 3);
+    }
+
+    std::swap(LastLODs, NextStaticMeshLODs);
+}
+
+void FStaticMeshRenderPass::BatchInstances(const USceneComponent* SelectedComponent)
+{
+    InstanceBatcher.Reset();
+    SingleProxyIndices.Empty();
+
+    const TArray<FStaticMeshSceneProxy>& Proxies = RenderScene->GetStaticMeshProxies();
+    for (const int32 ProxyIndex : VisibleIndices)
+    {
+        const FStaticMeshSceneProxy& Proxy = Proxies[ProxyIndex];
+        OBJ::FStaticMeshRenderData* RenderData = Proxy.StaticMesh->GetRenderData();
         if (RenderData == nullptr)
         {
             continue;
         }
 
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+        // 선택 강조는 Pixel Shader가 Object 상수에서 읽으므로, 선택된 Component는 Object 상수로 따로 그립니다.
+        if (InstancedVertexShader == nullptr || Proxy.Component == SelectedComponent)
+        {
+            SingleProxyIndices.Add(ProxyIndex);
+            continue;
+        }
+
+        const int32 NumMaterials = Proxy.StaticMesh->GetMaterials().Num();
+        MaterialScratch.SetNum(NumMaterials);
+        for (int32 MaterialSlot = 0; MaterialSlot < NumMaterials; ++MaterialSlot)
+        {
+            MaterialScratch[MaterialSlot] = GetSlotMaterial(Proxy, MaterialSlot);
+        }
+
+        // LOD마다 Index Buffer가 다르므로 같은 Mesh라도 LOD가 다르면 묶지 않습니다.
+        const int32 LODIndex = ProxyLODs[ProxyIndex];
+        const void* MeshKey = LODIndex > 0 ? static_cast<const void*>(&RenderData->LODs[LODIndex - 1]) : RenderData;
+        InstanceBatcher.AddObject(ProxyIndex, MeshKey, MaterialScratch.GetData(), NumMaterials, Proxy.Component->GetselectedSubMeshIndex());
+    }
+
+    InstanceBatcher.Build();
+    for (const uint32 ProxyIndex : InstanceBatcher.GetSingleObjects())
+    {
+        SingleProxyIndices.Add(ProxyIndex);
+    }
+}
+
+bool FStaticMeshRenderPass::EnsureInstanceBuffer(uint32 NumInstances)
+{
+    if (InstanceBuffer && NumInstances <= InstanceBufferCapacity)
+    {
+        return true;
+    }
+
+    ReleaseInstanceBuffer();
 
-        USceneComponent* SelectedComponent = Engine->GetSelectedComponent();
-        AActor* SelectedActor = Engine->GetSelectedActor();
+    const uint32 NewCapacity = std::max({ NumInstances, InstanceBufferCapacity * 2, 256u });
 
-        USceneComponent* TargetComponent = nullptr;
+    D3D11_BUFFER_DESC Desc = {};
+    Desc.ByteWidth = NewCapacity * sizeof(FStaticMeshInstanceData);
+    Desc.Usage = D3D11_USAGE_DYNAMIC;
+    Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
 
-        if (SelectedComponent != nullptr)
+    HRESULT hr = Graphics->Device->CreateBuffer(&Desc, nullptr, &InstanceBuffer);
+    if (FAILED(hr))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Failed to create Static Mesh Instance Buffer"));
+        return false;
+    }
+
+    InstanceBufferCapacity = NewCapacity;
+    return true;
+}
+
+void FStaticMeshRenderPass::ReleaseInstanceBuffer()
+{
+    if (InstanceBuffer)
+    {
+        InstanceBuffer->Release();
+        InstanceBuffer = nullptr;
+    }
+}
+
+bool FStaticMeshRenderPass::UploadInstances()
+{
+    const TArray<uint32>& InstanceObjects = InstanceBatcher.GetInstanceObjects();
+    if (InstanceObjects.Num() == 0)
+    {
+        return false;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE Mapped = {};
+    if (!EnsureInstanceBuffer(InstanceObjects.Num()) || FAILED(Graphics->DeviceContext->Map(InstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped)))
+    {
+        for (const uint32 ProxyIndex : InstanceObjects)
+        {
+            SingleProxyIndices.Add(ProxyIndex);
+        }
+        return false;
+    }
+
+    const TArray<FStaticMeshSceneProxy>& Proxies = RenderScene->GetStaticMeshProxies();
+    FStaticMeshInstanceData* Instances = static_cast<FStaticMeshInstanceData*>(Mapped.pData);
+    for (int32 InstanceIndex = 0; InstanceIndex < InstanceObjects.Num(); ++InstanceIndex)
+    {
+        const FStaticMeshSceneProxy& Proxy = Proxies[InstanceObjects[InstanceIndex]];
+        Instances[InstanceIndex] = FStaticMeshInstanceData::Make(Proxy.WorldMatrix, Proxy.WorldInverseTransposeMatrix);
+    }
+
+    Graphics->DeviceContext->Unmap(InstanceBuffer, 0);
+    return true;
+}
+
+void FStaticMeshRenderPass::AddMeshDrawCommands(const FStaticMeshSceneProxy& Proxy, int32 LODIndex, FMeshDrawCommand Command, float Depth01, bool bGroupByMaterial)
+{
+    OBJ::FStaticMeshRenderData* RenderData = Proxy.StaticMesh->GetRenderData();
+    const OBJ::FStaticMeshLODData* LOD = LODIndex > 0 ? &RenderData->LODs[LODIndex - 1] : nullptr;
+    const TArray<FMaterialSubset>& MaterialSubsets = LOD ? LOD->MaterialSubsets : RenderData->MaterialSubsets;
+
+    Command.VertexBuffer = RenderData->VertexBuffer;
+    Command.IndexBuffer = LOD ? LOD->IndexBuffer : RenderData->IndexBuffer;
+    const uint32 MeshId = DrawCommands.FindOrAddMesh(LOD ? LOD->IndexBuffer : RenderData->VertexBuffer);
+
+    if (MaterialSubsets.Num() == 0)
+    {
+        Command.IndexCount = StaticMeshLOD::GetNumIndices(*RenderData, LODIndex);
+        Command.SortKey = FMeshDrawCommandList::MakeSortKey(0, Command.ShaderId, INDEX_NONE, MeshId, Depth01);
+        DrawCommands.AddCommand(Command);
+        return;
+    }
+
+    const int32 SelectedSubMeshIndex = Proxy.Component->GetselectedSubMeshIndex();
+    for (int32 SubMeshIndex = 0; SubMeshIndex < MaterialSubsets.Num(); ++SubMeshIndex)
+    {
+        const FMaterialSubset& Subset = MaterialSubsets[SubMeshIndex];
+        if (Subset.IndexCount == 0)
+        {
+            continue;
+        }
+
+        Command.MaterialId = FindOrAddDrawMaterial(GetSlotMaterial(Proxy, Subset.MaterialIndex)->GetMaterialInfo());
+        Command.IndexStart = Subset.IndexStart;
+        Command.IndexCount = Subset.IndexCount;
+        Command.bSelectedSubMesh = SubMeshIndex == SelectedSubMeshIndex;
+        Command.SortKey = FMeshDrawCommandList::MakeSortKey(0, Command.ShaderId, bGroupByMaterial ? Command.MaterialId : 0, MeshId, Depth01);
+        DrawCommands.AddCommand(Command);
+    }
+}
+
+void FStaticMeshRenderPass::BuildDrawCommands(const std::shared_ptr<FViewportClient>& Viewport, bool bGroupByMaterial, bool bInstancesUploaded)
+{
+    DrawCommands.Reset();
+
+    const FMatrix ViewMatrix = Viewport->GetViewMatrix();
+    const float InvFarClip = 1.0f / Viewport->GetFarClip();
+
+    const TArray<FStaticMeshSceneProxy>& Proxies = RenderScene->GetStaticMeshProxies();
+    for (int32 ObjectIndex = 0; ObjectIndex < SingleProxyIndices.Num(); ++ObjectIndex)
+    {
+        const FStaticMeshSceneProxy& Proxy = Proxies[SingleProxyIndices[ObjectIndex]];
+        const float Depth01 = ViewMatrix.TransformPosition(Proxy.WorldMatrix.GetTranslationVector()).Z * InvFarClip;
+
+        FMeshDrawCommand Command;
+        Command.ShaderId = SingleShaderId;
+        Command.ObjectIndex = ObjectIndex;
+        AddMeshDrawCommands(Proxy, ProxyLODs[SingleProxyIndices[ObjectIndex]], Command, Depth01, bGroupByMaterial);
+    }
+
+    if (!bInstancesUploaded)
+    {
+        DrawCommands.Sort();
+        return;
+    }
+
+    // 묶음 안에서 가장 가까운 Instance의 깊이로 정렬합니다.
+    const TArray<uint32>& InstanceObjects = InstanceBatcher.GetInstanceObjects();
+    for (const FMeshInstanceBatch& Batch : InstanceBatcher.GetBatches())
+    {
+        float Depth01 = 1.0f;
+        for (uint32 InstanceIndex = Batch.FirstInstance; InstanceIndex < Batch.FirstInstance + Batch.NumInstances; ++InstanceIndex)
+        {
+            const FStaticMeshSceneProxy& Proxy = Proxies[InstanceObjects[InstanceIndex]];
+            Depth01 = std::min(Depth01, ViewMatrix.TransformPosition(Proxy.WorldMatrix.GetTranslationVector()).Z * InvFarClip);
+        }
+
+        FMeshDrawCommand Command;
+        Command.ShaderId = InstancedShaderId;
+        Command.ObjectIndex = InstancedObjectIndex;
+        Command.FirstInstance = Batch.FirstInstance;
+        Command.NumInstances = Batch.NumInstances;
+        // 묶음의 Object는 모두 같은 LOD입니다.
+        const uint32 FirstProxyIndex = InstanceObjects[Batch.FirstInstance];
+        AddMeshDrawCommands(Proxies[FirstProxyIndex], ProxyLODs[FirstProxyIndex], Command, Depth01, bGroupByMaterial);
+    }
+
+    DrawCommands.Sort();
+}
+
+void FStaticMeshRenderPass::RenderAllStaticMeshes(const std::shared_ptr<FViewportClient>& Viewport)
+{
+    VisibleIndices.Empty();
+    const FConvexVolume ViewFrustum = FConvexVolume::FromViewProjection(Viewport->GetViewMatrix() * Viewport->GetProjectionMatrix());
+    RenderScene->GetStaticMeshBounds().Cull(ViewFrustum, VisibleIndices, CullStats);
+
+    // 선택 상태는 Mesh마다 바뀌지 않으므로 한 번만 구합니다.
+    UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
+    USceneComponent* TargetComponent = nullptr;
+    if (Engine)
+    {
+        if (USceneComponent* SelectedComponent = Engine->GetSelectedComponent())
         {
             TargetComponent = SelectedComponent;
         }
-        else if (SelectedActor != nullptr)
+        else if (AActor* SelectedActor = Engine->GetSelectedActor())
         {
             TargetComponent = SelectedActor->GetRootComponent();
         }
+    }
 
-        const bool bIsSelected = (Engine && TargetComponent == Comp);
+    // 멀리 있어서 작게 보이는 Mesh는 Cook할 때 만든 LOD로 그립니다.
+    SelectLODs(Viewport);
 
+    // 같은 Mesh와 재질을 쓰는 Object는 Instance Buffer로 한 번에 그리고, 나머지만 Object 상수로 그립니다.
+    BatchInstances(TargetComponent);
+    const bool bInstancesUploaded = UploadInstances();
 
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-        FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
+    // 따로 그리는 Mesh의 Object 상수를 한 번에 올려두고, Draw마다 범위만 바꿔서 Bind합니다.
+    FUploadAllocation ObjectAllocation;
+    const bool bUploadedObjectConstants = UploadObjectConstants(TargetComponent, ObjectAllocation);
 
-        UpdateObjectConstant(WorldMatrix, UUIDColor, bIsSelected);
+    // Object 상수를 Draw마다 Map해야 한다면 재질로 모으지 않고 Object의 Subset끼리 붙여서 Object 상수 갱신이 늘지 않게 합니다.
+    BuildDrawCommands(Viewport, bUploadedObjectConstants, bInstancesUploaded);
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+    if (bInstancesUploaded)
+    {
+        UINT Stride = sizeof(FStaticMeshInstanceData);
+        UINT Offset = 0;
+        Graphics->DeviceContext->IASetVertexBuffers(1, 1, &InstanceBuffer, &Stride, &Offset);
+    }
+
+    const TArray<FStaticMeshSceneProxy>& Proxies = RenderScene->GetStaticMeshProxies();
+    DrawCommands.Submit([&](const FMeshDrawCommand& Command, const FMeshDrawMaterial* Material, const FMeshDrawBinds& Binds)
+    {
+        const bool bInstanced = Command.ShaderId == InstancedShaderId;
 
-        if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB))
+        if (Binds.bShader)
         {
-            FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Comp->GetBoundingBox(), WorldMatrix);
+            Graphics->DeviceContext->VSSetShader(bInstanced ? InstancedVertexShader : VertexShader, nullptr, 0);
+            Graphics->DeviceContext->IASetInputLayout(bInstanced ? InstancedInputLayout : InputLayout);
         }
+
+        if (Binds.bVertexBuffer)
+        {
+            UINT Stride = sizeof(FStaticMeshVertex);
+            UINT Offset = 0;
+            Graphics->DeviceContext->IASetVertexBuffers(0, 1, &Command.VertexBuffer, &Stride, &Offset);
+        }
+
+        if (Binds.bIndexBuffer)
+        {
+            Graphics->DeviceContext->IASetIndexBuffer(Command.IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+        }
+
+        if (Binds.bObject)
+        {
+            if (Command.ObjectIndex == InstancedObjectIndex)
+            {
+                // World 행렬은 Instance Buffer에서 읽고, Pixel Shader는 선택되지 않은 상태만 읽습니다.
+                UpdateObjectConstant(FMatrix::Identity, FMatrix::Identity, FVector4(), false);
+                if (bUploadedObjectConstants)
+                {
+                    BufferManager->BindConstantBuffer(ObjectBuffer, 12, EShaderStage::Vertex);
+                    BufferManager->BindConstantBuffer(ObjectBuffer, 12, EShaderStage::Pixel);
+                }
+            }
+            else if (bUploadedObjectConstants)
+            {
+                BufferManager->BindUploadConstantBuffer(ObjectAllocation, Command.ObjectIndex, 12, EShaderStage::Vertex);
+                BufferManager->BindUploadConstantBuffer(ObjectAllocation, Command.ObjectIndex, 12, EShaderStage::Pixel);
+            }
+            else
+            {
+                const FStaticMeshSceneProxy& Proxy = Proxies[SingleProxyIndices[Command.ObjectIndex]];
+                const bool bIsSelected = TargetComponent == Proxy.Component;
+                UpdateObjectConstant(Proxy.WorldMatrix, Proxy.WorldInverseTransposeMatrix, Proxy.UUIDColor, bIsSelected);
+            }
+        }
+
+        if (Binds.bSubMesh)
+        {
+            BufferManager->UpdateConstantBuffer(SubMeshBuffer, FSubMeshConstants(Command.bSelectedSubMesh));
+        }
+
+        if (Binds.bMaterial)
+        {
+            MaterialUtils::UpdateMaterialConstants(BufferManager, MaterialBuffer, *Material->MaterialInfo);
+        }
+
+        if (Binds.bTextures)
+        {
+            MaterialUtils::BindMaterialTextures(Graphics, Material->DiffuseTexture, Material->BumpTexture);
+        }
+
+        if (bInstanced)
+        {
+            Graphics->DeviceContext->DrawIndexedInstanced(Command.IndexCount, Command.NumInstances, Command.IndexStart, 0, Command.FirstInstance);
+        }
+        else
+        {
+            Graphics->DeviceContext->DrawIndexed(Command.IndexCount, Command.IndexStart, 0);
+        }
+    });
+
+    if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB))
+    {
+        for (const int32 ProxyIndex : VisibleIndices)
+        {
+            const FStaticMeshSceneProxy& Proxy = Proxies[ProxyIndex];
+            if (Proxy.StaticMesh->GetRenderData())
+            {
+                FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Proxy.LocalBounds, Proxy.WorldMatrix);
+            }
+        }
+    }
+
+    // 다른 Pass는 12번 Slot에 FObjectConstantBuffer가 있다고 보고 갱신하므로 되돌려둡니다.
+    if (bUploadedObjectConstants)
+    {
+        BufferManager->BindConstantBuffer(ObjectBuffer, 12, EShaderStage::Vertex);
+        BufferManager->BindConstantBuffer(ObjectBuffer, 12, EShaderStage::Pixel);
+    }
+
+    // 이후 Pass가 같은 Vertex Shader를 쓴다고 보고 Draw하므로 Instancing Shader와 Instance Buffer를 되돌려둡니다.
+    if (bInstancesUploaded)
+    {
+        ID3D11Buffer* NullBuffer = nullptr;
+        UINT Stride = 0;
+        UINT Offset = 0;
+        Graphics->DeviceContext->IASetVertexBuffers(1, 1, &NullBuffer, &Stride, &Offset);
+        Graphics->DeviceContext->VSSetShader(VertexShader, nullptr, 0);
+        Graphics->DeviceContext->IASetInputLayout(InputLayout);
     }
 }
 
@@ -391,26 +778,20 @@ void FStaticMeshRenderPass::Render(const std::shared_ptr<FViewportClient>& Viewp
 
 void FStaticMeshRenderPass::ClearRenderArr()
 {
-    StaticMeshComponents.Empty();
+    RenderScene = nullptr;
 }
 
 
 void FStaticMeshRenderPass::RenderAllStaticMeshesForPointLight(const std::shared_ptr<FViewportClient>& Viewport, UPointLightComponent*& PointLight)
 {
-    for (UStaticMeshComponent* Comp : StaticMeshComponents)
+    for (const FStaticMeshSceneProxy& Proxy : RenderScene->GetStaticMeshProxies())
     {
-        if (!Comp || !Comp->GetStaticMesh()) { continue; }
-
-        OBJ::FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
+        OBJ::FStaticMeshRenderData* RenderData = Proxy.StaticMesh->GetRenderData();
         if (RenderData == nullptr) { continue; }
 
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
-
-        FMatrix WorldMatrix = Comp->GetWorldMatrix();
-
-        //ShadowRenderPass->UpdateCubeMapConstantBuffer(PointLight, WorldMatrix);
+        //ShadowRenderPass->UpdateCubeMapConstantBuffer(PointLight, Proxy.WorldMatrix);
 
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        RenderPrimitive(RenderData, Proxy.StaticMesh->GetMaterials(), Proxy.OverrideMaterials, Proxy.Component->GetselectedSubMeshIndex());
     }
 }
  
@@ -1,21 +1,37 @@
 #pragma once
 #include "IRenderPass.h"
 #include "EngineBaseTypes.h"
+#include "VisibilityCuller.h"
+#include "MeshDrawCommandList.h"
+#include "MeshInstanceBatcher.h"
+#include "StaticMeshLOD.h"
 
 #include "Define.h"
 #include "Components/Light/PointLightComponent.h"
+#include "D3D11RHI/ConstantBufferRegistry.h"
 
 class FShadowManager;
 class FDXDShaderManager;
+class FRenderScene;
 class UWorld;
 class UMaterial;
 class UStaticMeshComponent;
 struct FStaticMaterial;
 class FShadowRenderPass;
+class USceneComponent;
+struct FUploadAllocation;
 class FLoaderFBX;
+struct FStaticMeshSceneProxy;
 class FStaticMeshRenderPass : public IRenderPass
 {
 public:
+    /** FMeshDrawCommand::ShaderId, Instancing Shader는 Object 상수 대신 Instance Buffer에서 World 행렬을 읽습니다. */
+    static constexpr uint32 SingleShaderId = 0;
+    static constexpr uint32 InstancedShaderId = 1;
+
+    /** Instanced 명령의 ObjectIndex, 선택되지 않은 Object 상수를 Bind합니다. */
+    static constexpr uint32 InstancedObjectIndex = ~0u - 1;
+
     FStaticMeshRenderPass();
     
     virtual ~FStaticMeshRenderPass();
@@ -35,11 +51,17 @@ public:
 
     virtual void RenderAllStaticMeshes(const std::shared_ptr<FViewportClient>& Viewport);
     
-    void UpdateObjectConstant(const FMatrix& WorldMatrix, const FVector4& UUIDColor, bool bIsSelected) const;
+    void UpdateObjectConstant(const FMatrix& WorldMatrix, const FMatrix& InverseTransposedWorld, const FVector4& UUIDColor, bool bIsSelected) const;
+
+    /**
+     * SingleProxyIndices 순서대로 Object 상수를 Upload Buffer에 한 번에 올립니다.
+     * @return Upload Buffer를 사용할 수 없다면 false, 이 경우 Draw마다 UpdateObjectConstant로 갱신합니다.
+     */
+    bool UploadObjectConstants(const USceneComponent* SelectedComponent, FUploadAllocation& OutAllocation) const;
   
     void UpdateLitUnlitConstant(int32 isLit) const;
 
-    void RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex) const;
+    void RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData, const TArray<FStaticMaterial*>& Materials, const TArray<UMaterial*>& OverrideMaterials, int SelectedSubMeshIndex) const;
     
     void RenderPrimitive(ID3D11Buffer* pBuffer, UINT numVertices) const;
 
@@ -50,14 +72,93 @@ public:
     void ReleaseShader();
 
     void ChangeViewMode(EViewModeIndex ViewModeIndex);
+
+    const FVisibilityCullStats& GetCullStats() const { return CullStats; }
+
+    /** 이번 프레임에 제출한 Draw Command 수와 상태 Filtering 전후의 Bind 횟수 */
+    const FMeshDrawStats& GetDrawStats() const { return DrawCommands.GetStats(); }
+
+    /** 이번 프레임에 Instancing으로 묶은 Object 수 */
+    const FMeshInstanceStats& GetInstanceStats() const { return InstanceBatcher.GetStats(); }
+
+    /** 이번 프레임에 LOD별로 그린 Object 수와 줄어든 Triangle 수 */
+    const FStaticMeshLODStats& GetLODStats() const { return LODStats; }
     
 protected:
+    /**
+     * 보이는 Proxy마다 화면 크기로 LOD를 골라 ProxyLODs에 채우고, Viewport에 남겨서 다음 프레임의 Hysteresis 기준으로 씁니다.
+     * 선택은 같은 입력에 대해 멱등이므로 같은 Viewport를 그리는 Depth Pre-Pass와 Base Pass는 같은 LOD를 고릅니다.
+     * 이번에 보이지 않은 Component는 Viewport의 기록에서 빠집니다.
+     */
+    void SelectLODs(const std::shared_ptr<FViewportClient>& Viewport);
+
+    /** 보이는 Mesh를 Instancing 묶음과 따로 그릴 Object로 나눕니다. 선택된 Component는 강조해야 하므로 묶지 않습니다. */
+    void BatchInstances(const USceneComponent* SelectedComponent);
+
+    /**
+     * Instancing 묶음의 World 행렬을 Instance Buffer에 올립니다.
+     * @return 올리지 못했다면 묶음의 Object를 SingleProxyIndices로 옮기고 false
+     */
+    bool UploadInstances();
+
+    /** NumInstances개가 들어가는 Instance Buffer를 준비합니다. 모자라면 두 배씩 키웁니다. */
+    bool EnsureInstanceBuffer(uint32 NumInstances);
+
+    void ReleaseInstanceBuffer();
+
+    /**
+     * 따로 그릴 Object와 Instancing 묶음의 Subset마다 Draw Command를 만들어 DrawCommands에 넣습니다.
+     * @param bGroupByMaterial false라면 Sort Key에 재질을 넣지 않아서 Object의 Subset끼리 붙어있게 합니다.
+     */
+    void BuildDrawCommands(const std::shared_ptr<FViewportClient>& Viewport, bool bGroupByMaterial, bool bInstancesUploaded);
+
+    /**
+     * Proxy의 Mesh Subset마다 Command를 복사해서 넣습니다. Object와 Instance 구간은 Command에 채워서 넘깁니다.
+     * @param LODIndex 0이 아니라면 LOD의 Index Buffer와 Subset으로 그리고, 모두 사라진 Subset은 건너뜁니다.
+     */
+    void AddMeshDrawCommands(const FStaticMeshSceneProxy& Proxy, int32 LODIndex, FMeshDrawCommand Command, float Depth01, bool bGroupByMaterial);
+
+    /** 이번 프레임에 처음 쓰는 재질이라면 Texture를 찾아서 등록합니다. */
+    int32 FindOrAddDrawMaterial(const FObjMaterialInfo& MaterialInfo);
+
+protected:
+    /** 이번 프레임에 그리는 World의 Render Scene, Static Mesh Proxy와 월드 AABB를 읽습니다. */
+    const FRenderScene* RenderScene = nullptr;
+
+    FVisibilityCullStats CullStats;
+
+    /** 현재 Viewport의 Frustum 안에 있는 Static Mesh Proxy의 Index */
+    TArray<int32> VisibleIndices;
+
+    /** Proxy Index마다 이번 Viewport에서 고른 LOD, VisibleIndices의 Proxy만 채웁니다. */
+    TArray<int32> ProxyLODs;
+
+    /** SelectLODs가 이번 Viewport의 LOD 기록을 새로 채우는 곳, Viewport의 기록과 맞바꿔서 메모리를 재사용합니다. */
+    TMap<const UStaticMeshComponent*, int32> NextStaticMeshLODs;
 
+    FStaticMeshLODStats LODStats;
 
-    TArray<UStaticMeshComponent*> StaticMeshComponents;
+    /** RenderAllStaticMeshes에서 Viewport마다 다시 채우는 Draw Command, 메모리는 프레임 사이에 재사용합니다. */
+    FMeshDrawCommandList DrawCommands;
+
+    FMeshInstanceBatcher InstanceBatcher;
+
+    /** Instancing하지 않고 Object 상수로 그리는 Proxy의 Index, 단일 Draw Command의 ObjectIndex는 이 배열의 Index입니다. */
+    TArray<int32> SingleProxyIndices;
+
+    /** BatchInstances에서 Proxy마다 재질 Slot을 채우는 임시 배열 */
+    TArray<const void*> MaterialScratch;
+
+    /** FStaticMeshInstanceData를 담는 Dynamic Vertex Buffer */
+    ID3D11Buffer* InstanceBuffer = nullptr;
+    uint32 InstanceBufferCapacity = 0;
 
     ID3D11VertexShader* VertexShader;
     ID3D11InputLayout* InputLayout;
+
+    /** View Mode에 맞는 Instancing Vertex Shader, 1번 Slot에 Instance Buffer를 받습니다. */
+    ID3D11VertexShader* InstancedVertexShader = nullptr;
+    ID3D11InputLayout* InstancedInputLayout = nullptr;
     
     ID3D11PixelShader* PixelShader;
     ID3D11PixelShader* DebugDepthShader;
@@ -66,6 +167,14 @@ protected:
     FDXDBufferManager* BufferManager;
     FGraphicsDevice* Graphics;
     FDXDShaderManager* ShaderManager;
+
+    /** Initialize에서 한 번 찾아둔 Constant Buffer */
+    TConstantBufferHandle<FLightInfoBuffer> LightInfoBuffer;
+    TConstantBufferHandle<FMaterialConstants> MaterialBuffer;
+    TConstantBufferHandle<FLitUnlitConstants> LitUnlitBuffer;
+    TConstantBufferHandle<FSubMeshConstants> SubMeshBuffer;
+    TConstantBufferHandle<FTextureUVConstants> TextureBuffer;
+    TConstantBufferHandle<FObjectConstantBuffer> ObjectBuffer;
     
     FShadowManager* ShadowManager;
 };
@@ -0,0 +1,305 @@
+#include "Misc/AutomationTest.h"
+#include <algorithm>
+#include <limits>
+#include "WindowsPlatformTime.h"
+#include "Renderer/MeshDrawCommandList.h"
+
+namespace
+{
+    /** 실행마다 같은 Key가 나오도록 하는 간단한 난수 */
+    struct FTestRandom
+    {
+        uint32 State = 12345u;
+
+        uint32 Next()
+        {
+            State = State * 1664525u + 1013904223u;
+            return State >> 8;
+        }
+
+        float Range(float Min, float Max)
+        {
+            return Min + (Max - Min) * static_cast<float>(Next() & 0xFFFF) / 65535.f;
+        }
+
+        /** Next()는 24bit이므로 세 번 섞어서 64bit 전체를 채웁니다. */
+        uint64 NextKey()
+        {
+            return static_cast<uint64>(Next()) << 40 ^ static_cast<uint64>(Next()) << 20 ^ Next();
+        }
+    };
+
+    /** 목록은 D3D 리소스와 재질을 포인터로만 비교하므로, 구별만 되는 가짜 주소를 씁니다. */
+    template <typename T>
+    const T* MakeFakePointer(int32 Index)
+    {
+        return reinterpret_cast<const T*>(static_cast<uintptr_t>(0x1000 + Index * 0x100));
+    }
+
+    struct FSortReference
+    {
+        uint64 SortKey;
+        uint32 ObjectIndex;
+    };
+
+    /**
+     * Key를 넣어서 정렬한 결과가 같은 Key를 std::stable_sort로 정렬한 순서와 같은지 확인합니다.
+     * 추가한 순서를 ObjectIndex에 넣어두므로, 같은 Key끼리의 순서도 비교됩니다.
+     */
+    bool MatchesStableSort(FMeshDrawCommandList& CommandList, const TArray<uint64>& Keys)
+    {
+        TArray<FSortReference> Reference;
+        Reference.Reserve(Keys.Num());
+
+        CommandList.Reset();
+        for (int32 Index = 0; Index < Keys.Num(); ++Index)
+        {
+            FMeshDrawCommand Command;
+            Command.SortKey = Keys[Index];
+            Command.ObjectIndex = static_cast<uint32>(Index);
+            CommandList.AddCommand(Command);
+            Reference.Add({ Keys[Index], static_cast<uint32>(Index) });
+        }
+
+        CommandList.Sort();
+        std::stable_sort(Reference.GetData(), Reference.GetData() + Reference.Num(), [](const FSortReference& A, const FSortReference& B)
+        {
+            return A.SortKey < B.SortKey;
+        });
+
+        if (CommandList.Num() != Reference.Num())
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < Reference.Num(); ++Index)
+        {
+            if (CommandList.GetCommand(Index).ObjectIndex != Reference[Index].ObjectIndex)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * FStaticMeshRenderPass처럼 Object마다 Subset 명령을 추가합니다.
+     * Mesh마다 Subset 3개가 서로 다른 재질을 쓰고, 재질 둘이 Diffuse Texture 하나를 같이 씁니다.
+     */
+    void AddTestScene(FMeshDrawCommandList& CommandList, int32 NumMeshes, int32 NumObjectsPerMesh, int32 NumMaterials, FTestRandom& Random)
+    {
+        constexpr int32 NumSubsets = 3;
+
+        // 등록 순서가 Mesh별로 모여있지 않도록 섞습니다.
+        TArray<int32> Objects;
+        Objects.SetNum(NumMeshes * NumObjectsPerMesh);
+        for (int32 Index = 0; Index < Objects.Num(); ++Index)
+        {
+            Objects[Index] = Index;
+        }
+        for (int32 Index = Objects.Num() - 1; Index > 0; --Index)
+        {
+            std::swap(Objects[Index], Objects[static_cast<int32>(Random.Next() % static_cast<uint32>(Index + 1))]);
+        }
+
+        uint32 ObjectIndex = 0;
+        for (const int32 Object : Objects)
+        {
+            const int32 Mesh = Object % NumMeshes;
+            const ID3D11Buffer* IndexBuffer = MakeFakePointer<ID3D11Buffer>(NumMeshes + Mesh);
+            const uint32 MeshId = CommandList.FindOrAddMesh(IndexBuffer);
+            const float Depth = Random.Range(0.f, 1.f);
+
+            for (int32 Subset = 0; Subset < NumSubsets; ++Subset)
+            {
+                const int32 Material = (Mesh + Subset * 5) % NumMaterials;
+                const FObjMaterialInfo* MaterialInfo = MakeFakePointer<FObjMaterialInfo>(Material);
+                int32 MaterialId = CommandList.FindMaterial(MaterialInfo);
+                if (MaterialId == INDEX_NONE)
+                {
+                    FMeshDrawMaterial DrawMaterial;
+                    DrawMaterial.MaterialInfo = MaterialInfo;
+                    DrawMaterial.DiffuseTexture = MakeFakePointer<FTexture>(Material / 2);
+                    MaterialId = CommandList.AddMaterial(DrawMaterial);
+                }
+
+                FMeshDrawCommand Command;
+                Command.SortKey = FMeshDrawCommandList::MakeSortKey(0, 0, MaterialId, MeshId, Depth);
+                Command.VertexBuffer = const_cast<ID3D11Buffer*>(MakeFakePointer<ID3D11Buffer>(Mesh));
+                Command.IndexBuffer = const_cast<ID3D11Buffer*>(IndexBuffer);
+                Command.MaterialId = MaterialId;
+                Command.ObjectIndex = ObjectIndex;
+                Command.IndexStart = Subset * 100;
+                Command.IndexCount = 100;
+                Command.bSelectedSubMesh = Object == 7 && Subset == 1;
+                CommandList.AddCommand(Command);
+            }
+            ++ObjectIndex;
+        }
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FMeshDrawCommandListSortTest, "Renderer.MeshDrawCommandList.MatchesStableSort", EAutomationTestType::Unit)
+{
+    constexpr int32 CommandCounts[] = { 0, 1, 2, 17, 1000, 50000 };
+
+    // 같은 목록을 계속 다시 쓰면서, 상위 자리가 모두 같은 Key와 전부 다른 Key를 섞습니다.
+    FTestRandom Random;
+    FMeshDrawCommandList CommandList;
+    for (const int32 NumCommands : CommandCounts)
+    {
+        TArray<uint64> Keys;
+        Keys.SetNum(NumCommands);
+        for (int32 Index = 0; Index < NumCommands; ++Index)
+        {
+            Keys[Index] = Index % 3 == 0 ? Random.NextKey() & 0xFFFF0000ull : Random.NextKey();
+        }
+
+        if (!TestTrue("Radix sort order matches std::stable_sort", MatchesStableSort(CommandList, Keys)))
+        {
+            AddError(FString::Printf(TEXT("%d commands"), NumCommands));
+        }
+    }
+
+    // 같은 Key가 많은 경우, 추가한 순서가 유지되어야 합니다.
+    TArray<uint64> Keys;
+    Keys.SetNum(4096);
+    for (int32 Index = 0; Index < Keys.Num(); ++Index)
+    {
+        Keys[Index] = FMeshDrawCommandList::MakeSortKey(0, 0, static_cast<int32>(Random.Next() % 4), Random.Next() % 4, 0.f);
+    }
+    TestTrue("Radix sort keeps the order of equal keys", MatchesStableSort(CommandList, Keys));
+
+    // Key의 상위 필드가 하위 필드보다 먼저 정렬되고, 범위를 벗어난 값은 잘립니다.
+    TestTrue("Material before depth", FMeshDrawCommandList::MakeSortKey(0, 0, 1, 0, 0.9f) < FMeshDrawCommandList::MakeSortKey(0, 0, 2, 0, 0.1f));
+    TestTrue("Mesh before depth", FMeshDrawCommandList::MakeSortKey(0, 0, 1, 5, 0.9f) < FMeshDrawCommandList::MakeSortKey(0, 0, 1, 6, 0.f));
+    TestTrue("Near before far", FMeshDrawCommandList::MakeSortKey(0, 0, 1, 5, 0.1f) < FMeshDrawCommandList::MakeSortKey(0, 0, 1, 5, 0.2f));
+    TestTrue("Materials before no material", FMeshDrawCommandList::MakeSortKey(0, 0, 70000, 5, 0.1f) < FMeshDrawCommandList::MakeSortKey(0, 0, INDEX_NONE, 0, 0.f));
+    TestTrue("Pass before everything else", FMeshDrawCommandList::MakeSortKey(1, 0, 0, 0, 0.f) > FMeshDrawCommandList::MakeSortKey(0, 255, INDEX_NONE, (1u << 20) - 1, 1.f));
+    TestTrue("Negative depth is clamped", FMeshDrawCommandList::MakeSortKey(0, 0, 0, 0, -1.f) == FMeshDrawCommandList::MakeSortKey(0, 0, 0, 0, 0.f));
+    TestTrue("NaN depth is clamped", FMeshDrawCommandList::MakeSortKey(0, 0, 0, 0, std::numeric_limits<float>::quiet_NaN()) == FMeshDrawCommandList::MakeSortKey(0, 0, 0, 0, 0.f));
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FMeshDrawCommandListBindTest, "Renderer.MeshDrawCommandList.StateFiltering", EAutomationTestType::Unit)
+{
+    constexpr int32 NumMeshes = 20;
+    constexpr int32 NumObjectsPerMesh = 50;
+    constexpr int32 NumMaterials = 12;
+    constexpr int32 NumCommands = NumMeshes * NumObjectsPerMesh * 3;
+
+    FTestRandom Random;
+    FMeshDrawCommandList CommandList;
+
+    // 두 번째 프레임은 Reset한 목록을 다시 쓰므로, 이전 프레임의 재질과 Mesh Id가 남아있지 않아야 합니다.
+    for (int32 Frame = 0; Frame < 2; ++Frame)
+    {
+        CommandList.Reset();
+        CommandList.ResetStats();
+        AddTestScene(CommandList, NumMeshes, NumObjectsPerMesh, NumMaterials, Random);
+        CommandList.Sort();
+
+        // Binds에서 true인 상태만 바꿔도 모든 명령이 자기 상태로 그려져야 합니다.
+        const ID3D11Buffer* VertexBuffer = nullptr;
+        const ID3D11Buffer* IndexBuffer = nullptr;
+        uint32 ObjectIndex = ~0u;
+        int32 MaterialId = INDEX_NONE;
+        const FTexture* DiffuseTexture = nullptr;
+        int32 SelectedSubMesh = INDEX_NONE;
+        int32 NumWrongStates = 0;
+        int32 NumDrawn = 0;
+        CommandList.Submit([&](const FMeshDrawCommand& Command, const FMeshDrawMaterial* Material, const FMeshDrawBinds& Binds)
+        {
+            VertexBuffer = Binds.bVertexBuffer ? Command.VertexBuffer : VertexBuffer;
+            IndexBuffer = Binds.bIndexBuffer ? Command.IndexBuffer : IndexBuffer;
+            ObjectIndex = Binds.bObject ? Command.ObjectIndex : ObjectIndex;
+            MaterialId = Binds.bMaterial ? Command.MaterialId : MaterialId;
+            DiffuseTexture = Binds.bTextures ? Material->DiffuseTexture : DiffuseTexture;
+            SelectedSubMesh = Binds.bSubMesh ? (Command.bSelectedSubMesh ? 1 : 0) : SelectedSubMesh;
+
+            const bool bCorrect = VertexBuffer == Command.VertexBuffer && IndexBuffer == Command.IndexBuffer && ObjectIndex == Command.ObjectIndex
+                && MaterialId == Command.MaterialId && DiffuseTexture == Material->DiffuseTexture && SelectedSubMesh == (Command.bSelectedSubMesh ? 1 : 0);
+            NumWrongStates += bCorrect ? 0 : 1;
+            ++NumDrawn;
+        });
+        TestEqual("Commands drawn with a stale state", NumWrongStates, 0);
+        TestEqual("Commands drawn", NumDrawn, NumCommands);
+    }
+
+    // 재질, Mesh 순서로 모였으므로 Buffer는 (재질, Mesh) 쌍마다, 재질은 재질마다 한 번 Bind합니다.
+    const FMeshDrawStats& Stats = CommandList.GetStats();
+    TestEqual("Commands", static_cast<int32>(Stats.NumCommands), NumCommands);
+    TestEqual("Filtered draw calls", static_cast<int32>(Stats.Filtered.NumDrawCalls), NumCommands);
+    TestEqual("Unfiltered vertex buffer binds", static_cast<int32>(Stats.Unfiltered.NumVertexBufferBinds), NumMeshes * NumObjectsPerMesh);
+    TestEqual("Filtered vertex buffer binds", static_cast<int32>(Stats.Filtered.NumVertexBufferBinds), NumMeshes * 3);
+    TestEqual("Filtered index buffer binds", static_cast<int32>(Stats.Filtered.NumIndexBufferBinds), NumMeshes * 3);
+    TestEqual("Unfiltered material binds", static_cast<int32>(Stats.Unfiltered.NumMaterialBinds), NumCommands);
+    TestEqual("Filtered material binds", static_cast<int32>(Stats.Filtered.NumMaterialBinds), NumMaterials);
+    TestTrue("Filtered texture binds do not exceed material binds", Stats.Filtered.NumTextureBinds <= Stats.Filtered.NumMaterialBinds);
+    TestEqual("Filtered submesh updates", static_cast<int32>(Stats.Filtered.NumSubMeshUpdates), 3);
+
+    AddInfo(FString::Printf(TEXT("%u commands, unfiltered -> filtered binds: VB %u -> %u, IB %u -> %u, Object %u -> %u, Material %u -> %u, Texture %u -> %u, SubMesh %u -> %u"),
+        Stats.NumCommands,
+        Stats.Unfiltered.NumVertexBufferBinds, Stats.Filtered.NumVertexBufferBinds,
+        Stats.Unfiltered.NumIndexBufferBinds, Stats.Filtered.NumIndexBufferBinds,
+        Stats.Unfiltered.NumObjectBinds, Stats.Filtered.NumObjectBinds,
+        Stats.Unfiltered.NumMaterialBinds, Stats.Filtered.NumMaterialBinds,
+        Stats.Unfiltered.NumTextureBinds, Stats.Filtered.NumTextureBinds,
+        Stats.Unfiltered.NumSubMeshUpdates, Stats.Filtered.NumSubMeshUpdates));
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FMeshDrawCommandListBenchmark, "Renderer.MeshDrawCommandList.SortSpeed", EAutomationTestType::Benchmark)
+{
+    constexpr int32 CommandCounts[] = { 3000, 30000, 300000 };
+    constexpr int32 NumRuns = 20;
+
+    FTestRandom Random;
+    for (const int32 NumCommands : CommandCounts)
+    {
+        // 재질 64개, Mesh 256개인 장면의 Key
+        TArray<uint64> Keys;
+        Keys.SetNum(NumCommands);
+        for (int32 Index = 0; Index < NumCommands; ++Index)
+        {
+            Keys[Index] = FMeshDrawCommandList::MakeSortKey(0, 0, static_cast<int32>(Random.Next() % 64), Random.Next() % 256, Random.Range(0.f, 1.f));
+        }
+
+        // 가장 빠른 실행끼리 비교합니다.
+        FMeshDrawCommandList CommandList;
+        TArray<FSortReference> Reference;
+        double RadixMs = 1.e9;
+        double StableSortMs = 1.e9;
+        for (int32 Run = 0; Run < NumRuns; ++Run)
+        {
+            CommandList.Reset();
+            for (int32 Index = 0; Index < NumCommands; ++Index)
+            {
+                FMeshDrawCommand Command;
+                Command.SortKey = Keys[Index];
+                Command.ObjectIndex = static_cast<uint32>(Index);
+                CommandList.AddCommand(Command);
+            }
+            uint64 StartCycles = FPlatformTime::Cycles64();
+            CommandList.Sort();
+            RadixMs = std::min(RadixMs, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+
+            Reference.SetNum(NumCommands);
+            for (int32 Index = 0; Index < NumCommands; ++Index)
+            {
+                Reference[Index] = { Keys[Index], static_cast<uint32>(Index) };
+            }
+            StartCycles = FPlatformTime::Cycles64();
+            std::stable_sort(Reference.GetData(), Reference.GetData() + Reference.Num(), [](const FSortReference& A, const FSortReference& B)
+            {
+                return A.SortKey < B.SortKey;
+            });
+            StableSortMs = std::min(StableSortMs, FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+        }
+
+        AddInfo(FString::Printf(TEXT("%d commands: radix sort %.3f ms, std::stable_sort %.3f ms"), NumCommands, RadixMs, StableSortMs));
+    }
+    return true;
+}
@@ -0,0 +1,363 @@
+#include "Misc/AutomationTest.h"
+#include <algorithm>
+#include "WindowsPlatformTime.h"
+#include "Renderer/MeshDrawCommandList.h"
+#include "Renderer/MeshInstanceBatcher.h"
+
+namespace
+{
+    /** 실행마다 같은 장면이 나오도록 하는 간단한 난수 */
+    struct FTestRandom
+    {
+        uint32 State = 12345u;
+
+        uint32 Next()
+        {
+            State = State * 1664525u + 1013904223u;
+            return State >> 8;
+        }
+    };
+
+    /** Batcher는 Mesh와 재질을 포인터로만 비교하므로, 구별만 되는 가짜 주소를 씁니다. */
+    template <typename T = void>
+    const T* MakeFakePointer(int32 Index)
+    {
+        return reinterpret_cast<const T*>(static_cast<uintptr_t>(0x1000 + Index * 0x100));
+    }
+
+    struct FTestObject
+    {
+        int32 Mesh = 0;
+        TArray<const void*> Materials;
+        int32 SelectedSubMesh = INDEX_NONE;
+    };
+
+    /** Object를 하나씩 모든 묶음과 비교해서 묶는 기준 구현 */
+    struct FReferenceGroup
+    {
+        const FTestObject* Key = nullptr;
+        TArray<uint32> Objects;
+    };
+
+    bool IsSameGroup(const FTestObject& A, const FTestObject& B)
+    {
+        if (A.Mesh != B.Mesh || A.SelectedSubMesh != B.SelectedSubMesh || A.Materials.Num() != B.Materials.Num())
+        {
+            return false;
+        }
+        for (int32 Slot = 0; Slot < A.Materials.Num(); ++Slot)
+        {
+            if (A.Materials[Slot] != B.Materials[Slot])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void BuildReferenceGroups(const TArray<FTestObject>& Objects, TArray<FReferenceGroup>& OutGroups)
+    {
+        for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ++ObjectIndex)
+        {
+            FReferenceGroup* Found = nullptr;
+            for (FReferenceGroup& Group : OutGroups)
+            {
+                if (IsSameGroup(*Group.Key, Objects[ObjectIndex]))
+                {
+                    Found = &Group;
+                    break;
+                }
+            }
+            if (Found == nullptr)
+            {
+                Found = &OutGroups[OutGroups.Add(FReferenceGroup())];
+                Found->Key = &Objects[ObjectIndex];
+            }
+            Found->Objects.Add(static_cast<uint32>(ObjectIndex));
+        }
+    }
+
+    /**
+     * 모든 묶음이 기준 구현의 묶음 하나와 같은 Object를 같은 순서로 갖고, 작은 묶음의 Object는 모두 추가한 순서로 Single에 있는지 확인합니다.
+     * @return 찾은 문제, 없다면 빈 문자열
+     */
+    FString FindBatchMismatch(const FMeshInstanceBatcher& Batcher, const TArray<FTestObject>& Objects, uint32 MinInstances)
+    {
+        TArray<FReferenceGroup> Groups;
+        BuildReferenceGroups(Objects, Groups);
+
+        const TArray<uint32>& InstanceObjects = Batcher.GetInstanceObjects();
+        int32 NumExpectedBatches = 0;
+        int32 NumExpectedSingles = 0;
+        for (const FReferenceGroup& Group : Groups)
+        {
+            if (static_cast<uint32>(Group.Objects.Num()) < MinInstances)
+            {
+                NumExpectedSingles += Group.Objects.Num();
+            }
+            else
+            {
+                ++NumExpectedBatches;
+            }
+        }
+        if (Batcher.GetBatches().Num() != NumExpectedBatches)
+        {
+            return FString::Printf(TEXT("%d batches, expected %d"), Batcher.GetBatches().Num(), NumExpectedBatches);
+        }
+        if (Batcher.GetSingleObjects().Num() != NumExpectedSingles)
+        {
+            return FString::Printf(TEXT("%d single objects, expected %d"), Batcher.GetSingleObjects().Num(), NumExpectedSingles);
+        }
+
+        for (int32 BatchIndex = 0; BatchIndex < Batcher.GetBatches().Num(); ++BatchIndex)
+        {
+            const FMeshInstanceBatch& Batch = Batcher.GetBatches()[BatchIndex];
+            const FTestObject& First = Objects[InstanceObjects[Batch.FirstInstance]];
+            const FReferenceGroup* Group = nullptr;
+            for (const FReferenceGroup& Candidate : Groups)
+            {
+                Group = IsSameGroup(*Candidate.Key, First) ? &Candidate : Group;
+            }
+
+            bool bSame = Batch.Mesh == MakeFakePointer(First.Mesh) && Batch.SelectedSubMesh == First.SelectedSubMesh
+                && Batch.NumMaterials == First.Materials.Num() && Batch.NumInstances == static_cast<uint32>(Group->Objects.Num());
+            for (int32 Slot = 0; Slot < Batch.NumMaterials && bSame; ++Slot)
+            {
+                bSame = Batcher.GetMaterial(Batch, Slot) == First.Materials[Slot];
+            }
+            for (uint32 Instance = 0; Instance < Batch.NumInstances && bSame; ++Instance)
+            {
+                bSame = InstanceObjects[Batch.FirstInstance + Instance] == Group->Objects[Instance];
+            }
+            if (!bSame)
+            {
+                return FString::Printf(TEXT("Batch %d differs from the reference group"), BatchIndex);
+            }
+        }
+
+        const TArray<uint32>& SingleObjects = Batcher.GetSingleObjects();
+        for (int32 Index = 1; Index < SingleObjects.Num(); ++Index)
+        {
+            if (SingleObjects[Index - 1] >= SingleObjects[Index])
+            {
+                return FString::Printf(TEXT("Single object %d is out of order"), Index);
+            }
+        }
+        return FString();
+    }
+
+    /** FStaticMeshRenderPass::BuildDrawCommands처럼 Object의 Subset마다 명령을 추가합니다. */
+    void AddTestDrawCommands(FMeshDrawCommandList& CommandList, const FTestObject& Object, FMeshDrawCommand Command)
+    {
+        const ID3D11Buffer* IndexBuffer = MakeFakePointer<ID3D11Buffer>(1000 + Object.Mesh);
+        const uint32 MeshId = CommandList.FindOrAddMesh(IndexBuffer);
+        Command.VertexBuffer = const_cast<ID3D11Buffer*>(MakeFakePointer<ID3D11Buffer>(Object.Mesh));
+        Command.IndexBuffer = const_cast<ID3D11Buffer*>(IndexBuffer);
+
+        for (int32 Slot = 0; Slot < Object.Materials.Num(); ++Slot)
+        {
+            const FObjMaterialInfo* MaterialInfo = static_cast<const FObjMaterialInfo*>(Object.Materials[Slot]);
+            int32 MaterialId = CommandList.FindMaterial(MaterialInfo);
+            if (MaterialId == INDEX_NONE)
+            {
+                FMeshDrawMaterial DrawMaterial;
+                DrawMaterial.MaterialInfo = MaterialInfo;
+                MaterialId = CommandList.AddMaterial(DrawMaterial);
+            }
+            Command.MaterialId = MaterialId;
+            Command.IndexStart = Slot * 36;
+            Command.IndexCount = 36;
+            Command.SortKey = FMeshDrawCommandList::MakeSortKey(0, Command.ShaderId, MaterialId, MeshId, 0.5f);
+            CommandList.AddCommand(Command);
+        }
+    }
+
+    /**
+     * 장면을 그리는 명령을 만들고 Draw Call 수를 반환합니다.
+     * @param bInstancing false라면 user-024 이전처럼 모든 Object를 따로 그립니다.
+     */
+    uint32 CountDrawCalls(const TArray<FTestObject>& Objects, bool bInstancing, FMeshInstanceBatcher& Batcher, FMeshDrawCommandList& CommandList)
+    {
+        CommandList.Reset();
+        CommandList.ResetStats();
+        Batcher.Reset();
+
+        TArray<uint32> SingleObjects;
+        if (bInstancing)
+        {
+            for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ++ObjectIndex)
+            {
+                const FTestObject& Object = Objects[ObjectIndex];
+                Batcher.AddObject(ObjectIndex, MakeFakePointer(Object.Mesh), Object.Materials.GetData(), Object.Materials.Num(), Object.SelectedSubMesh);
+            }
+            Batcher.Build();
+            for (const uint32 ObjectIndex : Batcher.GetSingleObjects())
+            {
+                SingleObjects.Add(ObjectIndex);
+            }
+        }
+        else
+        {
+            for (int32 ObjectIndex = 0; ObjectIndex < Objects.Num(); ++ObjectIndex)
+            {
+                SingleObjects.Add(static_cast<uint32>(ObjectIndex));
+            }
+        }
+
+        for (int32 Index = 0; Index < SingleObjects.Num(); ++Index)
+        {
+            FMeshDrawCommand Command;
+            Command.ObjectIndex = static_cast<uint32>(Index);
+            AddTestDrawCommands(CommandList, Objects[SingleObjects[Index]], Command);
+        }
+        for (const FMeshInstanceBatch& Batch : Batcher.GetBatches())
+        {
+            FMeshDrawCommand Command;
+            Command.ShaderId = 1;
+            Command.ObjectIndex = static_cast<uint32>(SingleObjects.Num());
+            Command.FirstInstance = Batch.FirstInstance;
+            Command.NumInstances = Batch.NumInstances;
+            AddTestDrawCommands(CommandList, Objects[Batcher.GetInstanceObjects()[Batch.FirstInstance]], Command);
+        }
+
+        CommandList.Sort();
+        CommandList.Submit([](const FMeshDrawCommand&, const FMeshDrawMaterial*, const FMeshDrawBinds&) {});
+        return CommandList.GetStats().Filtered.NumDrawCalls;
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FMeshInstanceBatcherReferenceTest, "Renderer.MeshInstanceBatcher.MatchesReference", EAutomationTestType::Unit)
+{
+    constexpr int32 NumTrials = 20;
+
+    // 같은 Batcher를 계속 다시 쓰면서, Object 수와 Mesh 수, 최소 묶음 크기를 바꿔봅니다.
+    FTestRandom Random;
+    FMeshInstanceBatcher Batcher;
+    for (int32 Trial = 0; Trial < NumTrials; ++Trial)
+    {
+        const int32 NumObjects = 1 + static_cast<int32>(Random.Next() % 3000);
+        const int32 NumMeshes = 1 + static_cast<int32>(Random.Next() % 10);
+        const uint32 MinInstances = 1 + Trial % 4;
+
+        // 대부분은 Slot 기본 재질을 쓰고, 일부만 Override 재질과 강조 Subset을 갖습니다.
+        TArray<FTestObject> Objects;
+        Objects.SetNum(NumObjects);
+        Batcher.Reset();
+        for (int32 ObjectIndex = 0; ObjectIndex < NumObjects; ++ObjectIndex)
+        {
+            FTestObject& Object = Objects[ObjectIndex];
+            Object.Mesh = static_cast<int32>(Random.Next() % NumMeshes);
+            const int32 NumMaterials = 1 + Object.Mesh % 3;
+            for (int32 Slot = 0; Slot < NumMaterials; ++Slot)
+            {
+                Object.Materials.Add(MakeFakePointer(100 + (Random.Next() % 4 == 0 ? 10 + static_cast<int32>(Random.Next() % 3) : Slot)));
+            }
+            Object.SelectedSubMesh = Random.Next() % 50 == 0 ? 1 : INDEX_NONE;
+
+            Batcher.AddObject(ObjectIndex, MakeFakePointer(Object.Mesh), Object.Materials.GetData(), NumMaterials, Object.SelectedSubMesh);
+        }
+        Batcher.Build(MinInstances);
+
+        const FString Mismatch = FindBatchMismatch(Batcher, Objects, MinInstances);
+        if (!Mismatch.IsEmpty())
+        {
+            AddError(FString::Printf(TEXT("Trial %d (%d objects, min %u): "), Trial, NumObjects, MinInstances) + Mismatch);
+            break;
+        }
+    }
+
+    // Instance Buffer는 Instancing Vertex Shader의 입력 순서대로 World 행렬 4행, Inverse Transposed World 3행을 담습니다.
+    FMatrix WorldMatrix;
+    FMatrix InverseTransposedWorld;
+    for (int32 Row = 0; Row < 4; ++Row)
+    {
+        for (int32 Column = 0; Column < 4; ++Column)
+        {
+            WorldMatrix.M[Row][Column] = static_cast<float>(Row * 4 + Column);
+            InverseTransposedWorld.M[Row][Column] = static_cast<float>(100 + Row * 4 + Column);
+        }
+    }
+    const FStaticMeshInstanceData Instance = FStaticMeshInstanceData::Make(WorldMatrix, InverseTransposedWorld);
+    const float* Floats = reinterpret_cast<const float*>(&Instance);
+    int32 NumWrongFloats = 0;
+    for (int32 Index = 0; Index < 16; ++Index)
+    {
+        NumWrongFloats += Floats[Index] == static_cast<float>(Index) ? 0 : 1;
+    }
+    for (int32 Index = 0; Index < 12; ++Index)
+    {
+        NumWrongFloats += Floats[16 + Index] == static_cast<float>(100 + Index) ? 0 : 1;
+    }
+    TestEqual("Instance data floats in the wrong place", NumWrongFloats, 0);
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FMeshInstanceBatcherBenchmark, "Renderer.MeshInstanceBatcher.DrawCalls", EAutomationTestType::Benchmark)
+{
+    struct FTestScene
+    {
+        const TCHAR* Name;
+        int32 NumBullets;
+        int32 NumCubes;
+        int32 NumUniqueMeshes;
+    };
+    constexpr FTestScene Scenes[] =
+    {
+        { TEXT("2000 bullets + 50 unique meshes"), 2000, 0, 50 },
+        { TEXT("1000 cubes with 2 materials"), 0, 1000, 0 },
+        { TEXT("300 bullets + 300 cubes + 200 unique meshes"), 300, 300, 200 },
+    };
+    constexpr int32 NumRuns = 50;
+
+    FTestRandom Random;
+    FMeshInstanceBatcher Batcher;
+    FMeshDrawCommandList CommandList;
+    for (const FTestScene& Scene : Scenes)
+    {
+        // 총알은 Mesh 0 재질 하나, 상자는 Mesh 1에 재질 둘 중 하나, 나머지는 서로 다른 Mesh에 재질 두 개를 씁니다.
+        TArray<FTestObject> Objects;
+        for (int32 Index = 0; Index < Scene.NumBullets; ++Index)
+        {
+            FTestObject& Object = Objects[Objects.Add(FTestObject())];
+            Object.Mesh = 0;
+            Object.Materials.Add(MakeFakePointer(100));
+        }
+        for (int32 Index = 0; Index < Scene.NumCubes; ++Index)
+        {
+            FTestObject& Object = Objects[Objects.Add(FTestObject())];
+            Object.Mesh = 1;
+            Object.Materials.Add(MakeFakePointer(101 + Index % 2));
+        }
+        for (int32 Index = 0; Index < Scene.NumUniqueMeshes; ++Index)
+        {
+            FTestObject& Object = Objects[Objects.Add(FTestObject())];
+            Object.Mesh = 2 + Index;
+            Object.Materials.Add(MakeFakePointer(103 + Index % 20));
+            Object.Materials.Add(MakeFakePointer(130 + Index % 7));
+        }
+        for (int32 Index = Objects.Num() - 1; Index > 0; --Index)
+        {
+            std::swap(Objects[Index], Objects[static_cast<int32>(Random.Next() % static_cast<uint32>(Index + 1))]);
+        }
+
+        // 가장 빠른 실행끼리 비교합니다.
+        uint32 DrawCalls[2] = {};
+        double BestMs[2] = { 1.e9, 1.e9 };
+        for (int32 Instancing = 0; Instancing < 2; ++Instancing)
+        {
+            for (int32 Run = 0; Run < NumRuns; ++Run)
+            {
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                DrawCalls[Instancing] = CountDrawCalls(Objects, Instancing == 1, Batcher, CommandList);
+                BestMs[Instancing] = std::min(BestMs[Instancing], FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles));
+            }
+        }
+
+        TestTrue("Instancing does not add draw calls", DrawCalls[1] <= DrawCalls[0]);
+        AddInfo(FString::Printf(TEXT("%s: %u draw calls -> %u instanced (%d batches), build and sort %.3f ms -> %.3f ms"),
+            Scene.Name, DrawCalls[0], DrawCalls[1], Batcher.GetBatches().Num(), BestMs[0], BestMs[1]));
+    }
+    return true;
+}
@@ -0,0 +1,108 @@
+#include "Misc/AutomationTest.h"
+#include <cmath>
+#include "Renderer/StaticMeshLOD.h"
+
+namespace
+{
+    /** Index 없이 ScreenSize만 채운 LOD Chain, SelectLOD는 ScreenSize만 읽습니다. */
+    void MakeTestLODs(OBJ::FStaticMeshRenderData& OutRenderData, std::initializer_list<float> ScreenSizes)
+    {
+        for (const float ScreenSize : ScreenSizes)
+        {
+            OBJ::FStaticMeshLODData& LOD = OutRenderData.LODs[OutRenderData.LODs.Add(OBJ::FStaticMeshLODData())];
+            LOD.ScreenSize = ScreenSize;
+        }
+    }
+
+    /** Hysteresis 없이 ScreenSize만으로 고른 LOD */
+    int32 ReferenceSelectLOD(const OBJ::FStaticMeshRenderData& RenderData, float ScreenSize)
+    {
+        int32 LODIndex = 0;
+        while (LODIndex < RenderData.LODs.Num() && ScreenSize < RenderData.LODs[LODIndex].ScreenSize)
+        {
+            ++LODIndex;
+        }
+        return LODIndex;
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FStaticMeshLODSelectTest, "Renderer.StaticMeshLOD.SelectLOD", EAutomationTestType::Unit)
+{
+    constexpr int32 NumSteps = 2000;
+    constexpr float Hysteresis = StaticMeshLOD::DefaultHysteresis;
+
+    OBJ::FStaticMeshRenderData RenderData = {};
+    MakeTestLODs(RenderData, { 0.4f, 0.2f, 0.1f });
+    const int32 NumLODs = RenderData.LODs.Num() + 1;
+
+    // 결과 LOD로 다시 고르면 같은 LOD가 나와야 Depth Pre-Pass와 Base Pass가 같은 LOD를 그립니다.
+    // 경계에서 Hysteresis보다 멀다면 이전 LOD와 상관없이 기준 구현과 같아야 합니다.
+    int32 NumNotIdempotent = 0;
+    int32 NumWrongAwayFromBoundary = 0;
+    int32 NumOutOfRange = 0;
+    for (int32 Step = 0; Step <= NumSteps; ++Step)
+    {
+        const float ScreenSize = 0.01f + 0.99f * Step / NumSteps;
+        const int32 Expected = ReferenceSelectLOD(RenderData, ScreenSize);
+        bool bNearBoundary = false;
+        for (const OBJ::FStaticMeshLODData& LOD : RenderData.LODs)
+        {
+            bNearBoundary |= ScreenSize >= LOD.ScreenSize * (1.f - Hysteresis) && ScreenSize <= LOD.ScreenSize * (1.f + Hysteresis);
+        }
+
+        for (int32 CurrentLOD = -1; CurrentLOD <= NumLODs + 1; ++CurrentLOD)
+        {
+            const int32 Selected = StaticMeshLOD::SelectLOD(RenderData, ScreenSize, CurrentLOD);
+            NumOutOfRange += Selected < 0 || Selected >= NumLODs ? 1 : 0;
+            NumNotIdempotent += StaticMeshLOD::SelectLOD(RenderData, ScreenSize, Selected) != Selected ? 1 : 0;
+            NumWrongAwayFromBoundary += !bNearBoundary && Selected != Expected ? 1 : 0;
+        }
+    }
+    TestEqual("Selected LODs out of range", NumOutOfRange, 0);
+    TestEqual("Selections that change when repeated", NumNotIdempotent, 0);
+    TestEqual("Selections away from a boundary that differ from the reference", NumWrongAwayFromBoundary, 0);
+
+    // 경계 근처에서 Hysteresis보다 작게 오가면 LOD가 바뀌지 않고, 더 멀어져야 바뀝니다.
+    int32 LODIndex = StaticMeshLOD::SelectLOD(RenderData, 0.21f, 0);
+    TestEqual("LOD just above the 0.2 boundary", LODIndex, 1);
+    int32 NumSwitches = 0;
+    for (int32 Frame = 0; Frame < 100; ++Frame)
+    {
+        const float ScreenSize = 0.2f * (1.f + (Frame % 2 == 0 ? -0.5f : 0.5f) * Hysteresis);
+        const int32 NextLOD = StaticMeshLOD::SelectLOD(RenderData, ScreenSize, LODIndex);
+        NumSwitches += NextLOD != LODIndex ? 1 : 0;
+        LODIndex = NextLOD;
+    }
+    TestEqual("LOD switches while oscillating inside the hysteresis band", NumSwitches, 0);
+
+    LODIndex = StaticMeshLOD::SelectLOD(RenderData, 0.2f * (1.f - 2.f * Hysteresis), LODIndex);
+    TestEqual("LOD after moving past the band", LODIndex, 2);
+    LODIndex = StaticMeshLOD::SelectLOD(RenderData, 0.2f * (1.f + 0.5f * Hysteresis), LODIndex);
+    TestEqual("LOD after moving back inside the band", LODIndex, 2);
+    LODIndex = StaticMeshLOD::SelectLOD(RenderData, 0.2f * (1.f + 2.f * Hysteresis), LODIndex);
+    TestEqual("LOD after moving back past the band", LODIndex, 1);
+
+    // 한 프레임에 여러 경계를 지나면 중간 LOD를 거치지 않고 바로 맞는 LOD로 갑니다.
+    TestEqual("Jump from LOD 0 to the last LOD", StaticMeshLOD::SelectLOD(RenderData, 0.01f, 0), NumLODs - 1);
+    TestEqual("Jump from the last LOD to LOD 0", StaticMeshLOD::SelectLOD(RenderData, 1.f, NumLODs - 1), 0);
+
+    // LOD가 없다면 항상 원본 Mesh입니다.
+    const OBJ::FStaticMeshRenderData NoLODs = {};
+    TestEqual("Mesh without LODs far away", StaticMeshLOD::SelectLOD(NoLODs, 0.001f, 0), 0);
+    TestEqual("Mesh without LODs and a stale LOD", StaticMeshLOD::SelectLOD(NoLODs, 0.001f, 3), 0);
+
+    // Perspective에서는 거리에 반비례하고, Orthographic에서는 거리와 상관없습니다.
+    FMatrix Projection = FMatrix::Identity;
+    Projection.M[0][0] = 1.f;
+    Projection.M[1][1] = 1.5f;
+    const FVector Center(0.f, 0.f, 0.f);
+    const float Near = StaticMeshLOD::ComputeBoundsScreenSize(Center, 1.f, FMatrix::CreateTranslationMatrix(FVector(10.f, 0.f, 0.f)), Projection, false);
+    const float Far = StaticMeshLOD::ComputeBoundsScreenSize(Center, 1.f, FMatrix::CreateTranslationMatrix(FVector(20.f, 0.f, 0.f)), Projection, false);
+    TestTrue("Screen size halves when the distance doubles", std::abs(Near - 2.f * Far) < 1.e-5f);
+    TestTrue("Screen size uses the larger projection scale", std::abs(Near - 0.15f) < 1.e-5f);
+    const float OrthoNear = StaticMeshLOD::ComputeBoundsScreenSize(Center, 1.f, FMatrix::CreateTranslationMatrix(FVector(10.f, 0.f, 0.f)), Projection, true);
+    const float OrthoFar = StaticMeshLOD::ComputeBoundsScreenSize(Center, 1.f, FMatrix::CreateTranslationMatrix(FVector(20.f, 0.f, 0.f)), Projection, true);
+    TestTrue("Orthographic screen size does not depend on the distance", OrthoNear == OrthoFar);
+    return true;
+}
@@ -0,0 +1,432 @@
+#include "Misc/AutomationTest.h"
+#include <cfloat>
+#include <cmath>
+#include "WindowsPlatformTime.h"
+#include "Math/JungleMath.h"
+#include "Renderer/VisibilityCuller.h"
+
+namespace
+{
+    /** 실행마다 같은 Bounds가 나오도록 하는 간단한 난수 */
+    struct FTestRandom
+    {
+        uint32 State = 12345u;
+
+        uint32 Next()
+        {
+            State = State * 1664525u + 1013904223u;
+            return State >> 8;
+        }
+
+        float Range(float Min, float Max)
+        {
+            return Min + (Max - Min) * static_cast<float>(Next() & 0xFFFF) / 65535.f;
+        }
+    };
+
+    /** Culler에 등록한 것과 같은 로컬 AABB와 월드 행렬 */
+    struct FTestBounds
+    {
+        FBoundingBox LocalBounds;
+        FMatrix WorldMatrix;
+    };
+
+    void MakeTestBounds(int32 NumBounds, float WorldSize, FTestRandom& Random, TArray<FTestBounds>& OutBounds)
+    {
+        OutBounds.SetNum(NumBounds);
+        for (FTestBounds& Bounds : OutBounds)
+        {
+            const FVector Min(Random.Range(-2.f, 0.f), Random.Range(-2.f, 0.f), Random.Range(-2.f, 0.f));
+            Bounds.LocalBounds = FBoundingBox(Min, Min + FVector(Random.Range(0.1f, 3.f), Random.Range(0.1f, 3.f), Random.Range(0.1f, 3.f)));
+            Bounds.WorldMatrix = FMatrix::CreateScaleMatrix(Random.Range(0.5f, 2.f), Random.Range(0.5f, 2.f), Random.Range(0.5f, 2.f))
+                * FMatrix::CreateRotationMatrix(Random.Range(-180.f, 180.f), Random.Range(-180.f, 180.f), Random.Range(-180.f, 180.f))
+                * FMatrix::CreateTranslationMatrix(FVector(Random.Range(-WorldSize, WorldSize), Random.Range(-WorldSize, WorldSize), Random.Range(-WorldSize, WorldSize)));
+        }
+    }
+
+    FVector GetCorner(const FBoundingBox& Box, int32 CornerIndex)
+    {
+        return FVector(CornerIndex & 1 ? Box.max.X : Box.min.X, CornerIndex & 2 ? Box.max.Y : Box.min.Y, CornerIndex & 4 ? Box.max.Z : Box.min.Z);
+    }
+
+    /** 8개 꼭짓점을 변환해서 구한 월드 AABB */
+    FBoundingBox ReferenceWorldBounds(const FTestBounds& Bounds)
+    {
+        FBoundingBox WorldBounds(FVector(FLT_MAX, FLT_MAX, FLT_MAX), FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX));
+        for (int32 CornerIndex = 0; CornerIndex < 8; ++CornerIndex)
+        {
+            const FVector Corner = Bounds.WorldMatrix.TransformPosition(GetCorner(Bounds.LocalBounds, CornerIndex));
+            WorldBounds.min = FVector(FMath::Min(WorldBounds.min.X, Corner.X), FMath::Min(WorldBounds.min.Y, Corner.Y), FMath::Min(WorldBounds.min.Z, Corner.Z));
+            WorldBounds.max = FVector(FMath::Max(WorldBounds.max.X, Corner.X), FMath::Max(WorldBounds.max.Y, Corner.Y), FMath::Max(WorldBounds.max.Z, Corner.Z));
+        }
+        return WorldBounds;
+    }
+
+    /**
+     * 평면마다 월드 AABB의 꼭짓점 중 가장 앞쪽 점의 거리, 하나라도 음수면 그 평면 뒤에 완전히 있습니다.
+     * 가장 작은 값을 돌려주므로, 0에 가까우면 부동소수점 오차로 결과가 달라질 수 있는 경계입니다.
+     */
+    float ReferenceVolumeMargin(const FConvexVolume& Volume, const FBoundingBox& WorldBounds)
+    {
+        float Margin = FLT_MAX;
+        for (int32 PlaneIndex = 0; PlaneIndex < Volume.NumPlanes; ++PlaneIndex)
+        {
+            float MaxDistance = -FLT_MAX;
+            for (int32 CornerIndex = 0; CornerIndex < 8; ++CornerIndex)
+            {
+                MaxDistance = FMath::Max(MaxDistance, Volume.Planes[PlaneIndex].PlaneDot(GetCorner(WorldBounds, CornerIndex)));
+            }
+            Margin = FMath::Min(Margin, MaxDistance);
+        }
+        return Margin;
+    }
+
+    /**
+     * 로컬 박스의 꼭짓점을 Clip 공간으로 변환해서, 모든 꼭짓점이 같은 Clip 평면 밖에 있으면 보이지 않는다고 판정합니다.
+     * 박스가 Frustum과 겹치면 항상 보인다고 판정하므로, Culler는 이 결과가 보이는 것을 하나도 빼면 안 됩니다.
+     * @return 가장 바깥쪽 Clip 평면에 대한 여유, Epsilon보다 크면 확실히 보입니다.
+     */
+    float ReferenceClipSpaceMargin(const FTestBounds& Bounds, const FMatrix& ViewProjection)
+    {
+        const FMatrix LocalToClip = Bounds.WorldMatrix * ViewProjection;
+
+        // -w <= x <= w, -w <= y <= w, 0 <= z <= w 를 모두 "값 >= 0" 형태로 씁니다.
+        float MaxValues[6] = { -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX };
+        for (int32 CornerIndex = 0; CornerIndex < 8; ++CornerIndex)
+        {
+            const FVector Corner = GetCorner(Bounds.LocalBounds, CornerIndex);
+            float Clip[4];
+            for (int32 Axis = 0; Axis < 4; ++Axis)
+            {
+                Clip[Axis] = Corner.X * LocalToClip.M[0][Axis] + Corner.Y * LocalToClip.M[1][Axis] + Corner.Z * LocalToClip.M[2][Axis] + LocalToClip.M[3][Axis];
+            }
+            const float Values[6] = { Clip[3] + Clip[0], Clip[3] - Clip[0], Clip[3] + Clip[1], Clip[3] - Clip[1], Clip[3] - Clip[2], Clip[2] };
+            for (int32 PlaneIndex = 0; PlaneIndex < 6; ++PlaneIndex)
+            {
+                MaxValues[PlaneIndex] = FMath::Max(MaxValues[PlaneIndex], Values[PlaneIndex]);
+            }
+        }
+
+        float Margin = FLT_MAX;
+        for (const float MaxValue : MaxValues)
+        {
+            Margin = FMath::Min(Margin, MaxValue);
+        }
+        return Margin;
+    }
+
+    /** 구 중심에서 월드 AABB까지의 거리 */
+    float ReferenceSphereDistance(const FVector& Center, const FBoundingBox& WorldBounds)
+    {
+        const FVector Closest(
+            FMath::Clamp(Center.X, WorldBounds.min.X, WorldBounds.max.X),
+            FMath::Clamp(Center.Y, WorldBounds.min.Y, WorldBounds.max.Y),
+            FMath::Clamp(Center.Z, WorldBounds.min.Z, WorldBounds.max.Z));
+        return (Center - Closest).Length();
+    }
+
+    /** Cull 결과를 Index별 표시로 바꿉니다. 범위 밖 Index와 중복은 따로 셉니다. */
+    int32 MarkVisible(const TArray<int32>& VisibleIndices, int32 NumBounds, TArray<uint8>& OutVisible)
+    {
+        int32 NumInvalid = 0;
+        OutVisible.SetNum(NumBounds);
+        for (int32 Index = 0; Index < NumBounds; ++Index)
+        {
+            OutVisible[Index] = 0;
+        }
+        for (int32 ListIndex = 0; ListIndex < VisibleIndices.Num(); ++ListIndex)
+        {
+            const int32 Index = VisibleIndices[ListIndex];
+            if (Index < 0 || Index >= NumBounds || OutVisible[Index] || (ListIndex > 0 && Index < VisibleIndices[ListIndex - 1]))
+            {
+                ++NumInvalid;
+                continue;
+            }
+            OutVisible[Index] = 1;
+        }
+        return NumInvalid;
+    }
+
+    FMatrix MakeTestViewProjection()
+    {
+        const FMatrix View = JungleMath::CreateViewMatrix(FVector(0.f, 0.f, 0.f), FVector(1.f, 0.3f, 0.1f), FVector(0.f, 0.f, 1.f));
+        return View * JungleMath::CreateProjectionMatrix(1.2f, 16.f / 9.f, 0.1f, 150.f);
+    }
+
+    /** SSE 없이 같은 AABB 평면 판정을 Bounds 하나씩 수행하는 기준 구현, 벤치마크의 비교 대상입니다. */
+    void ReferenceCull(const FConvexVolume* Volumes, int32 NumVolumes, const TArray<FVector>& Centers, const TArray<FVector>& Extents, TArray<int32>& OutVisibleIndices)
+    {
+        for (int32 Index = 0; Index < Centers.Num(); ++Index)
+        {
+            for (int32 VolumeIndex = 0; VolumeIndex < NumVolumes; ++VolumeIndex)
+            {
+                const FConvexVolume& Volume = Volumes[VolumeIndex];
+                bool bInside = true;
+                for (int32 PlaneIndex = 0; PlaneIndex < Volume.NumPlanes && bInside; ++PlaneIndex)
+                {
+                    const FPlane& Plane = Volume.Planes[PlaneIndex];
+                    const float PushOut = FMath::Abs(Plane.X) * Extents[Index].X + FMath::Abs(Plane.Y) * Extents[Index].Y + FMath::Abs(Plane.Z) * Extents[Index].Z;
+                    bInside = Plane.PlaneDot(Centers[Index]) + PushOut >= 0.f;
+                }
+                if (bInside)
+                {
+                    OutVisibleIndices.Add(Index);
+                    break;
+                }
+            }
+        }
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FVisibilityCullerReferenceTest, "Renderer.VisibilityCuller.MatchesReference", EAutomationTestType::Unit)
+{
+    // 4의 배수가 아니어야 마지막 SSE 묶음의 빈 칸이 결과에 섞이지 않는지 확인할 수 있습니다.
+    constexpr int32 NumBounds = 4001;
+    constexpr float BoundsTolerance = 1.e-3f;
+    constexpr float PlaneTolerance = 1.e-3f;
+
+    FTestRandom Random;
+    TArray<FTestBounds> Bounds;
+    MakeTestBounds(NumBounds, 120.f, Random, Bounds);
+
+    FVisibilityCuller Culler;
+    TArray<FBoundingBox> WorldBounds;
+    int32 NumWrongIndices = 0;
+    int32 NumWrongBounds = 0;
+    for (int32 Index = 0; Index < NumBounds; ++Index)
+    {
+        NumWrongIndices += Culler.AddBounds(Bounds[Index].LocalBounds, Bounds[Index].WorldMatrix) != Index ? 1 : 0;
+        WorldBounds.Add(ReferenceWorldBounds(Bounds[Index]));
+
+        const FVector Center = (WorldBounds[Index].min + WorldBounds[Index].max) * 0.5f;
+        const FVector Extent = (WorldBounds[Index].max - WorldBounds[Index].min) * 0.5f;
+        NumWrongBounds += (Culler.GetCenter(Index) - Center).Length() > BoundsTolerance || (Culler.GetExtent(Index) - Extent).Length() > BoundsTolerance ? 1 : 0;
+    }
+    TestEqual("AddBounds indices", NumWrongIndices, 0);
+    TestEqual("World bounds that differ from the transformed corners", NumWrongBounds, 0);
+
+    // 평면 판정이 기준 구현과 같아야 하고, Clip 공간에서 보이는 박스는 하나도 빠지면 안 됩니다.
+    const FMatrix ViewProjection = MakeTestViewProjection();
+    const FConvexVolume Frustum = FConvexVolume::FromViewProjection(ViewProjection);
+    TestEqual("Frustum planes", Frustum.NumPlanes, 6);
+
+    TArray<int32> VisibleIndices;
+    FVisibilityCullStats Stats;
+    Culler.Cull(Frustum, VisibleIndices, Stats);
+
+    TArray<uint8> Visible;
+    TestEqual("Invalid, duplicate or unsorted visible indices", MarkVisible(VisibleIndices, NumBounds, Visible), 0);
+    TestEqual("Tested bounds", static_cast<int32>(Stats.NumTested), NumBounds);
+    TestEqual("Culled bounds", static_cast<int32>(Stats.NumCulled), NumBounds - VisibleIndices.Num());
+
+    int32 NumPlaneMismatches = 0;
+    int32 NumClipSpaceMissing = 0;
+    int32 NumClipSpaceVisible = 0;
+    for (int32 Index = 0; Index < NumBounds; ++Index)
+    {
+        const float PlaneMargin = ReferenceVolumeMargin(Frustum, WorldBounds[Index]);
+        if (FMath::Abs(PlaneMargin) > PlaneTolerance)
+        {
+            NumPlaneMismatches += (PlaneMargin > 0.f) != (Visible[Index] != 0) ? 1 : 0;
+        }
+
+        const float ClipMargin = ReferenceClipSpaceMargin(Bounds[Index], ViewProjection);
+        NumClipSpaceVisible += ClipMargin >= 0.f ? 1 : 0;
+        NumClipSpaceMissing += ClipMargin > PlaneTolerance && !Visible[Index] ? 1 : 0;
+    }
+    TestEqual("Bounds that differ from the scalar plane test", NumPlaneMismatches, 0);
+    TestEqual("Bounds visible in clip space that were culled", NumClipSpaceMissing, 0);
+    TestTrue("Some bounds are culled", VisibleIndices.Num() > 0 && VisibleIndices.Num() < NumBounds);
+    AddInfo(FString::Printf(TEXT("%d visible of %d, %d visible in clip space (AABB test keeps %d extra)"),
+        VisibleIndices.Num(), NumBounds, NumClipSpaceVisible, VisibleIndices.Num() - NumClipSpaceVisible));
+
+    // 여러 Volume은 각 Volume 결과의 합집합입니다.
+    FConvexVolume Cascades[3];
+    TArray<uint8> UnionVisible;
+    UnionVisible.SetNum(NumBounds);
+    for (int32 Index = 0; Index < NumBounds; ++Index)
+    {
+        UnionVisible[Index] = 0;
+    }
+    for (int32 CascadeIndex = 0; CascadeIndex < 3; ++CascadeIndex)
+    {
+        const FMatrix LightView = JungleMath::CreateViewMatrix(FVector(-30.f * CascadeIndex, 50.f, 80.f), FVector(30.f * CascadeIndex, 0.f, 0.f), FVector(0.f, 0.f, 1.f));
+        Cascades[CascadeIndex] = FConvexVolume::FromViewProjection(LightView * JungleMath::CreateOrthoProjectionMatrix(40.f, 40.f, 1.f, 200.f), false);
+
+        TArray<int32> CascadeVisible;
+        FVisibilityCullStats CascadeStats;
+        Culler.Cull(Cascades[CascadeIndex], CascadeVisible, CascadeStats);
+        for (const int32 Index : CascadeVisible)
+        {
+            UnionVisible[Index] = 1;
+        }
+    }
+    TestEqual("Light frustum planes", Cascades[0].NumPlanes, 5);
+
+    VisibleIndices.Empty();
+    Stats.Reset();
+    Culler.Cull(Cascades, 3, VisibleIndices, Stats);
+    TestEqual("Invalid, duplicate or unsorted visible indices of several volumes", MarkVisible(VisibleIndices, NumBounds, Visible), 0);
+    int32 NumUnionMismatches = 0;
+    for (int32 Index = 0; Index < NumBounds; ++Index)
+    {
+        NumUnionMismatches += Visible[Index] != UnionVisible[Index] ? 1 : 0;
+    }
+    TestEqual("Bounds that differ from the union of single volumes", NumUnionMismatches, 0);
+
+    // Light Frustum은 Near 평면이 없으므로, 광원 뒤에 있는 Shadow Caster도 남깁니다.
+    FVisibilityCuller BehindCuller;
+    const FMatrix LightView = JungleMath::CreateViewMatrix(FVector(0.f, 0.f, 0.f), FVector(1.f, 0.f, 0.f), FVector(0.f, 0.f, 1.f));
+    const FMatrix LightViewProjection = LightView * JungleMath::CreateOrthoProjectionMatrix(40.f, 40.f, 1.f, 200.f);
+    BehindCuller.AddBounds(FBoundingBox(FVector(-1.f, -1.f, -1.f), FVector(1.f, 1.f, 1.f)), FMatrix::CreateTranslationMatrix(FVector(-50.f, 0.f, 0.f)));
+    VisibleIndices.Empty();
+    BehindCuller.Cull(FConvexVolume::FromViewProjection(LightViewProjection, false), VisibleIndices, Stats);
+    TestEqual("Caster behind the light without the near plane", VisibleIndices.Num(), 1);
+    VisibleIndices.Empty();
+    BehindCuller.Cull(FConvexVolume::FromViewProjection(LightViewProjection, true), VisibleIndices, Stats);
+    TestEqual("Caster behind the light with the near plane", VisibleIndices.Num(), 0);
+
+    // 구 판정은 구 중심에서 월드 AABB까지의 거리로 비교합니다.
+    int32 NumSphereMismatches = 0;
+    for (int32 SphereIndex = 0; SphereIndex < 8; ++SphereIndex)
+    {
+        const FVector SphereCenter(Random.Range(-100.f, 100.f), Random.Range(-100.f, 100.f), Random.Range(-100.f, 100.f));
+        const float Radius = Random.Range(5.f, 60.f);
+
+        VisibleIndices.Empty();
+        Stats.Reset();
+        Culler.CullSphere(SphereCenter, Radius, VisibleIndices, Stats);
+        NumWrongIndices += MarkVisible(VisibleIndices, NumBounds, Visible);
+        for (int32 Index = 0; Index < NumBounds; ++Index)
+        {
+            const float Distance = ReferenceSphereDistance(SphereCenter, WorldBounds[Index]);
+            if (FMath::Abs(Distance - Radius) > PlaneTolerance)
+            {
+                NumSphereMismatches += (Distance < Radius) != (Visible[Index] != 0) ? 1 : 0;
+            }
+        }
+    }
+    TestEqual("Invalid sphere visible indices", NumWrongIndices, 0);
+    TestEqual("Bounds that differ from the scalar sphere test", NumSphereMismatches, 0);
+
+    // RemoveAtSwap과 SetBounds 후에도 기준 Bounds와 같은 순서를 유지해야 합니다.
+    TArray<FTestBounds> NewBounds;
+    for (int32 Step = 0; Step < 1500; ++Step)
+    {
+        const int32 Index = static_cast<int32>(Random.Next() % static_cast<uint32>(Culler.Num()));
+        if (Step % 3 == 0)
+        {
+            MakeTestBounds(1, 120.f, Random, NewBounds);
+            Culler.SetBounds(Index, NewBounds[0].LocalBounds, NewBounds[0].WorldMatrix);
+            WorldBounds[Index] = ReferenceWorldBounds(NewBounds[0]);
+        }
+        else
+        {
+            Culler.RemoveAtSwap(Index);
+            WorldBounds[Index] = WorldBounds[WorldBounds.Num() - 1];
+            WorldBounds.SetNum(WorldBounds.Num() - 1);
+        }
+    }
+    TestEqual("Bounds after RemoveAtSwap", Culler.Num(), WorldBounds.Num());
+
+    VisibleIndices.Empty();
+    Culler.Cull(Frustum, VisibleIndices, Stats);
+    TestEqual("Invalid visible indices after RemoveAtSwap", MarkVisible(VisibleIndices, Culler.Num(), Visible), 0);
+    NumPlaneMismatches = 0;
+    for (int32 Index = 0; Index < Culler.Num(); ++Index)
+    {
+        const float PlaneMargin = ReferenceVolumeMargin(Frustum, WorldBounds[Index]);
+        if (FMath::Abs(PlaneMargin) > PlaneTolerance)
+        {
+            NumPlaneMismatches += (PlaneMargin > 0.f) != (Visible[Index] != 0) ? 1 : 0;
+        }
+    }
+    TestEqual("Bounds that differ from the scalar plane test after RemoveAtSwap", NumPlaneMismatches, 0);
+
+    Culler.Empty();
+    VisibleIndices.Empty();
+    Culler.Cull(Frustum, VisibleIndices, Stats);
+    TestEqual("Visible bounds after Empty", VisibleIndices.Num(), 0);
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FVisibilityCullerBenchmark, "Renderer.VisibilityCuller.CullSpeed", EAutomationTestType::Benchmark)
+{
+    constexpr int32 BoundsCounts[] = { 1000, 10000, 100000 };
+    constexpr int32 NumRuns = 20;
+    constexpr int32 NumCascades = 4;
+
+    const FConvexVolume Frustum = FConvexVolume::FromViewProjection(MakeTestViewProjection());
+    FConvexVolume Cascades[NumCascades];
+    for (int32 CascadeIndex = 0; CascadeIndex < NumCascades; ++CascadeIndex)
+    {
+        const float Size = 30.f * (CascadeIndex + 1);
+        const FMatrix LightView = JungleMath::CreateViewMatrix(FVector(0.f, 50.f, 80.f), FVector(Size, 0.f, 0.f), FVector(0.f, 0.f, 1.f));
+        Cascades[CascadeIndex] = FConvexVolume::FromViewProjection(LightView * JungleMath::CreateOrthoProjectionMatrix(Size, Size, 1.f, 300.f), false);
+    }
+
+    for (const int32 NumBounds : BoundsCounts)
+    {
+        FTestRandom Random;
+        TArray<FTestBounds> Bounds;
+        MakeTestBounds(NumBounds, 200.f, Random, Bounds);
+
+        FVisibilityCuller Culler;
+        TArray<FVector> Centers;
+        TArray<FVector> Extents;
+        for (const FTestBounds& Each : Bounds)
+        {
+            const int32 Index = Culler.AddBounds(Each.LocalBounds, Each.WorldMatrix);
+            Centers.Add(Culler.GetCenter(Index));
+            Extents.Add(Culler.GetExtent(Index));
+        }
+
+        // View Frustum 하나와 Cascade 여러 개를 각각 가장 빠른 실행 시간으로 비교합니다.
+        double ScalarMs = 0.0;
+        double SSEMs = 0.0;
+        double ScalarCascadeMs = 0.0;
+        double SSECascadeMs = 0.0;
+        int32 NumVisible = 0;
+        int32 NumCascadeVisible = 0;
+        TArray<int32> VisibleIndices;
+        VisibleIndices.Reserve(NumBounds);
+        FVisibilityCullStats Stats;
+        for (int32 Run = 0; Run < NumRuns; ++Run)
+        {
+            VisibleIndices.Empty();
+            uint64 StartCycles = FPlatformTime::Cycles64();
+            ReferenceCull(&Frustum, 1, Centers, Extents, VisibleIndices);
+            const double RunScalarMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+            VisibleIndices.Empty();
+            StartCycles = FPlatformTime::Cycles64();
+            Culler.Cull(Frustum, VisibleIndices, Stats);
+            const double RunSSEMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+            NumVisible = VisibleIndices.Num();
+
+            VisibleIndices.Empty();
+            StartCycles = FPlatformTime::Cycles64();
+            ReferenceCull(Cascades, NumCascades, Centers, Extents, VisibleIndices);
+            const double RunScalarCascadeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+            VisibleIndices.Empty();
+            StartCycles = FPlatformTime::Cycles64();
+            Culler.Cull(Cascades, NumCascades, VisibleIndices, Stats);
+            const double RunSSECascadeMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+            NumCascadeVisible = VisibleIndices.Num();
+
+            ScalarMs = Run == 0 ? RunScalarMs : FMath::Min(ScalarMs, RunScalarMs);
+            SSEMs = Run == 0 ? RunSSEMs : FMath::Min(SSEMs, RunSSEMs);
+            ScalarCascadeMs = Run == 0 ? RunScalarCascadeMs : FMath::Min(ScalarCascadeMs, RunScalarCascadeMs);
+            SSECascadeMs = Run == 0 ? RunSSECascadeMs : FMath::Min(SSECascadeMs, RunSSECascadeMs);
+        }
+
+        AddInfo(FString::Printf(TEXT("%d bounds, view frustum (%d visible): scalar %.3f ms, SSE %.3f ms (x%.2f)"),
+            NumBounds, NumVisible, ScalarMs, SSEMs, ScalarMs / SSEMs));
+        AddInfo(FString::Printf(TEXT("%d bounds, %d cascades (%d visible): scalar %.3f ms, SSE %.3f ms (x%.2f)"),
+            NumBounds, NumCascades, NumCascadeVisible, ScalarCascadeMs, SSECascadeMs, ScalarCascadeMs / SSECascadeMs));
+    }
+    return true;
+}
@@ -11,7 +11,7 @@
 #include "Components/Light/LightComponent.h"
 #include "Components/Light/PointLightComponent.h"
 #include "Components/Light/SpotLightComponent.h"
-#include "UObject/UObjectIterator.h"
+#include "World/World.h"
 
 #define SAFE_RELEASE(p) if (p) { (p)->Release(); (p) = nullptr; }
 
@@ -49,24 +49,16 @@ void FTileLightCullingPass::Initialize(FDXDBufferManager* InBufferManager, FGrap
 
 void FTileLightCullingPass::PrepareRenderArr()
 {
-    for (const auto iter : TObjectRange<ULightComponentBase>())
+    const FRenderScene& RenderScene = GEngine->ActiveWorld->GetRenderScene();
+    PointLights = RenderScene.GetPointLights();
+    SpotLights = RenderScene.GetSpotLights();
+
+    // [주의] : Directional Light에 대한 CasCade Shadow Map을 만들 때에 아래 View,Proj 갱신을 전제
+    RenderScene.ForEachLight([](ULightComponentBase* Light)
     {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(iter))
-            {
-                PointLights.Add(PointLight);
-            }
-            else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(iter))
-            {
-                SpotLight->GetDirection();
-                SpotLights.Add(SpotLight);
-            }
-            // [주의] : Directional Light에 대한 CasCade Shadow Map을 만들 때에 아래 View,Proj 갱신을 전제
-            iter->UpdateViewMatrix();
-            iter->UpdateProjectionMatrix();
-        }
-    }
+        Light->UpdateViewMatrix();
+        Light->UpdateProjectionMatrix();
+    });
 
     CreatePointLightBufferGPU();
     CreateSpotLightBufferGPU();
@@ -13,7 +13,7 @@
 #include "Components/Light/AmbientLightComponent.h"
 #include "Engine/EditorEngine.h"
 #include "GameFramework/Actor.h"
-#include "UObject/UObjectIterator.h"
+#include "World/World.h"
 #include "TileLightCullingPass.h"
 
 //------------------------------------------------------------------------------
@@ -44,28 +44,10 @@ void FUpdateLightBufferPass::Initialize(FDXDBufferManager* InBufferManager, FGra
 
 void FUpdateLightBufferPass::PrepareRenderArr()
 {
-    for (const auto iter : TObjectRange<ULightComponentBase>())
-    {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(iter))
-            {
-                //PointLights.Add(PointLight); // 당분간 UnUsed : Structured Buffer로 전달
-            }
-            else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(iter))
-            {
-                //SpotLights.Add(SpotLight); // UnUsed : Structured Buffer로 전달
-            }
-            else if (UDirectionalLightComponent* DirectionalLight = Cast<UDirectionalLightComponent>(iter))
-            {
-                DirectionalLights.Add(DirectionalLight);
-            }
-            else if (UAmbientLightComponent* AmbientLight = Cast<UAmbientLightComponent>(iter))
-            {
-                AmbientLights.Add(AmbientLight);
-            }
-        }
-    }
+    // Point, Spot Light는 TileLightCullingPass에서 Structured Buffer로 전달
+    const FRenderScene& RenderScene = GEngine->ActiveWorld->GetRenderScene();
+    DirectionalLights = RenderScene.GetDirectionalLights();
+    AmbientLights = RenderScene.GetAmbientLights();
 }
 
 void FUpdateLightBufferPass::Render(const std::shared_ptr<FViewportClient>& Viewport)
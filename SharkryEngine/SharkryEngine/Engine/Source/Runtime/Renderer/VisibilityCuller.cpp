@@ -0,0 +1,221 @@
+#include "VisibilityCuller.h"
+
+#include <bit>
+#include <emmintrin.h>
+
+FConvexVolume FConvexVolume::FromViewProjection(const FMatrix& ViewProjection, bool bIncludeNearPlane)
+{
+    // 행 벡터 규약(p' = p * M)이므로 Clip 좌표의 각 성분은 행렬의 열과의 내적입니다.
+    const auto Column = [&ViewProjection](int32 Index)
+    {
+        return FPlane(ViewProjection.M[0][Index], ViewProjection.M[1][Index], ViewProjection.M[2][Index], ViewProjection.M[3][Index]);
+    };
+    const auto Add = [](const FPlane& A, const FPlane& B) { return FPlane(A.X + B.X, A.Y + B.Y, A.Z + B.Z, A.W + B.W); };
+    const auto Sub = [](const FPlane& A, const FPlane& B) { return FPlane(A.X - B.X, A.Y - B.Y, A.Z - B.Z, A.W - B.W); };
+
+    const FPlane X = Column(0);
+    const FPlane Y = Column(1);
+    const FPlane Z = Column(2);
+    const FPlane W = Column(3);
+
+    FConvexVolume Volume;
+    Volume.Planes[Volume.NumPlanes++] = Add(W, X);  // Left:   -w <= x
+    Volume.Planes[Volume.NumPlanes++] = Sub(W, X);  // Right:   x <= w
+    Volume.Planes[Volume.NumPlanes++] = Add(W, Y);  // Bottom: -w <= y
+    Volume.Planes[Volume.NumPlanes++] = Sub(W, Y);  // Top:     y <= w
+    Volume.Planes[Volume.NumPlanes++] = Sub(W, Z);  // Far:     z <= w
+    if (bIncludeNearPlane)
+    {
+        Volume.Planes[Volume.NumPlanes++] = Z;      // Near:    0 <= z (D3D)
+    }
+
+    for (int32 Index = 0; Index < Volume.NumPlanes; ++Index)
+    {
+        Volume.Planes[Index].Normalize();
+    }
+
+    return Volume;
+}
+
+void FVisibilityCuller::Empty()
+{
+    CenterX.Empty();
+    CenterY.Empty();
+    CenterZ.Empty();
+    ExtentX.Empty();
+    ExtentY.Empty();
+    ExtentZ.Empty();
+    NumBounds = 0;
+}
+
+int32 FVisibilityCuller::AddBounds(const FBoundingBox& InLocalBounds, const FMatrix& InWorldMatrix)
+{
+    const int32 Index = NumBounds++;
+    if (Index == CenterX.Num())
+    {
+        // 4개 단위로 늘립니다. 남는 칸은 Cull에서 결과를 무시합니다.
+        const int32 NewNum = Index + 4;
+        CenterX.SetNum(NewNum);
+        CenterY.SetNum(NewNum);
+        CenterZ.SetNum(NewNum);
+        ExtentX.SetNum(NewNum);
+        ExtentY.SetNum(NewNum);
+        ExtentZ.SetNum(NewNum);
+    }
+
+    SetBounds(Index, InLocalBounds, InWorldMatrix);
+    return Index;
+}
+
+void FVisibilityCuller::SetBounds(int32 Index, const FBoundingBox& InLocalBounds, const FMatrix& InWorldMatrix)
+{
+    const FVector LocalCenter = (InLocalBounds.min + InLocalBounds.max) * 0.5f;
+    const FVector LocalExtent = (InLocalBounds.max - InLocalBounds.min) * 0.5f;
+
+    // 중심은 그대로 변환하고, 반 크기는 회전/스케일 행렬의 절댓값으로 변환하면 회전된 박스를 감싸는 AABB가 됩니다.
+    float Center[3];
+    float Extent[3];
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Center[Axis] = LocalCenter.X * InWorldMatrix.M[0][Axis]
+            + LocalCenter.Y * InWorldMatrix.M[1][Axis]
+            + LocalCenter.Z * InWorldMatrix.M[2][Axis]
+            + InWorldMatrix.M[3][Axis];
+        Extent[Axis] = LocalExtent.X * FMath::Abs(InWorldMatrix.M[0][Axis])
+            + LocalExtent.Y * FMath::Abs(InWorldMatrix.M[1][Axis])
+            + LocalExtent.Z * FMath::Abs(InWorldMatrix.M[2][Axis]);
+    }
+
+    CenterX[Index] = Center[0];
+    CenterY[Index] = Center[1];
+    CenterZ[Index] = Center[2];
+    ExtentX[Index] = Extent[0];
+    ExtentY[Index] = Extent[1];
+    ExtentZ[Index] = Extent[2];
+}
+
+void FVisibilityCuller::RemoveAtSwap(int32 Index)
+{
+    const int32 LastIndex = --NumBounds;
+    CenterX[Index] = CenterX[LastIndex];
+    CenterY[Index] = CenterY[LastIndex];
+    CenterZ[Index] = CenterZ[LastIndex];
+    ExtentX[Index] = ExtentX[LastIndex];
+    ExtentY[Index] = ExtentY[LastIndex];
+    ExtentZ[Index] = ExtentZ[LastIndex];
+
+    // 4의 배수 길이는 유지하고, 마지막 묶음이 통째로 비었을 때만 줄입니다.
+    if (NumBounds + 4 <= CenterX.Num())
+    {
+        const int32 NewNum = CenterX.Num() - 4;
+        CenterX.SetNum(NewNum);
+        CenterY.SetNum(NewNum);
+        CenterZ.SetNum(NewNum);
+        ExtentX.SetNum(NewNum);
+        ExtentY.SetNum(NewNum);
+        ExtentZ.SetNum(NewNum);
+    }
+}
+
+void FVisibilityCuller::Cull(const FConvexVolume* Volumes, int32 NumVolumes, TArray<int32>& OutVisibleIndices, FVisibilityCullStats& Stats) const
+{
+    const __m128 SignMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    uint32 NumVisible = 0;
+
+    for (int32 Base = 0; Base < NumBounds; Base += 4)
+    {
+        const __m128 CX = _mm_loadu_ps(&CenterX[Base]);
+        const __m128 CY = _mm_loadu_ps(&CenterY[Base]);
+        const __m128 CZ = _mm_loadu_ps(&CenterZ[Base]);
+        const __m128 EX = _mm_loadu_ps(&ExtentX[Base]);
+        const __m128 EY = _mm_loadu_ps(&ExtentY[Base]);
+        const __m128 EZ = _mm_loadu_ps(&ExtentZ[Base]);
+
+        __m128 AnyInside = _mm_setzero_ps();
+        for (int32 VolumeIndex = 0; VolumeIndex < NumVolumes; ++VolumeIndex)
+        {
+            const FConvexVolume& Volume = Volumes[VolumeIndex];
+
+            __m128 Inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+            for (int32 PlaneIndex = 0; PlaneIndex < Volume.NumPlanes; ++PlaneIndex)
+            {
+                const FPlane& Plane = Volume.Planes[PlaneIndex];
+                const __m128 NX = _mm_set1_ps(Plane.X);
+                const __m128 NY = _mm_set1_ps(Plane.Y);
+                const __m128 NZ = _mm_set1_ps(Plane.Z);
+
+                // Distance = N · C + D, PushOut = |N| · E
+                __m128 Distance = _mm_add_ps(_mm_mul_ps(NX, CX), _mm_set1_ps(Plane.W));
+                Distance = _mm_add_ps(Distance, _mm_mul_ps(NY, CY));
+                Distance = _mm_add_ps(Distance, _mm_mul_ps(NZ, CZ));
+
+                __m128 PushOut = _mm_mul_ps(_mm_and_ps(NX, SignMask), EX);
+                PushOut = _mm_add_ps(PushOut, _mm_mul_ps(_mm_and_ps(NY, SignMask), EY));
+                PushOut = _mm_add_ps(PushOut, _mm_mul_ps(_mm_and_ps(NZ, SignMask), EZ));
+
+                // 평면 완전히 뒤쪽이면 제외
+                Inside = _mm_and_ps(Inside, _mm_cmpge_ps(_mm_add_ps(Distance, PushOut), _mm_setzero_ps()));
+                if (_mm_movemask_ps(Inside) == 0)
+                {
+                    break;
+                }
+            }
+
+            AnyInside = _mm_or_ps(AnyInside, Inside);
+            if (_mm_movemask_ps(AnyInside) == 0xF)
+            {
+                break;
+            }
+        }
+
+        int32 Mask = _mm_movemask_ps(AnyInside);
+        while (Mask != 0)
+        {
+            const int32 Index = Base + std::countr_zero(static_cast<uint32>(Mask));
+            Mask &= Mask - 1;
+            if (Index < NumBounds)
+            {
+                OutVisibleIndices.Add(Index);
+                ++NumVisible;
+            }
+        }
+    }
+
+    Stats.NumTested += NumBounds;
+    Stats.NumCulled += NumBounds - NumVisible;
+}
+
+void FVisibilityCuller::CullSphere(const FVector& Center, float Radius, TArray<int32>& OutVisibleIndices, FVisibilityCullStats& Stats) const
+{
+    const __m128 SignMask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 SX = _mm_set1_ps(Center.X);
+    const __m128 SY = _mm_set1_ps(Center.Y);
+    const __m128 SZ = _mm_set1_ps(Center.Z);
+    const __m128 RadiusSquared = _mm_set1_ps(Radius * Radius);
+    uint32 NumVisible = 0;
+
+    for (int32 Base = 0; Base < NumBounds; Base += 4)
+    {
+        // 축마다 구 중심에서 박스 표면까지의 거리, 박스 안쪽이면 0
+        const __m128 DX = _mm_max_ps(_mm_sub_ps(_mm_and_ps(_mm_sub_ps(SX, _mm_loadu_ps(&CenterX[Base])), SignMask), _mm_loadu_ps(&ExtentX[Base])), _mm_setzero_ps());
+        const __m128 DY = _mm_max_ps(_mm_sub_ps(_mm_and_ps(_mm_sub_ps(SY, _mm_loadu_ps(&CenterY[Base])), SignMask), _mm_loadu_ps(&ExtentY[Base])), _mm_setzero_ps());
+        const __m128 DZ = _mm_max_ps(_mm_sub_ps(_mm_and_ps(_mm_sub_ps(SZ, _mm_loadu_ps(&CenterZ[Base])), SignMask), _mm_loadu_ps(&ExtentZ[Base])), _mm_setzero_ps());
+
+        const __m128 DistanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(DX, DX), _mm_mul_ps(DY, DY)), _mm_mul_ps(DZ, DZ));
+
+        int32 Mask = _mm_movemask_ps(_mm_cmple_ps(DistanceSquared, RadiusSquared));
+        while (Mask != 0)
+        {
+            const int32 Index = Base + std::countr_zero(static_cast<uint32>(Mask));
+            Mask &= Mask - 1;
+            if (Index < NumBounds)
+            {
+                OutVisibleIndices.Add(Index);
+                ++NumVisible;
+            }
+        }
+    }
+
+    Stats.NumTested += NumBounds;
+    Stats.NumCulled += NumBounds - NumVisible;
+}
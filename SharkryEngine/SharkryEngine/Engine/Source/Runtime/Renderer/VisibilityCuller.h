@@ -0,0 +1,91 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+#include "Math/Plane.h"
+
+/**
+ * 평면들로 둘러싸인 볼록 영역 (View Frustum, Light Frustum 등)
+ *
+ * 각 평면의 법선은 영역 안쪽을 향하며, 모든 평면의 앞쪽에 있는 점만 영역 안에 있습니다.
+ */
+struct FConvexVolume
+{
+    static constexpr int32 MaxPlanes = 6;
+
+    FPlane Planes[MaxPlanes];
+    int32 NumPlanes = 0;
+
+    /**
+     * View * Projection 행렬로부터 Frustum 평면을 추출합니다.
+     * @param bIncludeNearPlane false라면 Near 평면을 제외합니다. 카메라 뒤에 있는 Shadow Caster도 그림자를 드리우므로, Light Frustum에서는 false를 사용합니다.
+     */
+    static FConvexVolume FromViewProjection(const FMatrix& ViewProjection, bool bIncludeNearPlane = true);
+};
+
+/** Cull, CullSphere 결과 통계, 여러 Pass가 같은 Culler를 사용하므로 Pass마다 따로 가집니다. */
+struct FVisibilityCullStats
+{
+    uint32 NumTested = 0;
+    uint32 NumCulled = 0;
+
+    void Reset()
+    {
+        NumTested = 0;
+        NumCulled = 0;
+    }
+};
+
+/**
+ * D3D 리소스에 의존하지 않는 CPU 가시성 판정 단계
+ *
+ * 후보 Component의 월드 AABB를 중심/반 크기로 나눠 SoA 배열에 모아두고,
+ * Frustum 평면 판정을 SSE로 4개씩 수행해서 보이는 후보의 Index만 압축된 목록으로 돌려줍니다.
+ * Distance Culling은 View Frustum의 Far 평면이 담당합니다.
+ */
+class FVisibilityCuller
+{
+public:
+    FVisibilityCuller() = default;
+
+    /** 등록된 Bounds를 모두 제거합니다. 할당된 메모리는 유지합니다. */
+    void Empty();
+
+    /**
+     * 로컬 AABB를 월드 행렬로 변환해서 등록합니다.
+     * @return 등록된 Bounds의 Index, Cull 결과로 돌려받는 Index와 같습니다.
+     */
+    int32 AddBounds(const FBoundingBox& InLocalBounds, const FMatrix& InWorldMatrix);
+
+    /** 이미 등록된 Index의 Bounds를 다시 계산합니다. */
+    void SetBounds(int32 Index, const FBoundingBox& InLocalBounds, const FMatrix& InWorldMatrix);
+
+    /** 마지막 Bounds를 Index 자리로 옮기고 제거합니다. 호출한 쪽도 같은 방식으로 Index를 맞춰야 합니다. */
+    void RemoveAtSwap(int32 Index);
+
+    int32 Num() const { return NumBounds; }
+
+    /** 등록된 월드 AABB의 중심과 반 크기 */
+    FVector GetCenter(int32 Index) const { return FVector(CenterX[Index], CenterY[Index], CenterZ[Index]); }
+    FVector GetExtent(int32 Index) const { return FVector(ExtentX[Index], ExtentY[Index], ExtentZ[Index]); }
+
+    /**
+     * Volumes 중 하나라도 겹치는 Bounds의 Index를 OutVisibleIndices에 추가합니다.
+     * Cascade처럼 여러 Frustum에 한 번에 그리는 경우 합집합으로 판정합니다.
+     */
+    void Cull(const FConvexVolume* Volumes, int32 NumVolumes, TArray<int32>& OutVisibleIndices, FVisibilityCullStats& Stats) const;
+    void Cull(const FConvexVolume& Volume, TArray<int32>& OutVisibleIndices, FVisibilityCullStats& Stats) const { Cull(&Volume, 1, OutVisibleIndices, Stats); }
+
+    /** 구와 겹치는 Bounds의 Index를 OutVisibleIndices에 추가합니다. Point Light의 영향 범위 판정에 사용합니다. */
+    void CullSphere(const FVector& Center, float Radius, TArray<int32>& OutVisibleIndices, FVisibilityCullStats& Stats) const;
+
+private:
+    /** SSE로 4개씩 처리하므로, 각 배열은 4의 배수 길이로 유지합니다. */
+    TArray<float> CenterX;
+    TArray<float> CenterY;
+    TArray<float> CenterZ;
+    TArray<float> ExtentX;
+    TArray<float> ExtentY;
+    TArray<float> ExtentZ;
+
+    int32 NumBounds = 0;
+};
@@ -0,0 +1,48 @@
+#include "ConstantBufferRegistry.h"
+
+#include "UserInterface/Console.h"
+
+bool FConstantBufferRegistry::Add(const FString& Key, ID3D11Buffer* Buffer, uint32 ByteWidth)
+{
+    if (Entries.Contains(Key))
+    {
+        return false;
+    }
+
+    Entries.Add(Key, { Buffer, ByteWidth });
+    return true;
+}
+
+bool FConstantBufferRegistry::Contains(const FString& Key) const
+{
+    return Entries.Contains(Key);
+}
+
+ID3D11Buffer* FConstantBufferRegistry::Find(const FString& Key) const
+{
+    const FEntry* Entry = Entries.Find(Key);
+    return Entry ? Entry->Buffer : nullptr;
+}
+
+void FConstantBufferRegistry::Empty()
+{
+    Entries.Empty();
+}
+
+ID3D11Buffer* FConstantBufferRegistry::FindChecked(const FString& Key, uint32 RequiredSize) const
+{
+    const FEntry* Entry = Entries.Find(Key);
+    if (!Entry)
+    {
+        UE_LOG(LogLevel::Error, TEXT("Constant Buffer Handle: 키 %s에 해당하는 buffer가 없습니다."), *Key);
+        return nullptr;
+    }
+
+    if (Entry->ByteWidth < RequiredSize)
+    {
+        UE_LOG(LogLevel::Error, TEXT("Constant Buffer Handle: %s의 크기 %u byte가 구조체 크기 %u byte보다 작습니다."), *Key, Entry->ByteWidth, RequiredSize);
+        return nullptr;
+    }
+
+    return Entry->Buffer;
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+struct ID3D11Buffer;
+
+/** 이름으로 한 번 찾아둔 Constant Buffer, Pass를 초기화할 때 구해두면 프레임마다 이름으로 찾지 않습니다. */
+struct FConstantBufferHandle
+{
+    ID3D11Buffer* Buffer = nullptr;
+
+    bool IsValid() const { return Buffer != nullptr; }
+};
+
+/** 구조체 T를 담는 Constant Buffer의 Handle, 다른 구조체로 갱신하면 Compile Error가 납니다. */
+template <typename T>
+struct TConstantBufferHandle : FConstantBufferHandle
+{
+};
+
+/**
+ * 이름별 Constant Buffer와 크기
+ *
+ * FDXDBufferManager가 D3D Buffer를 만든 뒤 등록하고, Handle을 찾을 때 구조체 크기가 Buffer에 들어가는지 확인합니다.
+ * D3D 헤더에 의존하지 않으므로 Handle을 찾는 규칙만 따로 확인할 수 있습니다.
+ */
+class FConstantBufferRegistry
+{
+public:
+    /** @return 이미 등록된 이름이라면 등록하지 않고 false */
+    bool Add(const FString& Key, ID3D11Buffer* Buffer, uint32 ByteWidth);
+
+    bool Contains(const FString& Key) const;
+
+    /** 등록되지 않은 이름이라면 nullptr */
+    ID3D11Buffer* Find(const FString& Key) const;
+
+    /** 등록되지 않았거나 T보다 작은 Buffer라면 Error Log를 남기고 비어있는 Handle을 반환합니다. */
+    template <typename T>
+    TConstantBufferHandle<T> FindHandle(const FString& Key) const
+    {
+        TConstantBufferHandle<T> Handle;
+        Handle.Buffer = FindChecked(Key, sizeof(T));
+        return Handle;
+    }
+
+    /** 등록된 모든 Buffer에 대해 Func를 호출합니다. 해제할 때 사용합니다. */
+    template <typename FuncType>
+    void ForEachBuffer(FuncType Func) const
+    {
+        for (const auto& [Key, Entry] : Entries)
+        {
+            Func(Entry.Buffer);
+        }
+    }
+
+    void Empty();
+
+    int32 Num() const { return Entries.Num(); }
+
+private:
+    ID3D11Buffer* FindChecked(const FString& Key, uint32 RequiredSize) const;
+
+private:
+    struct FEntry
+    {
+        ID3D11Buffer* Buffer = nullptr;
+        uint32 ByteWidth = 0;
+    };
+
+    TMap<FString, FEntry> Entries;
+};
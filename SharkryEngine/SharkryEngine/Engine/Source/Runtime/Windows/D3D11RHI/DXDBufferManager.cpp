@@ -8,6 +8,7 @@ void FDXDBufferManager::Initialize(ID3D11Device* InDXDevice, ID3D11DeviceContext
     DXDevice = InDXDevice;
     DXDeviceContext = InDXDeviceContext;
     CreateQuadBuffer();
+    CreateUploadBuffer();
 }
 
 void FDXDBufferManager::ReleaseBuffers()
@@ -35,15 +36,109 @@ void FDXDBufferManager::ReleaseBuffers()
 
 void FDXDBufferManager::ReleaseConstantBuffer()
 {
-    for (auto& Pair : ConstantBufferPool)
+    ConstantBufferPool.ForEachBuffer([](ID3D11Buffer* Buffer)
     {
-        if (Pair.Value)
+        if (Buffer)
         {
-            Pair.Value->Release();
-            Pair.Value = nullptr;
+            Buffer->Release();
         }
-    }
+    });
     ConstantBufferPool.Empty();
+
+    ReleaseUploadBuffer();
+}
+
+void FDXDBufferManager::CreateUploadBuffer()
+{
+    if (FAILED(DXDeviceContext->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&DXDeviceContext1))))
+    {
+        DXDeviceContext1 = nullptr;
+        return;
+    }
+
+    D3D11_FEATURE_DATA_D3D11_OPTIONS Options = {};
+    HRESULT hr = DXDevice->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &Options, sizeof(Options));
+    if (FAILED(hr) || !Options.ConstantBufferOffsetting || !Options.MapNoOverwriteOnDynamicConstantBuffer)
+    {
+        UE_LOG(LogLevel::Warning, TEXT("Constant Buffer Offset을 지원하지 않아 Object 상수를 Draw마다 갱신합니다."));
+        ReleaseUploadBuffer();
+        return;
+    }
+
+    D3D11_BUFFER_DESC Desc = {};
+    Desc.ByteWidth = UploadBufferSize;
+    Desc.Usage = D3D11_USAGE_DYNAMIC;
+    Desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    hr = DXDevice->CreateBuffer(&Desc, nullptr, &UploadBuffer);
+    if (FAILED(hr))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Error Create Upload Buffer!"));
+        ReleaseUploadBuffer();
+        return;
+    }
+
+    UploadAllocator.Initialize(UploadBufferSize);
+}
+
+void FDXDBufferManager::ReleaseUploadBuffer()
+{
+    SafeRelease(UploadBuffer);
+    SafeRelease(DXDeviceContext1);
+}
+
+void FDXDBufferManager::BeginUploadFrame()
+{
+    UploadAllocator.BeginFrame();
+}
+
+uint8* FDXDBufferManager::MapUpload(uint32 ElementSize, uint32 NumElements, FUploadAllocation& OutAllocation)
+{
+    if (!UploadBuffer)
+    {
+        return nullptr;
+    }
+
+    bool bDiscard = false;
+    if (!UploadAllocator.Allocate(ElementSize, NumElements, OutAllocation, bDiscard))
+    {
+        return nullptr;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE MappedResource;
+    const D3D11_MAP MapType = bDiscard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+    HRESULT hr = DXDeviceContext->Map(UploadBuffer, 0, MapType, 0, &MappedResource);
+    if (FAILED(hr))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Upload Buffer Map 실패, HRESULT: 0x%X"), hr);
+        // 이미 자리를 받았으므로, 다음 Map은 Discard로 해서 쓰지 못한 구간을 읽지 않도록 합니다.
+        UploadAllocator.BeginFrame();
+        return nullptr;
+    }
+
+    return static_cast<uint8*>(MappedResource.pData) + OutAllocation.Offset;
+}
+
+void FDXDBufferManager::UnmapUpload() const
+{
+    DXDeviceContext->Unmap(UploadBuffer, 0);
+}
+
+void FDXDBufferManager::BindUploadConstantBuffer(const FUploadAllocation& Allocation, uint32 Index, UINT Slot, EShaderStage Stage) const
+{
+    const UINT FirstConstant = Allocation.GetFirstConstant(Index);
+    const UINT NumConstants = Allocation.GetNumConstants();
+    ID3D11Buffer* Buffer = UploadBuffer;
+
+    if (Stage == EShaderStage::Vertex)
+        DXDeviceContext1->VSSetConstantBuffers1(Slot, 1, &Buffer, &FirstConstant, &NumConstants);
+    else if (Stage == EShaderStage::Pixel)
+        DXDeviceContext1->PSSetConstantBuffers1(Slot, 1, &Buffer, &FirstConstant, &NumConstants);
+    else if (Stage == EShaderStage::Compute)
+        DXDeviceContext1->CSSetConstantBuffers1(Slot, 1, &Buffer, &FirstConstant, &NumConstants);
+    else if (Stage == EShaderStage::Geometry)
+        DXDeviceContext1->GSSetConstantBuffers1(Slot, 1, &Buffer, &FirstConstant, &NumConstants);
 }
 
 void FDXDBufferManager::BindConstantBuffers(const TArray<FString>& Keys, UINT StartSlot, EShaderStage Stage) const
@@ -75,6 +170,42 @@ void FDXDBufferManager::BindConstantBuffers(const TArray<FString>& Keys, UINT St
     }
 }   
 
+void FDXDBufferManager::BindConstantBuffers(std::initializer_list<FConstantBufferHandle> Handles, UINT StartSlot, EShaderStage Stage) const
+{
+    ID3D11Buffer* Buffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT] = {};
+    UINT Count = 0;
+    for (const FConstantBufferHandle& Handle : Handles)
+    {
+        if (Count == D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT)
+        {
+            break;
+        }
+        Buffers[Count++] = Handle.Buffer;
+    }
+
+    if (Stage == EShaderStage::Vertex)
+        DXDeviceContext->VSSetConstantBuffers(StartSlot, Count, Buffers);
+    else if (Stage == EShaderStage::Pixel)
+        DXDeviceContext->PSSetConstantBuffers(StartSlot, Count, Buffers);
+    else if (Stage == EShaderStage::Compute)
+        DXDeviceContext->CSSetConstantBuffers(StartSlot, Count, Buffers);
+    else if (Stage == EShaderStage::Geometry)
+        DXDeviceContext->GSSetConstantBuffers(StartSlot, Count, Buffers);
+}
+
+void FDXDBufferManager::BindConstantBuffer(const FConstantBufferHandle& Handle, UINT StartSlot, EShaderStage Stage) const
+{
+    ID3D11Buffer* Buffer = Handle.Buffer;
+    if (Stage == EShaderStage::Vertex)
+        DXDeviceContext->VSSetConstantBuffers(StartSlot, 1, &Buffer);
+    else if (Stage == EShaderStage::Pixel)
+        DXDeviceContext->PSSetConstantBuffers(StartSlot, 1, &Buffer);
+    else if (Stage == EShaderStage::Compute)
+        DXDeviceContext->CSSetConstantBuffers(StartSlot, 1, &Buffer);
+    else if (Stage == EShaderStage::Geometry)
+        DXDeviceContext->GSSetConstantBuffers(StartSlot, 1, &Buffer);
+}
+
 void FDXDBufferManager::BindConstantBuffer(const FString& Key, UINT StartSlot, EShaderStage Stage) const
 {
     ID3D11Buffer* Buffer = GetConstantBuffer(Key);
@@ -121,10 +252,7 @@ FIndexInfo FDXDBufferManager::GetTextIndexBuffer(const FWString& InName) const
 
 ID3D11Buffer* FDXDBufferManager::GetConstantBuffer(const FString& InName) const
 {
-    if (ConstantBufferPool.Contains(InName))
-        return ConstantBufferPool[InName];
-
-    return nullptr;
+    return ConstantBufferPool.Find(InName);
 }
 
 void FDXDBufferManager::CreateQuadBuffer()
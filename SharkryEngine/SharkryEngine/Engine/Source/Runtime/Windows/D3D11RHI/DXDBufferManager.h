@@ -1,13 +1,15 @@
 #pragma once
 #define _TCHAR_DEFINED
 #include "Define.h"
-#include <d3d11.h>
+#include <d3d11_1.h>
 #include <d3dcompiler.h>
 #include "Container/String.h"
 #include "Container/Array.h"
 #include "Container/Map.h"
 #include "Engine/Texture.h"
 #include "GraphicDevice.h"
+#include "ConstantBufferRegistry.h"
+#include "LinearUploadAllocator.h"
 #include "UserInterface/Console.h"
 
 // ShaderStage 열거형
@@ -71,12 +73,48 @@ public:
     template<typename T>
     void UpdateConstantBuffer(const FString& key, const TArray<T>& data) const;
 
+    /** 이름으로 한 번 찾아둔 Handle로 갱신합니다. 프레임마다 호출하는 곳은 FString Key 대신 이 함수를 사용합니다. */
+    template<typename T>
+    void UpdateConstantBuffer(const TConstantBufferHandle<T>& Handle, const T& Data) const;
+
+    /** Pass를 초기화할 때 한 번 호출해서 Handle을 구해둡니다. 없거나 T보다 작은 Buffer라면 비어있는 Handle */
+    template<typename T>
+    TConstantBufferHandle<T> GetConstantBufferHandle(const FString& Key) const;
+
     template<typename T>
     void UpdateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices) const;
 
     void BindConstantBuffers(const TArray<FString>& Keys, UINT StartSlot, EShaderStage Stage) const;
     void BindConstantBuffer(const FString& Key, UINT StartSlot, EShaderStage Stage) const;
 
+    /** StartSlot부터 Handle 순서대로 연속된 Slot에 Bind합니다. */
+    void BindConstantBuffers(std::initializer_list<FConstantBufferHandle> Handles, UINT StartSlot, EShaderStage Stage) const;
+    void BindConstantBuffer(const FConstantBufferHandle& Handle, UINT StartSlot, EShaderStage Stage) const;
+
+    /**
+     * Object 상수처럼 Draw마다 바뀌는 값을 하나의 큰 Buffer에 모아 올리는 Upload Buffer
+     *
+     * Pass는 그릴 Object 수만큼 한 번에 MapUpload로 자리를 받아 값을 채우고, Draw마다 BindUploadConstantBuffer로 범위만 바꿉니다.
+     * Draw마다 Constant Buffer를 Discard로 Map하지 않으므로 Map 횟수가 Pass당 한 번으로 줄어듭니다.
+     * D3D11.1의 Constant Buffer Offset이나 Dynamic Constant Buffer No Overwrite Map을 지원하지 않으면 사용할 수 없습니다.
+     */
+    bool IsUploadBufferSupported() const { return UploadBuffer != nullptr; }
+
+    /** 프레임을 시작할 때 호출해서 이전 프레임의 Upload 할당을 버립니다. */
+    void BeginUploadFrame();
+
+    /**
+     * ElementSize byte 원소 NumElements개의 자리를 받고 Map합니다. 원소 Index는 반환값 + Index * OutAllocation.Stride에 씁니다.
+     * @return 지원하지 않거나 Capacity보다 크거나 Map에 실패하면 nullptr, 성공했다면 UnmapUpload를 호출해야 합니다.
+     */
+    uint8* MapUpload(uint32 ElementSize, uint32 NumElements, FUploadAllocation& OutAllocation);
+    void UnmapUpload() const;
+
+    /** Allocation의 Index번째 원소를 Slot에 Constant Buffer로 Bind합니다. */
+    void BindUploadConstantBuffer(const FUploadAllocation& Allocation, uint32 Index, UINT Slot, EShaderStage Stage) const;
+
+    const FLinearUploadAllocator& GetUploadAllocator() const { return UploadAllocator; }
+
     template<typename T>
     static void SafeRelease(T*& comObject);
 
@@ -93,13 +131,25 @@ public:
 private:
     // 16바이트 정렬
     inline UINT Align16(UINT size) { return (size + 15) & ~15; }
+
+    void CreateUploadBuffer();
+    void ReleaseUploadBuffer();
 private:
+    /** Upload Buffer 크기, 256 byte 단위로 나누므로 FObjectConstantBuffer가 4096개 들어갑니다. */
+    static constexpr uint32 UploadBufferSize = 1024 * 1024;
+
     ID3D11Device* DXDevice = nullptr;
     ID3D11DeviceContext* DXDeviceContext = nullptr;
 
+    /** *SetConstantBuffers1을 호출하기 위한 D3D11.1 Context, 지원하지 않으면 nullptr */
+    ID3D11DeviceContext1* DXDeviceContext1 = nullptr;
+
     TMap<FString, FVertexInfo> VertexBufferPool;
     TMap<FString, FIndexInfo> IndexBufferPool;
-    TMap<FString, ID3D11Buffer*> ConstantBufferPool;
+    FConstantBufferRegistry ConstantBufferPool;
+
+    ID3D11Buffer* UploadBuffer = nullptr;
+    FLinearUploadAllocator UploadAllocator;
 
     TMap<FWString, FBufferInfo> TextAtlasBufferPool;
     TMap<FWString, FVertexInfo> TextAtlasVertexBufferPool;
@@ -281,7 +331,7 @@ HRESULT FDXDBufferManager::CreateBufferGeneric(const FString& KeyName, T* data,
         return hr;
     }
 
-    ConstantBufferPool.Add(KeyName, buffer);
+    ConstantBufferPool.Add(KeyName, buffer, byteWidth);
     return S_OK;
 }
 
@@ -329,6 +379,31 @@ void FDXDBufferManager::UpdateConstantBuffer(const FString& key, const TArray<T>
     DXDeviceContext->Unmap(buffer, 0);
 }
 
+template<typename T>
+void FDXDBufferManager::UpdateConstantBuffer(const TConstantBufferHandle<T>& Handle, const T& Data) const
+{
+    if (!Handle.IsValid())
+    {
+        return;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE MappedResource;
+    HRESULT hr = DXDeviceContext->Map(Handle.Buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &MappedResource);
+    if (FAILED(hr))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Buffer Map 실패, HRESULT: 0x%X"), hr);
+        return;
+    }
+    memcpy(MappedResource.pData, &Data, sizeof(T));
+    DXDeviceContext->Unmap(Handle.Buffer, 0);
+}
+
+template<typename T>
+TConstantBufferHandle<T> FDXDBufferManager::GetConstantBufferHandle(const FString& Key) const
+{
+    return ConstantBufferPool.FindHandle<T>(Key);
+}
+
 template<typename T>
 void FDXDBufferManager::UpdateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices) const
 {
@@ -0,0 +1,47 @@
+#include "LinearUploadAllocator.h"
+
+void FLinearUploadAllocator::Initialize(uint32 InCapacity, uint32 InAlignment)
+{
+    Alignment = InAlignment;
+    Capacity = InCapacity - InCapacity % InAlignment;
+    Offset = 0;
+    NumWraps = 0;
+    bNeedsDiscard = true;
+}
+
+void FLinearUploadAllocator::BeginFrame()
+{
+    Offset = 0;
+    bNeedsDiscard = true;
+}
+
+bool FLinearUploadAllocator::Allocate(uint32 ElementSize, uint32 NumElements, FUploadAllocation& OutAllocation, bool& bOutDiscard)
+{
+    if (ElementSize == 0 || NumElements == 0)
+    {
+        return false;
+    }
+
+    const uint32 Stride = (ElementSize + Alignment - 1) / Alignment * Alignment;
+    const uint64 Size = static_cast<uint64>(Stride) * NumElements;
+    if (Size > Capacity)
+    {
+        return false;
+    }
+
+    if (Offset + Size > Capacity)
+    {
+        Offset = 0;
+        bNeedsDiscard = true;
+        ++NumWraps;
+    }
+
+    OutAllocation.Offset = Offset;
+    OutAllocation.Stride = Stride;
+    OutAllocation.NumElements = NumElements;
+
+    bOutDiscard = bNeedsDiscard;
+    bNeedsDiscard = false;
+    Offset += static_cast<uint32>(Size);
+    return true;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+/** FLinearUploadAllocator에서 한 번에 받은 연속 구간, 원소 하나마다 Stride byte를 차지합니다. */
+struct FUploadAllocation
+{
+    /** Upload Buffer 처음부터의 byte 위치 */
+    uint32 Offset = 0;
+
+    /** 원소 하나의 byte 크기, Alignment의 배수 */
+    uint32 Stride = 0;
+
+    uint32 NumElements = 0;
+
+    bool IsValid() const { return NumElements > 0; }
+
+    uint32 GetElementOffset(uint32 Index) const { return Offset + Index * Stride; }
+
+    /** *SetConstantBuffers1에 넘기는 시작 위치, 16 byte 상수 단위 */
+    uint32 GetFirstConstant(uint32 Index) const { return GetElementOffset(Index) / 16; }
+
+    /** *SetConstantBuffers1에 넘기는 길이, 16 byte 상수 단위 */
+    uint32 GetNumConstants() const { return Stride / 16; }
+};
+
+/**
+ * 하나의 큰 Dynamic Buffer를 앞에서부터 잘라 쓰는 할당기, D3D에 의존하지 않고 위치만 계산합니다.
+ *
+ * 프레임 시작이나 공간이 부족할 때 처음으로 돌아가며, 그 다음 Map은 Discard로 해야 합니다.
+ * Discard로 Map하면 Driver가 새 메모리를 주므로, 이전 내용을 읽는 Draw가 남아있어도 안전합니다.
+ * 그 외에는 GPU가 읽고 있을 수 있는 구간을 다시 쓰지 않으므로 No Overwrite로 Map합니다.
+ * 처음으로 돌아간 뒤에는 이전에 받은 구간을 새 Draw에 Bind할 수 없으므로, 받은 구간은 다음 Allocate 전에 모두 그립니다.
+ */
+class FLinearUploadAllocator
+{
+public:
+    /** D3D11.1에서 Constant Buffer 범위는 256 byte(상수 16개) 단위로 시작하고 길이도 그 배수여야 합니다. */
+    static constexpr uint32 ConstantBufferAlignment = 256;
+
+    FLinearUploadAllocator() = default;
+
+    void Initialize(uint32 InCapacity, uint32 InAlignment = ConstantBufferAlignment);
+
+    /** 이전 프레임의 할당을 모두 버리고, 다음 Allocate가 처음부터 채우도록 합니다. */
+    void BeginFrame();
+
+    /**
+     * ElementSize byte 원소 NumElements개를 연속으로 잡습니다.
+     * @param bOutDiscard 처음으로 돌아갔다면 true, 이번 Map은 Discard로 해야 합니다.
+     * @return Capacity보다 크거나 원소가 없다면 false
+     */
+    bool Allocate(uint32 ElementSize, uint32 NumElements, FUploadAllocation& OutAllocation, bool& bOutDiscard);
+
+    uint32 GetCapacity() const { return Capacity; }
+    uint32 GetAlignment() const { return Alignment; }
+
+    /** 마지막으로 처음으로 돌아간 뒤 사용한 byte 수 */
+    uint32 GetUsedSize() const { return Offset; }
+
+    /** Initialize 이후 공간이 부족해서 처음으로 돌아간 횟수, 자주 늘어난다면 Capacity를 키워야 합니다. */
+    uint32 GetNumWraps() const { return NumWraps; }
+
+private:
+    uint32 Capacity = 0;
+    uint32 Alignment = ConstantBufferAlignment;
+    uint32 Offset = 0;
+    uint32 NumWraps = 0;
+    bool bNeedsDiscard = true;
+};
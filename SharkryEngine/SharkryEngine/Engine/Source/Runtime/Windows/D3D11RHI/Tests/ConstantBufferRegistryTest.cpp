@@ -0,0 +1,181 @@
+#include "Misc/AutomationTest.h"
+#include "WindowsPlatformTime.h"
+#include "D3D11RHI/ConstantBufferRegistry.h"
+#include "D3D11RHI/LinearUploadAllocator.h"
+
+namespace
+{
+    /** FObjectConstantBuffer와 같은 160 byte 구조체 */
+    struct FTestObjectConstants
+    {
+        float WorldMatrix[16];
+        float InverseTransposedWorld[16];
+        float UUIDColor[4];
+        int32 bIsSelected;
+        float Padding[3];
+    };
+    static_assert(sizeof(FTestObjectConstants) == 160);
+
+    struct FTestSmallConstants
+    {
+        float Value[4];
+    };
+
+    /** Registry는 Buffer를 역참조하지 않으므로, 구별만 되는 가짜 주소를 씁니다. */
+    ID3D11Buffer* MakeFakeBuffer(uintptr_t Address)
+    {
+        return reinterpret_cast<ID3D11Buffer*>(Address);
+    }
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FConstantBufferRegistryTest, "Windows.D3D11RHI.ConstantBufferRegistry.Handles", EAutomationTestType::Unit)
+{
+    ID3D11Buffer* ObjectBuffer = MakeFakeBuffer(0x1000);
+    ID3D11Buffer* SmallBuffer = MakeFakeBuffer(0x2000);
+
+    FConstantBufferRegistry Registry;
+    TestTrue("Add a new key", Registry.Add(TEXT("FObjectConstantBuffer"), ObjectBuffer, sizeof(FTestObjectConstants)));
+    TestFalse("Add an existing key", Registry.Add(TEXT("FObjectConstantBuffer"), SmallBuffer, sizeof(FTestObjectConstants)));
+    TestTrue("Add a second key", Registry.Add(TEXT("FSmallConstants"), SmallBuffer, sizeof(FTestSmallConstants)));
+    TestEqual("Registered buffers", Registry.Num(), 2);
+
+    TestTrue("Find keeps the first buffer for a key", Registry.Find(TEXT("FObjectConstantBuffer")) == ObjectBuffer);
+    TestNull("Find with a missing key", Registry.Find(TEXT("Missing")));
+    TestTrue("Contains", Registry.Contains(TEXT("FSmallConstants")));
+
+    const TConstantBufferHandle<FTestObjectConstants> ObjectHandle = Registry.FindHandle<FTestObjectConstants>(TEXT("FObjectConstantBuffer"));
+    TestTrue("Handle to a buffer of the same size", ObjectHandle.IsValid() && ObjectHandle.Buffer == ObjectBuffer);
+
+    const TConstantBufferHandle<FTestSmallConstants> SmallHandle = Registry.FindHandle<FTestSmallConstants>(TEXT("FSmallConstants"));
+    TestTrue("Handle to a buffer of the same size", SmallHandle.IsValid() && SmallHandle.Buffer == SmallBuffer);
+
+    // 작은 구조체로 큰 Buffer를 갱신하는 것은 괜찮지만, 큰 구조체는 작은 Buffer에 들어가지 않습니다.
+    TestTrue("Handle for a smaller struct", Registry.FindHandle<FTestSmallConstants>(TEXT("FObjectConstantBuffer")).IsValid());
+    TestFalse("Handle for a struct larger than the buffer", Registry.FindHandle<FTestObjectConstants>(TEXT("FSmallConstants")).IsValid());
+    TestFalse("Handle with a missing key", Registry.FindHandle<FTestObjectConstants>(TEXT("Missing")).IsValid());
+
+    int32 NumVisited = 0;
+    Registry.ForEachBuffer([&NumVisited](ID3D11Buffer* Buffer)
+    {
+        NumVisited += Buffer ? 1 : 0;
+    });
+    TestEqual("Buffers visited by ForEachBuffer", NumVisited, 2);
+
+    Registry.Empty();
+    TestEqual("Registered buffers after Empty", Registry.Num(), 0);
+    TestFalse("Handle after Empty", Registry.FindHandle<FTestSmallConstants>(TEXT("FSmallConstants")).IsValid());
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FLinearUploadAllocatorTest, "Windows.D3D11RHI.LinearUploadAllocator.Allocate", EAutomationTestType::Unit)
+{
+    constexpr uint32 Capacity = 1024 * 1024;
+    constexpr uint32 Alignment = FLinearUploadAllocator::ConstantBufferAlignment;
+    constexpr uint32 NumElementsPerBuffer = Capacity / Alignment;
+
+    FLinearUploadAllocator Allocator;
+    Allocator.Initialize(Capacity);
+
+    // 프레임의 첫 할당은 Discard로 Map하고, 원소마다 Alignment 단위로 자리를 잡습니다.
+    FUploadAllocation Allocation;
+    bool bDiscard = false;
+    TestTrue("First allocation", Allocator.Allocate(sizeof(FTestObjectConstants), 10, Allocation, bDiscard));
+    TestTrue("First allocation of a frame discards", bDiscard);
+    TestEqual("First allocation offset", static_cast<int32>(Allocation.Offset), 0);
+    TestEqual("Stride is rounded up to the alignment", static_cast<int32>(Allocation.Stride), static_cast<int32>(Alignment));
+    TestEqual("Allocated elements", static_cast<int32>(Allocation.NumElements), 10);
+    TestEqual("First constant of element 3", static_cast<int32>(Allocation.GetFirstConstant(3)), 3 * 16);
+    TestEqual("Constants per element", static_cast<int32>(Allocation.GetNumConstants()), 16);
+
+    // 같은 프레임의 다음 할당은 이어서 잡고 No Overwrite로 Map합니다.
+    FUploadAllocation Next;
+    TestTrue("Second allocation", Allocator.Allocate(sizeof(FTestObjectConstants), 5, Next, bDiscard));
+    TestFalse("Second allocation does not discard", bDiscard);
+    TestEqual("Second allocation follows the first", static_cast<int32>(Next.Offset), static_cast<int32>(10 * Alignment));
+
+    TestFalse("Zero elements", Allocator.Allocate(sizeof(FTestObjectConstants), 0, Next, bDiscard));
+    TestFalse("More than the capacity", Allocator.Allocate(sizeof(FTestObjectConstants), NumElementsPerBuffer + 1, Next, bDiscard));
+
+    // Buffer를 끝까지 채운 뒤의 할당은 처음으로 돌아가고 Discard로 Map합니다.
+    TestTrue("Fill the rest of the buffer", Allocator.Allocate(sizeof(FTestObjectConstants), NumElementsPerBuffer - 15, Next, bDiscard));
+    TestFalse("Filling the rest does not discard", bDiscard);
+    TestEqual("Fill offset", static_cast<int32>(Next.Offset), static_cast<int32>(15 * Alignment));
+    TestEqual("Used size after filling", static_cast<int32>(Allocator.GetUsedSize()), static_cast<int32>(Capacity));
+
+    TestTrue("Allocation after the buffer is full", Allocator.Allocate(sizeof(FTestSmallConstants), 1, Next, bDiscard));
+    TestTrue("Wrapping discards", bDiscard);
+    TestEqual("Wrapped allocation offset", static_cast<int32>(Next.Offset), 0);
+    TestEqual("Wraps", static_cast<int32>(Allocator.GetNumWraps()), 1);
+
+    // 프레임을 시작하면 처음부터 Discard로 다시 채우고, 이것은 Wrap으로 세지 않습니다.
+    Allocator.BeginFrame();
+    TestTrue("First allocation of the next frame", Allocator.Allocate(sizeof(FTestSmallConstants), 1, Next, bDiscard));
+    TestTrue("First allocation of the next frame discards", bDiscard);
+    TestEqual("First allocation offset of the next frame", static_cast<int32>(Next.Offset), 0);
+    TestEqual("Wraps after BeginFrame", static_cast<int32>(Allocator.GetNumWraps()), 1);
+
+    TestTrue("Element larger than the alignment", Allocator.Allocate(300, 2, Next, bDiscard));
+    TestFalse("Element larger than the alignment does not discard", bDiscard);
+    TestEqual("Offset after a small element", static_cast<int32>(Next.Offset), static_cast<int32>(Alignment));
+    TestEqual("Stride of a 300 byte element", static_cast<int32>(Next.Stride), static_cast<int32>(2 * Alignment));
+
+    // Capacity는 Alignment 단위로 내림합니다.
+    FLinearUploadAllocator Unaligned;
+    Unaligned.Initialize(1000);
+    TestEqual("Capacity rounded down to the alignment", static_cast<int32>(Unaligned.GetCapacity()), static_cast<int32>(3 * Alignment));
+    return true;
+}
+
+
+IMPLEMENT_AUTOMATION_TEST(FConstantBufferRegistryBenchmark, "Windows.D3D11RHI.ConstantBufferRegistry.LookupSpeed", EAutomationTestType::Benchmark)
+{
+    constexpr int32 NumIterations = 1000000;
+
+    // Renderer가 등록하는 것과 비슷한 수의 Buffer를 등록합니다.
+    const TCHAR* Keys[] =
+    {
+        TEXT("FObjectConstantBuffer"), TEXT("FCascadeConstantBuffer"), TEXT("FPointLightGSBuffer"), TEXT("FIsShadowConstants"),
+        TEXT("FShadowConstantBuffer"), TEXT("FCameraConstantBuffer"), TEXT("FSubUVConstant"), TEXT("FMaterialConstants"),
+        TEXT("FSubMeshConstants"), TEXT("FTextureConstants"), TEXT("FLitUnlitConstants"), TEXT("FViewModeConstants"),
+        TEXT("FScreenConstants"), TEXT("FFogConstants"), TEXT("FLightInfoBuffer"), TEXT("FFadeConstants"),
+    };
+
+    FConstantBufferRegistry Registry;
+    uintptr_t Address = 0x1000;
+    for (const TCHAR* Key : Keys)
+    {
+        Registry.Add(Key, MakeFakeBuffer(Address), sizeof(FTestObjectConstants));
+        Address += 0x1000;
+    }
+
+    // Draw마다 Object, SubMesh, Material Buffer를 찾던 이전 방식과, Pass 초기화 때 구한 Handle을 비교합니다.
+    uintptr_t Checksum = 0;
+    uint64 StartCycles = FPlatformTime::Cycles64();
+    for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+    {
+        Checksum += reinterpret_cast<uintptr_t>(Registry.Find(TEXT("FObjectConstantBuffer")));
+        Checksum += reinterpret_cast<uintptr_t>(Registry.Find(TEXT("FSubMeshConstants")));
+        Checksum += reinterpret_cast<uintptr_t>(Registry.Find(TEXT("FMaterialConstants")));
+    }
+    const double KeyNs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) * 1.e6 / NumIterations;
+
+    const TConstantBufferHandle<FTestObjectConstants> ObjectHandle = Registry.FindHandle<FTestObjectConstants>(TEXT("FObjectConstantBuffer"));
+    const TConstantBufferHandle<FTestSmallConstants> SubMeshHandle = Registry.FindHandle<FTestSmallConstants>(TEXT("FSubMeshConstants"));
+    const TConstantBufferHandle<FTestSmallConstants> MaterialHandle = Registry.FindHandle<FTestSmallConstants>(TEXT("FMaterialConstants"));
+    volatile const FConstantBufferHandle* Handles[] = { &ObjectHandle, &SubMeshHandle, &MaterialHandle };
+    StartCycles = FPlatformTime::Cycles64();
+    for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+    {
+        for (volatile const FConstantBufferHandle* Handle : Handles)
+        {
+            Checksum += reinterpret_cast<uintptr_t>(Handle->Buffer);
+        }
+    }
+    const double HandleNs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) * 1.e6 / NumIterations;
+
+    AddInfo(FString::Printf(TEXT("3 buffers per draw, key lookup: %.2f ns"), KeyNs));
+    AddInfo(FString::Printf(TEXT("3 buffers per draw, handle:     %.2f ns (checksum %llu)"), HandleNs, static_cast<uint64>(Checksum)));
+    return true;
+}
@@ -7,6 +7,7 @@ ReturnTable.LifeTimer = 0.0 -- 수명 타이머 추가
 -- BeginPlay: Actor가 처음 활성화될 때 호출
 function ReturnTable:BeginPlay()
     --print("BeginPlay ", self.Name)
+    self.this.Health = 100
     self.this.Speed = 20
     self.this.AttackDamage = 25
     self.LifeTimer = 0.0
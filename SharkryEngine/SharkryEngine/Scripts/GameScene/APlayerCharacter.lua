@@ -8,6 +8,9 @@ function ReturnTable:BeginPlay()
 
     print("BeginPlay ", self.Name)
     self.this.CharacterMeshCount = 1
+
+    -- 총알은 Destroy 대신 Pool로 반환해서 재사용
+    self.this:EnableActorPoolLua("ABullet", 32)
     self.SpawnTimer = 0.0
 end
 
@@ -17,6 +17,10 @@ ReturnTable.WallSpawnProbability = 0.5
 function ReturnTable:BeginPlay()
     print("BeginPlay SpawnerActor")
 
+    -- 적과 벽은 Destroy 대신 Pool로 반환해서 재사용
+    self.this:EnableActorPoolLua("AEnemyCharacter", self.MaxSpawnCount * 2)
+    self.this:EnableActorPoolLua("AWall", 2)
+
     self.SpawnTimer = 0.0
 end
 
@@ -15,12 +15,34 @@ cbuffer MaterialConstants : register(b1)
 #endif
 
 
+#ifdef STATIC_MESH_INSTANCING
+// FStaticMeshInstanceData와 같은 배치, Instance Buffer(Slot 1)에서 Instance마다 읽습니다.
+struct VS_INPUT_StaticMeshInstance
+{
+    float4 World0 : INSTANCE_WORLD0;
+    float4 World1 : INSTANCE_WORLD1;
+    float4 World2 : INSTANCE_WORLD2;
+    float4 World3 : INSTANCE_WORLD3;
+    float4 InverseTransposedWorld0 : INSTANCE_NORMAL0;
+    float4 InverseTransposedWorld1 : INSTANCE_NORMAL1;
+    float4 InverseTransposedWorld2 : INSTANCE_NORMAL2;
+};
+
+PS_INPUT_StaticMesh mainVS(VS_INPUT_StaticMesh Input, VS_INPUT_StaticMeshInstance Instance)
+{
+    const float4x4 World = float4x4(Instance.World0, Instance.World1, Instance.World2, Instance.World3);
+    const float3x3 NormalMatrix = float3x3(Instance.InverseTransposedWorld0.xyz, Instance.InverseTransposedWorld1.xyz, Instance.InverseTransposedWorld2.xyz);
+#else
 PS_INPUT_StaticMesh mainVS(VS_INPUT_StaticMesh Input)
 {
+    const float4x4 World = WorldMatrix;
+    const float3x3 NormalMatrix = (float3x3)InverseTransposedWorld;
+#endif
+
     PS_INPUT_StaticMesh Output;
 
     Output.Position = float4(Input.Position, 1.0);
-    Output.Position = mul(Output.Position, WorldMatrix);
+    Output.Position = mul(Output.Position, World);
     Output.WorldPosition = Output.Position.xyz;
     
     Output.Position = mul(Output.Position, ViewMatrix);
@@ -28,7 +50,7 @@ PS_INPUT_StaticMesh mainVS(VS_INPUT_StaticMesh Input)
 
     Output.WorldViewPosition = float3(InvViewMatrix._41, InvViewMatrix._42, InvViewMatrix._43);
     
-    Output.WorldNormal = mul(Input.Normal, (float3x3)InverseTransposedWorld);
+    Output.WorldNormal = mul(Input.Normal, NormalMatrix);
 
     float3 BiTangent = cross(Input.Normal, Input.Tangent);
     matrix<float, 3, 3> TBN = {